@@ -0,0 +1,965 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace mvlt
+{
+    template <class KeyType, class ValueType>
+    class BPlusTree;
+
+    /**
+        \brief Node of the BPlusTree
+
+        Leaf nodes store pairs of key and value sorted by key and are linked with neighbour leaves.
+        Inner nodes store children and separators. All items of the child with index i are not less than
+        separator i - 1 and less than separator i.
+
+        \tparam <KeyType> - The type of key for the tree
+        \tparam <ValueType> - The type of value for the tree
+    */
+    template <class KeyType, class ValueType>
+    struct BPlusTreeNode
+    {
+        /// Is this node leaf
+        bool IsLeaf = true;
+
+        /// Parent node. It is nullptr for root
+        BPlusTreeNode* Parent = nullptr;
+
+        /// Sorted items for leaf, separators for inner node
+        std::vector<std::pair<KeyType, ValueType>> Items;
+
+        /// Children of inner node
+        std::vector<BPlusTreeNode*> Children;
+
+        /// Number of items in all leaves of this node
+        std::size_t Count = 0;
+
+        /// Previous leaf
+        BPlusTreeNode* Prev = nullptr;
+
+        /// Next leaf
+        BPlusTreeNode* Next = nullptr;
+    };
+
+    /**
+        \brief Iterator class for BPlusTree
+
+        Iterator points to the item inside the leaf. Any insertion or erasing invalidates all iterators.
+
+        \tparam <KeyType> - The type of key for the tree
+        \tparam <ValueType> - The type of value for the tree
+        \tparam <IsReverse> - Is iterator moves from the last item to the first one
+    */
+    template <class KeyType, class ValueType, bool IsReverse>
+    class BPlusTreeIterator
+    {
+    private:
+        // Tree to which the iterator belongs. It is required to move from the end iterator
+        const BPlusTree<KeyType, ValueType>* Tree = nullptr;
+
+        // Leaf with item. It is nullptr for the end iterator
+        BPlusTreeNode<KeyType, ValueType>* Leaf = nullptr;
+
+        // Item index inside the leaf
+        std::size_t Index = 0;
+
+        // A method for moving to the next item in ascending order
+        void StepForward() noexcept
+        {
+            if (Leaf == nullptr)
+            {
+                Leaf = Tree->FirstLeaf->Items.empty() ? nullptr : Tree->FirstLeaf;
+                Index = 0;
+                return;
+            }
+
+            if (++Index == Leaf->Items.size())
+            {
+                Leaf = Leaf->Next;
+                Index = 0;
+            }
+        }
+
+        // A method for moving to the previous item in ascending order
+        void StepBackward() noexcept
+        {
+            if (Leaf == nullptr)
+            {
+                Leaf = Tree->LastLeaf->Items.empty() ? nullptr : Tree->LastLeaf;
+                Index = Leaf == nullptr ? 0 : Leaf->Items.size() - 1;
+                return;
+            }
+
+            if (Index == 0)
+            {
+                Leaf = Leaf->Prev;
+                Index = Leaf == nullptr ? 0 : Leaf->Items.size() - 1;
+            }
+            else --Index;
+        }
+
+    public:
+        /// Making the BPlusTree class friendly so that it has access to the internal members of the BPlusTreeIterator class
+        friend BPlusTree<KeyType, ValueType>;
+
+        /// \brief Default constructor
+        BPlusTreeIterator() noexcept = default;
+
+        /**
+            \brief Constructor
+
+            \param [in] tree tree to which the iterator belongs
+            \param [in] leaf leaf with item or nullptr for the end iterator
+            \param [in] index item index inside the leaf
+        */
+        BPlusTreeIterator(const BPlusTree<KeyType, ValueType>* tree, BPlusTreeNode<KeyType, ValueType>* leaf, const std::size_t& index) noexcept :
+            Tree(tree), Leaf(leaf), Index(index) {}
+
+        /**
+            \brief Not equal operator
+
+            \param [in] other object to compare
+
+            \return true it other and this not equal
+        */
+        bool operator!=(const BPlusTreeIterator& other) const noexcept
+        {
+            return Leaf != other.Leaf || Index != other.Index;
+        }
+
+        /**
+            \brief Compare operator
+
+            \param [in] other object to compare
+
+            \return true it other and this equal
+        */
+        bool operator==(const BPlusTreeIterator& other) const noexcept
+        {
+            return Leaf == other.Leaf && Index == other.Index;
+        }
+
+        /**
+            \brief Pre increment operator
+
+            \return incremented iterator
+        */
+        BPlusTreeIterator& operator++() noexcept
+        {
+            if (IsReverse) StepBackward();
+            else StepForward();
+            return *this;
+        }
+
+        /**
+            \brief Pre decrement operator
+
+            \return decremented iterator
+        */
+        BPlusTreeIterator& operator--() noexcept
+        {
+            if (IsReverse) StepForward();
+            else StepBackward();
+            return *this;
+        }
+
+        /**
+            \brief Operator*
+
+            \return pair with iterator key and value
+        */
+        const std::pair<KeyType, ValueType>& operator*() const noexcept
+        {
+            return Leaf->Items[Index];
+        }
+
+        /**
+            \brief Operator->
+
+            \return pointer to pair with iterator key and value
+        */
+        const std::pair<KeyType, ValueType>* operator->() const noexcept
+        {
+            return &Leaf->Items[Index];
+        }
+
+        /// \brief Default destructor
+        ~BPlusTreeIterator() = default;
+    };
+
+    /**
+        \brief B+tree with wide nodes and linked leaves
+
+        Items are stored in leaves one after another, so iterating over a range reads memory sequentially
+        and jumps to another node only once per NodeCapacity items.
+
+        In multi tree items with the same key are ordered by value, so each pair of key and value
+        is found and erased in O(log n) regardless of the number of items with the same key.
+
+        On erasing, empty leaves are removed and a small leaf is merged with its neighbour if they fit into one node.
+
+        Every node knows the number of items in its leaves, so the number of items between two iterators is found in O(log n).
+
+        \tparam <KeyType> - The type of key for the tree. It must support operator<
+        \tparam <ValueType> - The type of value for the tree. In multi tree it must support std::less
+    */
+    template <class KeyType, class ValueType>
+    class BPlusTree
+    {
+    public:
+        /// Iterator from the first item to the last one
+        using Iterator = BPlusTreeIterator<KeyType, ValueType, false>;
+
+        /// Iterator from the last item to the first one
+        using ReverseIterator = BPlusTreeIterator<KeyType, ValueType, true>;
+
+        /// Making the iterators friendly so that they have access to the leaves of the BPlusTree class
+        friend Iterator;
+
+        /// Making the iterators friendly so that they have access to the leaves of the BPlusTree class
+        friend ReverseIterator;
+
+    private:
+        using Node = BPlusTreeNode<KeyType, ValueType>;
+        using Item = std::pair<KeyType, ValueType>;
+
+        // Maximum number of items in leaf and children in inner node
+        static constexpr std::size_t NodeCapacity = 64;
+
+        // A leaf smaller than this is merged with neighbour on erasing
+        static constexpr std::size_t MergeThreshold = NodeCapacity / 4;
+
+        // Is this multi tree
+        bool IsMultiMap = false;
+
+        // Root node
+        Node* Root = nullptr;
+
+        // Leaf with the smallest items
+        Node* FirstLeaf = nullptr;
+
+        // Leaf with the biggest items
+        Node* LastLeaf = nullptr;
+
+        // Number of items
+        std::size_t ItemsCount = 0;
+
+        // A method for comparing items. Items with the same key are ordered by value only in multi tree
+        bool IsLess(const Item& first, const Item& second) const noexcept
+        {
+            if (first.first < second.first) return true;
+            if (second.first < first.first) return false;
+            return IsMultiMap && std::less<ValueType>()(first.second, second.second);
+        }
+
+        // A method for creating empty leaf
+        Node* CreateLeaf() noexcept
+        {
+            Node* leaf = new Node;
+            leaf->Items.reserve(NodeCapacity + 1);
+            return leaf;
+        }
+
+        // A method for deleting node with all its children
+        void DeleteNode(Node* node) noexcept
+        {
+            for (Node* child : node->Children)
+                DeleteNode(child);
+            delete node;
+        }
+
+        // A method for creating iterator. If index is out of the leaf, then iterator points to the next leaf
+        Iterator MakeIterator(Node* leaf, const std::size_t& index) const noexcept
+        {
+            if (leaf != nullptr && index == leaf->Items.size()) return Iterator(this, leaf->Next, 0);
+            return Iterator(this, leaf, index);
+        }
+
+        // A method for finding the leaf where the first item with the key not less (or greater if isUpper) than key is located
+        Node* FindLeafByKey(const KeyType& key, const bool& isUpper) const noexcept
+        {
+            Node* node = Root;
+            while (!node->IsLeaf)
+            {
+                std::size_t childIndex;
+                if (isUpper)
+                    childIndex = std::upper_bound(node->Items.begin(), node->Items.end(), key,
+                        [](const KeyType& value, const Item& separator) { return value < separator.first; }) - node->Items.begin();
+                else
+                    childIndex = std::lower_bound(node->Items.begin(), node->Items.end(), key,
+                        [](const Item& separator, const KeyType& value) { return separator.first < value; }) - node->Items.begin();
+                node = node->Children[childIndex];
+            }
+
+            return node;
+        }
+
+        // A method for finding the leaf where the item is or should be located
+        Node* FindLeafByItem(const Item& item) const noexcept
+        {
+            Node* node = Root;
+            while (!node->IsLeaf)
+            {
+                std::size_t childIndex = std::upper_bound(node->Items.begin(), node->Items.end(), item,
+                    [this](const Item& first, const Item& second) { return IsLess(first, second); }) - node->Items.begin();
+                node = node->Children[childIndex];
+            }
+
+            return node;
+        }
+
+        // A method for changing the number of items of the node and all its parents by one
+        void ChangeCount(Node* node, const bool& isIncrease) noexcept
+        {
+            for (; node != nullptr; node = node->Parent)
+            {
+                if (isIncrease) ++node->Count;
+                else --node->Count;
+            }
+        }
+
+        // A method for getting the number of items before the iterator
+        std::size_t GetItemIndex(const Iterator& it) const noexcept
+        {
+            if (it.Leaf == nullptr) return ItemsCount;
+
+            std::size_t res = it.Index;
+            for (Node* node = it.Leaf; node->Parent != nullptr; node = node->Parent)
+            {
+                for (Node* child : node->Parent->Children)
+                {
+                    if (child == node) break;
+                    res += child->Count;
+                }
+            }
+
+            return res;
+        }
+
+        // A method for adding right node next to left node inside their parent
+        void InsertToParent(Node* left, const Item& separator, Node* right) noexcept
+        {
+            if (left == Root)
+            {
+                Root = new Node;
+                Root->IsLeaf = false;
+                Root->Items.emplace_back(separator);
+                Root->Children.emplace_back(left);
+                Root->Children.emplace_back(right);
+                Root->Count = left->Count + right->Count;
+                left->Parent = Root;
+                right->Parent = Root;
+                return;
+            }
+
+            Node* parent = left->Parent;
+            std::size_t leftIndex = std::find(parent->Children.begin(), parent->Children.end(), left) - parent->Children.begin();
+
+            parent->Items.emplace(parent->Items.begin() + leftIndex, separator);
+            parent->Children.emplace(parent->Children.begin() + leftIndex + 1, right);
+            right->Parent = parent;
+
+            if (parent->Children.size() > NodeCapacity) SplitInner(parent);
+        }
+
+        // A method for splitting overflowed leaf. Returns the new right leaf
+        Node* SplitLeaf(Node* leaf) noexcept
+        {
+            std::size_t middle = leaf->Items.size() / 2;
+            Node* right = CreateLeaf();
+
+            right->Items.assign(std::make_move_iterator(leaf->Items.begin() + middle), std::make_move_iterator(leaf->Items.end()));
+            leaf->Items.erase(leaf->Items.begin() + middle, leaf->Items.end());
+            leaf->Count = leaf->Items.size();
+            right->Count = right->Items.size();
+
+            right->Prev = leaf;
+            right->Next = leaf->Next;
+            if (leaf->Next != nullptr) leaf->Next->Prev = right;
+            else LastLeaf = right;
+            leaf->Next = right;
+
+            InsertToParent(leaf, right->Items.front(), right);
+            return right;
+        }
+
+        // A method for splitting overflowed inner node
+        void SplitInner(Node* node) noexcept
+        {
+            std::size_t middle = node->Items.size() / 2;
+            Item separator = node->Items[middle];
+
+            Node* right = new Node;
+            right->IsLeaf = false;
+            right->Items.assign(std::make_move_iterator(node->Items.begin() + middle + 1), std::make_move_iterator(node->Items.end()));
+            right->Children.assign(node->Children.begin() + middle + 1, node->Children.end());
+            for (Node* child : right->Children)
+            {
+                child->Parent = right;
+                right->Count += child->Count;
+            }
+            node->Count -= right->Count;
+
+            node->Items.erase(node->Items.begin() + middle, node->Items.end());
+            node->Children.erase(node->Children.begin() + middle + 1, node->Children.end());
+
+            InsertToParent(node, separator, right);
+        }
+
+        // A method for removing child from its parent and deleting it. Parents without children are removed too
+        void RemoveChild(Node* child) noexcept
+        {
+            Node* parent = child->Parent;
+            std::size_t childIndex = std::find(parent->Children.begin(), parent->Children.end(), child) - parent->Children.begin();
+
+            parent->Children.erase(parent->Children.begin() + childIndex);
+            if (!parent->Items.empty())
+                parent->Items.erase(parent->Items.begin() + (childIndex > 0 ? childIndex - 1 : 0));
+            delete child;
+
+            if (parent->Children.empty())
+            {
+                if (parent == Root)
+                {
+                    delete Root;
+                    Root = CreateLeaf();
+                    FirstLeaf = Root;
+                    LastLeaf = Root;
+                }
+                else RemoveChild(parent);
+            }
+        }
+
+        // A method for unlinking leaf from neighbours and removing it from the tree
+        void RemoveLeaf(Node* leaf) noexcept
+        {
+            if (leaf->Prev != nullptr) leaf->Prev->Next = leaf->Next;
+            else FirstLeaf = leaf->Next;
+
+            if (leaf->Next != nullptr) leaf->Next->Prev = leaf->Prev;
+            else LastLeaf = leaf->Prev;
+
+            RemoveChild(leaf);
+
+            // Remove root with the only child
+            while (!Root->IsLeaf && Root->Children.size() == 1)
+            {
+                Node* oldRoot = Root;
+                Root = Root->Children.front();
+                Root->Parent = nullptr;
+                delete oldRoot;
+            }
+        }
+
+        // A method for building the tree from sorted items. The tree must be empty
+        void Build(std::vector<Item>&& items) noexcept
+        {
+            if (items.empty()) return;
+
+            DeleteNode(Root);
+
+            // Leaves are filled by 3/4, so the next insertions do not split them at once
+            std::size_t leafSize = NodeCapacity * 3 / 4;
+            std::size_t nodesCount = (items.size() + leafSize - 1) / leafSize;
+
+            // Nodes of the current level and their smallest items which become separators in the upper level
+            std::vector<Node*> nodes;
+            std::vector<Item> firstItems;
+            nodes.reserve(nodesCount);
+            firstItems.reserve(nodesCount);
+
+            std::size_t begin = 0;
+            for (std::size_t i = 0; i < nodesCount; ++i)
+            {
+                std::size_t end = items.size() * (i + 1) / nodesCount;
+
+                Node* leaf = CreateLeaf();
+                leaf->Items.assign(std::make_move_iterator(items.begin() + begin), std::make_move_iterator(items.begin() + end));
+                leaf->Count = leaf->Items.size();
+
+                if (!nodes.empty())
+                {
+                    leaf->Prev = nodes.back();
+                    nodes.back()->Next = leaf;
+                }
+
+                firstItems.emplace_back(leaf->Items.front());
+                nodes.emplace_back(leaf);
+                begin = end;
+            }
+
+            FirstLeaf = nodes.front();
+            LastLeaf = nodes.back();
+
+            while (nodes.size() > 1)
+            {
+                nodesCount = (nodes.size() + NodeCapacity - 1) / NodeCapacity;
+
+                std::vector<Node*> upperNodes;
+                std::vector<Item> upperFirstItems;
+                upperNodes.reserve(nodesCount);
+                upperFirstItems.reserve(nodesCount);
+
+                begin = 0;
+                for (std::size_t i = 0; i < nodesCount; ++i)
+                {
+                    std::size_t end = nodes.size() * (i + 1) / nodesCount;
+
+                    Node* node = new Node;
+                    node->IsLeaf = false;
+                    for (std::size_t j = begin; j < end; ++j)
+                    {
+                        nodes[j]->Parent = node;
+                        node->Children.emplace_back(nodes[j]);
+                        node->Count += nodes[j]->Count;
+                        if (j != begin) node->Items.emplace_back(std::move(firstItems[j]));
+                    }
+
+                    upperFirstItems.emplace_back(std::move(firstItems[begin]));
+                    upperNodes.emplace_back(node);
+                    begin = end;
+                }
+
+                nodes.swap(upperNodes);
+                firstItems.swap(upperFirstItems);
+            }
+
+            Root = nodes.front();
+            ItemsCount = Root->Count;
+        }
+
+    public:
+        /**
+            \brief Class constructor
+
+            \param [in] isMultiMap is this tree may store several items with the same key
+        */
+        explicit BPlusTree(const bool& isMultiMap) noexcept : IsMultiMap(isMultiMap)
+        {
+            Root = CreateLeaf();
+            FirstLeaf = Root;
+            LastLeaf = Root;
+        }
+
+        /// \brief Deleted copy constructor
+        BPlusTree(const BPlusTree& other) noexcept = delete;
+
+        /// \brief Deleted assignment operator
+        BPlusTree& operator=(const BPlusTree& other) noexcept = delete;
+
+        /**
+            \brief Begin container method
+
+            The need for the container to support foreach loops
+
+            \return Iterator to the first item
+        */
+        Iterator begin() const noexcept
+        {
+            return MakeIterator(FirstLeaf, 0);
+        }
+
+        /**
+            \brief End container method
+
+            The need for the container to support foreach loops
+
+            \return Iterator after the last item
+        */
+        Iterator end() const noexcept
+        {
+            return Iterator(this, nullptr, 0);
+        }
+
+        /**
+            \brief Begin container method
+
+            \return Iterator to the first item
+        */
+        Iterator Begin() const noexcept
+        {
+            return MakeIterator(FirstLeaf, 0);
+        }
+
+        /**
+            \brief End container method
+
+            \return Iterator after the last item
+        */
+        Iterator End() const noexcept
+        {
+            return Iterator(this, nullptr, 0);
+        }
+
+        /**
+            \brief Reverse begin container method
+
+            \return Iterator to the last item
+        */
+        ReverseIterator Rbegin() const noexcept
+        {
+            if (LastLeaf->Items.empty()) return ReverseIterator(this, nullptr, 0);
+            return ReverseIterator(this, LastLeaf, LastLeaf->Items.size() - 1);
+        }
+
+        /**
+            \brief Reverse end container method
+
+            \return Iterator before the first item
+        */
+        ReverseIterator Rend() const noexcept
+        {
+            return ReverseIterator(this, nullptr, 0);
+        }
+
+        /**
+            \brief The method to check if it is multi container
+
+            \return true if it is multicontiner, otherwise return false
+        */
+        bool IsMultiContainer() const noexcept
+        {
+            return IsMultiMap;
+        }
+
+        /**
+            \brief The method for inserting data into the tree
+
+            \tparam <EmplaceKeyType> - Key type
+            \tparam <EmplaceValueType> - Value type
+
+            \param [in] key rvalue to key
+            \param [in] value rvlaue to value
+
+            \return A pair consisting of an iterator to the inserted element
+            (or to the element that prevented the insertion) and a bool value set to true if and only if the insertion took place.
+        */
+        template <class EmplaceKeyType, class EmplaceValueType>
+        std::pair<Iterator, bool> Emplace(EmplaceKeyType&& key, EmplaceValueType&& value) noexcept
+        {
+            Item item(std::forward<EmplaceKeyType>(key), std::forward<EmplaceValueType>(value));
+
+            Node* leaf = FindLeafByItem(item);
+            std::size_t index = std::lower_bound(leaf->Items.begin(), leaf->Items.end(), item,
+                [this](const Item& first, const Item& second) { return IsLess(first, second); }) - leaf->Items.begin();
+
+            // In not multi tree the same key may be only at the found position
+            if (!IsMultiMap)
+            {
+                Iterator it = MakeIterator(leaf, index);
+                if (it != End() && !(item.first < (*it).first)) return std::pair<Iterator, bool>(it, false);
+            }
+
+            leaf->Items.emplace(leaf->Items.begin() + index, std::move(item));
+            ChangeCount(leaf, true);
+            ++ItemsCount;
+
+            if (leaf->Items.size() > NodeCapacity)
+            {
+                Node* right = SplitLeaf(leaf);
+                if (index >= leaf->Items.size()) return std::pair<Iterator, bool>(Iterator(this, right, index - leaf->Items.size()), true);
+            }
+
+            return std::pair<Iterator, bool>(Iterator(this, leaf, index), true);
+        }
+
+        /**
+            \brief The method for inserting many items at once
+
+            Items are sorted first. If the tree has less items than the number of new items, then the tree is rebuilt
+            from all items in O(n), otherwise items are inserted one by one in sorted order, so neighbouring items go to the same leaves.
+            In not multi tree items with keys which are already in the tree or repeated are not inserted.
+
+            \param [in] items items to insert
+
+            \return Number of inserted items
+        */
+        std::size_t EmplaceRange(std::vector<Item>&& items) noexcept
+        {
+            if (items.empty()) return 0;
+
+            auto isLess = [this](const Item& first, const Item& second) { return IsLess(first, second); };
+
+            // Stable sort keeps the first of repeated keys, as inserting one by one does
+            std::stable_sort(items.begin(), items.end(), isLess);
+
+            std::size_t oldItemsCount = ItemsCount;
+            if (ItemsCount >= items.size())
+            {
+                for (Item& item : items)
+                    Emplace(std::move(item.first), std::move(item.second));
+
+                return ItemsCount - oldItemsCount;
+            }
+
+            std::vector<Item> allItems;
+            allItems.reserve(ItemsCount + items.size());
+
+            auto addItem = [&](Item&& item)
+            {
+                if (!IsMultiMap && !allItems.empty() && !(allItems.back().first < item.first)) return;
+                allItems.emplace_back(std::move(item));
+            };
+
+            // Merge items of the tree with new items. Items of the tree go first, so they are kept in not multi tree
+            auto itemsIt = items.begin();
+            for (Node* leaf = FirstLeaf; leaf != nullptr; leaf = leaf->Next)
+            {
+                for (Item& item : leaf->Items)
+                {
+                    for (; itemsIt != items.end() && IsLess(*itemsIt, item); ++itemsIt)
+                        addItem(std::move(*itemsIt));
+
+                    addItem(std::move(item));
+                }
+            }
+
+            for (; itemsIt != items.end(); ++itemsIt)
+                addItem(std::move(*itemsIt));
+
+            Clear();
+            Build(std::move(allItems));
+
+            return ItemsCount - oldItemsCount;
+        }
+
+        /**
+            \brief The method for getting range of data
+
+            \param [in] data key to find
+
+            \return Pair with first and last iterator with key equals to data
+        */
+        std::pair<Iterator, Iterator> EqualRange(const KeyType& data) const noexcept
+        {
+            return std::pair<Iterator, Iterator>(LowerBound(data), UpperBound(data));
+        }
+
+        /**
+            \brief The method for getting iterator with key
+
+            \param [in] data key to find
+
+            \return Iterator with key equals to data
+        */
+        Iterator Find(const KeyType& data) const noexcept
+        {
+            Iterator it = LowerBound(data);
+            if (it != End() && !(data < (*it).first)) return it;
+            return End();
+        }
+
+        /**
+            \brief Returns an iterator pointing to the first element that is not less than (i.e. greater or equal to) data
+
+            \param [in] data lower bound
+
+            \return Iterator pointing to the first element that is not less than key. If no such element is found, a End() is returned.
+        */
+        Iterator LowerBound(const KeyType& data) const noexcept
+        {
+            Node* leaf = FindLeafByKey(data, false);
+            std::size_t index = std::lower_bound(leaf->Items.begin(), leaf->Items.end(), data,
+                [](const Item& item, const KeyType& value) { return item.first < value; }) - leaf->Items.begin();
+            return MakeIterator(leaf, index);
+        }
+
+        /**
+            \brief Returns an iterator pointing to the first element that is greater than key.
+
+            \param [in] data lower bound
+
+            \return Iterator pointing to the first element that is greater than key. If no such element is found, End() iterator is returned.
+        */
+        Iterator UpperBound(const KeyType& data) const noexcept
+        {
+            Node* leaf = FindLeafByKey(data, true);
+            std::size_t index = std::upper_bound(leaf->Items.begin(), leaf->Items.end(), data,
+                [](const KeyType& value, const Item& item) { return value < item.first; }) - leaf->Items.begin();
+            return MakeIterator(leaf, index);
+        }
+
+        /**
+            \brief Returns an iterator pointing to the first item that is greater than the pair of key and value
+
+            In multi tree items with the same key are ordered by value, so the iteration can be continued after the item
+            even if the item itself was erased. In the other tree the value is ignored.
+
+            \param [in] key key of the item
+            \param [in] value value of the item
+
+            \return Iterator pointing to the first item after the pair. If no such item is found, End() iterator is returned.
+        */
+        Iterator UpperBound(const KeyType& key, const ValueType& value) const noexcept
+        {
+            Item item(key, value);
+
+            Node* leaf = FindLeafByItem(item);
+            std::size_t index = std::upper_bound(leaf->Items.begin(), leaf->Items.end(), item,
+                [this](const Item& first, const Item& second) { return IsLess(first, second); }) - leaf->Items.begin();
+            return MakeIterator(leaf, index);
+        }
+
+        /**
+            \brief Returns a reverse iterator pointing to the last item that is less than the pair of key and value
+
+            It is UpperBound for the iteration from the last item to the first one.
+
+            \param [in] key key of the item
+            \param [in] value value of the item
+
+            \return Reverse iterator pointing to the last item before the pair. If no such item is found, Rend() iterator is returned.
+        */
+        ReverseIterator RupperBound(const KeyType& key, const ValueType& value) const noexcept
+        {
+            Item item(key, value);
+
+            Node* leaf = FindLeafByItem(item);
+            std::size_t index = std::lower_bound(leaf->Items.begin(), leaf->Items.end(), item,
+                [this](const Item& first, const Item& second) { return IsLess(first, second); }) - leaf->Items.begin();
+
+            if (index > 0) return ReverseIterator(this, leaf, index - 1);
+            if (leaf->Prev == nullptr) return Rend();
+            return ReverseIterator(this, leaf->Prev, leaf->Prev->Items.size() - 1);
+        }
+
+        /**
+            \brief The method for erase data from tree with iterator
+
+            \param [in] dataIt iterator to erase
+
+            \return Iterator following the last removed element.
+        */
+        Iterator Erase(const Iterator& dataIt) noexcept
+        {
+            Node* leaf = dataIt.Leaf;
+            std::size_t index = dataIt.Index;
+
+            leaf->Items.erase(leaf->Items.begin() + index);
+            ChangeCount(leaf, false);
+            --ItemsCount;
+
+            if (leaf == Root) return MakeIterator(leaf, index);
+
+            if (leaf->Items.empty())
+            {
+                Node* next = leaf->Next;
+                RemoveLeaf(leaf);
+                return Iterator(this, next, 0);
+            }
+
+            if (leaf->Items.size() < MergeThreshold)
+            {
+                Node* next = leaf->Next;
+                Node* prev = leaf->Prev;
+
+                // Merge only leaves of one parent so that separators of parent stay correct
+                if (next != nullptr && next->Parent == leaf->Parent && leaf->Items.size() + next->Items.size() <= NodeCapacity)
+                {
+                    leaf->Items.insert(leaf->Items.end(), std::make_move_iterator(next->Items.begin()), std::make_move_iterator(next->Items.end()));
+                    leaf->Count = leaf->Items.size();
+                    RemoveLeaf(next);
+                }
+                else if (prev != nullptr && prev->Parent == leaf->Parent && leaf->Items.size() + prev->Items.size() <= NodeCapacity)
+                {
+                    index += prev->Items.size();
+                    prev->Items.insert(prev->Items.end(), std::make_move_iterator(leaf->Items.begin()), std::make_move_iterator(leaf->Items.end()));
+                    prev->Count = prev->Items.size();
+                    RemoveLeaf(leaf);
+                    leaf = prev;
+                }
+            }
+
+            return MakeIterator(leaf, index);
+        }
+
+        /**
+            \brief The method for erase data from tree with key
+
+            \param [in] data key to erase
+
+            \return Number of deleted items
+        */
+        std::size_t Erase(const KeyType& data) noexcept
+        {
+            std::size_t res = 0;
+
+            for (Iterator it = LowerBound(data); it != End() && !(data < (*it).first); ++res)
+                it = Erase(it);
+
+            return res;
+        }
+
+        /**
+            \brief The method for erase one item with key and value
+
+            \param [in] key key of item to erase
+            \param [in] value value of item to erase
+
+            \return Returns true if the item was found and erased
+        */
+        bool Erase(const KeyType& key, const ValueType& value) noexcept
+        {
+            Item item(key, value);
+
+            Node* leaf = FindLeafByItem(item);
+            std::size_t index = std::lower_bound(leaf->Items.begin(), leaf->Items.end(), item,
+                [this](const Item& first, const Item& second) { return IsLess(first, second); }) - leaf->Items.begin();
+
+            if (index == leaf->Items.size() || IsLess(item, leaf->Items[index]) || !(leaf->Items[index].second == value)) return false;
+
+            Erase(Iterator(this, leaf, index));
+            return true;
+        }
+
+        /// \brief The method for clear tree
+        void Clear() noexcept
+        {
+            DeleteNode(Root);
+            Root = CreateLeaf();
+            FirstLeaf = Root;
+            LastLeaf = Root;
+            ItemsCount = 0;
+        }
+
+        /**
+            \brief The method for getting the number of items between two iterators
+
+            \param [in] first iterator to the first item
+            \param [in] last iterator after the last item. It must not be before first
+
+            \return Number of items from first to last
+        */
+        std::size_t Distance(const Iterator& first, const Iterator& last) const noexcept
+        {
+            return GetItemIndex(last) - GetItemIndex(first);
+        }
+
+        /**
+            \brief The method for get tree size
+
+            \return Number of items
+        */
+        std::size_t Size() const noexcept
+        {
+            return ItemsCount;
+        }
+
+        /// \brief Destructor
+        ~BPlusTree() noexcept
+        {
+            DeleteNode(Root);
+        }
+    };
+
+    template <class KeyType, class ValueType>
+    constexpr std::size_t BPlusTree<KeyType, ValueType>::NodeCapacity;
+
+    template <class KeyType, class ValueType>
+    constexpr std::size_t BPlusTree<KeyType, ValueType>::MergeThreshold;
+}
@@ -0,0 +1,109 @@
+#include "CompositeIndex.h"
+
+namespace mvlt
+{
+    CompositeIndex::CompositeIndex(const std::vector<std::string>& keys, const std::vector<const DataColumn*>& columns, const VaultIndexPolicy& indexPolicy) noexcept :
+        Keys(keys), Columns(columns), HashMap(true), TreeMap(true), IndexHandles("", &HashMap, &TreeMap, indexPolicy) {}
+
+    const std::vector<std::string>& CompositeIndex::GetKeys() const noexcept
+    {
+        return Keys;
+    }
+
+    VaultIndexPolicy CompositeIndex::GetIndexPolicy() const noexcept
+    {
+        return IndexHandles.GetIndexPolicy();
+    }
+
+    bool CompositeIndex::IsHashIndexed() const noexcept
+    {
+        return IndexHandles.IsHashIndexed();
+    }
+
+    bool CompositeIndex::IsOrderedIndexed() const noexcept
+    {
+        return IndexHandles.IsOrderedIndexed();
+    }
+
+    bool CompositeIndex::IsKeyInIndex(const std::string& key) const noexcept
+    {
+        for (const std::string& indexKey : Keys)
+            if (indexKey == key) return true;
+
+        return false;
+    }
+
+    void CompositeIndex::MakeKey(const VaultRecord* record, CompositeKey& key) const noexcept
+    {
+        CompositeKeyPart part;
+
+        key.Clear();
+        key.Reserve(Columns.size());
+        for (const DataColumn* column : Columns)
+        {
+            column->GetCompositeKeyPart(record->Row, part);
+            key.AddPart(part);
+        }
+    }
+
+    void CompositeIndex::Emplace(VaultRecord* record) noexcept
+    {
+        CompositeKey key;
+        MakeKey(record, key);
+        IndexHandles.Emplace(key, record);
+    }
+
+    void CompositeIndex::Erase(VaultRecord* record) noexcept
+    {
+        CompositeKey key;
+        MakeKey(record, key);
+        IndexHandles.Erase(record, key);
+    }
+
+    void CompositeIndex::Clear() noexcept
+    {
+        IndexHandles.Clear();
+    }
+
+    void CompositeIndex::RequestRecords(const CompositeKey& prefix,
+        const CompositeKeyPart* beginValue, const bool& isBeginIncluded,
+        const CompositeKeyPart* endValue, const bool& isEndIncluded,
+        const std::function<bool(VaultRecord* record)>& func) const noexcept
+    {
+        // All keys are known, so the hash map returns all records at once
+        if (prefix.Size() == Keys.size() && IsHashIndexed())
+        {
+            auto equalRange = HashMap.EqualRange(prefix);
+            for (auto it = equalRange.first; it != equalRange.second; ++it)
+                if (!func((*it).second)) return;
+
+            return;
+        }
+
+        if (!IsOrderedIndexed()) return;
+
+        // Start from the first key with the prefix and the lower bound of the next key
+        CompositeKey firstKey = prefix;
+        if (beginValue != nullptr && prefix.Size() < Keys.size()) firstKey.AddPart(*beginValue);
+
+        for (auto it = TreeMap.LowerBound(firstKey); it != TreeMap.End(); ++it)
+        {
+            const CompositeKey& key = it->first;
+
+            // Keys are sorted, so the first key without the prefix ends the search
+            for (std::size_t i = 0; i < prefix.Size(); ++i)
+                if (!(key[i] == prefix[i])) return;
+
+            if (prefix.Size() < Keys.size())
+            {
+                const CompositeKeyPart& part = key[prefix.Size()];
+
+                if (beginValue != nullptr && !isBeginIncluded && part == *beginValue) continue;
+
+                if (endValue != nullptr && (*endValue < part || (!isEndIncluded && part == *endValue))) return;
+            }
+
+            if (!func(it->second)) return;
+        }
+    }
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "Map.h"
+#include "CompositeKey.h"
+#include "KeyIndexHandles.h"
+
+namespace mvlt
+{
+    /**
+        \brief A class for storing the index of several keys
+
+        Values of all keys of the record are stored as one CompositeKey. The hash map finds records with equal values
+        of all keys, and the B+tree finds records with equal values of first keys and, optionally, a range of values of the next key.
+        The index does not own the data, the key values are read from the columns of Vault, so records must be erased
+        from the index before their data is changed.
+    */
+    class CompositeIndex
+    {
+    private:
+        // Names of index keys in index order
+        std::vector<std::string> Keys;
+
+        // Columns of index keys in index order
+        std::vector<const DataColumn*> Columns;
+
+        // Hash map with composite key values
+        UnorderedMap<CompositeKey, VaultRecord*> HashMap;
+
+        // B+tree with composite key values
+        Map<CompositeKey, VaultRecord*> TreeMap;
+
+        // Positions of records inside HashMap and TreeMap
+        KeyIndexHandles<CompositeKey> IndexHandles;
+
+    public:
+        /**
+            \brief Constructor
+
+            \param [in] keys names of index keys
+            \param [in] columns columns of index keys in the same order
+            \param [in] indexPolicy structures used by the index. It must not be VaultIndexPolicy::None
+        */
+        CompositeIndex(const std::vector<std::string>& keys, const std::vector<const DataColumn*>& columns, const VaultIndexPolicy& indexPolicy) noexcept;
+
+        /// \brief Deleted copy constructor
+        CompositeIndex(const CompositeIndex& other) noexcept = delete;
+
+        /// \brief Deleted assignment operator
+        CompositeIndex& operator=(const CompositeIndex& other) noexcept = delete;
+
+        /**
+            \brief A method for getting names of index keys
+
+            \return names of index keys in index order
+        */
+        const std::vector<std::string>& GetKeys() const noexcept;
+
+        /**
+            \brief A method for getting structures used by the index
+
+            \return index policy of the index
+        */
+        VaultIndexPolicy GetIndexPolicy() const noexcept;
+
+        /**
+            \brief A method for checking that the index has a hash map
+
+            \return Returns true if records are stored in the hash map
+        */
+        bool IsHashIndexed() const noexcept;
+
+        /**
+            \brief A method for checking that the index has a B+tree
+
+            \return Returns true if records are stored in the B+tree
+        */
+        bool IsOrderedIndexed() const noexcept;
+
+        /**
+            \brief A method for checking that the key is part of the index
+
+            \param [in] key key name
+
+            \return Returns true if the key is part of the index
+        */
+        bool IsKeyInIndex(const std::string& key) const noexcept;
+
+        /**
+            \brief A method for reading the composite key value of the record
+
+            \param [in] record record to read from
+            \param [out] key composite key value of the record
+        */
+        void MakeKey(const VaultRecord* record, CompositeKey& key) const noexcept;
+
+        /**
+            \brief A method for adding the record to the index
+
+            \param [in] record record to add
+        */
+        void Emplace(VaultRecord* record) noexcept;
+
+        /**
+            \brief A method for erasing the record from the index
+
+            \param [in] record record to erase. It must still store key values with which it was added
+        */
+        void Erase(VaultRecord* record) noexcept;
+
+        /// \brief A method for erasing all records from the index
+        void Clear() noexcept;
+
+        /**
+            \brief A method for finding records by the prefix of the composite key
+
+            If the prefix contains all keys and the index has a hash map, then the hash map is used. Otherwise the index
+            must have a B+tree, and records are read from the B+tree starting with the first record with this prefix.
+
+            \param [in] prefix values of first keys of the index
+            \param [in] beginValue pointer to the lower bound of the next key after prefix. Nullptr if there is no lower bound
+            \param [in] isBeginIncluded is the lower bound included
+            \param [in] endValue pointer to the upper bound of the next key after prefix. Nullptr if there is no upper bound
+            \param [in] isEndIncluded is the upper bound included
+            \param [in] func function to call for every found record. If it returns false, the search stops
+        */
+        void RequestRecords(const CompositeKey& prefix,
+            const CompositeKeyPart* beginValue, const bool& isBeginIncluded,
+            const CompositeKeyPart* endValue, const bool& isEndIncluded,
+            const std::function<bool(VaultRecord* record)>& func) const noexcept;
+
+        /// \brief Default destructor
+        ~CompositeIndex() noexcept = default;
+    };
+}
@@ -0,0 +1,87 @@
+#include "CompositeKey.h"
+
+namespace mvlt
+{
+    std::type_index CompositeKeyPart::GetDataType() const noexcept
+    {
+        return Data.GetDataType();
+    }
+
+    std::size_t CompositeKeyPart::Hash() const noexcept
+    {
+        if (VTablePtr == nullptr) return 0;
+        return VTablePtr->HashFunc(Data.GetDataPtr());
+    }
+
+    bool CompositeKeyPart::operator==(const CompositeKeyPart& other) const noexcept
+    {
+        if (VTablePtr != other.VTablePtr) return false;
+        if (VTablePtr == nullptr) return true;
+        return VTablePtr->EqualFunc(Data.GetDataPtr(), other.Data.GetDataPtr());
+    }
+
+    bool CompositeKeyPart::operator<(const CompositeKeyPart& other) const noexcept
+    {
+        // Parts with different types are ordered by types
+        if (VTablePtr != other.VTablePtr) return GetDataType() < other.GetDataType();
+        if (VTablePtr == nullptr) return false;
+        return VTablePtr->LessFunc(Data.GetDataPtr(), other.Data.GetDataPtr());
+    }
+
+    void CompositeKey::Reserve(const std::size_t& size) noexcept
+    {
+        Parts.reserve(size);
+    }
+
+    void CompositeKey::AddPart(const CompositeKeyPart& part) noexcept
+    {
+        Parts.emplace_back(part);
+    }
+
+    void CompositeKey::Clear() noexcept
+    {
+        Parts.clear();
+    }
+
+    std::size_t CompositeKey::Size() const noexcept
+    {
+        return Parts.size();
+    }
+
+    const CompositeKeyPart& CompositeKey::operator[](const std::size_t& index) const noexcept
+    {
+        return Parts[index];
+    }
+
+    std::size_t CompositeKey::Hash() const noexcept
+    {
+        std::size_t res = Parts.size();
+        for (const CompositeKeyPart& part : Parts)
+            res ^= part.Hash() + 0x9e3779b97f4a7c15ull + (res << 6) + (res >> 2);
+        return res;
+    }
+
+    bool CompositeKey::operator==(const CompositeKey& other) const noexcept
+    {
+        if (Parts.size() != other.Parts.size()) return false;
+
+        for (std::size_t i = 0; i < Parts.size(); ++i)
+            if (!(Parts[i] == other.Parts[i])) return false;
+
+        return true;
+    }
+
+    bool CompositeKey::operator<(const CompositeKey& other) const noexcept
+    {
+        std::size_t size = Parts.size() < other.Parts.size() ? Parts.size() : other.Parts.size();
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (Parts[i] < other.Parts[i]) return true;
+            if (other.Parts[i] < Parts[i]) return false;
+        }
+
+        // If one key is the prefix of the other then the shorter key is less
+        return Parts.size() < other.Parts.size();
+    }
+}
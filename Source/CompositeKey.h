@@ -0,0 +1,240 @@
+#pragma once
+
+#include <vector>
+#include <typeindex>
+#include <functional>
+
+#include "DataSaver.h"
+
+namespace mvlt
+{
+    /**
+        \brief A class for storing one value of the composite key
+
+        The value of any key type is stored inside DataSaver. Functions to hash and compare values are kept
+        in one static table per type, so parts of the same type are compared without any conversions.
+        Parts of different types are ordered by their types.
+    */
+    class CompositeKeyPart
+    {
+    private:
+        // Table with functions to compare values of a specific data type
+        struct CompareVTable
+        {
+            // Pointer to function to get hash of the value
+            std::size_t (*HashFunc)(const void* data);
+
+            // Pointer to function to check that values are equal
+            bool (*EqualFunc)(const void* lhs, const void* rhs);
+
+            // Pointer to function to check that lhs value is less than rhs value
+            bool (*LessFunc)(const void* lhs, const void* rhs);
+        };
+
+        // Struct to store static function table for T type
+        template <class T>
+        struct TypeVTable
+        {
+            // Function table for T type
+            static const CompareVTable VTable;
+        };
+
+        template <class T>
+        static std::size_t HashData(const void* data) noexcept
+        {
+            return std::hash<T>()(*static_cast<const T*>(data));
+        }
+
+        template <class T>
+        static bool EqualData(const void* lhs, const void* rhs) noexcept
+        {
+            return *static_cast<const T*>(lhs) == *static_cast<const T*>(rhs);
+        }
+
+        template <class T>
+        static bool LessData(const void* lhs, const void* rhs) noexcept
+        {
+            return *static_cast<const T*>(lhs) < *static_cast<const T*>(rhs);
+        }
+
+        // Stored value
+        DataSaver Data;
+
+        // Pointer to function table of stored data type. Nullptr if there is no data
+        const CompareVTable* VTablePtr = nullptr;
+
+    public:
+        /// \brief Default constructor
+        CompositeKeyPart() noexcept = default;
+
+        /**
+            \brief Copy constructor
+
+            \param [in] other object to be copied
+        */
+        CompositeKeyPart(const CompositeKeyPart& other) noexcept = default;
+
+        /**
+            \brief Assignment operator
+
+            \param [in] other object to be copied
+
+            \return returns a reference to this object
+        */
+        CompositeKeyPart& operator=(const CompositeKeyPart& other) noexcept = default;
+
+        /**
+            \brief A template method for setting the part value
+
+            \tparam <T> Any type of data except for c arrays. It must be hashable and comparable
+
+            \param [in] data data to be saved
+        */
+        template <class T>
+        void SetData(const T& data) noexcept
+        {
+            Data.SetData(data);
+            VTablePtr = &TypeVTable<T>::VTable;
+        }
+
+        /**
+            \brief A method for getting the type of saved data.
+
+            \return std::type_index object with saved data type
+        */
+        std::type_index GetDataType() const noexcept;
+
+        /**
+            \brief A method for getting hash of the saved data
+
+            \return hash of the saved data or 0 if there is no data
+        */
+        std::size_t Hash() const noexcept;
+
+        /**
+            \brief Equality operator
+
+            \param [in] other part to compare with
+
+            \return Returns true if both parts store the same type and equal values
+        */
+        bool operator==(const CompositeKeyPart& other) const noexcept;
+
+        /**
+            \brief Less operator
+
+            \param [in] other part to compare with
+
+            \return Returns true if this part is less than other part
+        */
+        bool operator<(const CompositeKeyPart& other) const noexcept;
+
+        /// \brief Default destructor
+        ~CompositeKeyPart() noexcept = default;
+    };
+
+    template <class T>
+    const CompositeKeyPart::CompareVTable CompositeKeyPart::TypeVTable<T>::VTable =
+    {
+        &CompositeKeyPart::HashData<T>,
+        &CompositeKeyPart::EqualData<T>,
+        &CompositeKeyPart::LessData<T>
+    };
+
+    /**
+        \brief A class for storing values of several keys as one key of composite index
+
+        Keys are compared lexicographically. If one key is the prefix of the other key, then the shorter key is less.
+        So the search of the prefix in ordered structures returns the first key starting with this prefix.
+    */
+    class CompositeKey
+    {
+    private:
+        // Values of keys
+        std::vector<CompositeKeyPart> Parts;
+
+    public:
+        /// \brief Default constructor
+        CompositeKey() noexcept = default;
+
+        /**
+            \brief A method for reserving memory for parts
+
+            \param [in] size number of parts
+        */
+        void Reserve(const std::size_t& size) noexcept;
+
+        /**
+            \brief A method for adding part to the end of key
+
+            \param [in] part part to add
+        */
+        void AddPart(const CompositeKeyPart& part) noexcept;
+
+        /**
+            \brief A method for removing all parts
+        */
+        void Clear() noexcept;
+
+        /**
+            \brief A method for getting the number of parts
+
+            \return number of parts
+        */
+        std::size_t Size() const noexcept;
+
+        /**
+            \brief A method for getting part by index
+
+            \param [in] index part index. It must be less than Size()
+
+            \return reference to part
+        */
+        const CompositeKeyPart& operator[](const std::size_t& index) const noexcept;
+
+        /**
+            \brief A method for getting hash of all parts
+
+            \return hash of all parts
+        */
+        std::size_t Hash() const noexcept;
+
+        /**
+            \brief Equality operator
+
+            \param [in] other key to compare with
+
+            \return Returns true if keys have the same number of equal parts
+        */
+        bool operator==(const CompositeKey& other) const noexcept;
+
+        /**
+            \brief Less operator
+
+            \param [in] other key to compare with
+
+            \return Returns true if this key is lexicographically less than other key
+        */
+        bool operator<(const CompositeKey& other) const noexcept;
+    };
+}
+
+namespace std
+{
+    /// \brief Specialization of std::hash for CompositeKey
+    template <>
+    struct hash<mvlt::CompositeKey>
+    {
+        /**
+            \brief A method for getting hash of composite key
+
+            \param [in] key key to hash
+
+            \return hash of key
+        */
+        std::size_t operator()(const mvlt::CompositeKey& key) const noexcept
+        {
+            return key.Hash();
+        }
+    };
+}
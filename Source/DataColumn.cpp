@@ -0,0 +1,79 @@
+#include "DataColumn.h"
+
+namespace mvlt
+{
+    DataColumn::DataColumn() noexcept : DataType(typeid(void)) {}
+
+    void DataColumn::Resize(const std::size_t& size) noexcept
+    {
+        if (Ptr != nullptr)
+            ResizeFunc(Ptr, size);
+    }
+
+    void DataColumn::Reserve(const std::size_t& size) noexcept
+    {
+        if (Ptr != nullptr)
+            ReserveFunc(Ptr, size);
+    }
+
+    void DataColumn::ResetRow(const std::size_t& row) noexcept
+    {
+        if (Ptr != nullptr)
+            ResetRowFunc(Ptr, row);
+    }
+
+    bool DataColumn::CopyRow(const std::size_t& row, const DataColumn& other, const std::size_t& otherRow) noexcept
+    {
+        if (Ptr == nullptr || DataType != other.DataType) return false;
+
+        CopyRowFunc(Ptr, row, other.Ptr, otherRow);
+        return true;
+    }
+
+    std::string DataColumn::GetDataAsString(const std::size_t& row) const noexcept
+    {
+        if (Ptr == nullptr) return "";
+
+        return ToStringFunc(Ptr, row);
+    }
+
+    bool DataColumn::SetDataFromString(const std::size_t& row, const std::string& str) noexcept
+    {
+        if (Ptr == nullptr) return false;
+
+        return SetDataFromStringFunc(Ptr, row, str);
+    }
+
+    void DataColumn::GetDataSaver(const std::size_t& row, DataSaver& dataSaver) const noexcept
+    {
+        if (Ptr != nullptr)
+            GetDataSaverFunc(Ptr, row, dataSaver);
+    }
+
+    void DataColumn::GetCompositeKeyPart(const std::size_t& row, CompositeKeyPart& part) const noexcept
+    {
+        if (Ptr != nullptr)
+            GetCompositeKeyPartFunc(Ptr, row, part);
+    }
+
+    std::type_index DataColumn::GetDataType() const noexcept
+    {
+        return DataType;
+    }
+
+    void DataColumn::Clear() noexcept
+    {
+        if (Ptr != nullptr)
+        {
+            DeleteFunc(Ptr);
+            Ptr = nullptr;
+        }
+
+        DataType = typeid(void);
+    }
+
+    DataColumn::~DataColumn() noexcept
+    {
+        Clear();
+    }
+}
@@ -0,0 +1,331 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <typeindex>
+#include <type_traits>
+
+#include "DataSaver.h"
+#include "CompositeKey.h"
+
+namespace mvlt
+{
+    /**
+        \brief A class for storing all values of one key in a contiguous typed column
+
+        Internally it stores std::vector<T> and the default value of the key behind a void pointer,
+        and type-erased functions to work with them, in the same way as DataSaver does for a single value.
+        The row number is used to access a value of a specific record.
+
+        \warning The class cannot store с-arrays
+    */
+    class DataColumn
+    {
+    private:
+        // Typed storage behind Ptr
+        template <class T>
+        struct ColumnValues
+        {
+            // Values of all rows
+            std::vector<T> Values;
+
+            // Value to set in new rows
+            T DefaultValue;
+        };
+
+        // Void pointer to ColumnValues<T>
+        void* Ptr = nullptr;
+
+        // Type of data inside column
+        std::type_index DataType;
+
+        // Pointer to delete function. Required to delete pointer since it is not possibly to delete void*
+        void (*DeleteFunc)(void* column) = nullptr;
+
+        // Pointer to function to change the number of rows. New rows are filled with the default value
+        void (*ResizeFunc)(void* column, const std::size_t& size) = nullptr;
+
+        // Pointer to function to allocate memory for the number of rows without changing the number of rows
+        void (*ReserveFunc)(void* column, const std::size_t& size) = nullptr;
+
+        // Pointer to function to set the default value to the row
+        void (*ResetRowFunc)(void* column, const std::size_t& row) = nullptr;
+
+        // Pointer to function to copy the row from the other column of the same type
+        void (*CopyRowFunc)(void* dst, const std::size_t& dstRow, const void* src, const std::size_t& srcRow) = nullptr;
+
+        // Pointer to function to convert row value to string
+        std::string (*ToStringFunc)(const void* column, const std::size_t& row) = nullptr;
+
+        // Pointer to function to load row value from string
+        bool (*SetDataFromStringFunc)(void* column, const std::size_t& row, const std::string& str) = nullptr;
+
+        // Pointer to function to copy row value to DataSaver
+        void (*GetDataSaverFunc)(const void* column, const std::size_t& row, DataSaver& dataSaver) = nullptr;
+
+        // Pointer to function to copy row value to CompositeKeyPart
+        void (*GetCompositeKeyPartFunc)(const void* column, const std::size_t& row, CompositeKeyPart& part) = nullptr;
+
+    public:
+        /// \brief Default constructor
+        DataColumn() noexcept;
+
+        /// \brief Deleted copy constructor
+        DataColumn(const DataColumn& other) noexcept = delete;
+
+        /// \brief Deleted assignment operator
+        DataColumn& operator=(const DataColumn& other) noexcept = delete;
+
+        /**
+            \brief A template method for setting the column type
+
+            All previous data will be deleted.
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] defaultValue value to fill new rows
+            \param [in] size number of rows in column
+        */
+        template <class T>
+        void SetType(const T& defaultValue, const std::size_t& size) noexcept
+        {
+            Clear();
+
+            ColumnValues<T>* column = new ColumnValues<T>{std::vector<T>(size, defaultValue), defaultValue};
+            Ptr = static_cast<void*>(column);
+            DataType = typeid(T);
+
+            DeleteFunc = [](void* column)
+            {
+                delete static_cast<ColumnValues<T>*>(column);
+            };
+
+            ResizeFunc = [](void* column, const std::size_t& size)
+            {
+                ColumnValues<T>* values = static_cast<ColumnValues<T>*>(column);
+                values->Values.resize(size, values->DefaultValue);
+            };
+
+            ReserveFunc = [](void* column, const std::size_t& size)
+            {
+                static_cast<ColumnValues<T>*>(column)->Values.reserve(size);
+            };
+
+            ResetRowFunc = [](void* column, const std::size_t& row)
+            {
+                ColumnValues<T>* values = static_cast<ColumnValues<T>*>(column);
+                values->Values[row] = values->DefaultValue;
+            };
+
+            CopyRowFunc = [](void* dst, const std::size_t& dstRow, const void* src, const std::size_t& srcRow)
+            {
+                static_cast<ColumnValues<T>*>(dst)->Values[dstRow] = static_cast<const ColumnValues<T>*>(src)->Values[srcRow];
+            };
+
+            ToStringFunc = [](const void* column, const std::size_t& row)
+            {
+                return ToString(static_cast<const ColumnValues<T>*>(column)->Values[row]);
+            };
+
+            SetDataFromStringFunc = [](void* column, const std::size_t& row, const std::string& str)
+            {
+                T data = static_cast<ColumnValues<T>*>(column)->Values[row];
+                if (!FromString(str, data)) return false;
+                static_cast<ColumnValues<T>*>(column)->Values[row] = data;
+                return true;
+            };
+
+            GetDataSaverFunc = [](const void* column, const std::size_t& row, DataSaver& dataSaver)
+            {
+                dataSaver.SetData(static_cast<const ColumnValues<T>*>(column)->Values[row]);
+            };
+
+            GetCompositeKeyPartFunc = [](const void* column, const std::size_t& row, CompositeKeyPart& part)
+            {
+                part.SetData(static_cast<const ColumnValues<T>*>(column)->Values[row]);
+            };
+        }
+
+        /**
+            \brief A template method for changing the default value of the column
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] defaultValue new default value
+
+            \return Returns false if the column type is not T, and otherwise returns true.
+        */
+        template <class T>
+        bool SetDefaultValue(const T& defaultValue) noexcept
+        {
+            if (DataType != typeid(T)) return false;
+
+            static_cast<ColumnValues<T>*>(Ptr)->DefaultValue = defaultValue;
+            return true;
+        }
+
+        /**
+            \brief A template method for getting data from row
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] row row number
+            \param [out] data the ref to which the data will be written
+
+            \return Returns false if the column type is not T, and otherwise returns true.
+        */
+        template <class T>
+        bool GetData(const std::size_t& row, T& data) const noexcept
+        {
+            if (DataType != typeid(T)) return false;
+
+            data = static_cast<const ColumnValues<T>*>(Ptr)->Values[row];
+            return true;
+        }
+
+        /**
+            \brief A template method for setting data to row
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] row row number
+            \param [in] data new data. It is moved to the column if it is rvalue
+
+            \return Returns false if the column type is not T, and otherwise returns true.
+        */
+        template <class T>
+        bool SetData(const std::size_t& row, T&& data) noexcept
+        {
+            typedef typename std::decay<T>::type Type;
+
+            if (DataType != typeid(Type)) return false;
+
+            static_cast<ColumnValues<Type>*>(Ptr)->Values[row] = std::forward<T>(data);
+            return true;
+        }
+
+        /**
+            \brief A template method for getting data from row without type check
+
+            \tparam <T> Column type
+
+            \param [in] row row number
+            \param [out] data the ref to which the data will be written
+        */
+        template <class T>
+        void GetDataUnchecked(const std::size_t& row, T& data) const noexcept
+        {
+            data = static_cast<const ColumnValues<T>*>(Ptr)->Values[row];
+        }
+
+        /**
+            \brief A template method for getting reference to data of row without type check
+
+            \tparam <T> Column type
+
+            \param [in] row row number
+
+            \return Returns const reference to the row data. For bool column the value is returned
+        */
+        template <class T>
+        typename std::vector<T>::const_reference GetDataRef(const std::size_t& row) const noexcept
+        {
+            return static_cast<const ColumnValues<T>*>(Ptr)->Values[row];
+        }
+
+        /**
+            \brief A template method for setting data to row without type check
+
+            \tparam <T> Column type
+
+            \param [in] row row number
+            \param [in] data new data. It is moved to the column if it is rvalue
+        */
+        template <class T>
+        void SetDataUnchecked(const std::size_t& row, T&& data) noexcept
+        {
+            static_cast<ColumnValues<typename std::decay<T>::type>*>(Ptr)->Values[row] = std::forward<T>(data);
+        }
+
+        /**
+            \brief A method for changing the number of rows
+
+            \param [in] size new number of rows
+        */
+        void Resize(const std::size_t& size) noexcept;
+
+        /**
+            \brief A method for allocating memory for the number of rows
+
+            \param [in] size number of rows to allocate memory for
+        */
+        void Reserve(const std::size_t& size) noexcept;
+
+        /**
+            \brief A method for setting the default value to row
+
+            \param [in] row row number
+        */
+        void ResetRow(const std::size_t& row) noexcept;
+
+        /**
+            \brief A method for copying row from the other column
+
+            \param [in] row row number in this column
+            \param [in] other column to copy data from. Must have the same type
+            \param [in] otherRow row number in other column
+
+            \return Returns false if the column types are not match, and otherwise returns true.
+        */
+        bool CopyRow(const std::size_t& row, const DataColumn& other, const std::size_t& otherRow) noexcept;
+
+        /**
+            \brief A method for getting row data converted to string
+
+            \param [in] row row number
+
+            \return A string of data
+        */
+        std::string GetDataAsString(const std::size_t& row) const noexcept;
+
+        /**
+            \brief A method for setting row data from string
+
+            \param [in] row row number
+            \param [in] str a string with data
+
+            \return Returns true if the conversion was successful, otherwise it returns false
+        */
+        bool SetDataFromString(const std::size_t& row, const std::string& str) noexcept;
+
+        /**
+            \brief A method for copying row data to DataSaver
+
+            \param [in] row row number
+            \param [out] dataSaver the ref to which the data will be written
+        */
+        void GetDataSaver(const std::size_t& row, DataSaver& dataSaver) const noexcept;
+
+        /**
+            \brief A method for copying row data to CompositeKeyPart
+
+            \param [in] row row number
+            \param [out] part the ref to which the data will be written
+        */
+        void GetCompositeKeyPart(const std::size_t& row, CompositeKeyPart& part) const noexcept;
+
+        /**
+            \brief A method for getting the type of saved data.
+
+            \return std::type_index object with saved data type
+        */
+        std::type_index GetDataType() const noexcept;
+
+        /// \brief A method for deleting all data and resetting column type
+        void Clear() noexcept;
+
+        /// \brief Default destructor
+        ~DataColumn() noexcept;
+    };
+}
@@ -2,9 +2,9 @@
 
 namespace mvlt
 {
-    DataSaver::DataSaver() noexcept : DataType(typeid(void)) {}
+    DataSaver::DataSaver() noexcept {}
 
-    DataSaver::DataSaver(const DataSaver& other) noexcept : DataType(typeid(void))
+    DataSaver::DataSaver(const DataSaver& other) noexcept
     {
         // Call operator= method
         *this = other;
@@ -15,66 +15,63 @@ namespace mvlt
         // We check that there is no self-bonding
         if (&other != this)
         {
-            // Clear Ptr if it was data before
-            if (Ptr != nullptr)
-                DeleteFunc(Ptr);
+            // Clear data if it was data before
+            DeleteData();
 
             // Check that other DataSaver is not empty
-            if (other.Ptr != nullptr)
+            if (other.VTablePtr != nullptr)
             {
-                // Create new DataType object copying data type from other
-                DataType = other.DataType;
+                // Call copy func to copy data from other storage to local storage
+                other.VTablePtr->CopyFunc(*this, other.GetDataPtr());
 
-                // Set new CopyFunc from other
-                CopyFunc = other.CopyFunc;
-
-                // Call new copy func to copy data from other void pointer to local void pointer. Data to Ptr will be allocated inside function
-                CopyFunc(Ptr, other.Ptr);
-
-                // Copy to string function
-                ToStringFunc = other.ToStringFunc;
-
-                // Set delete function from other
-                DeleteFunc = other.DeleteFunc;
+                // Set function table from other
+                VTablePtr = other.VTablePtr;
 
                 // Set custom delete function from other
                 CustomDeleteFunc = other.CustomDeleteFunc;
-
-                SetDataFromStringFunc = other.SetDataFromStringFunc;
-            }
-            else
-            {
-                // If other is empty clear the variables
-                Ptr = nullptr;
             }
         }
 
         return *this;
     }
 
+    void* DataSaver::GetDataPtr() noexcept
+    {
+        if (VTablePtr->IsInline) return static_cast<void*>(&InlineBuffer);
+        return Ptr;
+    }
+
+    const void* DataSaver::GetDataPtr() const noexcept
+    {
+        if (VTablePtr->IsInline) return static_cast<const void*>(&InlineBuffer);
+        return Ptr;
+    }
+
+    void DataSaver::DeleteData() noexcept
+    {
+        if (VTablePtr != nullptr)
+        {
+            VTablePtr->DeleteFunc(*this);
+            VTablePtr = nullptr;
+        }
+    }
+
     bool DataSaver::SetDataFromString(const std::string& data) noexcept
     {
-        return SetDataFromStringFunc(Ptr, data);
+        return VTablePtr->SetDataFromStringFunc(GetDataPtr(), data);
     }
 
     void DataSaver::ResetData() noexcept
     {
         if (CustomDeleteFunc != nullptr)
         {
-            CustomDeleteFunc(Ptr);
-            CustomDeleteFunc = nullptr;
-        }
+            if (VTablePtr != nullptr)
+                CustomDeleteFunc(GetDataPtr());
 
-        if (Ptr != nullptr)
-        {
-            DeleteFunc(Ptr);
-            Ptr = nullptr;
+            CustomDeleteFunc = nullptr;
         }
 
-        DataType = typeid(void);
-        CopyFunc = nullptr;
-        ToStringFunc = nullptr;
-        SetDataFromStringFunc = nullptr;
+        DeleteData();
     }
 
     void DataSaver::Swap(DataSaver& other) noexcept
@@ -86,17 +83,17 @@ namespace mvlt
 
     std::string DataSaver::Str() const noexcept
     {
-        return ToStringFunc(Ptr);
+        return VTablePtr->ToStringFunc(GetDataPtr());
     }
 
     std::type_index DataSaver::GetDataType() const noexcept
     {
-        return DataType;
+        if (VTablePtr == nullptr) return typeid(void);
+        return VTablePtr->DataType;
     }
 
     DataSaver::~DataSaver() noexcept
     {
-        if (Ptr != nullptr)
-            DeleteFunc(Ptr);
+        DeleteData();
     }
-}
\ No newline at end of file
+}
@@ -3,6 +3,7 @@
 #include <string>
 #include <iostream>
 #include <typeindex>
+#include <type_traits>
 
 #include "Strings/ToString.h"
 #include "Strings/FromString.h"
@@ -14,34 +15,158 @@ namespace mvlt
 
         If a pointer is stored in a class, then you can set a function to automatically clear this pointer when an object of the class is destroyed.
         By default, it stores the void type.
+        Small types are stored inside the object without heap allocation, and all functions to work with the stored type
+        are kept in one static table per type.
 
         \warning The class cannot store с-arrays
     */
     class DataSaver
     {
     private:
-        // Void pointer to save pointer to any data
-        void* Ptr = nullptr;
+        // Table with functions to work with a specific data type. One static table is shared by all DataSavers storing this type
+        struct DataSaverVTable
+        {
+            // Stored data type
+            const std::type_info& DataType;
+
+            // Is data stored inside InlineBuffer instead of heap
+            bool IsInline;
+
+            // Pointer to copy function. Required to DataSaver copy. Data will be placed to dst storage
+            void (*CopyFunc)(DataSaver& dst, const void* src);
+
+            // Pointer to delete function. Required to delete data since it is not possibly to delete void*
+            void (*DeleteFunc)(DataSaver& dataSaverToDelete);
+
+            // A pointer to a function that will convert the value stored inside to a string
+            std::string (*ToStringFunc)(const void* ptrToPrint);
 
-        // Pointer to data type saver
-        std::type_index DataType;
+            // Pointer to function to load data from string to data saver
+            bool (*SetDataFromStringFunc)(void* ptrToStoreDataFromString, const std::string& str);
+        };
 
-        // Pointer to copy function. Required to DataSaver copy
-        void (*CopyFunc)(void*& dst, void* src) = nullptr;
+        // Struct to store static function table for T type
+        template <class T>
+        struct TypeVTable
+        {
+            // Function table for T type
+            static const DataSaverVTable VTable;
+        };
+
+        // Size of buffer to store small data without heap allocation
+        static constexpr std::size_t InlineBufferSize = 2 * sizeof(void*);
 
-        // Pointer to delete function. Required to delete pointer since it is not possibly to delete void*
-        void (*DeleteFunc)(void*& ptrToDelete) = nullptr;
+        // Type of buffer to store small data without heap allocation
+        typedef std::aligned_storage<InlineBufferSize>::type InlineBufferType;
 
-        // A pointer to a function that will convert the value stored inside to a string
-        std::string (*ToStringFunc)(void* ptrToPrint) = nullptr;
+        // Struct to check if T type will be stored inside InlineBuffer
+        template <class T>
+        struct IsInlineType
+        {
+            static constexpr bool value = sizeof(T) <= InlineBufferSize && alignof(T) <= alignof(InlineBufferType) &&
+                std::is_nothrow_copy_constructible<T>::value;
+        };
+
+        union
+        {
+            // Void pointer to save pointer to any data stored in heap
+            void* Ptr;
+
+            // Buffer to save small data
+            InlineBufferType InlineBuffer;
+        };
+
+        // Pointer to function table of stored data type. Nullptr if there is no data
+        const DataSaverVTable* VTablePtr = nullptr;
 
         // Pointer to custom delete function. Required to delete data if it is pointer
         void (*CustomDeleteFunc)(const void* ptr) = nullptr;
 
-        // Pointer to function to load data from string to data saver
-        bool (*SetDataFromStringFunc)(void* ptrToStoreDataFromString, const std::string& str) = nullptr;
+        /**
+            \brief A method for getting a pointer to stored data
+
+            \return pointer to data inside InlineBuffer or inside heap
+        */
+        void* GetDataPtr() noexcept;
+
+        /**
+            \brief A method for getting a pointer to stored data
+
+            \return pointer to data inside InlineBuffer or inside heap
+        */
+        const void* GetDataPtr() const noexcept;
+
+        /**
+            \brief A template method for placing a copy of data to DataSaver storage
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [out] dst DataSaver to place data in. Must be empty
+            \param [in] src pointer to data to copy
+        */
+        template <class T>
+        static void CopyData(DataSaver& dst, const void* src) noexcept
+        {
+            if (IsInlineType<T>::value)
+                new (&dst.InlineBuffer) T(*static_cast<const T*>(src));
+            else
+                dst.Ptr = static_cast<void*>(new T(*static_cast<const T*>(src)));
+        }
+
+        /**
+            \brief A template method for deleting data from DataSaver storage
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] dataSaverToDelete DataSaver to delete data from
+        */
+        template <class T>
+        static void DeleteData(DataSaver& dataSaverToDelete) noexcept
+        {
+            if (IsInlineType<T>::value)
+                reinterpret_cast<T*>(&dataSaverToDelete.InlineBuffer)->~T();
+            else
+                delete static_cast<T*>(dataSaverToDelete.Ptr);
+        }
+
+        /**
+            \brief A template method for converting data to string
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] ptrToPrint pointer to data
+
+            \return A string of data
+        */
+        template <class T>
+        static std::string DataToString(const void* ptrToPrint) noexcept
+        {
+            return ToString(*static_cast<const T*>(ptrToPrint));
+        }
+
+        /**
+            \brief A template method for loading data from string
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [out] ptrToStoreDataFromString pointer to data
+            \param [in] str a string with data
+
+            \return Returns true if the conversion was successful, otherwise it returns false
+        */
+        template <class T>
+        static bool DataFromString(void* ptrToStoreDataFromString, const std::string& str) noexcept
+        {
+            return FromString(str, *static_cast<T*>(ptrToStoreDataFromString));
+        }
+
+        /// \brief A method for deleting data without calling custom delete function
+        void DeleteData() noexcept;
 
     public:
+        /// Making the CompositeKeyPart class friendly so that it compares stored data without copying it
+        friend class CompositeKeyPart;
+
         /// \brief Default constructor
         DataSaver() noexcept;
 
@@ -67,7 +192,7 @@ namespace mvlt
             \param [in] data data to be stored inside DataSaver
         */
         template <class T>
-        explicit DataSaver(const T& data) noexcept : DataType(typeid(void))
+        explicit DataSaver(const T& data) noexcept
         {
             SetData(data);
         }
@@ -85,7 +210,7 @@ namespace mvlt
             \param [in] customDeleteFunc function to delete data
         */
         template <class T, class F>
-        DataSaver(const T& data, F&& customDeleteFunc) noexcept : DataType(typeid(void))
+        DataSaver(const T& data, F&& customDeleteFunc) noexcept
         {
             SetData(data, customDeleteFunc);
         }
@@ -138,45 +263,17 @@ namespace mvlt
         template <class T, class F>
         void SetData(const T& data, F&& customDeleteFunc) noexcept
         {
-            // Clear Ptr if it was data before
-            if (Ptr != nullptr)
-                DeleteFunc(Ptr);
-
-            // Create new T type object and save it pointer like void ptr. Data from data will be copying using copy constructor
-            Ptr = static_cast<void*>(new T(data));
+            // Clear data if it was data before
+            DeleteData();
 
-            // Save data type to DataType
-            DataType = typeid(data);
-
-            // Set new CopyFunc. It is get to void pointers and convert void pointers to T pointers and copy data.
-            CopyFunc = [](void*& dst, void* src)
-            {
-                // Convert src pointer to T pointer and get data from T pointer.
-                // Use T copy constructor to create T object.
-                // Allocate new memory to T type and convert it to void pointer.
-                dst = static_cast<void*>(new T(*reinterpret_cast<T*>(src)));
-            };
-
-            // Set new DeleteFunc
-            DeleteFunc = [](void*& ptrToDelete)
-            {
-                delete static_cast<T*>(ptrToDelete);
-            };
+            // Copy data to inline buffer or to heap depending on T size
+            CopyData<T>(*this, &data);
 
-            // Set new to string function
-            ToStringFunc = [](void* ptrToPrint)
-            {
-                return ToString(*static_cast<T*>(ptrToPrint));
-            };
+            // Set function table of T type
+            VTablePtr = &TypeVTable<T>::VTable;
 
             // Set custom delete function from dataSaver
             CustomDeleteFunc = customDeleteFunc;
-
-            // Set new copy from string function
-            SetDataFromStringFunc = [](void* ptrToStoreDataFromString, const std::string& str)
-            {
-                return FromString(str, *static_cast<T*>(ptrToStoreDataFromString));
-            };
         }
 
         /**
@@ -193,18 +290,14 @@ namespace mvlt
         bool GetData(T& data) const noexcept
         {
             // Check data type stored in DataSaver
-            if (DataType != typeid(data))
+            if (GetDataType() != typeid(data))
             {
-                std::cerr << "Wrong type! Was: " + std::string(DataType.name()) + " Requested: " + typeid(data).name() << "\n";
+                std::cerr << "Wrong type! Was: " + std::string(GetDataType().name()) + " Requested: " + typeid(data).name() << "\n";
                 return false;
             }
 
-            // Check that was data inside Ptr
-            if (Ptr == nullptr)
-                return false;
-
-            // Copy data from Ptr to data
-            data = *static_cast<T*>(Ptr);
+            // Copy data from storage to data
+            data = *static_cast<const T*>(GetDataPtr());
             return true;
         }
 
@@ -241,4 +334,15 @@ namespace mvlt
         /// \brief Default destructor
         ~DataSaver() noexcept;
     };
+
+    template <class T>
+    const DataSaver::DataSaverVTable DataSaver::TypeVTable<T>::VTable =
+    {
+        typeid(T),
+        DataSaver::IsInlineType<T>::value,
+        &DataSaver::CopyData<T>,
+        &DataSaver::DeleteData<T>,
+        &DataSaver::DataToString<T>,
+        &DataSaver::DataFromString<T>
+    };
 }
\ No newline at end of file
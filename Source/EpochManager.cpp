@@ -0,0 +1,87 @@
+#include "EpochManager.h"
+
+namespace mvlt
+{
+    // Counter to give readers stripes to new threads in turn
+    static std::atomic<std::size_t> NextThreadEpochStripe(0);
+
+    // Index of readers stripe of the current thread
+    static thread_local std::size_t LocalThreadEpochStripe = NextThreadEpochStripe.fetch_add(1);
+
+    EpochManager::EpochManager() noexcept
+    {
+        for (ReadersStripe& stripe : ReadersStripes)
+        {
+            stripe.Counters[0].store(0);
+            stripe.Counters[1].store(0);
+        }
+
+        Epoch.store(0);
+    }
+
+    EpochManager::ReadersStripe& EpochManager::GetThreadReadersStripe() noexcept
+    {
+        return ReadersStripes[LocalThreadEpochStripe % ReadersStripesCount];
+    }
+
+    bool EpochManager::IsNoReaders(const std::size_t& parity) const noexcept
+    {
+        long readersCount = 0;
+        for (const ReadersStripe& stripe : ReadersStripes)
+            readersCount += stripe.Counters[parity].load();
+
+        return readersCount == 0;
+    }
+
+    void EpochManager::DeleteObjects(std::vector<std::pair<void*, void (*)(void*)>>& objects) noexcept
+    {
+        for (std::pair<void*, void (*)(void*)>& object : objects)
+            object.second(object.first);
+
+        objects.clear();
+    }
+
+    std::size_t EpochManager::Enter() noexcept
+    {
+        ReadersStripe& stripe = GetThreadReadersStripe();
+
+        while (true)
+        {
+            std::uint64_t epoch = Epoch.load();
+            std::size_t parity = epoch & 1;
+
+            stripe.Counters[parity].fetch_add(1);
+
+            // If the epoch was advanced before the counter was changed, the writer could not see this reader
+            // and could delete objects retired before the advanced epoch, so the reader enters the new epoch
+            if (Epoch.load() == epoch) return parity;
+
+            stripe.Counters[parity].fetch_sub(1);
+        }
+    }
+
+    void EpochManager::Leave(const std::size_t& parity) noexcept
+    {
+        GetThreadReadersStripe().Counters[parity].fetch_sub(1);
+    }
+
+    void EpochManager::TryReclaim() noexcept
+    {
+        std::uint64_t epoch = Epoch.load();
+        std::size_t previousParity = (epoch + 1) & 1;
+
+        // Readers of the previous epoch can still see objects retired in it
+        if (!IsNoReaders(previousParity)) return;
+
+        DeleteObjects(RetiredObjects[previousParity]);
+
+        // Objects retired in the current epoch will be deleted when its readers leave
+        Epoch.store(epoch + 1);
+    }
+
+    EpochManager::~EpochManager() noexcept
+    {
+        DeleteObjects(RetiredObjects[0]);
+        DeleteObjects(RetiredObjects[1]);
+    }
+}
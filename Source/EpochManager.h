@@ -0,0 +1,172 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+namespace mvlt
+{
+    /**
+        \brief A class for deleting objects only after all readers who could see them have finished
+
+        Readers enter the epoch before reading shared objects and leave it after. They do not take any locks,
+        they only change the counter of the current epoch parity in their own cache line.
+        The writer removes an object from shared structures and retires it. The retired object is deleted
+        when all readers who entered before the object was retired have left.
+
+        Epochs alternate between two parities. The epoch is advanced only when there are no readers with the parity of the previous epoch,
+        so objects retired in the previous epoch can not be seen by any reader and are deleted.
+
+        \warning Retire and TryReclaim must not be called by several threads at the same time
+    */
+    class EpochManager
+    {
+    private:
+        // Size of cache line to place readers counters in different lines
+        static constexpr std::size_t CacheLineSize = 64;
+
+        // Number of readers counters
+        static constexpr std::size_t ReadersStripesCount = 16;
+
+        // Counters of readers of both epoch parities padded to the size of cache line
+        struct ReadersStripe
+        {
+            // Number of readers entered using this stripe for each epoch parity
+            std::atomic<long> Counters[2];
+
+            // Padding to place the next counters in the other cache line
+            char Padding[CacheLineSize - 2 * sizeof(std::atomic<long>)];
+        };
+
+        // Readers counters. Each thread uses only one of them
+        ReadersStripe ReadersStripes[ReadersStripesCount];
+
+        // Current epoch
+        std::atomic<std::uint64_t> Epoch;
+
+        // Objects retired in the epochs of each parity with functions to delete them
+        std::vector<std::pair<void*, void (*)(void*)>> RetiredObjects[2];
+
+        /**
+            \brief A template method for deleting the object
+
+            \tparam <T> Type of the object
+
+            \param [in] object pointer to the object
+        */
+        template <class T>
+        static void DeleteObject(void* object) noexcept
+        {
+            delete static_cast<T*>(object);
+        }
+
+        /**
+            \brief A method for getting the readers stripe of the current thread
+
+            \return readers stripe of the current thread
+        */
+        ReadersStripe& GetThreadReadersStripe() noexcept;
+
+        /**
+            \brief A method for checking that there are no readers with the epoch parity
+
+            \param [in] parity epoch parity
+
+            \return Returns true if there are no readers with the parity, otherwise returns false
+        */
+        bool IsNoReaders(const std::size_t& parity) const noexcept;
+
+        /**
+            \brief A method for deleting retired objects
+
+            \param [in] objects objects to delete. The vector will be cleared
+        */
+        static void DeleteObjects(std::vector<std::pair<void*, void (*)(void*)>>& objects) noexcept;
+
+    public:
+        /// \brief Default constructor
+        EpochManager() noexcept;
+
+        /// \brief Deleted copy constructor
+        EpochManager(const EpochManager& other) noexcept = delete;
+
+        /// \brief Deleted assignment operator
+        EpochManager& operator=(const EpochManager& other) noexcept = delete;
+
+        /**
+            \brief A method for entering the current epoch
+
+            \return parity of the entered epoch. It must be passed to Leave
+        */
+        std::size_t Enter() noexcept;
+
+        /**
+            \brief A method for leaving the epoch
+
+            \param [in] parity parity returned by Enter
+        */
+        void Leave(const std::size_t& parity) noexcept;
+
+        /**
+            \brief A template method for retiring the object
+
+            The object must be already removed from all structures available for readers.
+
+            \tparam <T> Type of the object. The object must be created with new
+
+            \param [in] object pointer to the object
+        */
+        template <class T>
+        void Retire(T* object) noexcept
+        {
+            RetiredObjects[Epoch.load() & 1].emplace_back(const_cast<void*>(static_cast<const void*>(object)), &DeleteObject<typename std::remove_const<T>::type>);
+        }
+
+        /// \brief A method for deleting the objects which can not be seen by readers and advancing the epoch
+        void TryReclaim() noexcept;
+
+        /// \brief Destructor. Deletes all retired objects
+        ~EpochManager() noexcept;
+    };
+
+    /**
+        \brief A class for the automatic leaving of the epoch
+
+        It enters the epoch when the object is created, and leaves it when the object is destroyed.
+    */
+    class EpochGuard
+    {
+    private:
+        // Manager of the entered epoch
+        EpochManager* Epochs = nullptr;
+
+        // Parity of the entered epoch
+        std::size_t Parity = 0;
+
+    public:
+        /**
+            \brief Constructor
+
+            \param [in] epochs manager to enter the epoch
+        */
+        explicit EpochGuard(EpochManager& epochs) noexcept : Epochs(&epochs)
+        {
+            Parity = Epochs->Enter();
+        }
+
+        /// \brief Deleted copy constructor
+        EpochGuard(const EpochGuard& other) noexcept = delete;
+
+        /// \brief Deleted assignment operator
+        EpochGuard& operator=(const EpochGuard& other) noexcept = delete;
+
+        /// \brief Destructor
+        ~EpochGuard() noexcept
+        {
+            Epochs->Leave(Parity);
+        }
+    };
+}
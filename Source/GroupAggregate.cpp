@@ -0,0 +1,70 @@
+#include "GroupAggregate.h"
+
+namespace mvlt
+{
+    GroupAggregate::GroupAggregate(const std::string& groupKey, const std::string& valueKey, const DataColumn* groupColumn, const DataColumn* valueColumn) noexcept :
+        GroupKey(groupKey), ValueKey(valueKey), GroupColumn(groupColumn), ValueColumn(valueColumn), GroupType(typeid(void)), ValueType(typeid(void)) {}
+
+    void GroupAggregate::CopyTypes(const GroupAggregate& other) noexcept
+    {
+        if (Ptr != nullptr) DeleteFunc(Ptr);
+
+        GroupType = other.GroupType;
+        ValueType = other.ValueType;
+        CreateFunc = other.CreateFunc;
+        DeleteFunc = other.DeleteFunc;
+        ClearFunc = other.ClearFunc;
+        UpdateFunc = other.UpdateFunc;
+
+        Ptr = CreateFunc != nullptr ? CreateFunc() : nullptr;
+    }
+
+    const std::string& GroupAggregate::GetGroupKey() const noexcept
+    {
+        return GroupKey;
+    }
+
+    const std::string& GroupAggregate::GetValueKey() const noexcept
+    {
+        return ValueKey;
+    }
+
+    bool GroupAggregate::IsKeyInAggregate(const std::string& key) const noexcept
+    {
+        return key == GroupKey || key == ValueKey;
+    }
+
+    std::type_index GroupAggregate::GetGroupType() const noexcept
+    {
+        return GroupType;
+    }
+
+    std::type_index GroupAggregate::GetValueType() const noexcept
+    {
+        return ValueType;
+    }
+
+    void GroupAggregate::Emplace(const VaultRecord* record) noexcept
+    {
+        if (Ptr != nullptr)
+            UpdateFunc(Ptr, GroupColumn, ValueColumn, record->Row, true);
+    }
+
+    void GroupAggregate::Erase(const VaultRecord* record) noexcept
+    {
+        if (Ptr != nullptr)
+            UpdateFunc(Ptr, GroupColumn, ValueColumn, record->Row, false);
+    }
+
+    void GroupAggregate::Clear() noexcept
+    {
+        if (Ptr != nullptr)
+            ClearFunc(Ptr);
+    }
+
+    GroupAggregate::~GroupAggregate() noexcept
+    {
+        if (Ptr != nullptr)
+            DeleteFunc(Ptr);
+    }
+}
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+
+#include "DataColumn.h"
+#include "VaultRecord.h"
+
+namespace mvlt
+{
+    /**
+        \brief Structure for storing the aggregate of one group
+
+        \tparam <V> Type of the aggregated key
+    */
+    template <class V>
+    struct VaultGroup
+    {
+        /// \brief Number of records in the group
+        std::size_t Count = 0;
+
+        /// \brief Sum of the aggregated key values of records in the group
+        V Sum{};
+    };
+
+    /**
+        \brief A class for storing the number of records and the sum of one key for every value of other key
+
+        Internally it stores std::unordered_map<G, VaultGroup<V>> behind a void pointer and type-erased functions to work with it,
+        in the same way as DataColumn does. The aggregate does not own the data, the key values are read from the columns of Vault,
+        so records must be erased from the aggregate before their data is changed. A group is removed when its last record is erased.
+    */
+    class GroupAggregate
+    {
+    private:
+        // Name of the key to group by
+        std::string GroupKey;
+
+        // Name of the key to sum
+        std::string ValueKey;
+
+        // Column of the key to group by
+        const DataColumn* GroupColumn = nullptr;
+
+        // Column of the key to sum
+        const DataColumn* ValueColumn = nullptr;
+
+        // Void pointer to std::unordered_map<G, VaultGroup<V>>
+        void* Ptr = nullptr;
+
+        // Type of the key to group by
+        std::type_index GroupType;
+
+        // Type of the key to sum
+        std::type_index ValueType;
+
+        // Pointer to function to create empty groups of the same types
+        void* (*CreateFunc)() = nullptr;
+
+        // Pointer to delete function. Required to delete pointer since it is not possibly to delete void*
+        void (*DeleteFunc)(void* groups) = nullptr;
+
+        // Pointer to function to erase all groups
+        void (*ClearFunc)(void* groups) = nullptr;
+
+        // Pointer to function to add the row to its group or to erase it from the group
+        void (*UpdateFunc)(void* groups, const DataColumn* groupColumn, const DataColumn* valueColumn, const std::size_t& row, const bool& isAdd) = nullptr;
+
+    public:
+        /**
+            \brief Constructor
+
+            \param [in] groupKey name of the key to group by
+            \param [in] valueKey name of the key to sum
+            \param [in] groupColumn column of the key to group by
+            \param [in] valueColumn column of the key to sum
+        */
+        GroupAggregate(const std::string& groupKey, const std::string& valueKey, const DataColumn* groupColumn, const DataColumn* valueColumn) noexcept;
+
+        /// \brief Deleted copy constructor
+        GroupAggregate(const GroupAggregate& other) noexcept = delete;
+
+        /// \brief Deleted assignment operator
+        GroupAggregate& operator=(const GroupAggregate& other) noexcept = delete;
+
+        /**
+            \brief A template method for setting types of keys
+
+            All previous groups will be deleted.
+
+            \tparam <G> Type of the key to group by. It must be hashable
+            \tparam <V> Type of the key to sum. It must support += and -= operators
+        */
+        template <class G, class V>
+        void SetTypes() noexcept
+        {
+            if (Ptr != nullptr) DeleteFunc(Ptr);
+
+            GroupType = typeid(G);
+            ValueType = typeid(V);
+
+            CreateFunc = []()
+            {
+                return static_cast<void*>(new std::unordered_map<G, VaultGroup<V>>);
+            };
+
+            DeleteFunc = [](void* groups)
+            {
+                delete static_cast<std::unordered_map<G, VaultGroup<V>>*>(groups);
+            };
+
+            ClearFunc = [](void* groups)
+            {
+                static_cast<std::unordered_map<G, VaultGroup<V>>*>(groups)->clear();
+            };
+
+            UpdateFunc = [](void* groups, const DataColumn* groupColumn, const DataColumn* valueColumn, const std::size_t& row, const bool& isAdd)
+            {
+                std::unordered_map<G, VaultGroup<V>>* groupsMap = static_cast<std::unordered_map<G, VaultGroup<V>>*>(groups);
+
+                G groupValue{};
+                V value{};
+                groupColumn->GetDataUnchecked(row, groupValue);
+                valueColumn->GetDataUnchecked(row, value);
+
+                if (isAdd)
+                {
+                    VaultGroup<V>& group = (*groupsMap)[groupValue];
+                    ++group.Count;
+                    group.Sum += value;
+                }
+                else
+                {
+                    auto groupIt = groupsMap->find(groupValue);
+                    if (groupIt == groupsMap->end()) return;
+
+                    if (--groupIt->second.Count == 0) groupsMap->erase(groupIt);
+                    else groupIt->second.Sum -= value;
+                }
+            };
+
+            Ptr = CreateFunc();
+        }
+
+        /**
+            \brief A method for setting the same types of keys as in other aggregate
+
+            All previous groups will be deleted.
+
+            \param [in] other aggregate to copy types from
+        */
+        void CopyTypes(const GroupAggregate& other) noexcept;
+
+        /**
+            \brief A method for getting the name of the key to group by
+
+            \return name of the key to group by
+        */
+        const std::string& GetGroupKey() const noexcept;
+
+        /**
+            \brief A method for getting the name of the key to sum
+
+            \return name of the key to sum
+        */
+        const std::string& GetValueKey() const noexcept;
+
+        /**
+            \brief A method for checking that the key is used by the aggregate
+
+            \param [in] key key name
+
+            \return Returns true if the key is the key to group by or the key to sum
+        */
+        bool IsKeyInAggregate(const std::string& key) const noexcept;
+
+        /**
+            \brief A method for getting the type of the key to group by
+
+            \return type of the key to group by
+        */
+        std::type_index GetGroupType() const noexcept;
+
+        /**
+            \brief A method for getting the type of the key to sum
+
+            \return type of the key to sum
+        */
+        std::type_index GetValueType() const noexcept;
+
+        /**
+            \brief A template method for getting all groups
+
+            \tparam <G> Type of the key to group by
+            \tparam <V> Type of the key to sum
+
+            \return Returns pointer to groups, or nullptr if the types do not match
+        */
+        template <class G, class V>
+        const std::unordered_map<G, VaultGroup<V>>* GetGroups() const noexcept
+        {
+            if (Ptr == nullptr || GroupType != typeid(G) || ValueType != typeid(V)) return nullptr;
+            return static_cast<const std::unordered_map<G, VaultGroup<V>>*>(Ptr);
+        }
+
+        /**
+            \brief A method for adding the record to its group
+
+            \param [in] record record to add
+        */
+        void Emplace(const VaultRecord* record) noexcept;
+
+        /**
+            \brief A method for erasing the record from its group
+
+            \param [in] record record to erase. It must still store key values with which it was added
+        */
+        void Erase(const VaultRecord* record) noexcept;
+
+        /// \brief A method for erasing all groups
+        void Clear() noexcept;
+
+        /// \brief Destructor
+        ~GroupAggregate() noexcept;
+    };
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <string>
+
+#include "DataColumn.h"
+#include "VaultClasses.h"
+
+namespace mvlt
+{
+    /**
+        \brief A class for fast access to the key of Vault
+
+        The handle is obtained once using Vault::GetKeyHandle and stores pointers to the key structures inside Vault and to the key column.
+        Vault and VaultRecordRef methods that accept the handle instead of the key name do not search the key by name and do not check its type.
+        The handle becomes invalid when the key is removed from Vault, when Vault is dropped or moved.
+        All methods that receive an invalid handle return VaultOperationResultCode::WrongKey.
+
+        \tparam <T> Key type
+    */
+    template <class T>
+    class KeyHandle
+    {
+    private:
+        // Vault to which the key belongs
+        const Vault* Vlt = nullptr;
+
+        // Key name
+        std::string Key;
+
+        // Version of Vault keys at the moment of handle creation
+        std::size_t KeysVersion = 0;
+
+        // Pointer to key structures with positions of records inside them
+        KeyIndexHandles<T>* TtoVaultRecordIndexHandles = nullptr;
+
+        // Pointer to column with key data
+        DataColumn* Column = nullptr;
+
+    public:
+        /// Making the Vault class friendly so that it has access to the internal members of the KeyHandle class
+        friend Vault;
+
+        /// Making the VaultRecordRef class friendly so that it has access to the internal members of the KeyHandle class
+        friend VaultRecordRef;
+
+        /// \brief Default constructor
+        KeyHandle() noexcept = default;
+
+        /**
+            \brief A method for getting the key name
+
+            \return key name
+        */
+        std::string GetKey() const noexcept
+        {
+            return Key;
+        }
+
+        /// \brief Default destructor
+        ~KeyHandle() noexcept = default;
+    };
+}
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "Map.h"
+#include "VaultRecord.h"
+
+namespace mvlt
+{
+    /**
+        \brief A class for storing positions of records inside the indexes of one key
+
+        The hash map stores all records with the same key value together. For each record it stores the position of the record
+        among them by the record row number, so the record is erased from the hash map in O(1) without searching among
+        all records with the same key value. When the record is erased, the last record with the same value takes its position,
+        so only the position of that record is updated. Positions do not change when the hash map grows.
+
+        The map is a B+tree, so its iterators are invalidated by any insertion. Instead of iterators the map finds
+        the pair of the record key value and the record in O(log n), it also does not depend on the number of records with the same value.
+        The key value of the record is read from the record itself, so records must be erased before their data is changed.
+
+        Only the structures enabled by VaultIndexPolicy of the key are filled, the others stay empty.
+
+        \tparam <T> Key type
+    */
+    template <class T>
+    class KeyIndexHandles
+    {
+    private:
+        // Key name
+        std::string Key;
+
+        // Pointer to hash map with T type key and vault record as value
+        UnorderedMap<T, VaultRecord*>* TtoVaultRecordHashMap = nullptr;
+
+        // Pointer to B+tree with T type key and vault record as value
+        Map<T, VaultRecord*>* TtoVaultRecordMap = nullptr;
+
+        // Structures used by the key
+        VaultIndexPolicy IndexPolicy = VaultIndexPolicy::HashAndOrdered;
+
+        // Positions of records among records with the same key value inside TtoVaultRecordHashMap by record row
+        std::vector<std::size_t> HashMapPositions;
+
+        // A method for adding the record to the hash map
+        bool EmplaceToHashMap(const T& value, VaultRecord* record) noexcept
+        {
+            auto emplaceRes = TtoVaultRecordHashMap->Emplace(value, record);
+            if (!emplaceRes.second) return false;
+
+            if (record->Row >= HashMapPositions.size()) HashMapPositions.resize(record->Row + 1);
+            HashMapPositions[record->Row] = emplaceRes.first.GetValueIndex();
+            return true;
+        }
+
+        // A method for adding the record to the map
+        bool EmplaceToMap(const T& value, VaultRecord* record) noexcept
+        {
+            return TtoVaultRecordMap->Emplace(value, record).second;
+        }
+
+    public:
+        /// Making the Vault class friendly so that it has access to the internal members of the KeyIndexHandles class
+        friend Vault;
+
+        /**
+            \brief Constructor
+
+            \param [in] key key name
+            \param [in] hashMap hash map of the key
+            \param [in] map map of the key
+            \param [in] indexPolicy structures used by the key
+        */
+        KeyIndexHandles(const std::string& key, UnorderedMap<T, VaultRecord*>* hashMap, Map<T, VaultRecord*>* map, const VaultIndexPolicy& indexPolicy) noexcept :
+            Key(key), TtoVaultRecordHashMap(hashMap), TtoVaultRecordMap(map), IndexPolicy(indexPolicy) {}
+
+        /// \brief Deleted copy constructor
+        KeyIndexHandles(const KeyIndexHandles& other) noexcept = delete;
+
+        /// \brief Deleted assignment operator
+        KeyIndexHandles& operator=(const KeyIndexHandles& other) noexcept = delete;
+
+        /**
+            \brief A method for getting structures used by the key
+
+            \return index policy of the key
+        */
+        VaultIndexPolicy GetIndexPolicy() const noexcept
+        {
+            return IndexPolicy;
+        }
+
+        /**
+            \brief A method for checking that the key has a hash map
+
+            \return Returns true if records are stored in the hash map
+        */
+        bool IsHashIndexed() const noexcept
+        {
+            return IndexPolicy == VaultIndexPolicy::HashAndOrdered || IndexPolicy == VaultIndexPolicy::HashOnly;
+        }
+
+        /**
+            \brief A method for checking that the key has a map
+
+            \return Returns true if records are stored in the map
+        */
+        bool IsOrderedIndexed() const noexcept
+        {
+            return IndexPolicy == VaultIndexPolicy::HashAndOrdered || IndexPolicy == VaultIndexPolicy::OrderedOnly;
+        }
+
+        /**
+            \brief A method for adding the record to the hash map and to the map
+
+            \param [in] value key value of the record
+            \param [in] record record to add
+
+            \return Returns false if the key is unique and it already has the value, otherwise returns true.
+        */
+        bool Emplace(const T& value, VaultRecord* record) noexcept
+        {
+            if (IsHashIndexed() && !EmplaceToHashMap(value, record)) return false;
+
+            // Map of unique key may reject the value only if there is no hash map, so nothing to roll back
+            if (IsOrderedIndexed() && !EmplaceToMap(value, record)) return false;
+
+            return true;
+        }
+
+        /**
+            \brief A method for checking that the key values of new records may be added to the unique key
+
+            \param [in] items pairs of key value and record to add. They are sorted by key value by the method
+
+            \return Returns false if the key is unique and some value is repeated or already added, otherwise returns true.
+        */
+        bool IsUniqueRange(std::vector<std::pair<T, VaultRecord*>>& items) const noexcept
+        {
+            if (IsHashIndexed() ? TtoVaultRecordHashMap->IsMultiContainer() : (!IsOrderedIndexed() || TtoVaultRecordMap->IsMultiContainer()))
+                return true;
+
+            std::sort(items.begin(), items.end(), [](const std::pair<T, VaultRecord*>& a, const std::pair<T, VaultRecord*>& b)
+                {
+                    return a.first < b.first;
+                });
+
+            for (std::size_t i = 0; i < items.size(); ++i)
+            {
+                if (i > 0 && !(items[i - 1].first < items[i].first)) return false;
+
+                if (IsHashIndexed())
+                {
+                    if (TtoVaultRecordHashMap->Find(items[i].first) != TtoVaultRecordHashMap->End()) return false;
+                }
+                else if (TtoVaultRecordMap->Find(items[i].first) != TtoVaultRecordMap->End()) return false;
+            }
+
+            return true;
+        }
+
+        /**
+            \brief A method for adding many records to the hash map and to the map
+
+            The hash map of the unique key is reallocated at most once and the map is filled in sorted order.
+            Values of the unique key must be checked by IsUniqueRange before.
+
+            \param [in] items pairs of key value and record to add
+        */
+        void EmplaceRange(std::vector<std::pair<T, VaultRecord*>>&& items) noexcept
+        {
+            if (IsHashIndexed())
+            {
+                // Multi map may store all values in few keys, so it is not reserved
+                if (!TtoVaultRecordHashMap->IsMultiContainer())
+                    TtoVaultRecordHashMap->Reserve(TtoVaultRecordHashMap->Size() + items.size());
+
+                for (const auto& item : items)
+                    EmplaceToHashMap(item.first, item.second);
+            }
+
+            if (IsOrderedIndexed()) TtoVaultRecordMap->EmplaceRange(std::move(items));
+        }
+
+        /**
+            \brief A method for erasing the record from the hash map and from the map
+
+            \param [in] record record to erase. It must be added to both indexes and still store its key value
+        */
+        void Erase(VaultRecord* record) noexcept
+        {
+            if (IndexPolicy == VaultIndexPolicy::None) return;
+
+            Erase(record, record->GetDataRef<T>(Key));
+        }
+
+        /**
+            \brief A method for erasing the record with known key value from the hash map and from the map
+
+            \param [in] record record to erase. It must be added to both indexes
+            \param [in] value key value with which the record was added
+        */
+        void Erase(VaultRecord* record, const T& value) noexcept
+        {
+            if (IsHashIndexed())
+            {
+                // The last record with the same value takes the position of erased record
+                VaultRecord* const* movedRecord = TtoVaultRecordHashMap->EraseValue(value, HashMapPositions[record->Row]);
+                if (movedRecord != nullptr) HashMapPositions[(*movedRecord)->Row] = HashMapPositions[record->Row];
+            }
+
+            if (IsOrderedIndexed()) TtoVaultRecordMap->Erase(value, record);
+        }
+
+        /**
+            \brief A method for changing the key value of the record in the hash map and in the map
+
+            \param [in] record record to update. It must be added to both indexes and still store its old key value
+            \param [in] data new key value
+
+            \return Returns false if the key is unique and other record already has the data, otherwise returns true.
+        */
+        bool Update(VaultRecord* record, const T& data) noexcept
+        {
+            if (IndexPolicy == VaultIndexPolicy::None) return true;
+
+            // Check if it is unique key and try to set duplicate data
+            if (IsHashIndexed() && !TtoVaultRecordHashMap->IsMultiContainer())
+            {
+                auto it = TtoVaultRecordHashMap->Find(data);
+                if (it != TtoVaultRecordHashMap->End()) return (*it).second == record;
+            }
+            else if (IsOrderedIndexed() && !TtoVaultRecordMap->IsMultiContainer())
+            {
+                auto it = TtoVaultRecordMap->Find(data);
+                if (it != TtoVaultRecordMap->End()) return (*it).second == record;
+            }
+
+            Erase(record);
+            Emplace(data, record);
+            return true;
+        }
+
+        /// \brief A method for clearing the hash map, the map and all handles
+        void Clear() noexcept
+        {
+            TtoVaultRecordHashMap->Clear();
+            TtoVaultRecordMap->Clear();
+            HashMapPositions.clear();
+        }
+
+        /// \brief Default destructor
+        ~KeyIndexHandles() noexcept = default;
+    };
+}
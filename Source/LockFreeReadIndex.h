@@ -0,0 +1,363 @@
+#pragma once
+
+#include <list>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <typeindex>
+#include <unordered_map>
+
+#include "EpochManager.h"
+#include "VaultRecord.h"
+#include "VaultRecordSnapshot.h"
+
+namespace mvlt
+{
+    /**
+        \brief A base class for the index of the record snapshots by the unique key value
+
+        It allows Vault to keep the index synchronized with records without knowing the key type.
+        All methods except for the reading methods of derived classes must be called under the Vault write lock.
+    */
+    class LockFreeReadIndexBase
+    {
+    protected:
+        // Key name
+        std::string Key;
+
+        // Key type
+        std::type_index KeyType;
+
+        // Manager to retire objects removed from the index
+        EpochManager* Epochs = nullptr;
+
+        // Positions of keys values inside snapshots
+        std::shared_ptr<const std::unordered_map<std::string, std::size_t>> KeysPositions;
+
+    public:
+        /**
+            \brief Constructor
+
+            \param [in] key key name
+            \param [in] keyType key type
+            \param [in] epochs manager to retire objects removed from the index
+        */
+        LockFreeReadIndexBase(const std::string& key, const std::type_index& keyType, EpochManager* epochs) noexcept :
+            Key(key), KeyType(keyType), Epochs(epochs) {}
+
+        /// \brief Deleted copy constructor
+        LockFreeReadIndexBase(const LockFreeReadIndexBase& other) noexcept = delete;
+
+        /// \brief Deleted assignment operator
+        LockFreeReadIndexBase& operator=(const LockFreeReadIndexBase& other) noexcept = delete;
+
+        /**
+            \brief A method for getting the key name
+
+            \return key name
+        */
+        const std::string& GetKey() const noexcept
+        {
+            return Key;
+        }
+
+        /**
+            \brief A method for getting the key type
+
+            \return key type
+        */
+        std::type_index GetKeyType() const noexcept
+        {
+            return KeyType;
+        }
+
+        /**
+            \brief A method for setting keys stored in the snapshots
+
+            Existing snapshots are not changed, so all records must be added again.
+
+            \param [in] keys all keys of Vault
+        */
+        void SetKeys(const std::list<std::string>& keys) noexcept
+        {
+            std::unordered_map<std::string, std::size_t> keysPositions;
+            for (const std::string& key : keys)
+                keysPositions.emplace(key, keysPositions.size());
+
+            KeysPositions = std::make_shared<const std::unordered_map<std::string, std::size_t>>(std::move(keysPositions));
+        }
+
+        /**
+            \brief A method for adding the record or replacing its snapshot
+
+            \param [in] record record to add
+        */
+        virtual void AddRecord(const VaultRecord* record) noexcept = 0;
+
+        /**
+            \brief A method for erasing the record
+
+            \param [in] record record to erase
+        */
+        virtual void EraseRecord(const VaultRecord* record) noexcept = 0;
+
+        /// \brief A method for erasing all records
+        virtual void Clear() noexcept = 0;
+
+        /**
+            \brief A method for creating an empty index with the same key
+
+            \param [in] epochs manager to retire objects removed from the new index
+
+            \return pointer to the new index
+        */
+        virtual LockFreeReadIndexBase* Clone(EpochManager* epochs) const noexcept = 0;
+
+        /// \brief Destructor
+        virtual ~LockFreeReadIndexBase() noexcept = default;
+    };
+
+    /**
+        \brief A class for reading the record snapshots by the unique key value without locks
+
+        The index is a hash table with chains of links. Each link points to an immutable entry with the key value and the record snapshot.
+        The only writer changes the table by publishing new pointers, so readers always see the old or the new state.
+        Removed links, entries and tables are retired to EpochManager and deleted when all readers that could see them have finished.
+
+        \tparam <T> Key type. It must support std::hash
+    */
+    template <class T>
+    class LockFreeReadIndex : public LockFreeReadIndexBase
+    {
+    private:
+        // Immutable key value with the record snapshot
+        struct Entry
+        {
+            // Key value of the record
+            T KeyValue;
+
+            // Hash of the key value
+            std::size_t Hash;
+
+            // Copy of the record data
+            VaultRecordSnapshot Snapshot;
+
+            // Constructor
+            Entry(const T& keyValue, const std::size_t& hash, const std::shared_ptr<const std::unordered_map<std::string, std::size_t>>& keysPositions,
+                const VaultRecord* record) noexcept : KeyValue(keyValue), Hash(hash), Snapshot(keysPositions, record) {}
+        };
+
+        // Link of the hash table chain
+        struct Link
+        {
+            // Current entry of the record
+            std::atomic<const Entry*> EntryPtr;
+
+            // Next link in the chain
+            std::atomic<Link*> Next;
+
+            // Constructor
+            explicit Link(const Entry* entry) noexcept
+            {
+                EntryPtr.store(entry);
+                Next.store(nullptr);
+            }
+        };
+
+        // Hash table with heads of the chains
+        struct Buckets
+        {
+            // Heads of the chains
+            std::vector<std::atomic<Link*>> Heads;
+
+            // Constructor
+            explicit Buckets(const std::size_t& bucketsCount) noexcept : Heads(bucketsCount)
+            {
+                for (std::atomic<Link*>& head : Heads)
+                    head.store(nullptr);
+            }
+        };
+
+        // Minimal number of buckets
+        static constexpr std::size_t MinBucketsCount = 16;
+
+        // Current hash table
+        std::atomic<Buckets*> CurrentBuckets;
+
+        // Links of records. It is used only by the writer
+        std::unordered_map<const VaultRecord*, Link*> RecordsLinks;
+
+        // A method for adding the link to the head of its chain
+        void InsertLink(Buckets* buckets, Link* link) noexcept
+        {
+            std::atomic<Link*>& head = buckets->Heads[link->EntryPtr.load()->Hash % buckets->Heads.size()];
+            link->Next.store(head.load());
+            head.store(link);
+        }
+
+        // A method for removing the link from the current hash table. Readers standing on the link still can go to the next link
+        void UnlinkLink(Link* link) noexcept
+        {
+            Buckets* buckets = CurrentBuckets.load();
+            std::atomic<Link*>* prevNext = &buckets->Heads[link->EntryPtr.load()->Hash % buckets->Heads.size()];
+
+            while (prevNext->load() != link)
+                prevNext = &prevNext->load()->Next;
+
+            prevNext->store(link->Next.load());
+        }
+
+        // A method for moving all entries to the hash table of double size. Entries are shared by the old and the new links
+        void Grow() noexcept
+        {
+            Buckets* oldBuckets = CurrentBuckets.load();
+            Buckets* newBuckets = new Buckets(oldBuckets->Heads.size() * 2);
+
+            for (auto& recordLink : RecordsLinks)
+            {
+                Link* newLink = new Link(recordLink.second->EntryPtr.load());
+                InsertLink(newBuckets, newLink);
+
+                Epochs->Retire(recordLink.second);
+                recordLink.second = newLink;
+            }
+
+            CurrentBuckets.store(newBuckets);
+            Epochs->Retire(oldBuckets);
+        }
+
+    public:
+        /**
+            \brief Constructor
+
+            \param [in] key key name
+            \param [in] epochs manager to retire objects removed from the index
+        */
+        LockFreeReadIndex(const std::string& key, EpochManager* epochs) noexcept : LockFreeReadIndexBase(key, typeid(T), epochs)
+        {
+            CurrentBuckets.store(new Buckets(MinBucketsCount));
+        }
+
+        void AddRecord(const VaultRecord* record) noexcept override
+        {
+            const T& keyValue = record->GetDataRef<T>(Key);
+            std::size_t hash = std::hash<T>()(keyValue);
+            const Entry* newEntry = new Entry(keyValue, hash, KeysPositions, record);
+
+            auto recordLinkIt = RecordsLinks.find(record);
+            if (recordLinkIt == RecordsLinks.end())
+            {
+                Link* newLink = new Link(newEntry);
+                InsertLink(CurrentBuckets.load(), newLink);
+                RecordsLinks.emplace(record, newLink);
+
+                if (RecordsLinks.size() > CurrentBuckets.load()->Heads.size()) Grow();
+            }
+            else
+            {
+                Link* link = recordLinkIt->second;
+                const Entry* oldEntry = link->EntryPtr.load();
+
+                if (oldEntry->Hash == hash && oldEntry->KeyValue == keyValue)
+                {
+                    // The record stays in the same chain, so only its entry is replaced
+                    link->EntryPtr.store(newEntry);
+                }
+                else
+                {
+                    UnlinkLink(link);
+                    Epochs->Retire(link);
+
+                    Link* newLink = new Link(newEntry);
+                    InsertLink(CurrentBuckets.load(), newLink);
+                    recordLinkIt->second = newLink;
+                }
+
+                Epochs->Retire(oldEntry);
+            }
+
+            Epochs->TryReclaim();
+        }
+
+        void EraseRecord(const VaultRecord* record) noexcept override
+        {
+            auto recordLinkIt = RecordsLinks.find(record);
+            if (recordLinkIt == RecordsLinks.end()) return;
+
+            Link* link = recordLinkIt->second;
+            UnlinkLink(link);
+            Epochs->Retire(link->EntryPtr.load());
+            Epochs->Retire(link);
+            RecordsLinks.erase(recordLinkIt);
+
+            Epochs->TryReclaim();
+        }
+
+        void Clear() noexcept override
+        {
+            Buckets* oldBuckets = CurrentBuckets.load();
+            CurrentBuckets.store(new Buckets(MinBucketsCount));
+            Epochs->Retire(oldBuckets);
+
+            for (auto& recordLink : RecordsLinks)
+            {
+                Epochs->Retire(recordLink.second->EntryPtr.load());
+                Epochs->Retire(recordLink.second);
+            }
+
+            RecordsLinks.clear();
+
+            Epochs->TryReclaim();
+        }
+
+        LockFreeReadIndexBase* Clone(EpochManager* epochs) const noexcept override
+        {
+            return new LockFreeReadIndex<T>(Key, epochs);
+        }
+
+        /**
+            \brief A method for reading the record snapshot without locks
+
+            The caller must be inside the epoch of the EpochManager of the index until func returns.
+
+            \param [in] keyValue the value of the key to be found
+            \param [in] func function to call with the snapshot of the found record
+
+            \return returns true if the record was found otherwise returns false
+        */
+        template <class F>
+        bool ReadRecord(const T& keyValue, F&& func) const noexcept
+        {
+            const Buckets* buckets = CurrentBuckets.load();
+            std::size_t hash = std::hash<T>()(keyValue);
+
+            for (const Link* link = buckets->Heads[hash % buckets->Heads.size()].load(); link != nullptr; link = link->Next.load())
+            {
+                const Entry* entry = link->EntryPtr.load();
+                if (entry->Hash == hash && entry->KeyValue == keyValue)
+                {
+                    func(entry->Snapshot);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /// \brief Destructor. Readers must not use the index
+        ~LockFreeReadIndex() noexcept override
+        {
+            for (auto& recordLink : RecordsLinks)
+            {
+                delete recordLink.second->EntryPtr.load();
+                delete recordLink.second;
+            }
+
+            delete CurrentBuckets.load();
+        }
+    };
+
+    template <class T>
+    constexpr std::size_t LockFreeReadIndex<T>::MinBucketsCount;
+}
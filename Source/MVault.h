@@ -3,9 +3,25 @@
 #include "VaultRequest.h"
 #include "VaultRecordRef.h"
 #include "VaultRecordSet.h"
+#include "KeyHandle.h"
+#include "VaultPageCursor.h"
+#include "KeyIndexHandles.h"
+#include "CompositeKey.h"
+#include "CompositeIndex.h"
+#include "GroupAggregate.h"
+#include "TypedVault.h"
+#include "ShardedVault.h"
+#include "VaultTransaction.h"
 #include "VaultParamInput.h"
+#include "VaultColumnStorage.h"
+#include "VaultRecordArena.h"
+#include "VaultRecordBitmap.h"
+#include "VaultRecordSnapshot.h"
+#include "LockFreeReadIndex.h"
+#include "EpochManager.h"
 #include "VaultOperationResult.h"
 
+#include "DataColumn.h"
 #include "DataSaver.h"
 #include "DataContainer.h"
 #include "ReadWriteMutex.h"
@@ -25,4 +41,8 @@
 #include "VaultRequest.hpp"
 #include "VaultRecordSet.hpp"
 #include "VaultRecordRef.hpp"
-#include "VaultParamInput.hpp"
\ No newline at end of file
+#include "VaultParamInput.hpp"
+#include "TypedVault.hpp"
+#include "ShardedVault.hpp"
+#include "VaultTransaction.hpp"
+#include "VaultRecordSnapshot.hpp"
\ No newline at end of file
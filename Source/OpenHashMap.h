@@ -0,0 +1,589 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace mvlt
+{
+    template <class KeyType, class ValueType>
+    class OpenHashMap;
+
+    /**
+        \brief Slot of the OpenHashMap
+
+        Slot stores the key and all values with this key. The first value is stored inside the slot,
+        so the key with one value does not allocate memory. Other values are stored in vector.
+
+        \tparam <KeyType> - The type of key for the map
+        \tparam <ValueType> - The type of value for the map
+    */
+    template <class KeyType, class ValueType>
+    struct OpenHashMapSlot
+    {
+        /// Distance from the slot to the home slot of the key plus one. It is zero for empty slot
+        std::uint32_t Distance = 0;
+
+        /// Hash of the key
+        std::size_t Hash = 0;
+
+        /// Key
+        KeyType Key{};
+
+        /// The first value with the key
+        ValueType FirstValue{};
+
+        /// All other values with the key
+        std::vector<ValueType> OtherValues;
+
+        /**
+            \brief A method for getting number of values in slot
+
+            \return number of values
+        */
+        std::size_t ValuesCount() const noexcept
+        {
+            return Distance == 0 ? 0 : OtherValues.size() + 1;
+        }
+
+        /**
+            \brief A method for getting value by index
+
+            \param [in] valueIndex value index inside the slot
+
+            \return reference to value
+        */
+        ValueType& GetValue(const std::size_t& valueIndex) noexcept
+        {
+            return valueIndex == 0 ? FirstValue : OtherValues[valueIndex - 1];
+        }
+
+        /**
+            \brief A method for getting value by index
+
+            \param [in] valueIndex value index inside the slot
+
+            \return const reference to value
+        */
+        const ValueType& GetValue(const std::size_t& valueIndex) const noexcept
+        {
+            return valueIndex == 0 ? FirstValue : OtherValues[valueIndex - 1];
+        }
+    };
+
+    /**
+        \brief Iterator class for OpenHashMap
+
+        Iterator points to one value inside the slot. Any insertion or erasing invalidates all iterators.
+
+        \tparam <KeyType> - The type of key for the map
+        \tparam <ValueType> - The type of value for the map
+    */
+    template <class KeyType, class ValueType>
+    class OpenHashMapIterator
+    {
+    private:
+        // Map to which the iterator belongs
+        const OpenHashMap<KeyType, ValueType>* HashMap = nullptr;
+
+        // Slot index. It is equal to the number of slots for the end iterator
+        std::size_t SlotIndex = 0;
+
+        // Value index inside the slot
+        std::size_t ValueIndex = 0;
+
+    public:
+        /// Making the OpenHashMap class friendly so that it has access to the internal members of the OpenHashMapIterator class
+        friend OpenHashMap<KeyType, ValueType>;
+
+        /// \brief Default constructor
+        OpenHashMapIterator() noexcept = default;
+
+        /**
+            \brief Constructor
+
+            \param [in] hashMap map to which the iterator belongs
+            \param [in] slotIndex slot index
+            \param [in] valueIndex value index inside the slot
+        */
+        OpenHashMapIterator(const OpenHashMap<KeyType, ValueType>* hashMap, const std::size_t& slotIndex, const std::size_t& valueIndex) noexcept :
+            HashMap(hashMap), SlotIndex(slotIndex), ValueIndex(valueIndex) {}
+
+        /**
+            \brief Not equal operator
+
+            \param [in] other object to compare
+
+            \return true it other and this not equal
+        */
+        bool operator!=(const OpenHashMapIterator& other) const noexcept
+        {
+            return SlotIndex != other.SlotIndex || ValueIndex != other.ValueIndex;
+        }
+
+        /**
+            \brief Compare operator
+
+            \param [in] other object to compare
+
+            \return true it other and this equal
+        */
+        bool operator==(const OpenHashMapIterator& other) const noexcept
+        {
+            return SlotIndex == other.SlotIndex && ValueIndex == other.ValueIndex;
+        }
+
+        /**
+            \brief Pre increment operator
+
+            \return incremented iterator
+        */
+        OpenHashMapIterator& operator++() noexcept
+        {
+            *this = HashMap->MakeIterator(SlotIndex, ValueIndex + 1);
+            return *this;
+        }
+
+        /**
+            \brief Operator*
+
+            \return pair with references to iterator key and value
+        */
+        std::pair<const KeyType&, const ValueType&> operator*() const noexcept
+        {
+            const OpenHashMapSlot<KeyType, ValueType>& slot = HashMap->Slots[SlotIndex];
+            return std::pair<const KeyType&, const ValueType&>(slot.Key, slot.GetValue(ValueIndex));
+        }
+
+        /**
+            \brief A method for getting the value index among all values with the same key
+
+            \return value index
+        */
+        std::size_t GetValueIndex() const noexcept
+        {
+            return ValueIndex;
+        }
+
+        /// \brief Default destructor
+        ~OpenHashMapIterator() = default;
+    };
+
+    /**
+        \brief Hash map with open addressing
+
+        All slots are placed in one array and collisions are resolved with Robin Hood linear probing,
+        so the search reads neighbour slots instead of walking bucket chains. Erasing shifts the following slots back,
+        so there are no tombstones.
+
+        All values with the same key are stored in one slot. Erasing the value moves the last value of the slot to its place,
+        so the value is erased in O(1) by its index regardless of the number of values with the same key.
+
+        \tparam <KeyType> - The type of key for the map. It must support std::hash and operator==
+        \tparam <ValueType> - The type of value for the map
+    */
+    template <class KeyType, class ValueType>
+    class OpenHashMap
+    {
+    public:
+        /// Iterator over all values
+        using Iterator = OpenHashMapIterator<KeyType, ValueType>;
+
+        /// Making the iterator friendly so that it has access to the slots of the OpenHashMap class
+        friend Iterator;
+
+    private:
+        using Slot = OpenHashMapSlot<KeyType, ValueType>;
+
+        // Minimum number of slots
+        static constexpr std::size_t MinSlotsCount = 16;
+
+        // Is this multi map
+        bool IsMultiMap = false;
+
+        // Slots. Number of slots is always power of two
+        std::vector<Slot> Slots;
+
+        // Shift for getting the home slot from the hash
+        std::size_t HashShift = 64;
+
+        // Number of not empty slots
+        std::size_t KeysCount = 0;
+
+        // Number of values in all slots
+        std::size_t ValuesCount = 0;
+
+        // A method for getting the home slot. Hash is mixed because std::hash of integers returns value itself
+        std::size_t GetHomeSlot(const std::size_t& hash) const noexcept
+        {
+            return static_cast<std::size_t>((static_cast<std::uint64_t>(hash) * 11400714819323198485ull) >> HashShift);
+        }
+
+        // A method for finding the slot with key. Returns number of slots if key not found
+        std::size_t FindSlot(const KeyType& key, const std::size_t& hash) const noexcept
+        {
+            if (Slots.empty()) return 0;
+
+            std::size_t mask = Slots.size() - 1;
+            std::size_t slotIndex = GetHomeSlot(hash);
+
+            // Keys are sorted by distance, so the key can not be after the slot with smaller distance
+            for (std::uint32_t distance = 1; Slots[slotIndex].Distance >= distance; ++distance)
+            {
+                const Slot& slot = Slots[slotIndex];
+                if (slot.Hash == hash && slot.Key == key) return slotIndex;
+                slotIndex = (slotIndex + 1) & mask;
+            }
+
+            return Slots.size();
+        }
+
+        // A method for placing slot with new key. Returns the index where the slot was placed
+        std::size_t PlaceSlot(Slot&& newSlot) noexcept
+        {
+            std::size_t mask = Slots.size() - 1;
+            std::size_t slotIndex = GetHomeSlot(newSlot.Hash);
+            std::size_t placedIndex = Slots.size();
+
+            newSlot.Distance = 1;
+            for (;;)
+            {
+                Slot& slot = Slots[slotIndex];
+                if (slot.Distance == 0)
+                {
+                    slot = std::move(newSlot);
+                    return placedIndex == Slots.size() ? slotIndex : placedIndex;
+                }
+
+                // Take the place of the key which is closer to its home slot
+                if (slot.Distance < newSlot.Distance)
+                {
+                    std::swap(slot, newSlot);
+                    if (placedIndex == Slots.size()) placedIndex = slotIndex;
+                }
+
+                slotIndex = (slotIndex + 1) & mask;
+                ++newSlot.Distance;
+            }
+        }
+
+        // A method for doubling number of slots
+        void Grow() noexcept
+        {
+            Rehash(Slots.empty() ? MinSlotsCount : Slots.size() * 2);
+        }
+
+        // A method for moving all keys to the new slots. Number of slots must be power of two
+        void Rehash(const std::size_t& slotsCount) noexcept
+        {
+            std::vector<Slot> oldSlots(slotsCount);
+            oldSlots.swap(Slots);
+
+            HashShift = 64;
+            for (std::size_t count = Slots.size(); count > 1; count >>= 1)
+                --HashShift;
+
+            for (Slot& slot : oldSlots)
+                if (slot.Distance != 0) PlaceSlot(std::move(slot));
+        }
+
+        // A method for erasing slot with all values. Following slots are shifted back
+        void EraseSlot(std::size_t slotIndex) noexcept
+        {
+            std::size_t mask = Slots.size() - 1;
+            std::size_t nextIndex = (slotIndex + 1) & mask;
+
+            while (Slots[nextIndex].Distance > 1)
+            {
+                Slots[slotIndex] = std::move(Slots[nextIndex]);
+                --Slots[slotIndex].Distance;
+                slotIndex = nextIndex;
+                nextIndex = (nextIndex + 1) & mask;
+            }
+
+            Slots[slotIndex] = Slot();
+            --KeysCount;
+        }
+
+        // A method for erasing value from slot. Returns pointer to the value moved to valueIndex or nullptr
+        const ValueType* EraseFromSlot(const std::size_t& slotIndex, const std::size_t& valueIndex) noexcept
+        {
+            Slot& slot = Slots[slotIndex];
+            std::size_t lastIndex = slot.ValuesCount() - 1;
+
+            --ValuesCount;
+
+            if (lastIndex == 0)
+            {
+                EraseSlot(slotIndex);
+                return nullptr;
+            }
+
+            if (valueIndex == lastIndex)
+            {
+                slot.OtherValues.pop_back();
+                return nullptr;
+            }
+
+            slot.GetValue(valueIndex) = std::move(slot.GetValue(lastIndex));
+            slot.OtherValues.pop_back();
+            return &slot.GetValue(valueIndex);
+        }
+
+        // A method for creating iterator. If value index is out of slot, then iterator points to the next not empty slot
+        Iterator MakeIterator(std::size_t slotIndex, std::size_t valueIndex) const noexcept
+        {
+            while (slotIndex < Slots.size() && valueIndex >= Slots[slotIndex].ValuesCount())
+            {
+                ++slotIndex;
+                valueIndex = 0;
+            }
+
+            return Iterator(this, slotIndex, valueIndex);
+        }
+
+    public:
+        /**
+            \brief Class constructor
+
+            \param [in] isMultiMap is this map may store several values with the same key
+        */
+        explicit OpenHashMap(const bool& isMultiMap) noexcept : IsMultiMap(isMultiMap) {}
+
+        /// \brief Deleted copy constructor
+        OpenHashMap(const OpenHashMap& other) noexcept = delete;
+
+        /// \brief Deleted assignment operator
+        OpenHashMap& operator=(const OpenHashMap& other) noexcept = delete;
+
+        /**
+            \brief Begin container method
+
+            The need for the container to support foreach loops
+
+            \return Iterator to the first value
+        */
+        Iterator begin() const noexcept
+        {
+            return MakeIterator(0, 0);
+        }
+
+        /**
+            \brief End container method
+
+            The need for the container to support foreach loops
+
+            \return Iterator after the last value
+        */
+        Iterator end() const noexcept
+        {
+            return Iterator(this, Slots.size(), 0);
+        }
+
+        /**
+            \brief Begin container method
+
+            \return Iterator to the first value
+        */
+        Iterator Begin() const noexcept
+        {
+            return MakeIterator(0, 0);
+        }
+
+        /**
+            \brief End container method
+
+            \return Iterator after the last value
+        */
+        Iterator End() const noexcept
+        {
+            return Iterator(this, Slots.size(), 0);
+        }
+
+        /**
+            \brief The method to check if it is multi container
+
+            \return true if it is multicontiner, otherwise return false
+        */
+        bool IsMultiContainer() const noexcept
+        {
+            return IsMultiMap;
+        }
+
+        /**
+            \brief The method for inserting data into the map
+
+            \tparam <EmplaceKeyType> - Key type
+            \tparam <EmplaceValueType> - Value type
+
+            \param [in] key rvalue to key
+            \param [in] value rvlaue to value
+
+            \return A pair consisting of an iterator to the inserted element
+            (or to the element that prevented the insertion) and a bool value set to true if and only if the insertion took place.
+        */
+        template <class EmplaceKeyType, class EmplaceValueType>
+        std::pair<Iterator, bool> Emplace(EmplaceKeyType&& key, EmplaceValueType&& value) noexcept
+        {
+            Slot newSlot;
+            newSlot.Key = std::forward<EmplaceKeyType>(key);
+            newSlot.Hash = std::hash<KeyType>()(newSlot.Key);
+
+            std::size_t slotIndex = FindSlot(newSlot.Key, newSlot.Hash);
+            if (slotIndex < Slots.size())
+            {
+                if (!IsMultiMap) return std::pair<Iterator, bool>(Iterator(this, slotIndex, 0), false);
+
+                Slot& slot = Slots[slotIndex];
+                slot.OtherValues.emplace_back(std::forward<EmplaceValueType>(value));
+                ++ValuesCount;
+                return std::pair<Iterator, bool>(Iterator(this, slotIndex, slot.OtherValues.size()), true);
+            }
+
+            // Keep load factor not greater than 7/8
+            if ((KeysCount + 1) * 8 > Slots.size() * 7) Grow();
+
+            newSlot.FirstValue = std::forward<EmplaceValueType>(value);
+            slotIndex = PlaceSlot(std::move(newSlot));
+            ++KeysCount;
+            ++ValuesCount;
+
+            return std::pair<Iterator, bool>(Iterator(this, slotIndex, 0), true);
+        }
+
+        /**
+            \brief The method for getting range of data
+
+            \param [in] data key to find
+
+            \return Pair with first and last iterator with key equals to data
+        */
+        std::pair<Iterator, Iterator> EqualRange(const KeyType& data) const noexcept
+        {
+            std::size_t slotIndex = FindSlot(data, std::hash<KeyType>()(data));
+            if (slotIndex == Slots.size()) return std::pair<Iterator, Iterator>(End(), End());
+
+            return std::pair<Iterator, Iterator>(Iterator(this, slotIndex, 0), MakeIterator(slotIndex + 1, 0));
+        }
+
+        /**
+            \brief The method for getting iterator with key
+
+            \param [in] data key to find
+
+            \return Iterator with key equals to data
+        */
+        Iterator Find(const KeyType& data) const noexcept
+        {
+            return Iterator(this, FindSlot(data, std::hash<KeyType>()(data)), 0);
+        }
+
+        /**
+            \brief The method for getting number of values with key
+
+            \param [in] data key to find
+
+            \return Number of values with key
+        */
+        std::size_t Count(const KeyType& data) const noexcept
+        {
+            std::size_t slotIndex = FindSlot(data, std::hash<KeyType>()(data));
+            if (slotIndex == Slots.size()) return 0;
+
+            return Slots[slotIndex].ValuesCount();
+        }
+
+        /**
+            \brief The method for erase data from map with key
+
+            \param [in] data key to erase
+
+            \return Number of deleted items
+        */
+        std::size_t Erase(const KeyType& data) noexcept
+        {
+            std::size_t slotIndex = FindSlot(data, std::hash<KeyType>()(data));
+            if (slotIndex == Slots.size()) return 0;
+
+            std::size_t res = Slots[slotIndex].ValuesCount();
+            ValuesCount -= res;
+            EraseSlot(slotIndex);
+
+            return res;
+        }
+
+        /**
+            \brief The method for erase data from map with iterator
+
+            The last value with the same key is moved to the place of erased value.
+
+            \param [in] dataIt iterator to erase
+
+            \return Iterator to the value that took the place of erased value, or to the next value
+        */
+        Iterator Erase(const Iterator& dataIt) noexcept
+        {
+            EraseFromSlot(dataIt.SlotIndex, dataIt.ValueIndex);
+            return MakeIterator(dataIt.SlotIndex, dataIt.ValueIndex);
+        }
+
+        /**
+            \brief The method for erase value by its index among all values with the same key
+
+            The last value with the same key is moved to the place of erased value.
+
+            \param [in] key key of value to erase
+            \param [in] valueIndex value index returned by Iterator::GetValueIndex
+
+            \return Pointer to the value moved to valueIndex or nullptr if no value was moved
+        */
+        const ValueType* EraseValue(const KeyType& key, const std::size_t& valueIndex) noexcept
+        {
+            std::size_t slotIndex = FindSlot(key, std::hash<KeyType>()(key));
+            if (slotIndex == Slots.size()) return nullptr;
+
+            return EraseFromSlot(slotIndex, valueIndex);
+        }
+
+        /**
+            \brief The method for preparing the map for the number of keys
+
+            The slots are reallocated at most once, so adding keys after it does not rehash the map.
+
+            \param [in] keysCount number of keys to store
+        */
+        void Reserve(const std::size_t& keysCount) noexcept
+        {
+            std::size_t slotsCount = Slots.empty() ? MinSlotsCount : Slots.size();
+            while (keysCount * 8 > slotsCount * 7) slotsCount *= 2;
+
+            if (slotsCount != Slots.size()) Rehash(slotsCount);
+        }
+
+        /// \brief The method for clear map
+        void Clear() noexcept
+        {
+            std::vector<Slot>().swap(Slots);
+            HashShift = 64;
+            KeysCount = 0;
+            ValuesCount = 0;
+        }
+
+        /**
+            \brief The method for get map size
+
+            \return Number of values
+        */
+        std::size_t Size() const noexcept
+        {
+            return ValuesCount;
+        }
+
+        /// \brief Default destructor
+        ~OpenHashMap() noexcept = default;
+    };
+
+    template <class KeyType, class ValueType>
+    constexpr std::size_t OpenHashMap<KeyType, ValueType>::MinSlotsCount;
+}
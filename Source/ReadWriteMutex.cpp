@@ -2,10 +2,34 @@
 
 namespace mvlt
 {
+    // Counter to give readers counters to new threads in turn
+    static std::atomic<std::size_t> NextThreadReadersStripe(0);
+
+    // Index of readers counter of the current thread
+    thread_local std::size_t LocalThreadReadersStripe = NextThreadReadersStripe.fetch_add(1);
+
     ReadWriteMutex::ReadWriteMutex() noexcept
     {
-        ReadCounter.store(0);
-        IsCondVarWaiting.store(false);
+        for (ReadersStripe& stripe : ReadersStripes)
+            stripe.Counter.store(0);
+
+        WritersCounter.store(0);
+    }
+
+    std::atomic<long>& ReadWriteMutex::GetThreadReadersCounter() noexcept
+    {
+        return ReadersStripes[LocalThreadReadersStripe % ReadersStripesCount].Counter;
+    }
+
+    bool ReadWriteMutex::IsNoReaders() const noexcept
+    {
+        long readersCount = 0;
+        for (const ReadersStripe& stripe : ReadersStripes)
+            readersCount += stripe.Counter.load();
+
+        // The sum may be negative since RecursiveReadWriteMutex unlocks the mutex for reading before the write lock
+        // if the thread is locked other RecursiveReadWriteMutex for reading
+        return readersCount <= 0;
     }
 
     void ReadWriteMutex::Disable() noexcept
@@ -17,11 +41,22 @@ namespace mvlt
     {
         if (IsActive)
         {
-            WriteMutex.lock();
-            ReadMutex.lock();
-            ReadCounter.fetch_add(1);
-            ReadMutex.unlock();
-            WriteMutex.unlock();
+            std::atomic<long>& readersCounter = GetThreadReadersCounter();
+
+            for (;;)
+            {
+                // The reader is counted before checking writers and writer sets its counter before checking readers,
+                // so at least one of them sees the other
+                readersCounter.fetch_add(1);
+                if (WritersCounter.load() == 0) return;
+
+                // There is a writer, so the reader steps back and lets the writer work
+                readersCounter.fetch_sub(1);
+
+                std::unique_lock<std::mutex> lk(WaitMutex);
+                WriterCv.notify_one();
+                ReadersCv.wait(lk, [&]() { return WritersCounter.load() == 0; });
+            }
         }
     }
 
@@ -29,14 +64,14 @@ namespace mvlt
     {
         if (IsActive)
         {
-            ReadMutex.lock();
-            ReadCounter.fetch_sub(1);
-
-            if (ReadCounter.load() == 0)
-                while (IsCondVarWaiting.load())
-                    Cv.notify_all();
+            GetThreadReadersCounter().fetch_sub(1);
 
-            ReadMutex.unlock();
+            // Wake up the writer waiting for the end of reads
+            if (WritersCounter.load() != 0)
+            {
+                std::lock_guard<std::mutex> lk(WaitMutex);
+                WriterCv.notify_one();
+            }
         }
     }
 
@@ -44,16 +79,13 @@ namespace mvlt
     {
         if (IsActive)
         {
-            std::mutex mtx;
-            std::unique_lock<std::mutex> lk(mtx);
+            // Stop new readers before waiting for other writers
+            WritersCounter.fetch_add(1);
 
             WriteMutex.lock();
 
-            IsCondVarWaiting.store(true);
-
-            if (ReadCounter > 0) Cv.wait(lk);
-
-            IsCondVarWaiting.store(false);
+            std::unique_lock<std::mutex> lk(WaitMutex);
+            WriterCv.wait(lk, [&]() { return IsNoReaders(); });
         }
     }
 
@@ -62,6 +94,13 @@ namespace mvlt
         if (IsActive)
         {
             WriteMutex.unlock();
+
+            // Wake up readers only after the last writer
+            if (WritersCounter.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> lk(WaitMutex);
+                ReadersCv.notify_all();
+            }
         }
     }
 
@@ -3,6 +3,7 @@
 #include <mutex>
 #include <atomic>
 #include <thread>
+#include <cstddef>
 #include <iostream>
 #include <condition_variable>
 
@@ -15,18 +16,64 @@ namespace mvlt
         A write lock will ensure that there can only be one thread in the code section at a time.
         The read lock will ensure that no thread using the write lock gets into the code section until all threads using the read lock are unblocked.
         At the same time, after the write lock, no new threads with a read lock will enter the code section until all threads using the write lock are unblocked.
+
+        Readers are counted in several counters placed in different cache lines, and each thread uses its own counter,
+        so threads locking for reading do not write to the same memory. Waiting threads sleep on condition variables.
     */
     class ReadWriteMutex
     {
     private:
-        std::mutex WriteMutex, ReadMutex;
-        std::atomic_int ReadCounter;
-        std::atomic_bool IsCondVarWaiting;
-        std::condition_variable Cv;
+        // Size of cache line to place readers counters in different lines
+        static constexpr std::size_t CacheLineSize = 64;
+
+        // Number of readers counters
+        static constexpr std::size_t ReadersStripesCount = 16;
+
+        // Counter of readers padded to the size of cache line
+        struct ReadersStripe
+        {
+            // Number of readers locked using this counter. It may be negative if the thread unlocks the mutex locked in other thread
+            std::atomic<long> Counter;
+
+            // Padding to place the next counter in the other cache line
+            char Padding[CacheLineSize - sizeof(std::atomic<long>)];
+        };
+
+        // Readers counters. Each thread uses only one of them
+        ReadersStripe ReadersStripes[ReadersStripesCount];
+
+        // Number of threads waiting for the write lock or holding it. New readers wait while it is not zero
+        std::atomic<std::size_t> WritersCounter;
+
+        // Mutex to order writers
+        std::mutex WriteMutex;
+
+        // Mutex for condition variables
+        std::mutex WaitMutex;
+
+        // Condition variable to wait for the end of all writes
+        std::condition_variable ReadersCv;
+
+        // Condition variable to wait for the end of all reads
+        std::condition_variable WriterCv;
 
         // A variable for switching the operation of the mutex. It is needed so that you can disable the mutex during inheritance
         bool IsActive = true;
 
+        /**
+            \brief A method for getting the counter of readers of the current thread
+
+            \return counter of readers of the current thread
+        */
+        std::atomic<long>& GetThreadReadersCounter() noexcept;
+
+        /**
+            \brief A method for checking that there are no readers
+
+            \return Returns true if there are no threads locked the mutex for reading, otherwise returns false
+        */
+        bool IsNoReaders() const noexcept;
+
     public:
         /// \brief Default constructor
         ReadWriteMutex() noexcept;
@@ -39,6 +86,7 @@ namespace mvlt
 
             Using this method, you can lock the code section for reading, which means that all threads using the read lock will have access to data inside the code section
             but threads using the write lock will wait until all read operations are completed.
+            If there is no writers, then only the counter of the current thread is changed.
         */
         void ReadLock() noexcept;
 
@@ -0,0 +1,163 @@
+#include "ShardedVault.h"
+
+#include "ShardedVault.hpp"
+
+namespace mvlt
+{
+    std::size_t ShardedVault::GetShardIndex(const void* keyValue) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        return ValueHashFunc(keyValue) % Shards.size();
+    }
+
+    bool ShardedVault::GetParamsShardIndex(const std::vector<std::pair<std::string, VaultParamInput>>& params, std::size_t& shardIndex,
+        VaultOperationResult& vaultOperationResult) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        if (ShardKey.empty())
+        {
+            shardIndex = 0;
+            return true;
+        }
+
+        for (const std::pair<std::string, VaultParamInput>& param : params)
+        {
+            if (param.first != ShardKey) continue;
+
+            if (param.second.GetDataType() != ShardKeyType)
+            {
+                vaultOperationResult.Key = ShardKey;
+                vaultOperationResult.RequestedType = param.second.GetDataType();
+                vaultOperationResult.SavedType = ShardKeyType;
+                vaultOperationResult.IsOperationSuccess = false;
+                vaultOperationResult.ResultCode = VaultOperationResultCode::WrongType;
+                return false;
+            }
+
+            shardIndex = GetShardIndex(param.second.GetDataPtr());
+            return true;
+        }
+
+        shardIndex = DefaultValueShard;
+        return true;
+    }
+
+    ShardedVault::ShardedVault(const std::size_t& shardsCount) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        Shards.resize(shardsCount == 0 ? 1 : shardsCount);
+        for (std::unique_ptr<Vault>& shard : Shards)
+            shard.reset(new Vault);
+    }
+
+    std::size_t ShardedVault::GetShardsCount() const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        return Shards.size();
+    }
+
+    bool ShardedVault::IsKeyExist(const std::string& key) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        ReadLock<ReadWriteMutex> readLock(ShardsMtx);
+
+        return Shards.front()->IsKeyExist(key);
+    }
+
+    std::string ShardedVault::GetShardKey() const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        ReadLock<ReadWriteMutex> readLock(ShardsMtx);
+
+        return ShardKey;
+    }
+
+    VaultOperationResult ShardedVault::CreateRecord(const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultRecordRef vaultRecordRef;
+        return CreateRecord(vaultRecordRef, params);
+    }
+
+    VaultOperationResult ShardedVault::CreateRecord(VaultRecordRef& vaultRecordRef, const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        std::size_t shardIndex = 0;
+
+        // Lock ShardedVault to read. The shard locks itself to write
+        ReadLock<ReadWriteMutex> readLock(ShardsMtx);
+
+        if (!GetParamsShardIndex(params, shardIndex, res)) return res;
+
+        return Shards[shardIndex]->CreateRecord(vaultRecordRef, params);
+    }
+
+    VaultOperationResult ShardedVault::CreateRecord(std::vector<std::pair<std::string, VaultParamInput>>&& params) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultRecordRef vaultRecordRef;
+        return CreateRecord(vaultRecordRef, std::move(params));
+    }
+
+    VaultOperationResult ShardedVault::CreateRecord(VaultRecordRef& vaultRecordRef, std::vector<std::pair<std::string, VaultParamInput>>&& params) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        std::size_t shardIndex = 0;
+
+        // Lock ShardedVault to read. The shard locks itself to write
+        ReadLock<ReadWriteMutex> readLock(ShardsMtx);
+
+        if (!GetParamsShardIndex(params, shardIndex, res)) return res;
+
+        return Shards[shardIndex]->CreateRecord(vaultRecordRef, std::move(params));
+    }
+
+    bool ShardedVault::EraseRecord(const VaultRecordRef& recordRefToErase) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        // Lock ShardedVault to read. The shard locks itself to write
+        ReadLock<ReadWriteMutex> readLock(ShardsMtx);
+
+        for (const std::unique_ptr<Vault>& shard : Shards)
+            if (shard.get() == recordRefToErase.Vlt) return shard->EraseRecord(recordRefToErase);
+
+        return false;
+    }
+
+    std::size_t ShardedVault::Size() const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        std::size_t res = 0;
+
+        ReadLock<ReadWriteMutex> readLock(ShardsMtx);
+
+        for (const std::unique_ptr<Vault>& shard : Shards)
+            res += shard->Size();
+
+        return res;
+    }
+
+    void ShardedVault::DropData() noexcept
+    {
+        DBG_LOG_ENTER();
+
+        ReadLock<ReadWriteMutex> readLock(ShardsMtx);
+
+        for (const std::unique_ptr<Vault>& shard : Shards)
+            shard->DropData();
+    }
+}
@@ -0,0 +1,301 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <typeindex>
+
+#include "Vault.h"
+#include "VaultRequest.h"
+#include "VaultRecordRef.h"
+#include "VaultParamInput.h"
+#include "ReadWriteMutex.h"
+#include "VaultOperationResult.h"
+
+namespace mvlt
+{
+    /**
+        \brief A class for storing records in several independent Vaults
+
+        Records are partitioned across shards by the hash of the shard key value.
+        Each shard is a usual Vault with its own lock, so records of different shards are created, changed and erased in parallel.
+        Operations with the shard key value are routed to one shard, other operations are done on all shards and their results are merged.
+
+        Only the shard key is unique across all shards, because records with the same shard key value are always placed in the same shard.
+        The shard key value must not be changed by VaultRecordRef::SetData, since the record stays in the shard selected on its creation.
+    */
+    class ShardedVault
+    {
+    private:
+        // Shards with records. Vaults are stored by pointers since VaultRecordRef keeps a pointer to its Vault
+        std::vector<std::unique_ptr<Vault>> Shards;
+
+        // Name of the shard key. Empty until AddShardKey is called
+        std::string ShardKey;
+
+        // Type of the shard key
+        std::type_index ShardKeyType = typeid(void);
+
+        // Shard of the records without the shard key value in the params
+        std::size_t DefaultValueShard = 0;
+
+        // Pointer to function for getting the hash of the shard key value
+        std::size_t (*ValueHashFunc)(const void* keyValue) = nullptr;
+
+        // Mutex for thread safety. Record operations take the read lock, so only key changes wait for each other
+        mutable ReadWriteMutex ShardsMtx;
+
+        /**
+            \brief A template method for getting the hash of the value
+
+            \tparam <T> Type of the value
+
+            \param [in] keyValue pointer to value of T type
+
+            \return hash of the value
+        */
+        template <class T>
+        static std::size_t GetValueHash(const void* keyValue) noexcept;
+
+        /**
+            \brief A method for getting the shard of the shard key value
+
+            \param [in] keyValue pointer to value with the shard key type
+
+            \return index of the shard
+        */
+        std::size_t GetShardIndex(const void* keyValue) const noexcept;
+
+        /**
+            \brief A method for getting the shard of the record with params
+
+            \param [in] params vector of pairs with key and value
+            \param [out] shardIndex index of the shard for the record
+            \param [out] vaultOperationResult result of the operation. It is changed only if the shard key value has a wrong type
+
+            \return true if the shard is found, otherwise false
+        */
+        bool GetParamsShardIndex(const std::vector<std::pair<std::string, VaultParamInput>>& params, std::size_t& shardIndex,
+            VaultOperationResult& vaultOperationResult) const noexcept;
+
+    public:
+        /**
+            \brief Constructor
+
+            \param [in] shardsCount number of shards. If it is zero, one shard will be created
+        */
+        explicit ShardedVault(const std::size_t& shardsCount = 16) noexcept;
+
+        /// \brief Deleted copy constructor
+        ShardedVault(const ShardedVault& other) noexcept = delete;
+
+        /// \brief Deleted assignment operator
+        ShardedVault& operator=(const ShardedVault& other) noexcept = delete;
+
+        /**
+            \brief A method for getting the number of shards
+
+            \return number of shards
+        */
+        std::size_t GetShardsCount() const noexcept;
+
+        /**
+            \brief A template method for adding the shard key to all shards
+
+            The shard key is added as a unique key. It can be added only once and only when there are no records.
+
+            \tparam <T> Any type of data except for c arrays. It must support std::hash
+
+            \param [in] key new key name
+            \param [in] indexPolicy set of structures used to search records by the key
+
+            \return VaultOperationResult object with AddShardKey result.
+            If the shard key is already added, ResultCode will be equal to DuplicateKey.
+            If there are records in the shards, ResultCode will be equal to TryToAddUniqueKeyInNonEmptyVaultWithoutLambda
+        */
+        template <class T>
+        VaultOperationResult AddShardKey(const std::string& key, const VaultIndexPolicy& indexPolicy = VaultIndexPolicy::HashAndOrdered) noexcept;
+
+        /**
+            \brief A template method for adding a new key to all shards
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] key new key name
+            \param [in] defaultKeyValue default key value
+            \param [in] indexPolicy set of structures used to search records by the key
+
+            \return returns true if the key was added otherwise returns false
+        */
+        template <class T>
+        bool AddKey(const std::string& key, const T& defaultKeyValue, const VaultIndexPolicy& indexPolicy = VaultIndexPolicy::HashAndOrdered) noexcept;
+
+        /**
+            \brief The method for checking the existence of the key
+
+            \param [in] key the name of the key to search for
+
+            \return returns true if the key was found otherwise returns false
+        */
+        bool IsKeyExist(const std::string& key) const noexcept;
+
+        /**
+            \brief A method for getting the name of the shard key
+
+            \return name of the shard key. It is empty if the shard key is not added
+        */
+        std::string GetShardKey() const noexcept;
+
+        /**
+            \brief The method for creating a new record in the shard selected by the shard key value
+
+            If the shard key value is not in the params, the record is created in the shard of the default value of the shard key.
+            If the shard key is not added, all records are created in the first shard.
+
+            \param [in] params vector of pairs with key and value
+
+            \return VaultOperationResult object with CreateRecord result
+        */
+        VaultOperationResult CreateRecord(const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept;
+
+        /**
+            \brief The method for creating a new record in the shard selected by the shard key value
+
+            \param [out] vaultRecordRef a reference to the created record
+            \param [in] params vector of pairs with key and value
+
+            \return VaultOperationResult object with CreateRecord result
+        */
+        VaultOperationResult CreateRecord(VaultRecordRef& vaultRecordRef, const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept;
+
+        /**
+            \brief The method for creating a new record in the shard selected by the shard key value
+
+            Values of params are moved to the record.
+
+            \param [in] params vector of pairs with key and value
+
+            \return VaultOperationResult object with CreateRecord result
+        */
+        VaultOperationResult CreateRecord(std::vector<std::pair<std::string, VaultParamInput>>&& params) noexcept;
+
+        /**
+            \brief The method for creating a new record in the shard selected by the shard key value
+
+            Values of params are moved to the record.
+
+            \param [out] vaultRecordRef a reference to the created record
+            \param [in] params vector of pairs with key and value
+
+            \return VaultOperationResult object with CreateRecord result
+        */
+        VaultOperationResult CreateRecord(VaultRecordRef& vaultRecordRef, std::vector<std::pair<std::string, VaultParamInput>>&& params) noexcept;
+
+        /**
+            \brief The method for getting a reference to the record
+
+            If the key is the shard key, only one shard is searched. Otherwise the shards are searched one by one until the record is found.
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] key the name of the key to search for
+            \param [in] keyValue the value of the key to be found
+            \param [out] vaultRecordRef a reference to the found record. It works as in Vault::GetRecord
+
+            \return VaultOperationResult object with GetRecord result
+        */
+        template <class T>
+        VaultOperationResult GetRecord(const std::string& key, const T& keyValue, VaultRecordRef& vaultRecordRef) const noexcept;
+
+        /**
+            \brief The method for getting a vector of references to the records from all shards
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] key the name of the key to search for
+            \param [in] keyValue the value of the key to be found
+            \param [out] recordsRefs vector with found records. In case of errors, the vector will not change
+            \param [in] amountOfRecords The number of records requested
+
+            \return VaultOperationResult object with GetRecords result
+        */
+        template <class T>
+        VaultOperationResult GetRecords(const std::string& key, const T& keyValue, std::vector<VaultRecordRef>& recordsRefs, const std::size_t& amountOfRecords = -1) const noexcept;
+
+        /**
+            \brief A method for making a request to all shards
+
+            Each shard is read locked only while its records are collected, so writers of other shards are not blocked.
+
+            \param [in] request The request
+            \param [out] recordsRefs vector with found records of all shards. In case of errors, the vector will not change
+
+            \return VaultOperationResult object with the same result as Vault::Request would return
+        */
+        template <VaultRequestType Type>
+        VaultOperationResult Request(const VaultRequest<Type>& request, std::vector<VaultRecordRef>& recordsRefs) const;
+
+        /**
+            \brief A method for counting records found by the request in all shards
+
+            \param [in] request The request
+            \param [out] count number of found records. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the same result as Vault::Count would return
+        */
+        template <VaultRequestType Type>
+        VaultOperationResult Count(const VaultRequest<Type>& request, std::size_t& count) const;
+
+        /**
+            \brief A method for getting records of all shards sorted by the key
+
+            Each shard returns its sorted records, and they are merged into one sorted vector.
+
+            \tparam <T> Type of the key
+
+            \param [in] key The key by which the data should be sorted
+            \param [out] recordsRefs vector with sorted records. In case of errors, the vector will not change
+            \param [in] isReverse Sort in descending order or descending order. By default, ascending
+            \param [in] amountOfRecords The number of records. By default, everything is
+
+            \return VaultOperationResult object with GetSortedRecords result
+        */
+        template <class T>
+        VaultOperationResult GetSortedRecords(const std::string& key, std::vector<VaultRecordRef>& recordsRefs, const bool& isReverse = false,
+            const std::size_t& amountOfRecords = -1) const noexcept;
+
+        /**
+            \brief Method for deleting a record from its shard
+
+            \param [in] recordRefToErase the reference to the record that needs to be deleted
+
+            \return Returns true if the record existed and was successfully deleted, otherwise it returns false
+        */
+        bool EraseRecord(const VaultRecordRef& recordRefToErase) noexcept;
+
+        /**
+            \brief The method for erase record using key and value
+
+            If the key is the shard key, only one shard is changed. Otherwise the first found record is erased.
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] key the name of the key to search for
+            \param [in] keyValue the value of the key to be found
+
+            \return VaultOperationResult object with EraseRecord result
+        */
+        template <class T>
+        VaultOperationResult EraseRecord(const std::string& key, const T& keyValue) noexcept;
+
+        /**
+            \brief Method for getting the number of records in all shards
+
+            \return number of records
+        */
+        std::size_t Size() const noexcept;
+
+        /// \brief A method for deleting all data in all shards, but keeping all keys
+        void DropData() noexcept;
+    };
+}
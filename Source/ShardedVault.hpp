@@ -0,0 +1,297 @@
+#pragma once
+
+#include <algorithm>
+
+#include "ShardedVault.h"
+
+#include "Vault.hpp"
+#include "VaultRecordRef.hpp"
+
+// This file contains an implementation of the ShardedVault template methods
+namespace mvlt
+{
+    template <class T>
+    std::size_t ShardedVault::GetValueHash(const void* keyValue) noexcept
+    {
+        return std::hash<T>()(*static_cast<const T*>(keyValue));
+    }
+
+    template <class T>
+    VaultOperationResult ShardedVault::AddShardKey(const std::string& key, const VaultIndexPolicy& indexPolicy) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        res.Key = key;
+        res.RequestedType = typeid(T);
+
+        // Lock ShardedVault to change keys of all shards
+        WriteLock<ReadWriteMutex> writeLock(ShardsMtx);
+
+        if (!ShardKey.empty())
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::DuplicateKey;
+            return res;
+        }
+
+        // Records can not be moved between shards, so the shard key is added only to empty shards
+        for (const std::unique_ptr<Vault>& shard : Shards)
+        {
+            if (shard->Size() != 0)
+            {
+                res.IsOperationSuccess = false;
+                res.ResultCode = VaultOperationResultCode::TryToAddUniqueKeyInNonEmptyVaultWithoutLambda;
+                return res;
+            }
+        }
+
+        // All shards have the same keys, so if the key can not be added it fails on the first shard
+        for (const std::unique_ptr<Vault>& shard : Shards)
+        {
+            res = shard->AddUniqueKey<T>(key, indexPolicy);
+            if (!res.IsOperationSuccess) return res;
+        }
+
+        T defaultKeyValue{};
+        ShardKey = key;
+        ShardKeyType = typeid(T);
+        ValueHashFunc = &GetValueHash<T>;
+        DefaultValueShard = GetShardIndex(&defaultKeyValue);
+
+        return res;
+    }
+
+    template <class T>
+    bool ShardedVault::AddKey(const std::string& key, const T& defaultKeyValue, const VaultIndexPolicy& indexPolicy) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        // Lock ShardedVault to change keys of all shards
+        WriteLock<ReadWriteMutex> writeLock(ShardsMtx);
+
+        for (const std::unique_ptr<Vault>& shard : Shards)
+            if (!shard->AddKey(key, defaultKeyValue, indexPolicy)) return false;
+
+        return true;
+    }
+
+    template <class T>
+    VaultOperationResult ShardedVault::GetRecord(const std::string& key, const T& keyValue, VaultRecordRef& vaultRecordRef) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+
+        // Lock ShardedVault to read
+        ReadLock<ReadWriteMutex> readLock(ShardsMtx);
+
+        if (!ShardKey.empty() && key == ShardKey && ShardKeyType == typeid(T))
+            return Shards[GetShardIndex(&keyValue)]->GetRecord(key, keyValue, vaultRecordRef);
+
+        for (const std::unique_ptr<Vault>& shard : Shards)
+        {
+            res = shard->GetRecord(key, keyValue, vaultRecordRef);
+
+            // All shards have the same keys, so only a missing value allows to search in the next shard
+            if (res.ResultCode != VaultOperationResultCode::WrongValue) break;
+        }
+
+        return res;
+    }
+
+    template <class T>
+    VaultOperationResult ShardedVault::GetRecords(const std::string& key, const T& keyValue, std::vector<VaultRecordRef>& recordsRefs, const std::size_t& amountOfRecords) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        std::vector<VaultRecordRef> shardRecordsRefs;
+        std::vector<VaultRecordRef> foundRecordsRefs;
+
+        // Lock ShardedVault to read
+        ReadLock<ReadWriteMutex> readLock(ShardsMtx);
+
+        if (!ShardKey.empty() && key == ShardKey && ShardKeyType == typeid(T))
+            return Shards[GetShardIndex(&keyValue)]->GetRecords(key, keyValue, recordsRefs, amountOfRecords);
+
+        for (const std::unique_ptr<Vault>& shard : Shards)
+        {
+            if (foundRecordsRefs.size() >= amountOfRecords) break;
+
+            res = shard->GetRecords(key, keyValue, shardRecordsRefs, amountOfRecords - foundRecordsRefs.size());
+
+            if (res.ResultCode == VaultOperationResultCode::WrongValue) continue;
+            if (!res.IsOperationSuccess) return res;
+
+            foundRecordsRefs.insert(foundRecordsRefs.end(), shardRecordsRefs.begin(), shardRecordsRefs.end());
+        }
+
+        if (!foundRecordsRefs.empty())
+        {
+            res.IsOperationSuccess = true;
+            res.ResultCode = VaultOperationResultCode::Success;
+        }
+
+        recordsRefs.swap(foundRecordsRefs);
+
+        return res;
+    }
+
+    template <VaultRequestType Type>
+    VaultOperationResult ShardedVault::Request(const VaultRequest<Type>& request, std::vector<VaultRecordRef>& recordsRefs) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        std::vector<VaultRecordRef> foundRecordsRefs;
+
+        // Lock ShardedVault to read
+        ReadLock<ReadWriteMutex> readLock(ShardsMtx);
+
+        for (const std::unique_ptr<Vault>& shard : Shards)
+        {
+            res = shard->Scan(request, [&](const VaultRecordRef& ref) -> bool
+            {
+                foundRecordsRefs.emplace_back(ref);
+                return true;
+            });
+
+            if (!res.IsOperationSuccess) return res;
+        }
+
+        recordsRefs.swap(foundRecordsRefs);
+
+        return res;
+    }
+
+    template <VaultRequestType Type>
+    VaultOperationResult ShardedVault::Count(const VaultRequest<Type>& request, std::size_t& count) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        std::size_t shardCount = 0, totalCount = 0;
+
+        // Lock ShardedVault to read
+        ReadLock<ReadWriteMutex> readLock(ShardsMtx);
+
+        for (const std::unique_ptr<Vault>& shard : Shards)
+        {
+            res = shard->Count(request, shardCount);
+            if (!res.IsOperationSuccess) return res;
+
+            totalCount += shardCount;
+        }
+
+        count = totalCount;
+
+        return res;
+    }
+
+    template <class T>
+    VaultOperationResult ShardedVault::GetSortedRecords(const std::string& key, std::vector<VaultRecordRef>& recordsRefs, const bool& isReverse,
+        const std::size_t& amountOfRecords) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        res.Key = key;
+        res.RequestedType = typeid(T);
+
+        // Lock ShardedVault to read
+        ReadLock<ReadWriteMutex> readLock(ShardsMtx);
+
+        std::type_index keyType = typeid(void);
+        if (!Shards.front()->GetKeyType(key, keyType))
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongKey;
+            return res;
+        }
+
+        if (keyType != typeid(T))
+        {
+            res.SavedType = keyType;
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongType;
+            return res;
+        }
+
+        // Sorted records of each shard with copies of the key values. Values are copied under the shard lock,
+        // so they can be compared without locks while other threads change records
+        std::vector<std::vector<std::pair<T, VaultRecordRef>>> shardsRecords(Shards.size());
+        for (std::size_t i = 0; i < Shards.size(); ++i)
+        {
+            std::vector<std::pair<T, VaultRecordRef>>& shardRecords = shardsRecords[i];
+            Shards[i]->SortBy(key, [&](const VaultRecordRef& ref) -> bool
+            {
+                shardRecords.emplace_back(ref.VaultRecordPtr->GetDataRef<T>(key), ref);
+                return true;
+            }, isReverse, amountOfRecords);
+        }
+
+        // Positions of the next records in the shards
+        std::vector<std::size_t> positions(Shards.size(), 0);
+
+        // Heap of shards with the next record of the merged result on the top
+        std::vector<std::size_t> shardsHeap;
+        for (std::size_t i = 0; i < Shards.size(); ++i)
+            if (!shardsRecords[i].empty()) shardsHeap.emplace_back(i);
+
+        auto compareShards = [&](const std::size_t& a, const std::size_t& b) -> bool
+        {
+            const T& aValue = shardsRecords[a][positions[a]].first;
+            const T& bValue = shardsRecords[b][positions[b]].first;
+            return isReverse ? aValue < bValue : bValue < aValue;
+        };
+
+        std::make_heap(shardsHeap.begin(), shardsHeap.end(), compareShards);
+
+        std::vector<VaultRecordRef> sortedRecordsRefs;
+        while (!shardsHeap.empty() && sortedRecordsRefs.size() < amountOfRecords)
+        {
+            std::pop_heap(shardsHeap.begin(), shardsHeap.end(), compareShards);
+            std::size_t shardIndex = shardsHeap.back();
+
+            sortedRecordsRefs.emplace_back(shardsRecords[shardIndex][positions[shardIndex]].second);
+
+            if (++positions[shardIndex] < shardsRecords[shardIndex].size())
+                std::push_heap(shardsHeap.begin(), shardsHeap.end(), compareShards);
+            else
+                shardsHeap.pop_back();
+        }
+
+        recordsRefs.swap(sortedRecordsRefs);
+
+        res.SavedType = keyType;
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        return res;
+    }
+
+    template <class T>
+    VaultOperationResult ShardedVault::EraseRecord(const std::string& key, const T& keyValue) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+
+        // Lock ShardedVault to read. Shards lock themselves to write
+        ReadLock<ReadWriteMutex> readLock(ShardsMtx);
+
+        if (!ShardKey.empty() && key == ShardKey && ShardKeyType == typeid(T))
+            return Shards[GetShardIndex(&keyValue)]->EraseRecord(key, keyValue);
+
+        for (const std::unique_ptr<Vault>& shard : Shards)
+        {
+            res = shard->EraseRecord(key, keyValue);
+
+            // All shards have the same keys, so only a missing value allows to search in the next shard
+            if (res.ResultCode != VaultOperationResultCode::WrongValue) break;
+        }
+
+        return res;
+    }
+}
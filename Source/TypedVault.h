@@ -0,0 +1,470 @@
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_set>
+
+#include "Map.h"
+#include "VaultClasses.h"
+#include "ReadWriteMutex.h"
+#include "VaultOperationResult.h"
+
+namespace mvlt
+{
+    /// \brief Enum with kinds of TypedVault keys
+    enum class TypedKeyKind : std::uint8_t
+    {
+        NonUnique, ///< Many records can have the same key value
+        Unique     ///< Each record must have its own key value
+    };
+
+    /**
+        \brief Base class for the TypedVault key descriptions
+
+        Each key of TypedVault is described by an empty struct derived from this class.
+        The struct must also have a static Name method with the name of the key:
+
+        \code
+        struct Id : TypedField<int, TypedKeyKind::Unique> { static const char* Name() noexcept { return "Id"; } };
+        struct UserName : TypedField<std::string> { static const char* Name() noexcept { return "UserName"; } };
+
+        TypedVault<Id, UserName> vlt;
+        \endcode
+
+        \tparam <T> Key type. Any type except for c arrays
+        \tparam <Kind> Kind of the key
+    */
+    template <class T, TypedKeyKind Kind = TypedKeyKind::NonUnique>
+    struct TypedField
+    {
+        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value.");
+
+        /// Key type
+        using Type = T;
+
+        /// Is key unique
+        static constexpr bool IsUnique = Kind == TypedKeyKind::Unique;
+    };
+
+    template <class T, TypedKeyKind Kind>
+    constexpr bool TypedField<T, Kind>::IsUnique;
+
+    /**
+        \brief A class for getting the position of the key in the TypedVault keys list at compile time
+
+        \tparam <F> Required key
+        \tparam <Fields> All keys of TypedVault
+    */
+    template <class F, class... Fields>
+    struct TypedFieldIndex;
+
+    /// \brief Specialization for the case when F is not in the keys list
+    template <class F>
+    struct TypedFieldIndex<F>
+    {
+        static_assert(sizeof(F) == 0, "The key is not in the TypedVault keys list.");
+    };
+
+    /// \brief Specialization for the case when F is the first key in the keys list
+    template <class F, class... Rest>
+    struct TypedFieldIndex<F, F, Rest...> : std::integral_constant<std::size_t, 0> {};
+
+    /// \brief Specialization for the case when F is not the first key in the keys list
+    template <class F, class First, class... Rest>
+    struct TypedFieldIndex<F, First, Rest...> : std::integral_constant<std::size_t, 1 + TypedFieldIndex<F, Rest...>::value> {};
+
+    /**
+        \brief The default predicate for the TypedVault requests. It accepts all records
+    */
+    struct TypedRequestAnyRecord
+    {
+        /**
+            \brief Operator to check the record
+
+            \return Always returns true
+        */
+        template <class Record>
+        bool operator()(const Record&) const noexcept
+        {
+            return true;
+        }
+    };
+
+    template <class... Fields>
+    class TypedVault;
+
+    /**
+        \brief A class for storing one record of TypedVault
+
+        The record is a plain struct with all key values placed in std::tuple.
+        The values can only be changed by TypedVault, because they have to be synchronized with the TypedVault indexes.
+
+        \tparam <Fields> All keys of TypedVault
+    */
+    template <class... Fields>
+    class TypedRecord
+    {
+    private:
+        // Values of all keys in the order of the Fields
+        std::tuple<typename Fields::Type...> Values;
+
+    public:
+        /// Making the TypedVault class friendly so that it has access to the internal members of the TypedRecord class
+        friend class TypedVault<Fields...>;
+
+        /**
+            \brief Constructor
+
+            \param [in] values values of all keys in the order of the Fields
+        */
+        explicit TypedRecord(const typename Fields::Type&... values) noexcept : Values(values...) {}
+
+        /**
+            \brief A template method for getting the key value
+
+            The key position is resolved at compile time.
+
+            \tparam <F> Required key
+
+            \return Const ref to the key value
+        */
+        template <class F>
+        const typename F::Type& GetData() const noexcept
+        {
+            return std::get<TypedFieldIndex<F, Fields...>::value>(Values);
+        }
+    };
+
+    /**
+        \brief A class for storing records with a schema known at compile time
+
+        The class works like Vault, but the keys are set as template parameters instead of strings, so the key
+        lookup is resolved to the tuple position at compile time. There is no DataSaver type erasure, no std::function
+        adders, erasers and sorters and no runtime type checks: each key has its own typed hash map and map,
+        and records are plain structs.
+
+        Request results are filled as vectors of pointers to records. The pointers remain valid until the record is erased or the TypedVault is dropped.
+        To change the values of records, the TypedVault::SetData method is used.
+
+        \tparam <Fields> Keys of TypedVault. Each key must be derived from TypedField
+    */
+    template <class... Fields>
+    class TypedVault
+    {
+    public:
+        /// Type of records inside TypedVault
+        using Record = TypedRecord<Fields...>;
+
+    private:
+        // Structures for quick search by one key
+        template <class F>
+        struct KeyIndex
+        {
+            // Hash map with the key value as key and record as value
+            UnorderedMap<typename F::Type, Record*> HashMap;
+
+            // B+tree with the key value as key and record as value
+            Map<typename F::Type, Record*> TreeMap;
+
+            // Constructor
+            KeyIndex() noexcept : HashMap(!F::IsUnique), TreeMap(!F::IsUnique) {}
+        };
+
+        // Tag for iterating over the keys at compile time
+        template <std::size_t I>
+        using FieldTag = std::integral_constant<std::size_t, I>;
+
+        // Tag for the end of the keys list
+        using EndFieldTag = FieldTag<sizeof...(Fields)>;
+
+        // Indexes of all keys in the order of the Fields
+        mutable std::tuple<KeyIndex<Fields>...> Indexes;
+
+        // Set of all records
+        std::unordered_set<Record*> RecordsSet;
+
+        // Mutex for thread safety
+        mutable RecursiveReadWriteMutex RecursiveReadWriteMtx;
+
+        // A method for getting the index of the F key
+        template <class F>
+        KeyIndex<F>& GetIndex() const noexcept;
+
+        // A method for getting the name of the first unique key whose value of the record is already used by another record. Returns nullptr if there is no such key
+        template <std::size_t I>
+        const char* FindUsedUniqueValue(const Record* record, FieldTag<I>) const noexcept;
+
+        // The end of FindUsedUniqueValue recursion
+        const char* FindUsedUniqueValue(const Record* record, EndFieldTag) const noexcept;
+
+        // A method for adding the record to the indexes of all keys
+        template <std::size_t I>
+        void AddToIndexes(Record* record, FieldTag<I>) noexcept;
+
+        // The end of AddToIndexes recursion
+        void AddToIndexes(Record* record, EndFieldTag) noexcept;
+
+        // A method for removing the record from the index of the F key
+        template <class F>
+        void EraseFromIndex(Record* record) noexcept;
+
+        // A method for removing the record from the indexes of all keys
+        template <std::size_t I>
+        void EraseFromIndexes(Record* record, FieldTag<I>) noexcept;
+
+        // The end of EraseFromIndexes recursion
+        void EraseFromIndexes(Record* record, EndFieldTag) noexcept;
+
+        // A method for clearing the indexes of all keys
+        template <std::size_t I>
+        void ClearIndexes(FieldTag<I>) noexcept;
+
+        // The end of ClearIndexes recursion
+        void ClearIndexes(EndFieldTag) noexcept;
+
+        // A method for deleting the record and removing it from all structures
+        void RemoveRecord(Record* record) noexcept;
+
+        // A method for filling the result of request to the F key
+        template <class F, class Predicat>
+        VaultOperationResult RequestRecords(const VaultRequestType& requestType, const typename F::Type& beginKeyValue,
+            const typename F::Type& endKeyValue, std::vector<const Record*>& records, const bool& isIncludeBeginKeyValue,
+            const bool& isIncludeEndKeyValue, const std::size_t& amountOfRecords, const Predicat& requestPredicat) const noexcept;
+
+    public:
+        /// \brief Default constructor
+        TypedVault() noexcept = default;
+
+        /**
+            \brief Copy constructor
+
+            \param [in] other object to copy
+        */
+        TypedVault(const TypedVault& other) noexcept;
+
+        /**
+            \brief Assignment operator
+
+            \param [in] other object to copy
+
+            \return Returns a reference to the TypedVault after assignment
+        */
+        TypedVault& operator=(const TypedVault& other) noexcept;
+
+        /**
+            \brief A method for creating a new record
+
+            \param [in] values values of all keys in the order of the Fields
+
+            \return VaultOperationResult object with CreateRecord result. If the value of the unique key is already in TypedVault,
+            the Key will be the name of this key and the ResultCode will be VaultOperationResultCode::UniqueKeyValueAlredyInSet
+        */
+        VaultOperationResult CreateRecord(const typename Fields::Type&... values) noexcept;
+
+        /**
+            \brief A method for creating a new record and getting a pointer to it
+
+            \param [out] record the ref to the pointer to the new record. If the record was not created, the parameter will not change
+            \param [in] values values of all keys in the order of the Fields
+
+            \return VaultOperationResult object with CreateRecord result
+        */
+        VaultOperationResult CreateRecord(const Record*& record, const typename Fields::Type&... values) noexcept;
+
+        /**
+            \brief A template method for changing the value of the key in the record
+
+            \tparam <F> Key to change
+
+            \param [in] record pointer to the record of this TypedVault
+            \param [in] data new key value
+
+            \return VaultOperationResult object with SetData result
+        */
+        template <class F>
+        VaultOperationResult SetData(const Record* record, const typename F::Type& data) noexcept;
+
+        /**
+            \brief The method for getting a record with the key value
+
+            \tparam <F> Key to search by
+
+            \param [in] keyValue the key value to search for
+            \param [out] record the ref to the pointer to the found record. If the record is not found, the parameter will not change
+
+            \return VaultOperationResult object with GetRecord result
+        */
+        template <class F>
+        VaultOperationResult GetRecord(const typename F::Type& keyValue, const Record*& record) const noexcept;
+
+        /**
+            \brief The method for getting records with the key value
+
+            \tparam <F> Key to search by
+
+            \param [in] keyValue the key value to search for
+            \param [out] records the ref to the vector of found records. All previous data will be deleted
+            \param [in] amountOfRecords the number of records to search for
+
+            \return VaultOperationResult object with GetRecords result
+        */
+        template <class F>
+        VaultOperationResult GetRecords(const typename F::Type& keyValue, std::vector<const Record*>& records,
+            const std::size_t& amountOfRecords = -1) const noexcept;
+
+        /**
+            \brief A method for getting all records that have a value equal to keyValue
+
+            \tparam <F> Key to search by
+            \tparam <Predicat> Type of the predicate. It must be callable with const Record& and return bool
+
+            \param [in] keyValue the key value to search for
+            \param [out] records the ref to the vector of found records. All previous data will be deleted
+            \param [in] amountOfRecords the number of records to search for
+            \param [in] requestPredicat the predicate for filtering records
+
+            \return VaultOperationResult object with request result
+        */
+        template <class F, class Predicat = TypedRequestAnyRecord>
+        VaultOperationResult RequestEqual(const typename F::Type& keyValue, std::vector<const Record*>& records,
+            const std::size_t& amountOfRecords = -1, const Predicat& requestPredicat = Predicat()) const noexcept;
+
+        /**
+            \brief A method for getting all records that have a value greater than keyValue
+
+            \tparam <F> Key to search by
+            \tparam <Predicat> Type of the predicate. It must be callable with const Record& and return bool
+
+            \param [in] keyValue the key value to compare with
+            \param [out] records the ref to the vector of found records. All previous data will be deleted
+            \param [in] amountOfRecords the number of records to search for
+            \param [in] requestPredicat the predicate for filtering records
+
+            \return VaultOperationResult object with request result
+        */
+        template <class F, class Predicat = TypedRequestAnyRecord>
+        VaultOperationResult RequestGreater(const typename F::Type& keyValue, std::vector<const Record*>& records,
+            const std::size_t& amountOfRecords = -1, const Predicat& requestPredicat = Predicat()) const noexcept;
+
+        /**
+            \brief A method for getting all records that have a value greater than or equal to keyValue
+
+            \tparam <F> Key to search by
+            \tparam <Predicat> Type of the predicate. It must be callable with const Record& and return bool
+
+            \param [in] keyValue the key value to compare with
+            \param [out] records the ref to the vector of found records. All previous data will be deleted
+            \param [in] amountOfRecords the number of records to search for
+            \param [in] requestPredicat the predicate for filtering records
+
+            \return VaultOperationResult object with request result
+        */
+        template <class F, class Predicat = TypedRequestAnyRecord>
+        VaultOperationResult RequestGreaterOrEqual(const typename F::Type& keyValue, std::vector<const Record*>& records,
+            const std::size_t& amountOfRecords = -1, const Predicat& requestPredicat = Predicat()) const noexcept;
+
+        /**
+            \brief A method for getting all records that have a value less than keyValue
+
+            \tparam <F> Key to search by
+            \tparam <Predicat> Type of the predicate. It must be callable with const Record& and return bool
+
+            \param [in] keyValue the key value to compare with
+            \param [out] records the ref to the vector of found records. All previous data will be deleted
+            \param [in] amountOfRecords the number of records to search for
+            \param [in] requestPredicat the predicate for filtering records
+
+            \return VaultOperationResult object with request result
+        */
+        template <class F, class Predicat = TypedRequestAnyRecord>
+        VaultOperationResult RequestLess(const typename F::Type& keyValue, std::vector<const Record*>& records,
+            const std::size_t& amountOfRecords = -1, const Predicat& requestPredicat = Predicat()) const noexcept;
+
+        /**
+            \brief A method for getting all records that have a value less than or equal to keyValue
+
+            \tparam <F> Key to search by
+            \tparam <Predicat> Type of the predicate. It must be callable with const Record& and return bool
+
+            \param [in] keyValue the key value to compare with
+            \param [out] records the ref to the vector of found records. All previous data will be deleted
+            \param [in] amountOfRecords the number of records to search for
+            \param [in] requestPredicat the predicate for filtering records
+
+            \return VaultOperationResult object with request result
+        */
+        template <class F, class Predicat = TypedRequestAnyRecord>
+        VaultOperationResult RequestLessOrEqual(const typename F::Type& keyValue, std::vector<const Record*>& records,
+            const std::size_t& amountOfRecords = -1, const Predicat& requestPredicat = Predicat()) const noexcept;
+
+        /**
+            \brief The method for getting the result of the interval request
+
+            \tparam <F> Key to search by
+            \tparam <Predicat> Type of the predicate. It must be callable with const Record& and return bool
+
+            \param [in] beginKeyValue the left boundary of the interval
+            \param [in] endKeyValue the right boundary of the interval
+            \param [out] records the ref to the vector of found records. All previous data will be deleted
+            \param [in] isIncludeBeginKeyValue is beginKeyValue included in the interval
+            \param [in] isIncludeEndKeyValue is endKeyValue included in the interval
+            \param [in] amountOfRecords the number of records to search for
+            \param [in] requestPredicat the predicate for filtering records
+
+            \return VaultOperationResult object with request result
+        */
+        template <class F, class Predicat = TypedRequestAnyRecord>
+        VaultOperationResult RequestInterval(const typename F::Type& beginKeyValue, const typename F::Type& endKeyValue,
+            std::vector<const Record*>& records, const bool& isIncludeBeginKeyValue = true, const bool& isIncludeEndKeyValue = true,
+            const std::size_t& amountOfRecords = -1, const Predicat& requestPredicat = Predicat()) const noexcept;
+
+        /**
+            \brief The method for erasing the record
+
+            \param [in] record pointer to the record of this TypedVault
+
+            \return VaultOperationResult object with EraseRecord result
+        */
+        VaultOperationResult EraseRecord(const Record* record) noexcept;
+
+        /**
+            \brief The method for erasing the first record with the key value
+
+            \tparam <F> Key to search by
+
+            \param [in] keyValue the key value of the record to erase
+
+            \return VaultOperationResult object with EraseRecord result
+        */
+        template <class F>
+        VaultOperationResult EraseRecord(const typename F::Type& keyValue) noexcept;
+
+        /**
+            \brief The method for erasing records with the key value
+
+            \tparam <F> Key to search by
+
+            \param [in] keyValue the key value of records to erase
+            \param [in] amountOfRecords the number of records to erase
+
+            \return VaultOperationResult object with EraseRecords result
+        */
+        template <class F>
+        VaultOperationResult EraseRecords(const typename F::Type& keyValue, const std::size_t& amountOfRecords = -1) noexcept;
+
+        /**
+            \brief A method for getting the number of records
+
+            \return number of records
+        */
+        std::size_t Size() const noexcept;
+
+        /// \brief A method for deleting all records
+        void DropData() noexcept;
+
+        /// \brief Destructor
+        ~TypedVault() noexcept;
+    };
+}
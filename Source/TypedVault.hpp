@@ -0,0 +1,519 @@
+#pragma once
+
+#include "TypedVault.h"
+
+namespace mvlt
+{
+    template <class... Fields>
+    template <class F>
+    typename TypedVault<Fields...>::template KeyIndex<F>& TypedVault<Fields...>::GetIndex() const noexcept
+    {
+        return std::get<TypedFieldIndex<F, Fields...>::value>(Indexes);
+    }
+
+    template <class... Fields>
+    template <std::size_t I>
+    const char* TypedVault<Fields...>::FindUsedUniqueValue(const Record* record, FieldTag<I>) const noexcept
+    {
+        using F = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+
+        if (F::IsUnique)
+        {
+            KeyIndex<F>& index = GetIndex<F>();
+            auto it = index.HashMap.Find(std::get<I>(record->Values));
+            if (it != index.HashMap.End() && (*it).second != record)
+                return F::Name();
+        }
+
+        return FindUsedUniqueValue(record, FieldTag<I + 1>());
+    }
+
+    template <class... Fields>
+    const char* TypedVault<Fields...>::FindUsedUniqueValue(const Record* record, EndFieldTag) const noexcept
+    {
+        return nullptr;
+    }
+
+    template <class... Fields>
+    template <std::size_t I>
+    void TypedVault<Fields...>::AddToIndexes(Record* record, FieldTag<I>) noexcept
+    {
+        using F = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+
+        KeyIndex<F>& index = GetIndex<F>();
+        index.HashMap.Emplace(std::get<I>(record->Values), record);
+        index.TreeMap.Emplace(std::get<I>(record->Values), record);
+
+        AddToIndexes(record, FieldTag<I + 1>());
+    }
+
+    template <class... Fields>
+    void TypedVault<Fields...>::AddToIndexes(Record* record, EndFieldTag) noexcept {}
+
+    template <class... Fields>
+    template <class F>
+    void TypedVault<Fields...>::EraseFromIndex(Record* record) noexcept
+    {
+        KeyIndex<F>& index = GetIndex<F>();
+        const typename F::Type& keyValue = record->template GetData<F>();
+
+        // Find record and erase it from hash map
+        auto hashMapRange = index.HashMap.EqualRange(keyValue);
+        for (auto it = hashMapRange.first; it != hashMapRange.second; ++it)
+        {
+            if ((*it).second == record)
+            {
+                index.HashMap.Erase(it);
+                break;
+            }
+        }
+
+        // Erase record from map. Records with the same key value are ordered by pointer, so it is found without iterating over them
+        index.TreeMap.Erase(keyValue, record);
+    }
+
+    template <class... Fields>
+    template <std::size_t I>
+    void TypedVault<Fields...>::EraseFromIndexes(Record* record, FieldTag<I>) noexcept
+    {
+        EraseFromIndex<typename std::tuple_element<I, std::tuple<Fields...>>::type>(record);
+        EraseFromIndexes(record, FieldTag<I + 1>());
+    }
+
+    template <class... Fields>
+    void TypedVault<Fields...>::EraseFromIndexes(Record* record, EndFieldTag) noexcept {}
+
+    template <class... Fields>
+    template <std::size_t I>
+    void TypedVault<Fields...>::ClearIndexes(FieldTag<I>) noexcept
+    {
+        std::get<I>(Indexes).HashMap.Clear();
+        std::get<I>(Indexes).TreeMap.Clear();
+        ClearIndexes(FieldTag<I + 1>());
+    }
+
+    template <class... Fields>
+    void TypedVault<Fields...>::ClearIndexes(EndFieldTag) noexcept {}
+
+    template <class... Fields>
+    void TypedVault<Fields...>::RemoveRecord(Record* record) noexcept
+    {
+        EraseFromIndexes(record, FieldTag<0>());
+        RecordsSet.erase(record);
+        delete record;
+    }
+
+    template <class... Fields>
+    template <class F, class Predicat>
+    VaultOperationResult TypedVault<Fields...>::RequestRecords(const VaultRequestType& requestType, const typename F::Type& beginKeyValue,
+        const typename F::Type& endKeyValue, std::vector<const Record*>& records, const bool& isIncludeBeginKeyValue,
+        const bool& isIncludeEndKeyValue, const std::size_t& amountOfRecords, const Predicat& requestPredicat) const noexcept
+    {
+        VaultOperationResult res;
+        res.Key = F::Name();
+        res.RequestedType = typeid(typename F::Type);
+        res.SavedType = res.RequestedType;
+
+        records.clear();
+
+        // Lock TypedVault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        KeyIndex<F>& index = GetIndex<F>();
+        std::size_t counter = 0;
+
+        // Check if request type is equal
+        if (requestType == VaultRequestType::Equal)
+        {
+            auto equalRange = index.HashMap.EqualRange(beginKeyValue);
+            for (auto it = equalRange.first; it != equalRange.second; ++it)
+            {
+                if (counter >= amountOfRecords) break;
+
+                if (requestPredicat(static_cast<const Record&>(*(*it).second)))
+                    records.emplace_back((*it).second);
+
+                ++counter;
+            }
+        }
+        else
+        {
+            // Iterator to set it in switch
+            decltype(index.TreeMap.End()) startIt{}, endIt{};
+
+            // Switch by request type
+            switch (requestType)
+            {
+            case VaultRequestType::GreaterOrEqual:
+                startIt = index.TreeMap.LowerBound(beginKeyValue);
+                endIt = index.TreeMap.End();
+                break;
+
+            case VaultRequestType::Greater:
+                startIt = index.TreeMap.UpperBound(beginKeyValue);
+                endIt = index.TreeMap.End();
+                break;
+
+            case VaultRequestType::Less:
+                startIt = index.TreeMap.Begin();
+                endIt = index.TreeMap.LowerBound(endKeyValue);
+                break;
+
+            case VaultRequestType::LessOrEqual:
+                startIt = index.TreeMap.Begin();
+                endIt = index.TreeMap.UpperBound(endKeyValue);
+                break;
+
+            case VaultRequestType::Interval:
+                if (beginKeyValue > endKeyValue || (beginKeyValue == endKeyValue && (isIncludeBeginKeyValue == false || isIncludeEndKeyValue == false)))
+                {
+                    startIt = index.TreeMap.End();
+                    endIt = index.TreeMap.End();
+                    break;
+                }
+
+                if(isIncludeBeginKeyValue) startIt = index.TreeMap.LowerBound(beginKeyValue);
+                else startIt = index.TreeMap.UpperBound(beginKeyValue);
+                if(isIncludeEndKeyValue) endIt = index.TreeMap.UpperBound(endKeyValue);
+                else endIt = index.TreeMap.LowerBound(endKeyValue);
+                break;
+
+            case VaultRequestType::Equal:
+            case VaultRequestType::Or:
+            case VaultRequestType::And:
+            default:
+                startIt = index.TreeMap.End();
+                endIt = index.TreeMap.End();
+                break;
+            }
+
+            for (auto it = startIt; it != endIt; ++it)
+            {
+                if (counter >= amountOfRecords) break;
+
+                if (requestPredicat(static_cast<const Record&>(*(*it).second)))
+                    records.emplace_back((*it).second);
+
+                ++counter;
+            }
+        }
+
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        return res;
+    }
+
+    template <class... Fields>
+    TypedVault<Fields...>::TypedVault(const TypedVault& other) noexcept
+    {
+        *this = other;
+    }
+
+    template <class... Fields>
+    TypedVault<Fields...>& TypedVault<Fields...>::operator=(const TypedVault& other) noexcept
+    {
+        if (&other == this) return *this;
+
+        DropData();
+
+        // Lock both TypedVaults
+        ReadLock<RecursiveReadWriteMutex> otherReadLock(other.RecursiveReadWriteMtx);
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        for (const Record* otherRecord : other.RecordsSet)
+        {
+            Record* newRecord = new Record(*otherRecord);
+            RecordsSet.emplace(newRecord);
+            AddToIndexes(newRecord, FieldTag<0>());
+        }
+
+        return *this;
+    }
+
+    template <class... Fields>
+    VaultOperationResult TypedVault<Fields...>::CreateRecord(const typename Fields::Type&... values) noexcept
+    {
+        const Record* record = nullptr;
+        return CreateRecord(record, values...);
+    }
+
+    template <class... Fields>
+    VaultOperationResult TypedVault<Fields...>::CreateRecord(const Record*& record, const typename Fields::Type&... values) noexcept
+    {
+        VaultOperationResult res;
+
+        // Lock TypedVault to write
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        Record* newRecord = new Record(values...);
+
+        // Check that all unique values are free
+        const char* usedKey = FindUsedUniqueValue(newRecord, FieldTag<0>());
+        if (usedKey != nullptr)
+        {
+            delete newRecord;
+
+            res.Key = usedKey;
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::UniqueKeyValueAlredyInSet;
+            return res;
+        }
+
+        RecordsSet.emplace(newRecord);
+        AddToIndexes(newRecord, FieldTag<0>());
+        record = newRecord;
+
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        return res;
+    }
+
+    template <class... Fields>
+    template <class F>
+    VaultOperationResult TypedVault<Fields...>::SetData(const Record* record, const typename F::Type& data) noexcept
+    {
+        VaultOperationResult res;
+        res.Key = F::Name();
+        res.RequestedType = typeid(typename F::Type);
+        res.SavedType = res.RequestedType;
+
+        // Lock TypedVault to write
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        Record* recordPtr = const_cast<Record*>(record);
+
+        // Check that record belongs to this TypedVault
+        if (RecordsSet.find(recordPtr) == RecordsSet.end())
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::DataRecordNotValid;
+            return res;
+        }
+
+        typename F::Type& recordData = std::get<TypedFieldIndex<F, Fields...>::value>(recordPtr->Values);
+
+        if (recordData == data)
+        {
+            res.IsOperationSuccess = true;
+            res.ResultCode = VaultOperationResultCode::Success;
+            return res;
+        }
+
+        KeyIndex<F>& index = GetIndex<F>();
+
+        // Check unique value
+        if (F::IsUnique && index.HashMap.Find(data) != index.HashMap.End())
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::UniqueKeyValueAlredyInSet;
+            return res;
+        }
+
+        EraseFromIndex<F>(recordPtr);
+
+        recordData = data;
+
+        index.HashMap.Emplace(recordData, recordPtr);
+        index.TreeMap.Emplace(recordData, recordPtr);
+
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        return res;
+    }
+
+    template <class... Fields>
+    template <class F>
+    VaultOperationResult TypedVault<Fields...>::GetRecord(const typename F::Type& keyValue, const Record*& record) const noexcept
+    {
+        VaultOperationResult res;
+        res.Key = F::Name();
+        res.RequestedType = typeid(typename F::Type);
+        res.SavedType = res.RequestedType;
+
+        // Lock TypedVault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        KeyIndex<F>& index = GetIndex<F>();
+
+        auto it = index.HashMap.Find(keyValue);
+        if (it != index.HashMap.End())
+        {
+            record = (*it).second;
+
+            res.IsOperationSuccess = true;
+            res.ResultCode = VaultOperationResultCode::Success;
+        }
+        else
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongValue;
+        }
+
+        return res;
+    }
+
+    template <class... Fields>
+    template <class F>
+    VaultOperationResult TypedVault<Fields...>::GetRecords(const typename F::Type& keyValue, std::vector<const Record*>& records,
+        const std::size_t& amountOfRecords) const noexcept
+    {
+        VaultOperationResult res = RequestEqual<F>(keyValue, records, amountOfRecords);
+
+        if (records.empty())
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongValue;
+        }
+
+        return res;
+    }
+
+    template <class... Fields>
+    template <class F, class Predicat>
+    VaultOperationResult TypedVault<Fields...>::RequestEqual(const typename F::Type& keyValue, std::vector<const Record*>& records,
+        const std::size_t& amountOfRecords, const Predicat& requestPredicat) const noexcept
+    {
+        return RequestRecords<F>(VaultRequestType::Equal, keyValue, keyValue, records, true, true, amountOfRecords, requestPredicat);
+    }
+
+    template <class... Fields>
+    template <class F, class Predicat>
+    VaultOperationResult TypedVault<Fields...>::RequestGreater(const typename F::Type& keyValue, std::vector<const Record*>& records,
+        const std::size_t& amountOfRecords, const Predicat& requestPredicat) const noexcept
+    {
+        return RequestRecords<F>(VaultRequestType::Greater, keyValue, keyValue, records, false, false, amountOfRecords, requestPredicat);
+    }
+
+    template <class... Fields>
+    template <class F, class Predicat>
+    VaultOperationResult TypedVault<Fields...>::RequestGreaterOrEqual(const typename F::Type& keyValue, std::vector<const Record*>& records,
+        const std::size_t& amountOfRecords, const Predicat& requestPredicat) const noexcept
+    {
+        return RequestRecords<F>(VaultRequestType::GreaterOrEqual, keyValue, keyValue, records, true, false, amountOfRecords, requestPredicat);
+    }
+
+    template <class... Fields>
+    template <class F, class Predicat>
+    VaultOperationResult TypedVault<Fields...>::RequestLess(const typename F::Type& keyValue, std::vector<const Record*>& records,
+        const std::size_t& amountOfRecords, const Predicat& requestPredicat) const noexcept
+    {
+        return RequestRecords<F>(VaultRequestType::Less, keyValue, keyValue, records, false, false, amountOfRecords, requestPredicat);
+    }
+
+    template <class... Fields>
+    template <class F, class Predicat>
+    VaultOperationResult TypedVault<Fields...>::RequestLessOrEqual(const typename F::Type& keyValue, std::vector<const Record*>& records,
+        const std::size_t& amountOfRecords, const Predicat& requestPredicat) const noexcept
+    {
+        return RequestRecords<F>(VaultRequestType::LessOrEqual, keyValue, keyValue, records, false, true, amountOfRecords, requestPredicat);
+    }
+
+    template <class... Fields>
+    template <class F, class Predicat>
+    VaultOperationResult TypedVault<Fields...>::RequestInterval(const typename F::Type& beginKeyValue, const typename F::Type& endKeyValue,
+        std::vector<const Record*>& records, const bool& isIncludeBeginKeyValue, const bool& isIncludeEndKeyValue,
+        const std::size_t& amountOfRecords, const Predicat& requestPredicat) const noexcept
+    {
+        return RequestRecords<F>(VaultRequestType::Interval, beginKeyValue, endKeyValue, records, isIncludeBeginKeyValue, isIncludeEndKeyValue, amountOfRecords, requestPredicat);
+    }
+
+    template <class... Fields>
+    VaultOperationResult TypedVault<Fields...>::EraseRecord(const Record* record) noexcept
+    {
+        VaultOperationResult res;
+
+        // Lock TypedVault to write
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        Record* recordPtr = const_cast<Record*>(record);
+
+        // Check that record belongs to this TypedVault
+        if (RecordsSet.find(recordPtr) == RecordsSet.end())
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::DataRecordNotValid;
+            return res;
+        }
+
+        RemoveRecord(recordPtr);
+
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        return res;
+    }
+
+    template <class... Fields>
+    template <class F>
+    VaultOperationResult TypedVault<Fields...>::EraseRecord(const typename F::Type& keyValue) noexcept
+    {
+        return EraseRecords<F>(keyValue, 1);
+    }
+
+    template <class... Fields>
+    template <class F>
+    VaultOperationResult TypedVault<Fields...>::EraseRecords(const typename F::Type& keyValue, const std::size_t& amountOfRecords) noexcept
+    {
+        VaultOperationResult res;
+        res.Key = F::Name();
+        res.RequestedType = typeid(typename F::Type);
+        res.SavedType = res.RequestedType;
+
+        // Lock TypedVault to write
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        KeyIndex<F>& index = GetIndex<F>();
+
+        // Collect records first because erasing invalidates iterators
+        std::vector<Record*> recordsToErase;
+        auto equalRange = index.HashMap.EqualRange(keyValue);
+        for (auto it = equalRange.first; it != equalRange.second; ++it)
+        {
+            if (recordsToErase.size() >= amountOfRecords) break;
+            recordsToErase.emplace_back((*it).second);
+        }
+
+        if (recordsToErase.empty())
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongValue;
+            return res;
+        }
+
+        for (Record* record : recordsToErase)
+            RemoveRecord(record);
+
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        return res;
+    }
+
+    template <class... Fields>
+    std::size_t TypedVault<Fields...>::Size() const noexcept
+    {
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+        return RecordsSet.size();
+    }
+
+    template <class... Fields>
+    void TypedVault<Fields...>::DropData() noexcept
+    {
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        for (Record* record : RecordsSet)
+            delete record;
+
+        RecordsSet.clear();
+        ClearIndexes(FieldTag<0>());
+    }
+
+    template <class... Fields>
+    TypedVault<Fields...>::~TypedVault() noexcept
+    {
+        DropData();
+    }
+}
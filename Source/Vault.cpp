@@ -1,4 +1,5 @@
 #include "Vault.h"
+#include "VaultTransaction.h"
 
 #include "Vault.hpp"
 #include "VaultRequest.hpp"
@@ -6,14 +7,215 @@
 
 namespace mvlt
 {
-    std::unordered_set<VaultRecord*>::iterator Vault::RemoveRecord(VaultRecord* recordToErase, bool* wasDeleted) noexcept
+    std::atomic<std::size_t> Vault::KeysVersionCounter(0);
+
+    void Vault::UpdateKeysVersion() noexcept
+    {
+        DBG_LOG_ENTER();
+
+        KeysVersion = ++KeysVersionCounter;
+    }
+
+    void Vault::BuildLazyKeyIndex(const std::string& key) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        // Vault always keeps its indexes filled
+        if (VaultDerivedClass == VaultDerivedClasses::VaultBase) return;
+
+        std::lock_guard<std::mutex> lock(LazyKeyIndexersMtx);
+
+        auto lazyKeyIndexerIt = LazyKeyIndexers.find(key);
+        if (lazyKeyIndexerIt == LazyKeyIndexers.end()) return;
+
+        lazyKeyIndexerIt->second(const_cast<Vault*>(this));
+        LazyKeyIndexers.erase(lazyKeyIndexerIt);
+    }
+
+    void Vault::AddToCompositeIndexes(VaultRecord* record) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (CompositeIndex* index : CompositeIndexes)
+            index->Emplace(record);
+    }
+
+    void Vault::AddToCompositeIndexes(VaultRecord* record, const std::string& key) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (CompositeIndex* index : CompositeIndexes)
+            if (index->IsKeyInIndex(key)) index->Emplace(record);
+    }
+
+    void Vault::EraseFromCompositeIndexes(VaultRecord* record) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (CompositeIndex* index : CompositeIndexes)
+            index->Erase(record);
+    }
+
+    void Vault::EraseFromCompositeIndexes(VaultRecord* record, const std::string& key) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (CompositeIndex* index : CompositeIndexes)
+            if (index->IsKeyInIndex(key)) index->Erase(record);
+    }
+
+    void Vault::CopyCompositeIndexes(const Vault& other) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (const CompositeIndex* otherIndex : other.CompositeIndexes)
+        {
+            std::vector<const DataColumn*> columns;
+            for (const std::string& key : otherIndex->GetKeys())
+                columns.emplace_back(Storage->GetColumn(key));
+
+            CompositeIndexes.emplace_back(new CompositeIndex(otherIndex->GetKeys(), columns, otherIndex->GetIndexPolicy()));
+        }
+    }
+
+    void Vault::DeleteCompositeIndexes() noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (CompositeIndex* index : CompositeIndexes)
+            delete index;
+
+        CompositeIndexes.clear();
+    }
+
+    void Vault::AddToGroupAggregates(VaultRecord* record) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (GroupAggregate* aggregate : GroupAggregates)
+            aggregate->Emplace(record);
+    }
+
+    void Vault::AddToGroupAggregates(VaultRecord* record, const std::string& key) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (GroupAggregate* aggregate : GroupAggregates)
+            if (aggregate->IsKeyInAggregate(key)) aggregate->Emplace(record);
+    }
+
+    void Vault::EraseFromGroupAggregates(VaultRecord* record) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (GroupAggregate* aggregate : GroupAggregates)
+            aggregate->Erase(record);
+    }
+
+    void Vault::EraseFromGroupAggregates(VaultRecord* record, const std::string& key) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (GroupAggregate* aggregate : GroupAggregates)
+            if (aggregate->IsKeyInAggregate(key)) aggregate->Erase(record);
+    }
+
+    void Vault::CopyGroupAggregates(const Vault& other) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (const GroupAggregate* otherAggregate : other.GroupAggregates)
+        {
+            GroupAggregate* aggregate = new GroupAggregate(otherAggregate->GetGroupKey(), otherAggregate->GetValueKey(),
+                Storage->GetColumn(otherAggregate->GetGroupKey()), Storage->GetColumn(otherAggregate->GetValueKey()));
+            aggregate->CopyTypes(*otherAggregate);
+
+            GroupAggregates.emplace_back(aggregate);
+        }
+    }
+
+    void Vault::DeleteGroupAggregates() noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (GroupAggregate* aggregate : GroupAggregates)
+            delete aggregate;
+
+        GroupAggregates.clear();
+    }
+
+    void Vault::AddToLockFreeReadIndex(VaultRecord* record) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        LockFreeReadIndexBase* index = LockFreeIndex.load();
+        if (index != nullptr) index->AddRecord(record);
+    }
+
+    void Vault::EraseFromLockFreeReadIndex(VaultRecord* record) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        LockFreeReadIndexBase* index = LockFreeIndex.load();
+        if (index != nullptr) index->EraseRecord(record);
+    }
+
+    void Vault::RebuildLockFreeReadIndex() noexcept
+    {
+        DBG_LOG_ENTER();
+
+        LockFreeReadIndexBase* index = LockFreeIndex.load();
+        if (index == nullptr) return;
+
+        index->SetKeys(KeysOrder);
+        for (VaultRecord* record : RecordsSet)
+            index->AddRecord(record);
+    }
+
+    void Vault::CopyLockFreeReadIndex(const Vault& other) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        const LockFreeReadIndexBase* otherIndex = other.LockFreeIndex.load();
+        if (otherIndex == nullptr) return;
+
+        if (Epochs.load() == nullptr) Epochs.store(new EpochManager);
+
+        LockFreeReadIndexBase* index = otherIndex->Clone(Epochs.load());
+        index->SetKeys(KeysOrder);
+        LockFreeIndex.store(index);
+    }
+
+    void Vault::DeleteLockFreeReadIndex() noexcept
+    {
+        DBG_LOG_ENTER();
+
+        LockFreeReadIndexBase* index = LockFreeIndex.exchange(nullptr);
+        if (index == nullptr) return;
+
+        EpochManager* epochs = Epochs.load();
+        epochs->Retire(index);
+        epochs->TryReclaim();
+    }
+
+    GroupAggregate* Vault::FindGroupAggregate(const std::string& groupKey, const std::string& valueKey) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (GroupAggregate* aggregate : GroupAggregates)
+            if (aggregate->GetGroupKey() == groupKey && aggregate->GetValueKey() == valueKey) return aggregate;
+
+        return nullptr;
+    }
+
+    VaultRecordBitmap::iterator Vault::RemoveRecord(VaultRecord* recordToErase, bool* wasDeleted) noexcept
     {
         DBG_LOG_ENTER();
 
         // Lock Vault to write
         WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
 
-        std::unordered_set<VaultRecord*>::iterator dataIt = RecordsSet.find(recordToErase);
+        VaultRecordBitmap::iterator dataIt = RecordsSet.find(recordToErase);
         if (dataIt == RecordsSet.end())
         {
             if (wasDeleted != nullptr) *wasDeleted = false;
@@ -24,19 +226,308 @@ namespace mvlt
         for (auto& eraser : VaultRecordErasers)
             eraser.second(recordToErase);
 
+        EraseFromCompositeIndexes(recordToErase);
+        EraseFromGroupAggregates(recordToErase);
+        EraseFromLockFreeReadIndex(recordToErase);
+
         dataIt = RecordsSet.erase(dataIt);
 
+        // In VaultRecordSet "if" before this line will not called because type saved in VaultDerivedClass variable
         if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
-        {
-            // In VaultRecordSet "if" before this line will not called because type saved in VaultDerivedClass variable
-            recordToErase->RemoveFromDependentSets();
-            recordToErase->Invalidate();
-        }
+            ReleaseDetachedRecord(recordToErase);
 
         if (wasDeleted != nullptr) *wasDeleted = true;
         return dataIt;
     }
 
+    void Vault::DetachRecord(VaultRecord* record) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (auto& eraser : VaultRecordErasers)
+            eraser.second(record);
+
+        EraseFromCompositeIndexes(record);
+        EraseFromGroupAggregates(record);
+        EraseFromLockFreeReadIndex(record);
+
+        RecordsSet.erase(record);
+    }
+
+    void Vault::AttachRecord(VaultRecord* record) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        RecordsSet.emplace(record);
+
+        for (auto& adder : VaultRecordAdders)
+            adder.second(record);
+
+        AddToCompositeIndexes(record);
+        AddToGroupAggregates(record);
+        AddToLockFreeReadIndex(record);
+    }
+
+    void Vault::ReleaseDetachedRecord(VaultRecord* record) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        record->RemoveFromDependentSets();
+        Storage->FreeRow(record->Row);
+        record->Invalidate();
+    }
+
+    std::size_t Vault::BackupRecordData(const VaultRecord* record, const std::vector<std::string>& keys) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        std::size_t backupRow = Storage->AllocateRow();
+        for (const std::string& key : keys)
+        {
+            DataColumn* column = Storage->GetColumn(key);
+            if (column != nullptr) column->CopyRow(backupRow, *column, record->Row);
+        }
+
+        return backupRow;
+    }
+
+    void Vault::RestoreRecordData(VaultRecord* record, const std::vector<std::string>& keys, const std::size_t& backupRow) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        // Old values were consistent with the other records, so they can not be rejected by a unique key
+        for (const std::string& key : keys)
+            VaultRecordErasers.find(key)->second(record);
+
+        EraseFromCompositeIndexes(record);
+        EraseFromGroupAggregates(record);
+
+        for (VaultRecordSet* set : record->dependentVaultRecordSets)
+            for (const std::string& key : keys)
+                set->VaultRecordErasers.find(key)->second(record);
+
+        for (const std::string& key : keys)
+            Storage->GetColumn(key)->CopyRow(record->Row, *Storage->GetColumn(key), backupRow);
+
+        for (const std::string& key : keys)
+            VaultRecordAdders.find(key)->second(record);
+
+        AddToCompositeIndexes(record);
+        AddToGroupAggregates(record);
+        AddToLockFreeReadIndex(record);
+
+        for (VaultRecordSet* set : record->dependentVaultRecordSets)
+            for (const std::string& key : keys)
+                set->VaultRecordAdders.find(key)->second(record);
+
+        Storage->FreeRow(backupRow);
+    }
+
+    void Vault::FreeBackupRow(const std::size_t& backupRow) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        Storage->FreeRow(backupRow);
+    }
+
+    void Vault::PrepareRecordSet(VaultRecordSet& vaultRecordSet) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        // If it is Vault object
+        if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
+        {
+            // Save vaultRecordSet. Other readers can save their sets at the same time
+            {
+                std::lock_guard<std::mutex> lock(DependentSetsMtx);
+                RecordSetsSet.emplace(&vaultRecordSet);
+            }
+
+            // Remove old data from vaultRecordSet
+            if (vaultRecordSet.ParentVault != this)
+            {
+                vaultRecordSet.Reset();
+
+                // Set new parent vault to vaultRecordSet
+                vaultRecordSet.ParentVault = const_cast<Vault*>(this);
+
+                // Copy keys from this to vaultRecordSet
+                for (auto& keyCopierIt : VaultKeyCopiers)
+                    keyCopierIt.second(&vaultRecordSet);
+
+                // Set proper key order
+                vaultRecordSet.KeysOrder = KeysOrder;
+
+                // Set unique keys
+                vaultRecordSet.UniqueKeys = UniqueKeys;
+            }
+            else vaultRecordSet.Clear();
+        }
+    }
+
+    VaultOperationResult Vault::CheckRequestKey(const std::string& key, const std::type_index& keyType) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        res.Key = key;
+        res.RequestedType = keyType;
+
+        // If key not exist
+        if (!GetKeyType(key, res.SavedType))
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongKey;
+            return res;
+        }
+
+        // Check types
+        if (res.SavedType != res.RequestedType)
+        {
+            res.IsOperationSuccess = false;
+            res.SetOpResult(VaultOperationResultCode::WrongType);
+            return res;
+        }
+
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+        return res;
+    }
+
+    bool Vault::RequestByCompositeIndex(const std::vector<VaultRequestCondition>& conditions, const std::function<bool(VaultRecord* record)>& func) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        // Wrong keys and types are reported by the usual request
+        for (const VaultRequestCondition& condition : conditions)
+        {
+            auto keyTypeIt = KeysTypes.find(condition.Key);
+            if (keyTypeIt == KeysTypes.end() || keyTypeIt->second != condition.Value.GetDataType())
+                return false;
+        }
+
+        // Check if there is a condition with key and one of request types
+        auto isConditionExist = [&](const std::string& key, const VaultRequestType& type1, const VaultRequestType& type2)
+        {
+            for (const VaultRequestCondition& condition : conditions)
+                if (condition.Key == key && (condition.RequestType == type1 || condition.RequestType == type2))
+                    return true;
+
+            return false;
+        };
+
+        // Find the index which covers the most conditions
+        const CompositeIndex* bestIndex = nullptr;
+        std::size_t bestPrefixSize = 0, bestCoveredCount = 1;
+        for (const CompositeIndex* index : CompositeIndexes)
+        {
+            const std::vector<std::string>& keys = index->GetKeys();
+
+            // Count first keys with Equal conditions
+            std::size_t prefixSize = 0;
+            while (prefixSize < keys.size() && isConditionExist(keys[prefixSize], VaultRequestType::Equal, VaultRequestType::Equal))
+                ++prefixSize;
+
+            // Hash map requires values of all keys
+            if (prefixSize == 0 || (!index->IsOrderedIndexed() && prefixSize != keys.size())) continue;
+
+            // The B+tree also limits the next key by range conditions
+            std::size_t coveredCount = prefixSize;
+            if (prefixSize < keys.size())
+            {
+                if (isConditionExist(keys[prefixSize], VaultRequestType::Greater, VaultRequestType::GreaterOrEqual)) ++coveredCount;
+                if (isConditionExist(keys[prefixSize], VaultRequestType::Less, VaultRequestType::LessOrEqual)) ++coveredCount;
+            }
+
+            if (coveredCount > bestCoveredCount)
+            {
+                bestIndex = index;
+                bestPrefixSize = prefixSize;
+                bestCoveredCount = coveredCount;
+            }
+        }
+
+        if (bestIndex == nullptr) return false;
+
+        const std::vector<std::string>& keys = bestIndex->GetKeys();
+
+        // Conditions checked by the index
+        std::vector<bool> isUsedCondition(conditions.size(), false);
+
+        // Values of first keys
+        CompositeKey prefix;
+        for (std::size_t i = 0; i < bestPrefixSize; ++i)
+        {
+            for (std::size_t j = 0; j < conditions.size(); ++j)
+            {
+                if (!isUsedCondition[j] && conditions[j].Key == keys[i] && conditions[j].RequestType == VaultRequestType::Equal)
+                {
+                    prefix.AddPart(conditions[j].Value);
+                    isUsedCondition[j] = true;
+                    break;
+                }
+            }
+        }
+
+        // Range of the next key
+        const CompositeKeyPart* beginValue = nullptr;
+        const CompositeKeyPart* endValue = nullptr;
+        bool isBeginIncluded = false, isEndIncluded = false;
+        if (bestPrefixSize < keys.size())
+        {
+            for (std::size_t j = 0; j < conditions.size(); ++j)
+            {
+                if (isUsedCondition[j] || conditions[j].Key != keys[bestPrefixSize]) continue;
+
+                switch (conditions[j].RequestType)
+                {
+                case VaultRequestType::Greater:
+                case VaultRequestType::GreaterOrEqual:
+                    if (beginValue != nullptr) break;
+                    beginValue = &conditions[j].Value;
+                    isBeginIncluded = conditions[j].RequestType == VaultRequestType::GreaterOrEqual;
+                    isUsedCondition[j] = true;
+                    break;
+                case VaultRequestType::Less:
+                case VaultRequestType::LessOrEqual:
+                    if (endValue != nullptr) break;
+                    endValue = &conditions[j].Value;
+                    isEndIncluded = conditions[j].RequestType == VaultRequestType::LessOrEqual;
+                    isUsedCondition[j] = true;
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+
+        // Columns of conditions not checked by the index
+        std::vector<const DataColumn*> columns(conditions.size(), nullptr);
+        for (std::size_t j = 0; j < conditions.size(); ++j)
+            if (!isUsedCondition[j]) columns[j] = Storage->GetColumn(conditions[j].Key);
+
+        CompositeKeyPart keyValue;
+        Vault* vlt = const_cast<Vault*>(this);
+        bestIndex->RequestRecords(prefix, beginValue, isBeginIncluded, endValue, isEndIncluded, [&](VaultRecord* record)
+            {
+                for (std::size_t j = 0; j < conditions.size(); ++j)
+                {
+                    if (columns[j] != nullptr)
+                    {
+                        columns[j]->GetCompositeKeyPart(record->Row, keyValue);
+                        if (!conditions[j].IsMatch(keyValue)) return true;
+                    }
+
+                    if (conditions[j].RequestPredicat != nullptr && !(*conditions[j].RequestPredicat)(VaultRecordRef(record, vlt)))
+                        return true;
+                }
+
+                return func(record);
+            });
+
+        return true;
+    }
+
     bool Vault::ReadFile(const std::string& fileName, const bool& isPreprocessRecord,
             const char& separator, const bool& isLoadKeys, const std::vector<std::string>& userKeys,
             const std::function<void (const std::vector<std::string>& keys, std::vector<std::string>& values)>& recordHandler) noexcept
@@ -67,7 +558,7 @@ namespace mvlt
             ++lineCounter;
 
             // Record to set to it data from file and store in Vault
-            VaultRecord* newRecord = new VaultRecord(RecordTemplate);
+            VaultRecord* newRecord = Arena->CreateRecord(Storage);
 
             bool isCorrectRecordInFile = false;
 
@@ -137,7 +628,8 @@ namespace mvlt
 
             if (!isCorrectRecordInFile) 
             {
-                delete newRecord;
+                Storage->FreeRow(newRecord->Row);
+                Arena->ReleaseRecord(newRecord);
                 continue;
             }
 
@@ -163,7 +655,8 @@ namespace mvlt
 
                 // codechecker_intentional [all] false positive warning from clangsa
                 InvalidFileRecords.emplace_back(lineCounter, *uniqueKeyIt);
-                delete newRecord;
+                Storage->FreeRow(newRecord->Row);
+                Arena->ReleaseRecord(newRecord);
             }
             else
             {
@@ -173,6 +666,10 @@ namespace mvlt
                 // Add new record to every maps inside VaultStructureHashMap
                 for (const auto& vaultRecordAddersIt : VaultRecordAdders)
                     vaultRecordAddersIt.second(newRecord);
+
+                AddToCompositeIndexes(newRecord);
+                AddToGroupAggregates(newRecord);
+                AddToLockFreeReadIndex(newRecord);
             }
         }
 
@@ -183,6 +680,10 @@ namespace mvlt
     {
         DBG_LOG_ENTER();
 
+        Storage = new VaultColumnStorage;
+        Arena = new VaultRecordArena;
+        UpdateKeysVersion();
+
         VaultDerivedClass = VaultDerivedClasses::VaultBase;
     }
 
@@ -192,6 +693,9 @@ namespace mvlt
 
         ReadLock<RecursiveReadWriteMutex> readLock(other.RecursiveReadWriteMtx);
 
+        Storage = new VaultColumnStorage;
+        Arena = new VaultRecordArena;
+        UpdateKeysVersion();
         VaultDerivedClass = VaultDerivedClasses::VaultBase;
 
         // Copy keys
@@ -204,10 +708,16 @@ namespace mvlt
         // Set unique keys
         UniqueKeys = other.UniqueKeys;
 
+        // Create composite indexes, group aggregates and lock-free read index. They are filled when records are copied
+        CopyCompositeIndexes(other);
+        CopyGroupAggregates(other);
+        CopyLockFreeReadIndex(other);
+
         for (VaultRecord* recordPtr : other.RecordsSet)
         {
-            // Allocate space to new record and copy data to it
-            VaultRecord* newRecord = new VaultRecord(*recordPtr);
+            // Allocate row to new record and copy data to it
+            VaultRecord* newRecord = Arena->CreateRecord(Storage);
+            newRecord->CopyData(*recordPtr, KeysOrder);
             
             // Add new record to set
             RecordsSet.emplace(newRecord);
@@ -215,6 +725,10 @@ namespace mvlt
             // Add new record to every maps inside VaultStructureHashMap
             for (const auto& vaultRecordAddersIt : VaultRecordAdders)
                 vaultRecordAddersIt.second(newRecord);
+
+            AddToCompositeIndexes(newRecord);
+            AddToGroupAggregates(newRecord);
+            AddToLockFreeReadIndex(newRecord);
         }
     }
 
@@ -241,10 +755,16 @@ namespace mvlt
             // Set unique keys
             UniqueKeys = other.UniqueKeys;
 
+            // Create composite indexes, group aggregates and lock-free read index. They are filled when records are copied
+            CopyCompositeIndexes(other);
+            CopyGroupAggregates(other);
+            CopyLockFreeReadIndex(other);
+
             for (VaultRecord* recordPtr : other.RecordsSet)
             {
-                // Allocate space to new record and copy data to it
-                VaultRecord* newRecord = new VaultRecord(*recordPtr);
+                // Allocate row to new record and copy data to it
+                VaultRecord* newRecord = Arena->CreateRecord(Storage);
+                newRecord->CopyData(*recordPtr, KeysOrder);
                 
                 // Add new record to set
                 RecordsSet.emplace(newRecord);
@@ -252,6 +772,10 @@ namespace mvlt
                 // Add new record to every maps inside VaultStructureHashMap
                 for (const auto& vaultRecordAddersIt : VaultRecordAdders)
                     vaultRecordAddersIt.second(newRecord);
+
+                AddToCompositeIndexes(newRecord);
+                AddToGroupAggregates(newRecord);
+                AddToLockFreeReadIndex(newRecord);
             }
         }
 
@@ -266,17 +790,36 @@ namespace mvlt
 
         VaultDerivedClass = VaultDerivedClasses::VaultBase;
 
+        // Records from other point to other storage and arena, so take them and leave other with empty ones
+        Storage = other.Storage;
+        other.Storage = new VaultColumnStorage;
+        Arena = other.Arena;
+        other.Arena = new VaultRecordArena;
+
+        // KeyHandles of other point to moved structures
+        UpdateKeysVersion();
+        other.UpdateKeysVersion();
+
         RecordTemplate = std::move(other.RecordTemplate);
         VaultHashMapStructure = std::move(other.VaultHashMapStructure);
         VaultMapStructure = std::move(other.VaultMapStructure);
+        VaultIndexHandlesStructure = std::move(other.VaultIndexHandlesStructure);
         KeysTypes = std::move(other.KeysTypes);
         VaultRecordAdders = std::move(other.VaultRecordAdders);
+        VaultRecordRangeAdders = std::move(other.VaultRecordRangeAdders);
         VaultRecordClearers = std::move(other.VaultRecordClearers);
         VaultRecordErasers = std::move(other.VaultRecordErasers);
         VaultRecordSorters = std::move(other.VaultRecordSorters);
         VaultKeyCopiers = std::move(other.VaultKeyCopiers);
         KeysOrder = std::move(other.KeysOrder);
         UniqueKeys = std::move(other.UniqueKeys);
+        CompositeIndexes = std::move(other.CompositeIndexes);
+        other.CompositeIndexes.clear();
+        GroupAggregates = std::move(other.GroupAggregates);
+        other.GroupAggregates.clear();
+        // The index keeps pointer to its epoch manager, so they are moved together
+        Epochs.store(other.Epochs.exchange(nullptr));
+        LockFreeIndex.store(other.LockFreeIndex.exchange(nullptr));
         InvalidFileRecords = std::move(other.InvalidFileRecords);
         RecordsSet = std::move(other.RecordsSet);
         RecordSetsSet = std::move(other.RecordSetsSet);
@@ -294,17 +837,34 @@ namespace mvlt
 
             VaultDerivedClass = VaultDerivedClasses::VaultBase;
 
+            // Records from other point to other storage and arena, so swap them with the empty ones from this
+            std::swap(Storage, other.Storage);
+            std::swap(Arena, other.Arena);
+
+            // KeyHandles of other point to moved structures
+            other.UpdateKeysVersion();
+
             RecordTemplate = std::move(other.RecordTemplate);
             VaultHashMapStructure = std::move(other.VaultHashMapStructure);
             VaultMapStructure = std::move(other.VaultMapStructure);
+            VaultIndexHandlesStructure = std::move(other.VaultIndexHandlesStructure);
             KeysTypes = std::move(other.KeysTypes);
             VaultRecordAdders = std::move(other.VaultRecordAdders);
+            VaultRecordRangeAdders = std::move(other.VaultRecordRangeAdders);
             VaultRecordClearers = std::move(other.VaultRecordClearers);
             VaultRecordErasers = std::move(other.VaultRecordErasers);
             VaultRecordSorters = std::move(other.VaultRecordSorters);
             VaultKeyCopiers = std::move(other.VaultKeyCopiers);
             KeysOrder = std::move(other.KeysOrder);
             UniqueKeys = std::move(other.UniqueKeys);
+            CompositeIndexes = std::move(other.CompositeIndexes);
+            other.CompositeIndexes.clear();
+            GroupAggregates = std::move(other.GroupAggregates);
+            other.GroupAggregates.clear();
+            // The index keeps pointer to its epoch manager, so they are moved together. Objects retired by DropVault go to other
+            EpochManager* epochs = Epochs.exchange(other.Epochs.exchange(nullptr));
+            other.Epochs.store(epochs);
+            LockFreeIndex.store(other.LockFreeIndex.exchange(nullptr));
             InvalidFileRecords = std::move(other.InvalidFileRecords);
             RecordsSet = std::move(other.RecordsSet);
             RecordSetsSet = std::move(other.RecordSetsSet);
@@ -336,93 +896,500 @@ namespace mvlt
         else
             res = false;
 
-        return res;
+        return res;
+    }
+
+    std::vector<std::string> Vault::GetKeys() const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        std::vector<std::string> res(KeysOrder.size());
+
+        std::size_t counter = 0;
+        for (const std::string& key : KeysOrder) res[counter++] = key;
+
+        return res;
+    }
+
+    std::vector<std::string> Vault::GetUniqueKeys() const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        std::vector<std::string> res(UniqueKeys.size());
+
+        std::size_t counter = 0;
+        for (const std::string& key : UniqueKeys) res[counter++] = key;
+
+        return res;
+    }
+
+    bool Vault::RemoveKey(const std::string& key) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        // Find key in hash map
+        auto foundedKeyInHashMapIt = KeysTypes.find(key);
+
+        // If key was not find return false
+        if (foundedKeyInHashMapIt == KeysTypes.end())
+            return false;
+
+        // Try to erase unique key
+        UniqueKeys.erase(key);
+
+        // Delete composite indexes with the key
+        for (auto compositeIndexIt = CompositeIndexes.begin(); compositeIndexIt != CompositeIndexes.end();)
+        {
+            if ((*compositeIndexIt)->IsKeyInIndex(key))
+            {
+                delete *compositeIndexIt;
+                compositeIndexIt = CompositeIndexes.erase(compositeIndexIt);
+            }
+            else ++compositeIndexIt;
+        }
+
+        // Delete group aggregates with the key
+        for (auto groupAggregateIt = GroupAggregates.begin(); groupAggregateIt != GroupAggregates.end();)
+        {
+            if ((*groupAggregateIt)->IsKeyInAggregate(key))
+            {
+                delete *groupAggregateIt;
+                groupAggregateIt = GroupAggregates.erase(groupAggregateIt);
+            }
+            else ++groupAggregateIt;
+        }
+
+        // Delete lock-free read index with the key
+        LockFreeReadIndexBase* lockFreeIndex = LockFreeIndex.load();
+        if (lockFreeIndex != nullptr && lockFreeIndex->GetKey() == key)
+            DeleteLockFreeReadIndex();
+
+        // Remove key from hash map with keys types
+        KeysTypes.erase(foundedKeyInHashMapIt);
+
+        // Remove key from list with key order
+        for (auto keysOrderIt = KeysOrder.begin(); keysOrderIt != KeysOrder.end(); ++keysOrderIt)
+        {
+            if (key == *keysOrderIt)
+            {
+                KeysOrder.erase(keysOrderIt);
+                break;
+            }
+        }
+
+        // Erase key from record template
+        RecordTemplate.EraseData(key);
+
+        // Erase key from VaultHashMapStructure
+        VaultHashMapStructure.EraseData(key);
+
+        // Erase key from VaultMapStructure
+        VaultMapStructure.EraseData(key);
+
+        // Erase key from VaultIndexHandlesStructure
+        VaultIndexHandlesStructure.EraseData(key);
+
+        // Invalidate KeyHandles with pointers to erased structures
+        UpdateKeysVersion();
+
+        // Erase key from all maps
+        VaultRecordAdders.erase(key);
+        VaultRecordRangeAdders.erase(key);
+        VaultRecordClearers.erase(key);
+        VaultRecordErasers.erase(key);
+        VaultRecordSorters.erase(key);
+        VaultKeyCopiers.erase(key);
+        LazyKeyIndexers.erase(key);
+
+        if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
+        {
+            // Erase key data from all records
+            Storage->RemoveColumn(key);
+
+            for (VaultRecordSet* set : RecordSetsSet)
+                set->RemoveKey(key);
+        }
+
+        // Snapshots must not contain the removed key
+        RebuildLockFreeReadIndex();
+
+        return true;
+    }
+
+    VaultOperationResult Vault::AddCompositeIndex(const std::vector<std::string>& keys, const VaultIndexPolicy& indexPolicy) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        res.IsOperationSuccess = false;
+
+        // Lock Vault to write
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        // Check that all keys exist and are different
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            res.Key = keys[i];
+
+            auto keyTypeIt = KeysTypes.find(keys[i]);
+            if (keyTypeIt == KeysTypes.end())
+            {
+                res.ResultCode = VaultOperationResultCode::WrongKey;
+                return res;
+            }
+
+            res.SavedType = keyTypeIt->second;
+
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                if (keys[j] == keys[i])
+                {
+                    res.ResultCode = VaultOperationResultCode::WrongCompositeIndex;
+                    return res;
+                }
+            }
+        }
+
+        res.Key.clear();
+        res.SavedType = typeid(void);
+
+        if (keys.size() < 2 || indexPolicy == VaultIndexPolicy::None)
+        {
+            res.ResultCode = VaultOperationResultCode::WrongCompositeIndex;
+            return res;
+        }
+
+        if (IsCompositeIndexExist(keys))
+        {
+            res.ResultCode = VaultOperationResultCode::DuplicateCompositeIndex;
+            return res;
+        }
+
+        std::vector<const DataColumn*> columns;
+        for (const std::string& key : keys)
+            columns.emplace_back(Storage->GetColumn(key));
+
+        // Create index and add all records to it
+        CompositeIndex* index = new CompositeIndex(keys, columns, indexPolicy);
+        for (VaultRecord* record : RecordsSet)
+            index->Emplace(record);
+
+        CompositeIndexes.emplace_back(index);
+
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+        return res;
+    }
+
+    bool Vault::IsCompositeIndexExist(const std::vector<std::string>& keys) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        for (const CompositeIndex* index : CompositeIndexes)
+            if (index->GetKeys() == keys) return true;
+
+        return false;
+    }
+
+    std::vector<std::vector<std::string>> Vault::GetCompositeIndexes() const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        std::vector<std::vector<std::string>> res;
+        for (const CompositeIndex* index : CompositeIndexes)
+            res.emplace_back(index->GetKeys());
+
+        return res;
+    }
+
+    bool Vault::RemoveCompositeIndex(const std::vector<std::string>& keys) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        for (auto compositeIndexIt = CompositeIndexes.begin(); compositeIndexIt != CompositeIndexes.end(); ++compositeIndexIt)
+        {
+            if ((*compositeIndexIt)->GetKeys() == keys)
+            {
+                delete *compositeIndexIt;
+                CompositeIndexes.erase(compositeIndexIt);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool Vault::IsGroupByExist(const std::string& groupKey, const std::string& valueKey) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        return FindGroupAggregate(groupKey, valueKey) != nullptr;
+    }
+
+    bool Vault::RemoveGroupBy(const std::string& groupKey, const std::string& valueKey) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        for (auto groupAggregateIt = GroupAggregates.begin(); groupAggregateIt != GroupAggregates.end(); ++groupAggregateIt)
+        {
+            if ((*groupAggregateIt)->GetGroupKey() == groupKey && (*groupAggregateIt)->GetValueKey() == valueKey)
+            {
+                delete *groupAggregateIt;
+                GroupAggregates.erase(groupAggregateIt);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::string Vault::GetLockFreeReadKey() const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        const LockFreeReadIndexBase* index = LockFreeIndex.load();
+        if (index == nullptr) return std::string();
+
+        return index->GetKey();
+    }
+
+    bool Vault::RemoveLockFreeReadKey() noexcept
+    {
+        DBG_LOG_ENTER();
+
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        if (LockFreeIndex.load() == nullptr) return false;
+
+        DeleteLockFreeReadIndex();
+        return true;
+    }
+
+    bool Vault::SetParamsToRecord(VaultRecord* newRecord, const std::vector<std::pair<std::string, VaultParamInput>>& params, const bool& isMoveParams, VaultOperationResult& res) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        for (const auto& paramsIt : params)
+        {
+            res.Key = paramsIt.first;
+            res.RequestedType = paramsIt.second.GetDataType();
+
+            // Check if key exist in record template
+            auto keyTypeIt = KeysTypes.find(paramsIt.first);
+            if (keyTypeIt != KeysTypes.end())
+            {
+                res.SavedType = keyTypeIt->second;
+
+                // Check if type in params match type in record template
+                if (res.SavedType == res.RequestedType)
+                {
+                    paramsIt.second.SetDataToRecord(paramsIt.first, newRecord, isMoveParams);
+                }
+                else
+                {   // If the type in param not match type in record template
+                    res.IsOperationSuccess = false;
+                    res.SetOpResult(VaultOperationResultCode::WrongType);
+                    return false;
+                }
+            }
+            else
+            {   // If key not exist then stop set data from params
+                res.IsOperationSuccess = false;
+                res.SavedType = typeid(void);
+                res.RequestedType = paramsIt.second.GetDataType();
+                res.ResultCode = VaultOperationResultCode::WrongKey;
+                return false;
+            }
+        }
+
+        return true;
     }
 
-    std::vector<std::string> Vault::GetKeys() const noexcept
+    VaultOperationResult Vault::SetDataToRecord(VaultRecord* dataRecord, const std::vector<std::pair<std::string, VaultParamInput>>& params, const bool& isMoveParams) noexcept
     {
         DBG_LOG_ENTER();
 
-        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+        VaultOperationResult res;
 
-        std::vector<std::string> res(KeysOrder.size());
+        // Lock Vault to write
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
 
-        std::size_t counter = 0;
-        for (const std::string& key : KeysOrder) res[counter++] = key;
+        // Check if dataRecord valid
+        if (dataRecord == nullptr || !dataRecord->GetIsValid())
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::DataRecordNotValid;
+            return res;
+        }
 
-        return res;
-    }
+        // Check all params before changing the record
+        std::vector<std::string> changedKeys;
+        bool isUniqueKeyChanged = false;
+        for (const auto& paramsIt : params)
+        {
+            res.Key = paramsIt.first;
+            res.RequestedType = paramsIt.second.GetDataType();
+            res.SavedType = typeid(void);
 
-    std::vector<std::string> Vault::GetUniqueKeys() const noexcept
-    {
-        DBG_LOG_ENTER();
+            // If key not exist
+            if (!GetKeyType(paramsIt.first, res.SavedType))
+            {
+                res.IsOperationSuccess = false;
+                res.ResultCode = VaultOperationResultCode::WrongKey;
+                return res;
+            }
 
-        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+            // Check types
+            if (res.SavedType != res.RequestedType)
+            {
+                res.IsOperationSuccess = false;
+                res.SetOpResult(VaultOperationResultCode::WrongType);
+                return res;
+            }
 
-        std::vector<std::string> res(UniqueKeys.size());
+            if (std::find(changedKeys.begin(), changedKeys.end(), paramsIt.first) == changedKeys.end())
+            {
+                changedKeys.emplace_back(paramsIt.first);
+                if (UniqueKeys.find(paramsIt.first) != UniqueKeys.end()) isUniqueKeyChanged = true;
+            }
+        }
 
-        std::size_t counter = 0;
-        for (const std::string& key : UniqueKeys) res[counter++] = key;
+        // Find composite indexes and group aggregates with changed keys
+        std::vector<CompositeIndex*> changedIndexes;
+        for (CompositeIndex* index : CompositeIndexes)
+        {
+            for (const std::string& key : changedKeys)
+            {
+                if (index->IsKeyInIndex(key))
+                {
+                    changedIndexes.emplace_back(index);
+                    break;
+                }
+            }
+        }
 
-        return res;
-    }
+        std::vector<GroupAggregate*> changedAggregates;
+        for (GroupAggregate* aggregate : GroupAggregates)
+        {
+            for (const std::string& key : changedKeys)
+            {
+                if (aggregate->IsKeyInAggregate(key))
+                {
+                    changedAggregates.emplace_back(aggregate);
+                    break;
+                }
+            }
+        }
 
-    bool Vault::RemoveKey(const std::string& key) noexcept
-    {
-        DBG_LOG_ENTER();
+        // Old values are saved to the spare row if the new values may be rejected by a unique key
+        std::size_t backupRow = 0;
+        if (isUniqueKeyChanged)
+        {
+            backupRow = Storage->AllocateRow();
+            for (const std::string& key : changedKeys)
+            {
+                DataColumn* column = Storage->GetColumn(key);
+                column->CopyRow(backupRow, *column, dataRecord->Row);
+            }
+        }
 
-        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+        // Erase record from the structures of changed keys while it still stores old values
+        for (const std::string& key : changedKeys)
+            VaultRecordErasers.find(key)->second(dataRecord);
 
-        // Find key in hash map
-        auto foundedKeyInHashMapIt = KeysTypes.find(key);
+        for (CompositeIndex* index : changedIndexes)
+            index->Erase(dataRecord);
 
-        // If key was not find return false
-        if (foundedKeyInHashMapIt == KeysTypes.end())
-            return false;
+        for (GroupAggregate* aggregate : changedAggregates)
+            aggregate->Erase(dataRecord);
 
-        // Try to erase unique key
-        UniqueKeys.erase(key);
+        for (VaultRecordSet* set : dataRecord->dependentVaultRecordSets)
+            for (const std::string& key : changedKeys)
+                set->VaultRecordErasers.find(key)->second(dataRecord);
 
-        // Remove key from hash map with keys types
-        KeysTypes.erase(foundedKeyInHashMapIt);
+        // Set new values
+        for (const auto& paramsIt : params)
+            paramsIt.second.SetDataToRecord(paramsIt.first, dataRecord, isMoveParams);
 
-        // Remove key from list with key order
-        for (auto keysOrderIt = KeysOrder.begin(); keysOrderIt != KeysOrder.end(); ++keysOrderIt)
+        // Adding unique keys first since only they may reject the new values
+        std::vector<std::string> addedUniqueKeys;
+        std::string incorrectUniqueKey;
+        for (const std::string& key : changedKeys)
         {
-            if (key == *keysOrderIt)
+            if (UniqueKeys.find(key) == UniqueKeys.end()) continue;
+
+            if (!VaultRecordAdders.find(key)->second(dataRecord))
             {
-                KeysOrder.erase(keysOrderIt);
+                incorrectUniqueKey = key;
                 break;
             }
+
+            addedUniqueKeys.emplace_back(key);
         }
 
-        // Erase key from record template
-        RecordTemplate.EraseData(key);
+        if (!incorrectUniqueKey.empty())
+        {
+            // Restore old values
+            for (const std::string& key : addedUniqueKeys)
+                VaultRecordErasers.find(key)->second(dataRecord);
 
-        // Erase key from VaultHashMapStructure
-        VaultHashMapStructure.EraseData(key);
+            for (const std::string& key : changedKeys)
+                Storage->GetColumn(key)->CopyRow(dataRecord->Row, *Storage->GetColumn(key), backupRow);
 
-        // Erase key from VaultMapStructure
-        VaultMapStructure.EraseData(key);
+            addedUniqueKeys.clear();
+        }
 
-        // Erase key from all maps
-        VaultRecordAdders.erase(key);
-        VaultRecordClearers.erase(key);
-        VaultRecordErasers.erase(key);
-        VaultRecordSorters.erase(key);
-        VaultKeyCopiers.erase(key);
+        // Add record to the structures of changed keys
+        for (const std::string& key : changedKeys)
+            if (std::find(addedUniqueKeys.begin(), addedUniqueKeys.end(), key) == addedUniqueKeys.end())
+                VaultRecordAdders.find(key)->second(dataRecord);
 
-        if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
-        {
-            // Erase key data from all records
-            for (const auto& recordsSetIt : RecordsSet)
-                recordsSetIt->EraseData(key);
+        for (CompositeIndex* index : changedIndexes)
+            index->Emplace(dataRecord);
 
-            for (VaultRecordSet* set : RecordSetsSet)
-                set->RemoveKey(key);
+        for (GroupAggregate* aggregate : changedAggregates)
+            aggregate->Emplace(dataRecord);
+
+        AddToLockFreeReadIndex(dataRecord);
+
+        for (VaultRecordSet* set : dataRecord->dependentVaultRecordSets)
+            for (const std::string& key : changedKeys)
+                set->VaultRecordAdders.find(key)->second(dataRecord);
+
+        if (isUniqueKeyChanged) Storage->FreeRow(backupRow);
+
+        if (!incorrectUniqueKey.empty())
+        {
+            res.IsOperationSuccess = false;
+            res.Key = incorrectUniqueKey;
+            res.SavedType = KeysTypes.find(incorrectUniqueKey)->second;
+            res.RequestedType = res.SavedType;
+            res.ResultCode = VaultOperationResultCode::UniqueKeyValueAlredyInSet;
+            return res;
         }
 
-        return true;
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        return res;
     }
 
     VaultOperationResult Vault::CreateRecord(const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept
@@ -430,59 +1397,45 @@ namespace mvlt
         DBG_LOG_ENTER();
 
         VaultRecordRef tmp;
-        return CreateRecord(tmp, params);
+        return CreateRecord(tmp, params, false);
     }
 
     VaultOperationResult Vault::CreateRecord(VaultRecordRef& vaultRecordRef, const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept
     {
         DBG_LOG_ENTER();
 
-        VaultOperationResult res;
+        return CreateRecord(vaultRecordRef, params, false);
+    }
 
-        // Lock Vault to write
-        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+    VaultOperationResult Vault::CreateRecord(std::vector<std::pair<std::string, VaultParamInput>>&& params) noexcept
+    {
+        DBG_LOG_ENTER();
 
-        // Variable to check params vec correctness
-        bool isCorrectParams = true;
+        VaultRecordRef tmp;
+        return CreateRecord(tmp, params, true);
+    }
 
-        // Create new record
-        VaultRecord* newRecord = new VaultRecord(RecordTemplate);
+    VaultOperationResult Vault::CreateRecord(VaultRecordRef& vaultRecordRef, std::vector<std::pair<std::string, VaultParamInput>>&& params) noexcept
+    {
+        DBG_LOG_ENTER();
 
-        for (const auto& paramsIt : params)
-        {
-            DataSaver ds;
+        return CreateRecord(vaultRecordRef, params, true);
+    }
 
-            res.Key = paramsIt.first;
-            res.RequestedType = paramsIt.second.GetDataType();
+    VaultOperationResult Vault::CreateRecord(VaultRecordRef& vaultRecordRef, const std::vector<std::pair<std::string, VaultParamInput>>& params, const bool& isMoveParams) noexcept
+    {
+        DBG_LOG_ENTER();
 
-            // Check if key exist in record template
-            if (newRecord->GetDataSaver(paramsIt.first, ds))
-            {
-                res.SavedType = KeysTypes.find(paramsIt.first)->second;
+        VaultOperationResult res;
 
-                // Check if type in params match type in record template
-                if (ds.GetDataType() == paramsIt.second.GetDataType())
-                {
-                    paramsIt.second.SetDataToRecord(paramsIt.first, newRecord);
-                }
-                else
-                {   // If the type in param not match type in record template
-                    res.IsOperationSuccess = false;
-                    res.SetOpResult(VaultOperationResultCode::WrongType);
-                    isCorrectParams = false;
-                    break;
-                }
-            }
-            else
-            {   // If key not exist then stop set data from params
-                res.IsOperationSuccess = false;
-                res.SavedType = typeid(void);
-                res.RequestedType = paramsIt.second.GetDataType();
-                res.ResultCode = VaultOperationResultCode::WrongKey;
-                isCorrectParams = false;
-                break;
-            }
-        }
+        // Lock Vault to write
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        // Create new record
+        VaultRecord* newRecord = Arena->CreateRecord(Storage);
+
+        // Variable to check params vec correctness
+        bool isCorrectParams = SetParamsToRecord(newRecord, params, isMoveParams, res);
 
         // If param vec correct than add new record
         if (isCorrectParams)
@@ -515,7 +1468,8 @@ namespace mvlt
                 res.SavedType = typeid(void);
                 res.RequestedType = KeysTypes.find(incorrectUniqueKey)->second;
                 res.ResultCode = VaultOperationResultCode::UniqueKeyValueAlredyInSet;
-                delete newRecord;
+                Storage->FreeRow(newRecord->Row);
+                Arena->ReleaseRecord(newRecord);
             }
             else
             {
@@ -526,6 +1480,10 @@ namespace mvlt
                 for (const auto& vaultRecordAddersIt : VaultRecordAdders)
                     vaultRecordAddersIt.second(newRecord);
 
+                AddToCompositeIndexes(newRecord);
+                AddToGroupAggregates(newRecord);
+                AddToLockFreeReadIndex(newRecord);
+
                 vaultRecordRef.SetRecord(newRecord, this);
 
                 res.IsOperationSuccess = true;
@@ -533,11 +1491,122 @@ namespace mvlt
                 res.ResultCode = VaultOperationResultCode::Success;
             }
         }
-        else delete newRecord;
+        else
+        {
+            Storage->FreeRow(newRecord->Row);
+            Arena->ReleaseRecord(newRecord);
+        }
+
+        return res;
+    }
+
+    VaultOperationResult Vault::CreateRecords(const std::vector<std::vector<std::pair<std::string, VaultParamInput>>>& recordsParams) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        std::vector<VaultRecordRef> tmp;
+        return CreateRecords(tmp, recordsParams);
+    }
+
+    VaultOperationResult Vault::CreateRecords(std::vector<VaultRecordRef>& vaultRecordRefs, const std::vector<std::vector<std::pair<std::string, VaultParamInput>>>& recordsParams) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        vaultRecordRefs.clear();
+
+        // Lock Vault to write once for all records
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        std::vector<VaultRecord*> newRecords;
+        newRecords.reserve(recordsParams.size());
+        Storage->ReserveRows(recordsParams.size());
+
+        // Create new records and check params. Records are not added anywhere until all of them are correct
+        bool isCorrectParams = true;
+        for (const auto& params : recordsParams)
+        {
+            VaultRecord* newRecord = Arena->CreateRecord(Storage);
+            newRecords.emplace_back(newRecord);
+
+            isCorrectParams = SetParamsToRecord(newRecord, params, false, res);
+            if (!isCorrectParams) break;
+        }
+
+        // Adding unique keys. Values of each key are checked all together before they are added
+        std::vector<std::string> addedUniqueKeys;
+        if (isCorrectParams)
+        {
+            for (const std::string& uniqueKey : UniqueKeys)
+            {
+                if (!VaultRecordRangeAdders.find(uniqueKey)->second(newRecords))
+                {
+                    res.IsOperationSuccess = false;
+                    res.Key = uniqueKey;
+                    res.SavedType = typeid(void);
+                    res.RequestedType = KeysTypes.find(uniqueKey)->second;
+                    res.ResultCode = VaultOperationResultCode::UniqueKeyValueAlredyInSet;
+                    isCorrectParams = false;
+                    break;
+                }
+
+                addedUniqueKeys.emplace_back(uniqueKey);
+            }
+        }
+
+        if (!isCorrectParams)
+        {
+            // Remove records from added unique keys
+            for (const std::string& uniqueKey : addedUniqueKeys)
+            {
+                auto eraserIt = VaultRecordErasers.find(uniqueKey);
+                for (VaultRecord* newRecord : newRecords)
+                    eraserIt->second(newRecord);
+            }
+
+            for (VaultRecord* newRecord : newRecords)
+            {
+                Storage->FreeRow(newRecord->Row);
+                Arena->ReleaseRecord(newRecord);
+            }
+
+            return res;
+        }
+
+        // Add new records to every other key structures
+        for (const auto& vaultRecordRangeAddersIt : VaultRecordRangeAdders)
+            if (UniqueKeys.find(vaultRecordRangeAddersIt.first) == UniqueKeys.end())
+                vaultRecordRangeAddersIt.second(newRecords);
+
+        vaultRecordRefs.reserve(newRecords.size());
+
+        for (VaultRecord* newRecord : newRecords)
+        {
+            RecordsSet.emplace(newRecord);
+
+            AddToCompositeIndexes(newRecord);
+            AddToGroupAggregates(newRecord);
+            AddToLockFreeReadIndex(newRecord);
+
+            vaultRecordRefs.push_back(VaultRecordRef(newRecord, this));
+        }
 
+        res.Key.clear();
+        res.RequestedType = typeid(void);
+        res.SavedType = typeid(void);
         return res;
     }
 
+    VaultTransaction Vault::BeginTransaction() noexcept
+    {
+        DBG_LOG_ENTER();
+
+        return VaultTransaction(this);
+    }
+
     void Vault::DropVault() noexcept
     {
         DBG_LOG_ENTER();
@@ -556,16 +1625,23 @@ namespace mvlt
         // Clear unique keys vector
         UniqueKeys.clear();
 
+        // Delete all composite indexes, group aggregates and lock-free read index
+        DeleteCompositeIndexes();
+        DeleteGroupAggregates();
+        DeleteLockFreeReadIndex();
+
         // Clear last readed file errors
         InvalidFileRecords.clear();
 
-        // Invalidate all records
-        for (const auto& recordsSetIt : RecordsSet) 
-            recordsSetIt->Invalidate();
+        // Invalidate all records. Records without references are released by the arena in bulk
+        Arena->InvalidateAll();
 
         // Clear record template
         RecordTemplate.Clear();
 
+        // Delete all columns with records data
+        Storage->Clear();
+
         // Delete all unordered maps inside VaultHashMapStructure
         for (auto& vaultHashMapStructureIt : VaultHashMapStructure)
             vaultHashMapStructureIt.second.ResetData();
@@ -580,15 +1656,27 @@ namespace mvlt
         // Clear VaultMapStructure
         VaultMapStructure.Clear();
 
+        // Delete all records positions inside VaultIndexHandlesStructure
+        for (auto& vaultIndexHandlesStructureIt : VaultIndexHandlesStructure)
+            vaultIndexHandlesStructureIt.second.ResetData();
+
+        // Clear VaultIndexHandlesStructure
+        VaultIndexHandlesStructure.Clear();
+
         // Clear hash map with keys types
         KeysTypes.clear();
 
+        // Invalidate KeyHandles with pointers to deleted structures
+        UpdateKeysVersion();
+
         // Clear all maps with functions
         VaultRecordAdders.clear();
+        VaultRecordRangeAdders.clear();
         VaultRecordClearers.clear();
         VaultRecordErasers.clear();
         VaultRecordSorters.clear();
         VaultKeyCopiers.clear();
+        LazyKeyIndexers.clear();
 
         // Clear key order 
         KeysOrder.clear();
@@ -611,14 +1699,25 @@ namespace mvlt
         for (const auto& recordSetsSetIt : RecordSetsSet)
             recordSetsSetIt->Clear();
 
-        // Invalidate all records
-        for (const auto& recordsSetIt : RecordsSet) 
-            recordsSetIt->Invalidate();
+        // Invalidate all records. Records without references are released by the arena in bulk
+        Arena->InvalidateAll();
+
+        // Delete all rows with records data
+        Storage->ClearRows();
         
         // Clear structure
         for (const auto& vaultRecordClearersIt : VaultRecordClearers)
             vaultRecordClearersIt.second();
 
+        for (CompositeIndex* index : CompositeIndexes)
+            index->Clear();
+
+        for (GroupAggregate* aggregate : GroupAggregates)
+            aggregate->Clear();
+
+        LockFreeReadIndexBase* lockFreeIndex = LockFreeIndex.load();
+        if (lockFreeIndex != nullptr) lockFreeIndex->Clear();
+
         // Clear RecordsSet
         RecordsSet.clear();
     }
@@ -658,6 +1757,8 @@ namespace mvlt
         // Lock Vault to read
         ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
 
+        BuildLazyKeyIndex(key);
+
         auto findResIt = VaultRecordSorters.find(key);
         if (findResIt != VaultRecordSorters.end())
         {
@@ -683,6 +1784,8 @@ namespace mvlt
         // Lock Vault to read
         ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
         
+        BuildLazyKeyIndex(key);
+
         auto findResIt = VaultRecordSorters.find(key);
         if (findResIt != VaultRecordSorters.end())
         {
@@ -698,6 +1801,35 @@ namespace mvlt
         }
     }
 
+    std::vector<VaultRecordRef> Vault::GetTopRecords(const std::string& key, const std::size_t& amountOfRecords,
+        const std::function<bool(const VaultRecordRef& ref)>& requestPredicat, const bool& isReverse) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        std::vector<VaultRecordRef> res;
+        if (amountOfRecords == 0) return res;
+
+        // Lock Vault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        // The default predicat accepts all records, so there is no need to call it
+        bool isDefaultPredicat = requestPredicat.target_type() == DefaultRequestPredicat.target_type();
+
+        BuildLazyKeyIndex(key);
+
+        auto findResIt = VaultRecordSorters.find(key);
+        if (findResIt != VaultRecordSorters.end())
+        {
+            findResIt->second([&](const VaultRecordRef& vaultRecordRef)
+                {
+                    if (isDefaultPredicat || requestPredicat(vaultRecordRef)) res.emplace_back(vaultRecordRef);
+                    return res.size() < amountOfRecords;
+                }, const_cast<Vault*>(this), isReverse);
+        }
+
+        return res;
+    }
+
     std::string Vault::ToJson(const bool& isFormat, const std::size_t& tabSize, const bool& isUseRecordTemplate,
             const std::string& recordTemplate, const bool& isArray) const noexcept
     {
@@ -990,7 +2122,7 @@ namespace mvlt
             for (const auto& record : RecordsSet)
             {
                 // Getting the number of items in a record 
-                std::size_t counter = record->Size();
+                std::size_t counter = KeysOrder.size();
                 for (const std::string& key : KeysOrder)
                 {
                     std::string data;
@@ -1057,5 +2189,12 @@ namespace mvlt
         DBG_LOG_ENTER();
 
         DropVault();
+        delete Storage;
+
+        // Readers can not use Vault while it is destroyed, so all retired objects are deleted
+        delete Epochs.load();
+
+        // Arena will be deleted with the last record referenced by VaultRecordRef
+        Arena->ReleaseOwner();
     }
 }
\ No newline at end of file
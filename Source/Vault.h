@@ -1,16 +1,29 @@
 #pragma once
 
 #include <list>
+#include <mutex>
+#include <atomic>
 #include <vector>
+#include <algorithm>
 #include <functional>
 
 #include "VaultClasses.h"
 
 #include "Map.h"
+#include "KeyHandle.h"
+#include "KeyIndexHandles.h"
+#include "CompositeIndex.h"
+#include "GroupAggregate.h"
+#include "EpochManager.h"
+#include "LockFreeReadIndex.h"
 #include "VaultRecord.h"
+#include "VaultRecordArena.h"
+#include "VaultRecordBitmap.h"
 #include "VaultRequest.h"
 #include "VaultRecordRef.h"
+#include "VaultPageCursor.h"
 #include "VaultParamInput.h"
+#include "VaultRecordSnapshot.h"
 #include "VaultOperationResult.h"
 
 #include "CsvParser/CsvParser.h"
@@ -26,16 +39,22 @@ namespace mvlt
         The class can be represented as a simple table with the ability to quickly search in O(1) for each field of the table.
         Each row of the table is called a record, and the VaultRecord class is used to store it. The column is called the key.
         Further, the keys will mean the columns of the table, and the records will mean the rows of the table.
-        The SetKey function is used to add new keys. There is a template record inside the class and when adding a
-        key to the Vault, data will be added to this template record. When creating new records, they will be copied from this template record.
+        The SetKey function is used to add new keys. Records data is stored by columns: each key owns a contiguous typed column
+        with values of all records, and each record owns one row in all columns. When creating new records, their row will be filled with the default key values.
         Each record is unique, but the key values can be the same for many records.
         To work with records inside the Vault, the VaultRecordRef is used. You can use it to change the values of records inside the Vault.
     */
     class Vault
     {
     private:
-        // Template of data stored inside Vault
-        VaultRecord RecordTemplate;
+        // Default values of all keys inside Vault
+        DataHashMap RecordTemplate;
+
+        // Storage with records data. Each key is a column and each record is a row in it
+        VaultColumnStorage* Storage = nullptr;
+
+        // Arena with VaultRecord objects
+        VaultRecordArena* Arena = nullptr;
 
         /*
             Hash map to store records
@@ -60,12 +79,26 @@ namespace mvlt
         */
         mutable DataMap VaultMapStructure;
 
+        /*
+            Hash map to store positions of records inside VaultHashMapStructure and VaultMapStructure
+            A string with the name of the key is used as the key. All keys are the same as in Vault.
+            The value stores a pointer to KeyIndexHandles<T>.
+
+            It is needed to erase and update records inside the key structures in O(1),
+            without iterating over all records with the same key value
+        */
+        mutable DataHashMap VaultIndexHandlesStructure;
+
         // Unordered map with keys names and their types
         std::unordered_map<std::string, std::type_index> KeysTypes;
 
         // Unordered_map of functions that add a new element to the VaultStructureHashMap
         std::unordered_map<std::string, std::function<bool(VaultRecord* newRecord)>> VaultRecordAdders;
 
+        // Unordered_map of functions that add many new records to the key structures at once.
+        // It returns false and adds nothing if the key is unique and the key value of some record is repeated or already added
+        std::unordered_map<std::string, std::function<bool(const std::vector<VaultRecord*>& newRecords)>> VaultRecordRangeAdders;
+
         // Unordered_map of functions which clean up the Vault structure, but do not delete records
         std::unordered_map<std::string, std::function<void()>> VaultRecordClearers;
 
@@ -83,18 +116,259 @@ namespace mvlt
         // Unordered_map of functions that copy keys from this to VaultRecordSet
         std::unordered_map<std::string, std::function<void(Vault* vaultRecordSet)>> VaultKeyCopiers;
 
+        // Unordered_map of functions that fill the indexes of the VaultRecordSet key on the first request with the key.
+        // Until then the key has VaultIndexPolicy::None, so the key is not updated when the records change
+        mutable std::unordered_map<std::string, std::function<void(Vault* vltPtr)>> LazyKeyIndexers;
+
+        // Mutex for LazyKeyIndexers. The indexes are filled under the read lock, so several readers can try to fill them at once
+        mutable std::mutex LazyKeyIndexersMtx;
+
         // List to store keys order
         std::list<std::string> KeysOrder;
 
         // Set with all unique keys
         std::set<std::string> UniqueKeys;
 
+        // Vector with all composite indexes
+        std::vector<CompositeIndex*> CompositeIndexes;
+
+        // Vector with all group aggregates
+        std::vector<GroupAggregate*> GroupAggregates;
+
+        // Manager of epochs for lock-free reads. It is created with the first lock-free read key and lives until Vault is destroyed
+        std::atomic<EpochManager*> Epochs{nullptr};
+
+        // Index of record snapshots for lock-free reads. Nullptr if there is no lock-free read key
+        std::atomic<LockFreeReadIndexBase*> LockFreeIndex{nullptr};
+
         // Vector with all invalid records in last readed file
         std::vector<std::pair<std::size_t, std::string>> InvalidFileRecords;
 
         // Recursive mutex for thread safety
         mutable RecursiveReadWriteMutex RecursiveReadWriteMtx;
 
+        // Mutex for changing VaultRecordSets of records and RecordSetsSet under the read lock. The write lock does not need it
+        mutable std::mutex DependentSetsMtx;
+
+        // Counter to generate versions of keys unique for all Vaults
+        static std::atomic<std::size_t> KeysVersionCounter;
+
+        // Version of keys. It is changed when pointers stored inside KeyHandles become invalid
+        std::size_t KeysVersion;
+
+        /// \brief A method for changing the keys version to invalidate all KeyHandles
+        void UpdateKeysVersion() noexcept;
+
+        /**
+            \brief A method for filling the indexes of the VaultRecordSet key if they were not filled yet
+
+            \param [in] key name of the key
+        */
+        void BuildLazyKeyIndex(const std::string& key) const noexcept;
+
+        /**
+            \brief A method for setting params to the new record
+
+            \param [in] newRecord record to set params to
+            \param [in] params a vector of pairs with keys and values
+            \param [in] isMoveParams should values be moved from params instead of copying
+            \param [out] res result with the error in the first wrong param
+
+            \return Returns true if all params are set, otherwise returns false
+        */
+        bool SetParamsToRecord(VaultRecord* newRecord, const std::vector<std::pair<std::string, VaultParamInput>>& params, const bool& isMoveParams, VaultOperationResult& res) const noexcept;
+
+        /**
+            \brief Method to create new VaultRecord with copying or moving values from params
+
+            \param [in] vaultRecordRef The reference to the VaultRecordRef to which the new record will be assigned
+            \param [in] params a vector of pairs with data to be put in the Vault
+            \param [in] isMoveParams should values be moved from params instead of copying
+
+            \return VaultOperationResult object with CreateRecord result
+        */
+        VaultOperationResult CreateRecord(VaultRecordRef& vaultRecordRef, const std::vector<std::pair<std::string, VaultParamInput>>& params, const bool& isMoveParams) noexcept;
+
+        /**
+            \brief A method for adding the record to all composite indexes
+
+            \param [in] record record to add
+        */
+        void AddToCompositeIndexes(VaultRecord* record) noexcept;
+
+        /**
+            \brief A method for adding the record to composite indexes with the key
+
+            \param [in] record record to add
+            \param [in] key name of the key
+        */
+        void AddToCompositeIndexes(VaultRecord* record, const std::string& key) noexcept;
+
+        /**
+            \brief A method for erasing the record from all composite indexes
+
+            \param [in] record record to erase. It must still store its key values
+        */
+        void EraseFromCompositeIndexes(VaultRecord* record) noexcept;
+
+        /**
+            \brief A method for erasing the record from composite indexes with the key
+
+            \param [in] record record to erase. It must still store its key values
+            \param [in] key name of the key
+        */
+        void EraseFromCompositeIndexes(VaultRecord* record, const std::string& key) noexcept;
+
+        /**
+            \brief A method for creating empty composite indexes with the same keys as in other Vault
+
+            \param [in] other Vault to copy composite indexes from. This Vault must have all keys of the indexes
+        */
+        void CopyCompositeIndexes(const Vault& other) noexcept;
+
+        /// \brief A method for deleting all composite indexes
+        void DeleteCompositeIndexes() noexcept;
+
+        /**
+            \brief A method for adding the record to all group aggregates
+
+            \param [in] record record to add
+        */
+        void AddToGroupAggregates(VaultRecord* record) noexcept;
+
+        /**
+            \brief A method for adding the record to group aggregates with the key
+
+            \param [in] record record to add
+            \param [in] key name of the key
+        */
+        void AddToGroupAggregates(VaultRecord* record, const std::string& key) noexcept;
+
+        /**
+            \brief A method for erasing the record from all group aggregates
+
+            \param [in] record record to erase. It must still store its key values
+        */
+        void EraseFromGroupAggregates(VaultRecord* record) noexcept;
+
+        /**
+            \brief A method for erasing the record from group aggregates with the key
+
+            \param [in] record record to erase. It must still store its key values
+            \param [in] key name of the key
+        */
+        void EraseFromGroupAggregates(VaultRecord* record, const std::string& key) noexcept;
+
+        /**
+            \brief A method for creating empty group aggregates with the same keys as in other Vault
+
+            \param [in] other Vault to copy group aggregates from. This Vault must have all keys of the aggregates
+        */
+        void CopyGroupAggregates(const Vault& other) noexcept;
+
+        /// \brief A method for deleting all group aggregates
+        void DeleteGroupAggregates() noexcept;
+
+        /**
+            \brief A method for adding the record to the lock-free read index or replacing its snapshot
+
+            \param [in] record record with new data
+        */
+        void AddToLockFreeReadIndex(VaultRecord* record) noexcept;
+
+        /**
+            \brief A method for erasing the record from the lock-free read index
+
+            \param [in] record record to erase
+        */
+        void EraseFromLockFreeReadIndex(VaultRecord* record) noexcept;
+
+        /// \brief A method for creating snapshots of all records again after the keys were changed
+        void RebuildLockFreeReadIndex() noexcept;
+
+        /**
+            \brief A method for creating the empty lock-free read index with the same key as in other Vault
+
+            \param [in] other Vault to copy the index from. This Vault must have the key of the index
+        */
+        void CopyLockFreeReadIndex(const Vault& other) noexcept;
+
+        /// \brief A method for removing the lock-free read index. It is deleted when readers leave it
+        void DeleteLockFreeReadIndex() noexcept;
+
+        /**
+            \brief A method for erasing the record from all structures of Vault and RecordsSet
+
+            The record stays valid and keeps its data, so it can be returned back by AttachRecord. Must be called under Vault write lock
+
+            \param [in] record record to detach
+        */
+        void DetachRecord(VaultRecord* record) noexcept;
+
+        /**
+            \brief A method for returning the detached record to all structures of Vault and RecordsSet. Must be called under Vault write lock
+
+            \param [in] record record detached by DetachRecord
+        */
+        void AttachRecord(VaultRecord* record) noexcept;
+
+        /**
+            \brief A method for deleting the detached record from dependent VaultRecordSets and invalidating it. Must be called under Vault write lock
+
+            \param [in] record record detached by DetachRecord
+        */
+        void ReleaseDetachedRecord(VaultRecord* record) noexcept;
+
+        /**
+            \brief A method for copying values of the record keys to the spare row. Must be called under Vault write lock
+
+            \param [in] record record to copy values from
+            \param [in] keys names of the keys to copy
+
+            \return number of the spare row. It must be freed by RestoreRecordData or FreeBackupRow
+        */
+        std::size_t BackupRecordData(const VaultRecord* record, const std::vector<std::string>& keys) noexcept;
+
+        /**
+            \brief A method for setting values of the record keys back from the spare row and freeing the row. Must be called under Vault write lock
+
+            \param [in] record record to restore
+            \param [in] keys names of the keys passed to BackupRecordData
+            \param [in] backupRow row returned by BackupRecordData
+        */
+        void RestoreRecordData(VaultRecord* record, const std::vector<std::string>& keys, const std::size_t& backupRow) noexcept;
+
+        /**
+            \brief A method for freeing the spare row without restoring the record. Must be called under Vault write lock
+
+            \param [in] backupRow row returned by BackupRecordData
+        */
+        void FreeBackupRow(const std::size_t& backupRow) noexcept;
+
+        /**
+            \brief A method for finding the group aggregate by its keys. Must be called under Vault lock
+
+            \param [in] groupKey name of the key to group by
+            \param [in] valueKey name of the key to sum
+
+            \return Returns pointer to the aggregate, or nullptr if there is no such aggregate
+        */
+        GroupAggregate* FindGroupAggregate(const std::string& groupKey, const std::string& valueKey) const noexcept;
+
+        /**
+            \brief A method for getting the result of the And request using composite index
+
+            The index with the longest prefix of keys with Equal conditions is used. The ordered index may also use the range
+            conditions of the next key after prefix. The index must cover at least two conditions, the other conditions are
+            checked for every found record. Must be called under Vault lock.
+
+            \param [in] conditions conditions of all simple requests inside the And request
+            \param [in] func function which is called for each found record. The search stops when it returns false
+
+            \return Returns true if the composite index was used, otherwise returns false and func is not called
+        */
+        bool RequestByCompositeIndex(const std::vector<VaultRequestCondition>& conditions, const std::function<bool(VaultRecord* record)>& func) const noexcept;
+
     protected:
         /// \brief Enum for storing the object type during inheritance
         enum class VaultDerivedClasses : std::uint8_t
@@ -106,8 +380,8 @@ namespace mvlt
         /// \brief A variable for storing the object type in the Vault inheritance tree
         VaultDerivedClasses VaultDerivedClass;
 
-        /// \brief Unordered set with all VaultRecord pointers
-        std::unordered_set<VaultRecord*> RecordsSet;
+        /// \brief Bitmap with all records. Rows of records are bits in it
+        VaultRecordBitmap RecordsSet;
 
         /// \brief Unordered set with all VaultRecordSet pointers
         mutable std::unordered_set<VaultRecordSet*> RecordSetsSet;
@@ -119,12 +393,53 @@ namespace mvlt
 
             \param [in] dataRecord pointer to VaultRecord inside Vault
             \param [in] key key to set data
-            \param [in] data new data
+            \param [in] data new data. It is moved to the record if it is rvalue
 
             \return VaultOperationResult object with GetData result.
         */
         template <class T>
-        VaultOperationResult SetDataToRecord(VaultRecord* dataRecord, const std::string& key, const T& data) noexcept;
+        VaultOperationResult SetDataToRecord(VaultRecord* dataRecord, const std::string& key, T&& data) noexcept;
+
+        /**
+            \brief Method for setting a new value in VaultRecord and Vault using KeyHandle
+
+            \tparam <T> - any type except c arrays
+            \tparam <D> - T or reference to T
+
+            \param [in] dataRecord pointer to VaultRecord inside Vault
+            \param [in] keyHandle handle of the key to set data
+            \param [in] data new data. It is moved to the record if it is rvalue
+
+            \return VaultOperationResult object with GetData result.
+        */
+        template <class T, class D>
+        VaultOperationResult SetDataToRecord(VaultRecord* dataRecord, const KeyHandle<T>& keyHandle, D&& data) noexcept;
+
+        /**
+            \brief Method for setting many new values in VaultRecord and Vault at once
+
+            All params are checked before the record is changed. The record is erased from the structures of changed keys once,
+            and added back after all values are set. If the new value of a unique key is already in the Vault, all values are restored.
+
+            \param [in] dataRecord pointer to VaultRecord inside Vault
+            \param [in] params a vector of pairs with keys and new data
+            \param [in] isMoveParams should values be moved from params instead of copying
+
+            \return VaultOperationResult object with the result of the first incorrect param or with success.
+        */
+        VaultOperationResult SetDataToRecord(VaultRecord* dataRecord, const std::vector<std::pair<std::string, VaultParamInput>>& params, const bool& isMoveParams) noexcept;
+
+        /**
+            \brief A method for checking that KeyHandle was obtained from this Vault and still valid
+
+            \tparam <T> - any type except c arrays
+
+            \param [in] keyHandle handle to check
+
+            \return Returns true if handle is valid, otherwise returns false
+        */
+        template <class T>
+        bool IsKeyHandleValid(const KeyHandle<T>& keyHandle) const noexcept;
 
         /**
             \brief Method for removing a record from a Vault
@@ -136,7 +451,7 @@ namespace mvlt
 
             \return Returns an iterator to the RecordSet element immediately following the one being deleted. If the element to be deleted is not found, it returns RecordSet->end()
         */
-        std::unordered_set<VaultRecord*>::iterator RemoveRecord(VaultRecord* recordToErase, bool* wasDeleted) noexcept;
+        VaultRecordBitmap::iterator RemoveRecord(VaultRecord* recordToErase, bool* wasDeleted) noexcept;
 
         /**
             \brief The method for getting the result of the request in the std::set
@@ -158,9 +473,213 @@ namespace mvlt
         */
         template <class T>
         VaultOperationResult RequestRecordsSet(const VaultRequestType& requestType, const std::string& key, const T& beginKeyValue,
-            const T& endKeyValue, std::unordered_set<VaultRecord*>& recordsSet, const bool& isIncludeBeginKeyValue,
+            const T& endKeyValue, VaultRecordBitmap& recordsSet, const bool& isIncludeBeginKeyValue,
             const bool& isIncludeEndKeyValue, const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept;
 
+        /**
+            \brief The method for getting the result of the request in the std::set from the key structures
+
+            It does not check key and types, so the key structures must be of the key with T type.
+
+            \tparam <T> Any type of data except for c arrays
+
+            If the key has no map, range requests check key values of all records.
+
+            \param [in] requestType Type of request
+            \param [in] TtoVaultRecordIndexHandles key structures
+            \param [in] key the name of the key to search for
+            \param [in] beginKeyValue the begin value of the key to be found
+            \param [in] endKeyValue the end value of the key to be found
+            \param [in] isIncludeBeginKeyValue include beginKeyValue in the interval or not
+            \param [in] isIncludeEndKeyValue include endKeyValue in the interval or not
+            \param [in] recordsSet A reference to std::set<VaultRecord*>
+            \param [in] amountOfRecords The number of records requested. By default request all records
+            \param [in] requestPredicat A function that accepts VaultRecordRef and decides whether to add an record to the request.
+            When the function returns true, the record is added, and when false is not added.
+        */
+        template <class T>
+        void RequestRecordsSet(const VaultRequestType& requestType, KeyIndexHandles<T>* TtoVaultRecordIndexHandles,
+            const std::string& key, const T& beginKeyValue, const T& endKeyValue, VaultRecordBitmap& recordsSet,
+            const bool& isIncludeBeginKeyValue, const bool& isIncludeEndKeyValue, const std::size_t& amountOfRecords,
+            const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept;
+
+        /**
+            \brief The method for finding records by the simple request
+
+            Records are read directly from the key structures in the order of the structures.
+            It does not check key and types, so the key structures must be of the key with T type.
+            If the key has no map, range requests check key values of all records.
+
+            \tparam <T> Any type of data except for c arrays
+            \tparam <F> Function type which accepts VaultRecord* and returns bool
+
+            \param [in] requestType Type of request
+            \param [in] TtoVaultRecordIndexHandles key structures
+            \param [in] key the name of the key to search for
+            \param [in] beginKeyValue the begin value of the key to be found
+            \param [in] endKeyValue the end value of the key to be found
+            \param [in] isIncludeBeginKeyValue include beginKeyValue in the interval or not
+            \param [in] isIncludeEndKeyValue include endKeyValue in the interval or not
+            \param [in] func function which is called for each found record. The search stops when it returns false
+        */
+        template <class T, class F>
+        void FindRecords(const VaultRequestType& requestType, KeyIndexHandles<T>* TtoVaultRecordIndexHandles, const std::string& key,
+            const T& beginKeyValue, const T& endKeyValue, const bool& isIncludeBeginKeyValue, const bool& isIncludeEndKeyValue, const F& func) const noexcept;
+
+        /**
+            \brief The method for finding records by the simple request without saving them
+
+            It checks key and types and then calls func for each found record accepted by requestPredicat. Must be called under Vault lock.
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] requestType Type of request
+            \param [in] key the name of the key to search for
+            \param [in] beginKeyValue the begin value of the key to be found
+            \param [in] endKeyValue the end value of the key to be found
+            \param [in] isIncludeBeginKeyValue include beginKeyValue in the interval or not
+            \param [in] isIncludeEndKeyValue include endKeyValue in the interval or not
+            \param [in] requestPredicat A function that accepts VaultRecordRef and decides whether the record is found
+            \param [in] func function which is called for each found record. The search stops when it returns false
+
+            \return VaultOperationResult object with the result of key and type check
+        */
+        template <class T>
+        VaultOperationResult ScanRecords(const VaultRequestType& requestType, const std::string& key, const T& beginKeyValue,
+            const T& endKeyValue, const bool& isIncludeBeginKeyValue, const bool& isIncludeEndKeyValue,
+            const std::function<bool(const VaultRecordRef& ref)>& requestPredicat, const std::function<bool(VaultRecord* record)>& func) const noexcept;
+
+        /**
+            \brief The method for finding records with the key value
+
+            It uses the hash map of the key, if there is no hash map it uses the map, and if there are no structures
+            it checks key values of all records. It does not check key and types, so the key structures must be of the key with T type.
+
+            \tparam <T> Any type of data except for c arrays
+            \tparam <F> Function type which accepts VaultRecord* and returns bool
+
+            \param [in] TtoVaultRecordIndexHandles key structures
+            \param [in] key the name of the key to search for
+            \param [in] keyValue the value of the key to be found
+            \param [in] func function which is called for each found record. The search stops when it returns false
+        */
+        template <class T, class F>
+        void FindEqualRecords(KeyIndexHandles<T>* TtoVaultRecordIndexHandles, const std::string& key, const T& keyValue, const F& func) const noexcept;
+
+        /**
+            \brief The method for checking that the key exists and has the requested type
+
+            \param [in] key the name of the key to check
+            \param [in] keyType requested type of the key
+
+            \return VaultOperationResult object with the same result as the request with this key and type would have
+        */
+        VaultOperationResult CheckRequestKey(const std::string& key, const std::type_index& keyType) const noexcept;
+
+        /**
+            \brief The method for counting records found by the simple request without predicat
+
+            The hash map counts records with the value in O(1) and the map counts records between bounds in O(log n).
+            If the key has no structure for the request, then key values of all records are checked. It does not check key and types.
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] requestType Type of request. Only Equal, Greater, GreaterOrEqual, Less and LessOrEqual are supported
+            \param [in] key the name of the key to search for
+            \param [in] keyValue the value of the key to be found
+
+            \return the number of found records
+        */
+        template <class T>
+        std::size_t CountRecords(const VaultRequestType& requestType, const std::string& key, const T& keyValue) const noexcept;
+
+        /**
+            \brief The method for estimating the number of records found by the simple request
+
+            Records are counted using the key structures. If the key has no structure for the request, then the request checks
+            all records and the number of all records is returned. It does not check key and types.
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] requestType Type of request. Only Equal, Greater, GreaterOrEqual, Less and LessOrEqual are supported
+            \param [in] key the name of the key to search for
+            \param [in] keyValue the value of the key to be found
+
+            \return the number of found records or the number of all records
+        */
+        template <class T>
+        std::size_t EstimateRecords(const VaultRequestType& requestType, const std::string& key, const T& keyValue) const noexcept;
+
+        /**
+            \brief The method for checking that the record is found by the simple request
+
+            It reads the key value of the record without using the key structures. It does not check key and types.
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] record the record to check
+            \param [in] requestType Type of request. Only Equal, Greater, GreaterOrEqual, Less and LessOrEqual are supported
+            \param [in] key the name of the key to check
+            \param [in] keyValue the requested value of the key
+            \param [in] requestPredicat A pointer to the function that accepts VaultRecordRef and decides whether the record is found.
+            Nullptr if the request has no predicat.
+
+            \return Returns true if the key value of the record matches the request and the predicat accepts the record
+        */
+        template <class T>
+        bool IsRecordMatch(VaultRecord* record, const VaultRequestType& requestType, const std::string& key, const T& keyValue,
+            const std::function<bool(const VaultRecordRef& ref)>* requestPredicat) const noexcept;
+
+        /**
+            \brief The method for finding the minimum or the maximum key value among records found by the request
+
+            If the key has a map and the request is not too selective, then the map is read from the required end until
+            the first record found by the request. Otherwise all records found by the request are checked.
+
+            \tparam <T> Any type of data except for c arrays
+            \tparam <Type> Request type
+
+            \param [in] key the name of the key
+            \param [in] request pointer to the request. Nullptr to check all records
+            \param [in] isMax find the maximum value if true, otherwise find the minimum value
+            \param [out] value found value. It is not changed if there are no records
+
+            \return VaultOperationResult object with the result. If there are no records the ResultCode is WrongValue
+        */
+        template <class T, VaultRequestType Type>
+        VaultOperationResult FindExtremum(const std::string& key, const VaultRequest<Type>* request, const bool& isMax, T& value) const;
+
+        /**
+            \brief The method for getting the average key value of records found by the request
+
+            \tparam <T> Any type of data except for c arrays. It must support operator+= and conversion to double
+            \tparam <Type> Request type
+
+            \param [in] key the name of the key
+            \param [in] request pointer to the request. Nullptr to check all records
+            \param [out] avg the average value. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result. If there are no records the ResultCode is WrongValue
+        */
+        template <class T, VaultRequestType Type>
+        VaultOperationResult FindAverage(const std::string& key, const VaultRequest<Type>* request, double& avg) const;
+
+        /**
+            \brief The method for summing key values of records found by the request
+
+            \tparam <T> Any type of data except for c arrays. It must support operator+=
+            \tparam <Type> Request type
+
+            \param [in] key the name of the key
+            \param [in] request pointer to the request. Nullptr to sum all records
+            \param [out] sum sum of values. It is not changed if the operation fails
+            \param [out] counter number of summed records. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result
+        */
+        template <class T, VaultRequestType Type>
+        VaultOperationResult Accumulate(const std::string& key, const VaultRequest<Type>* request, T& sum, std::size_t& counter) const;
+
         /**
             \brief The method for getting the result of the request
 
@@ -184,6 +703,38 @@ namespace mvlt
             const T& endKeyValue, VaultRecordSet& vaultRecordSet, const bool& isIncludeBeginKeyValue,
             const bool& isIncludeEndKeyValue, const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept;
 
+        /**
+            \brief The method for getting the result of the request using KeyHandle
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] requestType Type of request
+            \param [in] keyHandle handle of the key to search for
+            \param [in] beginKeyValue the begin value of the key to be found
+            \param [in] endKeyValue the end value of the key to be found
+            \param [in] isIncludeBeginKeyValue include beginKeyValue in the interval or not
+            \param [in] isIncludeEndKeyValue include endKeyValue in the interval or not
+            \param [in] vaultRecordSet A reference to VaultRecordSet
+            \param [in] amountOfRecords The number of records requested. By default request all records
+            \param [in] requestPredicat A function that accepts VaultRecordRef and decides whether to add an record to the request.
+            When the function returns true, the record is added, and when false is not added.
+
+            \return VaultOperationResult object with RequestRecords result
+        */
+        template <class T>
+        VaultOperationResult RequestRecords(const VaultRequestType& requestType, const KeyHandle<T>& keyHandle, const T& beginKeyValue,
+            const T& endKeyValue, VaultRecordSet& vaultRecordSet, const bool& isIncludeBeginKeyValue,
+            const bool& isIncludeEndKeyValue, const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept;
+
+        /**
+            \brief A method for preparing VaultRecordSet to store the request result
+
+            The set will be attached to this Vault and cleared. Must be called under Vault lock.
+
+            \param [in] vaultRecordSet A reference to VaultRecordSet
+        */
+        void PrepareRecordSet(VaultRecordSet& vaultRecordSet) const noexcept;
+
         /**
             \brief Template method to add new key with default value to Vault
 
@@ -194,12 +745,13 @@ namespace mvlt
             \param [in] isUniqueKey is this is key with only unique values
             \param [in] isUniqueKeyWithoutLambda is try to add unique key without lambda. Vault must be empty
             \param [in] uniqueKeyFunction the function to add unique key in non-empty vault
+            \param [in] indexPolicy structures to create for the key
 
             \return Returns false if such a key already exists, otherwise it returns true
         */
         template <class T>
         VaultOperationResult AddKey(const std::string& key, const T& defaultKeyValue, const bool& isUniqueKey, const bool& isUniqueKeyWithoutLambda,
-            const std::function<T(const std::size_t& counter, const VaultRecordRef& ref)>& uniqueKeyFunction) noexcept;
+            const std::function<T(const std::size_t& counter, const VaultRecordRef& ref)>& uniqueKeyFunction, const VaultIndexPolicy& indexPolicy) noexcept;
 
         /**
             \brief A method for reading a csv file and loading data from it into memory
@@ -226,6 +778,9 @@ namespace mvlt
         /// Making the VaultRecordSet class friendly so that it has access to the internal members of the Vault class
         friend VaultRecordSet;
 
+        /// Making the VaultTransaction class friendly so that it has access to the internal members of the Vault class
+        friend VaultTransaction;
+
         /// Making the VaultRequest class friendly so that it has access to the internal members of the Vault class
         template <VaultRequestType Type>
         friend class VaultRequest;
@@ -273,13 +828,18 @@ namespace mvlt
 
             \tparam <T> Any type of data except for c arrays
 
+            By default the key has a hash table for equality requests and a B+tree for range requests and sorting.
+            Keys that are never requested or requested only by equality can skip one or both structures with indexPolicy,
+            then adding and updating records is cheaper, and requests which need the missing structure scan all records.
+
             \param [in] key new key name
             \param [in] defaultKeyValue default key value
+            \param [in] indexPolicy structures to create for the key
 
             \return Returns false if such a key already exists, otherwise it returns true
         */
         template <class T>
-        bool AddKey(const std::string& key, const T& defaultKeyValue) noexcept;
+        bool AddKey(const std::string& key, const T& defaultKeyValue, const VaultIndexPolicy& indexPolicy = VaultIndexPolicy::HashAndOrdered) noexcept;
 
         /**
             \brief Template method to add new unique key to Vault
@@ -287,13 +847,15 @@ namespace mvlt
             \tparam <T> Any type of data except for c arrays
 
             Use it only on empty vault. If vault is not empty, then this method return error.
+            The unique key must have at least one structure, so indexPolicy can not be VaultIndexPolicy::None.
 
             \param [in] key new key name
+            \param [in] indexPolicy structures to create for the key
 
             \return Returns VaultOperationResult with information about key adding
         */
         template <class T>
-        VaultOperationResult AddUniqueKey(const std::string& key) noexcept;
+        VaultOperationResult AddUniqueKey(const std::string& key, const VaultIndexPolicy& indexPolicy = VaultIndexPolicy::HashAndOrdered) noexcept;
 
         /**
             \brief Template method to add new unique key to Vault
@@ -311,10 +873,13 @@ namespace mvlt
             \endcode
             Note that the lambda function is enclosed in {} and the return value is specified via ->
 
+            \param [in] indexPolicy structures to create for the key. It can not be VaultIndexPolicy::None
+
             \return Returns VaultOperationResult with information about key adding
         */
         template <class T>
-        VaultOperationResult AddUniqueKey(const std::string& key, const std::function<T(const std::size_t& counter, const VaultRecordRef& ref)>& uniqueKeyFunction) noexcept;
+        VaultOperationResult AddUniqueKey(const std::string& key, const std::function<T(const std::size_t& counter, const VaultRecordRef& ref)>& uniqueKeyFunction,
+            const VaultIndexPolicy& indexPolicy = VaultIndexPolicy::HashAndOrdered) noexcept;
 
         /**
             \brief Template method to update default key value
@@ -363,6 +928,22 @@ namespace mvlt
         */
         bool GetKeyType(const std::string& key, std::type_index& keyType) const noexcept;
 
+        /**
+            \brief The method for getting a handle for fast access to the key
+
+            The handle can be passed instead of the key name to the methods of Vault and VaultRecordRef.
+            These methods do not search the key by name and do not check its type.
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] key the name of the key
+            \param [out] keyHandle the ref to KeyHandle. If the key is not found, or the saved type does not match the type T, the parameter will not change
+
+            \return VaultOperationResult object with GetKeyHandle result
+        */
+        template <class T>
+        VaultOperationResult GetKeyHandle(const std::string& key, KeyHandle<T>& keyHandle) const noexcept;
+
         /**
             \brief The method for getting all the keys
 
@@ -386,6 +967,165 @@ namespace mvlt
         */
         bool RemoveKey(const std::string& key) noexcept;
 
+        /**
+            \brief The method for adding the index of several keys
+
+            The index stores values of all keys of the record as one value. It is used automatically by And requests
+            with Equal requests of the first keys of the index. The ordered index is also used with range requests of
+            the next key after them. The index is removed when any of its keys is removed.
+
+            \param [in] keys names of index keys. The order of keys is important for the ordered index
+            \param [in] indexPolicy structures to create for the index. VaultIndexPolicy::None is not allowed
+
+            \return VaultOperationResult object with AddCompositeIndex result
+        */
+        VaultOperationResult AddCompositeIndex(const std::vector<std::string>& keys, const VaultIndexPolicy& indexPolicy = VaultIndexPolicy::HashAndOrdered) noexcept;
+
+        /**
+            \brief The method for checking that the index of keys exists
+
+            \param [in] keys names of index keys in index order
+
+            \return Returns true if the index exists, otherwise returns false
+        */
+        bool IsCompositeIndexExist(const std::vector<std::string>& keys) const noexcept;
+
+        /**
+            \brief The method for getting keys of all composite indexes
+
+            \return vector with keys of every composite index
+        */
+        std::vector<std::vector<std::string>> GetCompositeIndexes() const noexcept;
+
+        /**
+            \brief The method for removing the index of keys
+
+            \param [in] keys names of index keys in index order
+
+            \return Returns true if the index existed, otherwise returns false
+        */
+        bool RemoveCompositeIndex(const std::vector<std::string>& keys) noexcept;
+
+        /**
+            \brief The template method for adding the live aggregate of one key grouped by other key
+
+            The aggregate stores the number of records and the sum of valueKey values for every value of groupKey.
+            It is updated when records are created, changed and erased, so reading it does not read records.
+            The aggregate is removed when any of its keys is removed.
+
+            \tparam <G> Type of the key to group by. It must be hashable
+            \tparam <V> Type of the key to sum. It must support += and -= operators
+
+            \param [in] groupKey name of the key to group by
+            \param [in] valueKey name of the key to sum
+
+            \return VaultOperationResult object with AddGroupBy result
+        */
+        template <class G, class V>
+        VaultOperationResult AddGroupBy(const std::string& groupKey, const std::string& valueKey) noexcept;
+
+        /**
+            \brief The method for checking that the aggregate exists
+
+            \param [in] groupKey name of the key to group by
+            \param [in] valueKey name of the key to sum
+
+            \return Returns true if the aggregate exists, otherwise returns false
+        */
+        bool IsGroupByExist(const std::string& groupKey, const std::string& valueKey) const noexcept;
+
+        /**
+            \brief The template method for getting all groups of the aggregate
+
+            \tparam <G> Type of the key to group by
+            \tparam <V> Type of the key to sum
+
+            \param [in] groupKey name of the key to group by
+            \param [in] valueKey name of the key to sum
+            \param [out] groups the aggregate of every value of groupKey
+
+            \return VaultOperationResult object with GetGroups result
+        */
+        template <class G, class V>
+        VaultOperationResult GetGroups(const std::string& groupKey, const std::string& valueKey, std::unordered_map<G, VaultGroup<V>>& groups) const noexcept;
+
+        /**
+            \brief The template method for getting one group of the aggregate
+
+            \tparam <G> Type of the key to group by
+            \tparam <V> Type of the key to sum
+
+            \param [in] groupKey name of the key to group by
+            \param [in] valueKey name of the key to sum
+            \param [in] groupValue value of groupKey
+            \param [out] group the aggregate of records with groupValue
+
+            \return VaultOperationResult object with GetGroup result
+        */
+        template <class G, class V>
+        VaultOperationResult GetGroup(const std::string& groupKey, const std::string& valueKey, const G& groupValue, VaultGroup<V>& group) const noexcept;
+
+        /**
+            \brief The method for removing the aggregate
+
+            \param [in] groupKey name of the key to group by
+            \param [in] valueKey name of the key to sum
+
+            \return Returns true if the aggregate existed, otherwise returns false
+        */
+        bool RemoveGroupBy(const std::string& groupKey, const std::string& valueKey) noexcept;
+
+        /**
+            \brief A template method for enabling lock-free reads by the unique key
+
+            Vault keeps an immutable snapshot of every record in a separate index by the key value.
+            Snapshots are replaced when records are changed, so writes become slower and records data is stored twice.
+            Readers do not take any locks, removed snapshots are deleted when all readers who could see them have finished.
+            Only one key can be used for lock-free reads.
+
+            \tparam <T> Key type. It must support std::hash
+
+            \param [in] key name of the unique key
+
+            \return VaultOperationResult object with AddLockFreeReadKey result.
+            If the key is not unique, ResultCode will be equal to NonUniqueKey.
+            If Vault already has lock-free read key, ResultCode will be equal to DuplicateKey
+        */
+        template <class T>
+        VaultOperationResult AddLockFreeReadKey(const std::string& key) noexcept;
+
+        /**
+            \brief A method for getting the lock-free read key
+
+            \return name of the key. It is empty if lock-free reads are not enabled
+        */
+        std::string GetLockFreeReadKey() const noexcept;
+
+        /**
+            \brief A method for disabling lock-free reads
+
+            \return Returns true if lock-free reads were enabled, otherwise returns false
+        */
+        bool RemoveLockFreeReadKey() noexcept;
+
+        /**
+            \brief A template method for reading the record without locks
+
+            The snapshot passed to func is a copy of the record data made by the last change of the record before the reading.
+            It is valid only until func returns. The func must not change Vault.
+
+            \tparam <T> Type of the lock-free read key
+
+            \param [in] key the name of the lock-free read key
+            \param [in] keyValue the value of the key to be found
+            \param [in] func A function takes const VaultRecordSnapshot& as a parameter. It is called only if the record is found
+
+            \return VaultOperationResult object with ReadRecord result.
+            If the key is not the lock-free read key, ResultCode will be equal to WrongKey
+        */
+        template <class T, class F>
+        VaultOperationResult ReadRecord(const std::string& key, const T& keyValue, F&& func) const noexcept;
+
         /**
             \brief Method to create new VaultRecord.
 
@@ -413,49 +1153,130 @@ namespace mvlt
 
             or
 
-            \code{.cpp}
-                // A record with name mrognor will be created. The Id will be set to the default value
-                vlt.CreateRecord({ {"name", std::string("mrognor")} });
-            \endcode
+            \code{.cpp}
+                // A record with name mrognor will be created. The Id will be set to the default value
+                vlt.CreateRecord({ {"name", std::string("mrognor")} });
+            \endcode
+
+            or
+
+            \code{.cpp}
+                // A record with id 0 and name mrognor will be created
+                std::vector<std::pair<std::string, VaultParamInput>> params = { {"id", 0}, {"name", std::string("mrognor")} };
+                VaultRecordRef vltrr = vlt.CreateRecord(params);
+            \endcode
+
+            what is equivalent to such a code without passing values to a function
+
+            \code{.cpp}
+                VaultRecordRef vltrr = vlt.CreateRecord({});
+
+                vltrr.SetData("id", 0);
+                vltrr.SetData<std::string>("name", "mrognor");
+            \endcode
+
+            \param [in] params a vector of pairs with data to be put in the Vault
+
+            If there was an error in one of the parameters, the function will stop at this parameter and return an error for this parameter.
+
+            \return VaultOperationResult object with CreateRecord result
+        */
+        VaultOperationResult CreateRecord(const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept;
+
+        /**
+            \overload
+            \brief Method to create new VaultRecord.
+
+            If there are unique keys in the vault, then when you try to add a record with a unique key value that is already in the vault,
+            the new record will not be added.
+
+            \param [in] vaultRecordRef The reference to the VaultRecordRef to which the new record will be assigned
+            \param [in] params a vector of pairs with data to be put in the Vault
+
+            \return VaultOperationResult object with CreateRecord result
+        */
+        VaultOperationResult CreateRecord(VaultRecordRef& vaultRecordRef, const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept;
+
+        /**
+            \overload
+            \brief Method to create new VaultRecord with moving values from params
+
+            Values that were passed to VaultParamInput as rvalue are moved to the record without copying.
+            To create a record without copying values, fill the vector using emplace_back and pass it using std::move.
+            Braced list of params is copied to the vector once, and then values are moved to the record.
+
+            \code{.cpp}
+                std::vector<std::pair<std::string, VaultParamInput>> params;
+                params.emplace_back("name", std::move(name));
+                vlt.CreateRecord(std::move(params));
+            \endcode
+
+            \param [in] params a vector of pairs with data to be put in the Vault
+
+            \return VaultOperationResult object with CreateRecord result
+        */
+        VaultOperationResult CreateRecord(std::vector<std::pair<std::string, VaultParamInput>>&& params) noexcept;
+
+        /**
+            \overload
+            \brief Method to create new VaultRecord with moving values from params
+
+            \param [in] vaultRecordRef The reference to the VaultRecordRef to which the new record will be assigned
+            \param [in] params a vector of pairs with data to be put in the Vault
+
+            \return VaultOperationResult object with CreateRecord result
+        */
+        VaultOperationResult CreateRecord(VaultRecordRef& vaultRecordRef, std::vector<std::pair<std::string, VaultParamInput>>&& params) noexcept;
+
+        /**
+            \brief Method to create many new records at once
 
-            or
+            The Vault is locked once, memory for all records is allocated in advance and the key structures are filled
+            with all records together, so it is faster than calling CreateRecord for each record.
+            Params of each record are checked in the same way as in CreateRecord.
+            Records are created only if all of them are correct. If the params of some record are wrong,
+            or the value of unique key is repeated inside recordsParams or is already in the vault, then no record will be created.
 
             \code{.cpp}
-                // A record with id 0 and name mrognor will be created
-                std::vector<std::pair<std::string, VaultParamInput>> params = { {"id", 0}, {"name", std::string("mrognor")} };
-                VaultRecordRef vltrr = vlt.CreateRecord(params);
+                vlt.CreateRecords({
+                    { {"id", 0}, {"name", std::string("mrognor")} },
+                    { {"id", 1}, {"name", std::string("moskalenko")} }
+                });
             \endcode
 
-            what is equivalent to such a code without passing values to a function
-
-            \code{.cpp}
-                VaultRecordRef vltrr = vlt.CreateRecord({});
+            \param [in] recordsParams a vector with params of every record to be put in the Vault
 
-                vltrr.SetData("id", 0);
-                vltrr.SetData<std::string>("name", "mrognor");
-            \endcode
+            \return VaultOperationResult object with CreateRecords result
+        */
+        VaultOperationResult CreateRecords(const std::vector<std::vector<std::pair<std::string, VaultParamInput>>>& recordsParams) noexcept;
 
-            \param [in] params a vector of pairs with data to be put in the Vault
+        /**
+            \overload
+            \brief Method to create many new records at once
 
-            If there was an error in one of the parameters, the function will stop at this parameter and return an error for this parameter.
+            \param [out] vaultRecordRefs references to the new records in the same order as recordsParams. It is empty if no record was created
+            \param [in] recordsParams a vector with params of every record to be put in the Vault
 
-            \return VaultOperationResult object with CreateRecord result
+            \return VaultOperationResult object with CreateRecords result
         */
-        VaultOperationResult CreateRecord(const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept;
+        VaultOperationResult CreateRecords(std::vector<VaultRecordRef>& vaultRecordRefs, const std::vector<std::vector<std::pair<std::string, VaultParamInput>>>& recordsParams) noexcept;
 
         /**
-            \overload
-            \brief Method to create new VaultRecord.
+            \brief Method to start a transaction
 
-            If there are unique keys in the vault, then when you try to add a record with a unique key value that is already in the vault,
-            the new record will not be added.
+            The transaction saves record creations, changes and erasures and applies all of them at once by Commit.
+            If one of the operations fails, then none of them is applied.
 
-            \param [in] vaultRecordRef The reference to the VaultRecordRef to which the new record will be assigned
-            \param [in] params a vector of pairs with data to be put in the Vault
+            \code{.cpp}
+                VaultTransaction transaction = vlt.BeginTransaction();
+                transaction.SetData(firstRef, "balance", 90);
+                transaction.SetData(secondRef, "balance", 110);
+                transaction.Commit();
+            \endcode
 
-            \return VaultOperationResult object with CreateRecord result
+            \return transaction to change this Vault
         */
-        VaultOperationResult CreateRecord(VaultRecordRef& vaultRecordRef, const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept;
+        VaultTransaction BeginTransaction() noexcept;
 
         /**
             \brief The method for getting a reference to the data inside Vault
@@ -474,6 +1295,20 @@ namespace mvlt
         template <class T>
         VaultOperationResult GetRecord(const std::string& key, const T& keyValue, VaultRecordRef& vaultRecordRef) const noexcept;
 
+        /**
+            \brief The method for getting a reference to the data inside Vault using KeyHandle
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] keyHandle handle of the key to search for
+            \param [in] keyValue the value of the key to be found
+            \param [in] vaultRecordRef A reference to VaultRecordRef, where information about the requested record will be recorded
+
+            \return VaultOperationResult object with GetRecord result
+        */
+        template <class T>
+        VaultOperationResult GetRecord(const KeyHandle<T>& keyHandle, const T& keyValue, VaultRecordRef& vaultRecordRef) const noexcept;
+
         /**
             \brief The method for getting a vector of references to the data inside Vault
 
@@ -490,6 +1325,21 @@ namespace mvlt
         template <class T>
         VaultOperationResult GetRecords(const std::string& key, const T& keyValue, std::vector<VaultRecordRef>& recordsRefs, const std::size_t& amountOfRecords = -1) const noexcept;
 
+        /**
+            \brief The method for getting a vector of references to the data inside Vault using KeyHandle
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] keyHandle handle of the key to search for
+            \param [in] keyValue the value of the key to be found
+            \param [in] recordsRefs A reference to std::vector<VaultRecordRef>, where information about the requested records will be recorded
+            \param [in] amountOfRecords The number of records requested
+
+            \return VaultOperationResult object with GetRecords result
+        */
+        template <class T>
+        VaultOperationResult GetRecords(const KeyHandle<T>& keyHandle, const T& keyValue, std::vector<VaultRecordRef>& recordsRefs, const std::size_t& amountOfRecords = -1) const noexcept;
+
         /**
             \brief A method for getting all records that have a value equal to keyValue stored by the key key
 
@@ -508,6 +1358,24 @@ namespace mvlt
         VaultOperationResult RequestEqual(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
             const std::size_t& amountOfRecords = -1, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat) const noexcept;
 
+        /**
+            \brief A method for getting all records that have a value equal to keyValue using KeyHandle
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] keyHandle handle of the key to search for
+            \param [in] keyValue the value of the key to be found
+            \param [in] vaultRecordSet A reference to VaultRecordSet
+            \param [in] amountOfRecords The number of records requested. By default request all records
+            \param [in] requestPredicat A function that accepts VaultRecordRef and decides whether to add an record to the request.
+            When the function returns true, the record is added, and when false is not added.
+
+            \return VaultOperationResult object with RequestRecords result
+        */
+        template <class T>
+        VaultOperationResult RequestEqual(const KeyHandle<T>& keyHandle, const T& keyValue, VaultRecordSet& vaultRecordSet,
+            const std::size_t& amountOfRecords = -1, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat) const noexcept;
+
         /**
             \brief A method for getting all records that have a value greater than keyValue stored by the key key
 
@@ -526,6 +1394,24 @@ namespace mvlt
         VaultOperationResult RequestGreater(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
             const std::size_t& amountOfRecords = -1, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat) const noexcept;
 
+        /**
+            \brief A method for getting all records that have a value greater than keyValue using KeyHandle
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] keyHandle handle of the key to search for
+            \param [in] keyValue the value of the key to be found
+            \param [in] vaultRecordSet A reference to VaultRecordSet
+            \param [in] amountOfRecords The number of records requested. By default request all records
+            \param [in] requestPredicat A function that accepts VaultRecordRef and decides whether to add an record to the request.
+            When the function returns true, the record is added, and when false is not added.
+
+            \return VaultOperationResult object with RequestRecords result
+        */
+        template <class T>
+        VaultOperationResult RequestGreater(const KeyHandle<T>& keyHandle, const T& keyValue, VaultRecordSet& vaultRecordSet,
+            const std::size_t& amountOfRecords = -1, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat) const noexcept;
+
         /**
             \brief A method for getting all records that have a value greater than or equal to keyValue stored by the key key
 
@@ -544,6 +1430,24 @@ namespace mvlt
         VaultOperationResult RequestGreaterOrEqual(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
             const std::size_t& amountOfRecords = -1, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat) const noexcept;
 
+        /**
+            \brief A method for getting all records that have a value greater than or equal to keyValue using KeyHandle
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] keyHandle handle of the key to search for
+            \param [in] keyValue the value of the key to be found
+            \param [in] vaultRecordSet A reference to VaultRecordSet
+            \param [in] amountOfRecords The number of records requested. By default request all records
+            \param [in] requestPredicat A function that accepts VaultRecordRef and decides whether to add an record to the request.
+            When the function returns true, the record is added, and when false is not added.
+
+            \return VaultOperationResult object with RequestRecords result
+        */
+        template <class T>
+        VaultOperationResult RequestGreaterOrEqual(const KeyHandle<T>& keyHandle, const T& keyValue, VaultRecordSet& vaultRecordSet,
+            const std::size_t& amountOfRecords = -1, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat) const noexcept;
+
         /**
             \brief A method for getting all records that have a value less than keyValue stored by the key key
 
@@ -562,6 +1466,24 @@ namespace mvlt
         VaultOperationResult RequestLess(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
             const std::size_t& amountOfRecords = -1, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat) const noexcept;
 
+        /**
+            \brief A method for getting all records that have a value less than keyValue using KeyHandle
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] keyHandle handle of the key to search for
+            \param [in] keyValue the value of the key to be found
+            \param [in] vaultRecordSet A reference to VaultRecordSet
+            \param [in] amountOfRecords The number of records requested. By default request all records
+            \param [in] requestPredicat A function that accepts VaultRecordRef and decides whether to add an record to the request.
+            When the function returns true, the record is added, and when false is not added.
+
+            \return VaultOperationResult object with RequestRecords result
+        */
+        template <class T>
+        VaultOperationResult RequestLess(const KeyHandle<T>& keyHandle, const T& keyValue, VaultRecordSet& vaultRecordSet,
+            const std::size_t& amountOfRecords = -1, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat) const noexcept;
+
         /**
             \brief A method for getting all records that have a value less than or equal to keyValue stored by the key key
 
@@ -580,6 +1502,24 @@ namespace mvlt
         VaultOperationResult RequestLessOrEqual(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
             const std::size_t& amountOfRecords = -1, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat) const noexcept;
 
+        /**
+            \brief A method for getting all records that have a value less than or equal to keyValue using KeyHandle
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] keyHandle handle of the key to search for
+            \param [in] keyValue the value of the key to be found
+            \param [in] vaultRecordSet A reference to VaultRecordSet
+            \param [in] amountOfRecords The number of records requested. By default request all records
+            \param [in] requestPredicat A function that accepts VaultRecordRef and decides whether to add an record to the request.
+            When the function returns true, the record is added, and when false is not added.
+
+            \return VaultOperationResult object with RequestRecords result
+        */
+        template <class T>
+        VaultOperationResult RequestLessOrEqual(const KeyHandle<T>& keyHandle, const T& keyValue, VaultRecordSet& vaultRecordSet,
+            const std::size_t& amountOfRecords = -1, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat) const noexcept;
+
         /**
             \brief The method for getting the result of the request
 
@@ -603,6 +1543,29 @@ namespace mvlt
             const bool& isIncludeEndKeyValue = true, const std::size_t& amountOfRecords = -1,
             const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat) const noexcept;
 
+        /**
+            \brief The method for getting the result of the interval request using KeyHandle
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] keyHandle handle of the key to search for
+            \param [in] beginKeyValue the begin value of the key to be found
+            \param [in] endKeyValue the end value of the key to be found
+            \param [in] isIncludeBeginKeyValue include beginKeyValue in the interval or not
+            \param [in] isIncludeEndKeyValue include endKeyValue in the interval or not
+            \param [in] vaultRecordSet A reference to VaultRecordSet
+            \param [in] amountOfRecords The number of records requested. By default request all records
+            \param [in] requestPredicat A function that accepts VaultRecordRef and decides whether to add an record to the request.
+            When the function returns true, the record is added, and when false is not added.
+
+            \return VaultOperationResult object with RequestRecords result
+        */
+        template <class T>
+        VaultOperationResult RequestInterval(const KeyHandle<T>& keyHandle, const T& beginKeyValue,
+            const T& endKeyValue, VaultRecordSet& vaultRecordSet, const bool& isIncludeBeginKeyValue = true,
+            const bool& isIncludeEndKeyValue = true, const std::size_t& amountOfRecords = -1,
+            const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat) const noexcept;
+
         /**
             \brief A method for complex requests
 
@@ -612,6 +1575,151 @@ namespace mvlt
         template <VaultRequestType Type>
         VaultOperationResult Request(const VaultRequest<Type>& request, VaultRecordSet& vaultRecordSet) const;
 
+        /**
+            \brief A method for iterating over the result of the request without saving it
+
+            Records are read directly from the key structures under the read lock, so no VaultRecordSet is created.
+            It is cheaper than Request if the result is handled only once or only first records are needed.
+
+            \param [in] request The request
+            \param [in] func A function takes const VaultRecordRef& as a parameter. To get the next record it must return true,
+            to stop the iteration it must return false. The function must not change the Vault.
+
+            \return VaultOperationResult object with the same result as Request would return
+        */
+        template <VaultRequestType Type>
+        VaultOperationResult Scan(const VaultRequest<Type>& request, const std::function<bool(const VaultRecordRef& ref)>& func) const;
+
+        /**
+            \brief A method for counting records found by the request
+
+            Simple requests without predicat are counted by the key structures without reading records.
+            Other requests count records without creating VaultRecordSet.
+
+            \param [in] request The request
+            \param [out] count number of found records. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the same result as Request would return
+        */
+        template <VaultRequestType Type>
+        VaultOperationResult Count(const VaultRequest<Type>& request, std::size_t& count) const;
+
+        /**
+            \brief A method for getting the minimum key value
+
+            If the key has a map, then the value is taken from the beginning of the map.
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] key the name of the key
+            \param [out] minValue the minimum value. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result. If there are no records the ResultCode is WrongValue
+        */
+        template <class T>
+        VaultOperationResult Min(const std::string& key, T& minValue) const;
+
+        /**
+            \brief A method for getting the minimum key value among records found by the request
+
+            \tparam <T> Any type of data except for c arrays
+            \tparam <Type> Request type
+
+            \param [in] key the name of the key
+            \param [in] request The request
+            \param [out] minValue the minimum value. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result. If no records are found the ResultCode is WrongValue
+        */
+        template <class T, VaultRequestType Type>
+        VaultOperationResult Min(const std::string& key, const VaultRequest<Type>& request, T& minValue) const;
+
+        /**
+            \brief A method for getting the maximum key value
+
+            If the key has a map, then the value is taken from the end of the map.
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] key the name of the key
+            \param [out] maxValue the maximum value. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result. If there are no records the ResultCode is WrongValue
+        */
+        template <class T>
+        VaultOperationResult Max(const std::string& key, T& maxValue) const;
+
+        /**
+            \brief A method for getting the maximum key value among records found by the request
+
+            \tparam <T> Any type of data except for c arrays
+            \tparam <Type> Request type
+
+            \param [in] key the name of the key
+            \param [in] request The request
+            \param [out] maxValue the maximum value. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result. If no records are found the ResultCode is WrongValue
+        */
+        template <class T, VaultRequestType Type>
+        VaultOperationResult Max(const std::string& key, const VaultRequest<Type>& request, T& maxValue) const;
+
+        /**
+            \brief A method for summing key values of all records
+
+            \tparam <T> Any type of data except for c arrays. It must support operator+=
+
+            \param [in] key the name of the key
+            \param [out] sum sum of values. It is T() if there are no records. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result
+        */
+        template <class T>
+        VaultOperationResult Sum(const std::string& key, T& sum) const;
+
+        /**
+            \brief A method for summing key values of records found by the request
+
+            \tparam <T> Any type of data except for c arrays. It must support operator+=
+            \tparam <Type> Request type
+
+            \param [in] key the name of the key
+            \param [in] request The request
+            \param [out] sum sum of values. It is T() if no records are found. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result
+        */
+        template <class T, VaultRequestType Type>
+        VaultOperationResult Sum(const std::string& key, const VaultRequest<Type>& request, T& sum) const;
+
+        /**
+            \brief A method for getting the average key value of all records
+
+            \tparam <T> Any type of data except for c arrays. It must support operator+= and conversion to double
+
+            \param [in] key the name of the key
+            \param [out] avg the average value. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result. If there are no records the ResultCode is WrongValue
+        */
+        template <class T>
+        VaultOperationResult Avg(const std::string& key, double& avg) const;
+
+        /**
+            \brief A method for getting the average key value of records found by the request
+
+            \tparam <T> Any type of data except for c arrays. It must support operator+= and conversion to double
+            \tparam <Type> Request type
+
+            \param [in] key the name of the key
+            \param [in] request The request
+            \param [out] avg the average value. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result. If no records are found the ResultCode is WrongValue
+        */
+        template <class T, VaultRequestType Type>
+        VaultOperationResult Avg(const std::string& key, const VaultRequest<Type>& request, double& avg) const;
+
         /**
             \brief A method for deleting all data and keys
 
@@ -642,6 +1750,19 @@ namespace mvlt
         template <class T>
         VaultOperationResult EraseRecord(const std::string& key, const T& keyValue) noexcept;
 
+        /**
+            \brief The method for erase record using KeyHandle and value
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] keyHandle handle of the key to search for
+            \param [in] keyValue the value of the key to be found
+
+            \return VaultOperationResult object with EraseRecord result
+        */
+        template <class T>
+        VaultOperationResult EraseRecord(const KeyHandle<T>& keyHandle, const T& keyValue) noexcept;
+
         /**
             \brief The method for erase records using key and value
 
@@ -694,6 +1815,43 @@ namespace mvlt
         */
         void SortBy(const std::string& key, const std::function<bool(const VaultRecordRef& ref)>& func, const bool& isReverse = false, const std::size_t& amountOfRecords = -1) const noexcept;
 
+        /**
+            \brief Method for getting first sorted records that match the predicat
+
+            \param [in] key The key by which the data should be sorted
+            \param [in] amountOfRecords The number of records
+            \param [in] requestPredicat The function which is called for each record in sorted order. The record is added if it returns true
+            \param [in] isReverse Sort in descending order or descending order. By default, ascending
+
+            The iteration stops as soon as amountOfRecords records are found.
+            If the key is missing in the vault, the result vector will be empty
+            \return A vector with links to records
+        */
+        std::vector<VaultRecordRef> GetTopRecords(const std::string& key, const std::size_t& amountOfRecords,
+            const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat, const bool& isReverse = false) const noexcept;
+
+        /**
+            \brief Method for getting the next page of sorted records
+
+            The page starts right after the record saved in the cursor and the cursor is moved to the last read record.
+            If the key has the B+tree, then the page is found in O(log n) regardless of the number of previous pages.
+            Otherwise records after the cursor are sorted every time. If the page has less than pageSize records, then it is the last page.
+
+            \tparam <T> Key type
+
+            \param [in] key The key by which the data should be sorted
+            \param [in] cursor The position of the page. Default constructed cursor points to the first page
+            \param [in] pageSize The maximum number of records on the page
+            \param [out] records The vector to store links to records of the page
+            \param [in] isReverse Sort in descending order or descending order. By default, ascending
+            \param [in] requestPredicat The function which is called for each record in sorted order. The record is added if it returns true
+
+            \return VaultOperationResult object with GetSortedPage result
+        */
+        template <class T>
+        VaultOperationResult GetSortedPage(const std::string& key, VaultPageCursor<T>& cursor, const std::size_t& pageSize, std::vector<VaultRecordRef>& records,
+            const bool& isReverse = false, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat) const noexcept;
+
         /**
             \brief Method for saving the contents of the Vault in json
 
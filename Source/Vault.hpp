@@ -5,25 +5,25 @@
 
 #include "VaultRecord.hpp"
 #include "VaultParamInput.hpp"
+#include "VaultRecordSnapshot.hpp"
 
 // This file contains an implementation of the Vault template methods
 namespace mvlt
 {
     template <class T>
-    VaultOperationResult Vault::SetDataToRecord(VaultRecord* dataRecord, const std::string& key, const T& data) noexcept
+    VaultOperationResult Vault::SetDataToRecord(VaultRecord* dataRecord, const std::string& key, T&& data) noexcept
     {
         DBG_LOG_ENTER();
 
+        typedef typename std::decay<T>::type Type;
+
         // Fill res info known at start
         VaultOperationResult res;
         res.Key = key;
-        res.RequestedType = typeid(T);
+        res.RequestedType = typeid(Type);
 
-        // A pointer for storing a hash table with T type key and vault record as value
-        UnorderedMap<T, VaultRecord*>* TtoVaultRecordHashMap = nullptr;
-
-        // A pointer for storing a binary tree with T type key and vault record as value
-        Map<T, VaultRecord*>* TtoVaultRecordMap = nullptr;
+        // A pointer for storing positions of records inside the key structures
+        KeyIndexHandles<Type>* TtoVaultRecordIndexHandles = nullptr;
 
         // Lock Vault to write
         WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
@@ -52,19 +52,11 @@ namespace mvlt
             return res;
         }
 
+        // Get positions of records inside the key structures
+        VaultIndexHandlesStructure.GetData(key, TtoVaultRecordIndexHandles);
 
-        // Get std::unordered_multimap with T key and VaultRecord* value
-        VaultHashMapStructure.GetData(key, TtoVaultRecordHashMap);
-
-        // Get the current value of the key key inside the VaultRecordRef and save it for further work
-        T oldData{};
-        dataRecord->GetData(key, oldData);
-
-        // Remove oldData from TtoVaultRecordHashMap from VaultHashMapStructure
-        auto FirstAndLastIteratorsWithKeyOnHashMap = TtoVaultRecordHashMap->EqualRange(oldData);
-
-        // Check if it is unique key and try to set duplicate data
-        if (!TtoVaultRecordHashMap->IsMultiContainer() && FirstAndLastIteratorsWithKeyOnHashMap.first != TtoVaultRecordHashMap->End())
+        // Move record to the new value inside the key structures. It fails if it is unique key and try to set duplicate data
+        if (!TtoVaultRecordIndexHandles->Update(dataRecord, data))
         {
             res.IsOperationSuccess = false;
             res.ResultCode = VaultOperationResultCode::UniqueKeyValueAlredyInSet;
@@ -72,62 +64,101 @@ namespace mvlt
             return res;
         }
 
-        // Iterate over all data records with oldData key
-        for (auto& pairIt = FirstAndLastIteratorsWithKeyOnHashMap.first; pairIt != FirstAndLastIteratorsWithKeyOnHashMap.second; ++pairIt)
+        // Check if this method was original called. That mean that this method called not from next if statement.
+        // It is required since VaultRecordSet child of Vault and may also call this method
+        if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
         {
-            // Find required data record
-            if ((*pairIt).second == dataRecord)
-            {
-                TtoVaultRecordHashMap->Erase((*pairIt).first);
-                break;
-            }
+            // Composite indexes and group aggregates read old key values from the record, so the record is erased from them before data change
+            EraseFromCompositeIndexes(dataRecord, key);
+            EraseFromGroupAggregates(dataRecord, key);
+
+            // Update all dependent VaultRecordSets
+            dataRecord->UpdateDependentSets(key, data);
+
+            // Update data inside VaultRecord pointer inside VaultRecordRef and Vault. Data is moved only after all copies to indexes are done
+            dataRecord->SetData(key, std::forward<T>(data));
+
+            AddToCompositeIndexes(dataRecord, key);
+            AddToGroupAggregates(dataRecord, key);
+            AddToLockFreeReadIndex(dataRecord);
         }
 
-        // Add new data to TtoVaultRecordHashMap to Vault VaultHashMapStructure
-        TtoVaultRecordHashMap->Emplace(data, dataRecord);
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        return res;
+    }
 
+    template <class T, class D>
+    VaultOperationResult Vault::SetDataToRecord(VaultRecord* dataRecord, const KeyHandle<T>& keyHandle, D&& data) noexcept
+    {
+        DBG_LOG_ENTER();
 
-        // Get std::multimap with T key and VaultRecord* value
-        VaultMapStructure.GetData(key, TtoVaultRecordMap);
+        // Fill res info known at start
+        VaultOperationResult res;
+        res.Key = keyHandle.Key;
+        res.RequestedType = typeid(T);
 
-        // Remove oldData from TtoVaultRecordMap from VaultMapStructure
-        auto FirstAndLastIteratorsWithKeyOnMap = TtoVaultRecordMap->EqualRange(oldData);
+        // Lock Vault to write
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
 
-        // Iterate over all data records with oldData key
-        for (auto& pairIt = FirstAndLastIteratorsWithKeyOnMap.first; pairIt != FirstAndLastIteratorsWithKeyOnMap.second; ++pairIt)
+        // Check if dataRecord valid
+        if (dataRecord == nullptr || !dataRecord->GetIsValid())
         {
-            // Find required data record
-            if ((*pairIt).second == dataRecord)
-            {
-                TtoVaultRecordMap->Erase((*pairIt).first);
-                break;
-            }
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::DataRecordNotValid;
+            return res;
         }
 
-        // Add new data to TtoVaultRecordMap to Vault VaultMapStructure
-        TtoVaultRecordMap->Emplace(data, dataRecord);
+        // Check if handle valid
+        if (!IsKeyHandleValid(keyHandle))
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongKey;
+            return res;
+        }
 
+        res.SavedType = res.RequestedType;
 
-        // Check if this method was original called. That mean that this method called not from next if statement.
-        // It is required since VaultRecordSet child of Vault and may also call this method
-        if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
+        // Move record to the new value inside the key structures. It fails if it is unique key and try to set duplicate data
+        if (!keyHandle.TtoVaultRecordIndexHandles->Update(dataRecord, data))
         {
-            // Update all dependent VaultRecordSets
-            dataRecord->UpdateDependentSets(key, data);
-
-            // Update data inside VaultRecord pointer inside VaultRecordRef and Vault
-            dataRecord->SetData(key, data);
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::UniqueKeyValueAlredyInSet;
+            return res;
         }
 
+        // Composite indexes and group aggregates read old key values from the record, so the record is erased from them before data change
+        EraseFromCompositeIndexes(dataRecord, keyHandle.Key);
+        EraseFromGroupAggregates(dataRecord, keyHandle.Key);
+
+        // Update all dependent VaultRecordSets
+        dataRecord->UpdateDependentSets(keyHandle.Key, data);
+
+        // Update data inside VaultRecord column. Data is moved only after all copies to indexes are done
+        keyHandle.Column->SetDataUnchecked(dataRecord->Row, std::forward<D>(data));
+
+        AddToCompositeIndexes(dataRecord, keyHandle.Key);
+        AddToGroupAggregates(dataRecord, keyHandle.Key);
+        AddToLockFreeReadIndex(dataRecord);
+
         res.IsOperationSuccess = true;
         res.ResultCode = VaultOperationResultCode::Success;
 
         return res;
     }
 
+    template <class T>
+    bool Vault::IsKeyHandleValid(const KeyHandle<T>& keyHandle) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        return keyHandle.Vlt == this && keyHandle.KeysVersion == KeysVersion;
+    }
+
     template <class T>
     VaultOperationResult Vault::RequestRecordsSet(const VaultRequestType& requestType, const std::string& key, const T& beginKeyValue,
-        const T& endKeyValue, std::unordered_set<VaultRecord*>& vaultRecords, const bool& isIncludeBeginKeyValue, 
+        const T& endKeyValue, VaultRecordBitmap& vaultRecords, const bool& isIncludeBeginKeyValue, 
         const bool& isIncludeEndKeyValue, const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
     {
         DBG_LOG_ENTER();
@@ -156,46 +187,114 @@ namespace mvlt
             return res;
         }
         
+        // Pointer to store positions of records inside the key structures
+        KeyIndexHandles<T>* TtoVaultRecordIndexHandles = nullptr;
+
+        // Get structures
+        BuildLazyKeyIndex(key);
+        VaultIndexHandlesStructure.GetData(key, TtoVaultRecordIndexHandles);
+
+        RequestRecordsSet(requestType, TtoVaultRecordIndexHandles, key, beginKeyValue, endKeyValue, vaultRecords,
+            isIncludeBeginKeyValue, isIncludeEndKeyValue, amountOfRecords, requestPredicat);
+
+        res.ResultCode = VaultOperationResultCode::Success;
+        res.SavedType = res.RequestedType;
+        res.IsOperationSuccess = true;
+
+        return res;
+    }
+
+    template <class T>
+    void Vault::RequestRecordsSet(const VaultRequestType& requestType, KeyIndexHandles<T>* TtoVaultRecordIndexHandles,
+        const std::string& key, const T& beginKeyValue, const T& endKeyValue, VaultRecordBitmap& vaultRecords,
+        const bool& isIncludeBeginKeyValue, const bool& isIncludeEndKeyValue, const std::size_t& amountOfRecords,
+        const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        std::size_t counter = 0;
+
+        // Function to add found record to vaultRecords
+        auto addRecord = [&](VaultRecord* record)
+        {
+            // Check added records count
+            if (counter >= amountOfRecords) return false;
+
+            // Check if it is not default predicate
+            if (&requestPredicat != &DefaultRequestPredicat)
+            {
+                if (requestPredicat(VaultRecordRef(record, const_cast<Vault*>(this))))
+                    vaultRecords.emplace(record);
+            }
+            else
+                vaultRecords.emplace(record);
+
+            ++counter;
+            return true;
+        };
+
+        FindRecords(requestType, TtoVaultRecordIndexHandles, key, beginKeyValue, endKeyValue, isIncludeBeginKeyValue, isIncludeEndKeyValue, addRecord);
+    }
+
+    template <class T, class F>
+    void Vault::FindRecords(const VaultRequestType& requestType, KeyIndexHandles<T>* TtoVaultRecordIndexHandles, const std::string& key,
+        const T& beginKeyValue, const T& endKeyValue, const bool& isIncludeBeginKeyValue, const bool& isIncludeEndKeyValue, const F& func) const noexcept
+    {
+        DBG_LOG_ENTER();
+
         // Check if request type is equal
         if (requestType == VaultRequestType::Equal)
         {
-            // Pointer to store hash map inside VaultStructureHashMap
-            UnorderedMap<T, VaultRecord*>* TtoVaultRecordHashMap = nullptr;
-
-            // Get hash map
-            VaultHashMapStructure.GetData(key, TtoVaultRecordHashMap);
-            
-            // Pair with begin and end iterator with T type and beginKeyValue value
-            auto equalRange = TtoVaultRecordHashMap->EqualRange(beginKeyValue);
-            if (equalRange.first != TtoVaultRecordHashMap->End())
+            FindEqualRecords(TtoVaultRecordIndexHandles, key, beginKeyValue, func);
+        }
+        else if (!TtoVaultRecordIndexHandles->IsOrderedIndexed())
+        {
+            // The key has no map, so check values of all records
+            for (VaultRecord* record : RecordsSet)
             {
-                std::size_t counter = 0;
-                for (auto equalRangeIt = equalRange.first; equalRangeIt != equalRange.second; ++equalRangeIt)
+                T value{};
+                record->GetData(key, value);
+
+                bool isMatch = false;
+
+                // Switch by request type
+                switch (requestType) 
                 {
-                    // Check added records count
-                    if (counter >= amountOfRecords) break;
+                case VaultRequestType::GreaterOrEqual:
+                    isMatch = !(value < beginKeyValue);
+                    break;
 
-                    // Check if it is not default predicate
-                    if (&requestPredicat != &DefaultRequestPredicat)
-                    {
-                        if (requestPredicat(VaultRecordRef((*equalRangeIt).second, const_cast<Vault*>(this))))
-                            vaultRecords.emplace((*equalRangeIt).second);
-                    }
-                    else
-                        vaultRecords.emplace((*equalRangeIt).second);
-                    
-                    ++counter;
+                case VaultRequestType::Greater:
+                    isMatch = beginKeyValue < value;
+                    break;
+
+                case VaultRequestType::Less:
+                    isMatch = value < endKeyValue;
+                    break;
+
+                case VaultRequestType::LessOrEqual:
+                    isMatch = !(beginKeyValue < value);
+                    break;
+
+                case VaultRequestType::Interval:
+                    isMatch = (isIncludeBeginKeyValue ? !(value < beginKeyValue) : beginKeyValue < value) &&
+                        (isIncludeEndKeyValue ? !(endKeyValue < value) : value < endKeyValue);
+                    break;
+
+                case VaultRequestType::Equal:
+                case VaultRequestType::Or:
+                case VaultRequestType::And:
+                default:
+                    break;
                 }
+
+                if (isMatch && !func(record)) break;
             }
         }
         else 
         {
-            // Pointer to store map inside VaultStructureHashMap
-            Map<T, VaultRecord*>* TtoVaultRecordMap = nullptr;
+            Map<T, VaultRecord*>* TtoVaultRecordMap = TtoVaultRecordIndexHandles->TtoVaultRecordMap;
 
-            // Get map
-            VaultMapStructure.GetData(key, TtoVaultRecordMap);
-            
             // Iterator to set it in switch
             decltype(TtoVaultRecordMap->End()) startIt{}, endIt{};
 
@@ -243,29 +342,198 @@ namespace mvlt
                 break;
             }
 
-            std::size_t counter = 0;
             for (auto TtoVaultRecordMapIt = startIt; TtoVaultRecordMapIt != endIt; ++TtoVaultRecordMapIt)
+                if (!func((*TtoVaultRecordMapIt).second)) break;
+        }
+    }
+
+    template <class T>
+    VaultOperationResult Vault::ScanRecords(const VaultRequestType& requestType, const std::string& key, const T& beginKeyValue,
+        const T& endKeyValue, const bool& isIncludeBeginKeyValue, const bool& isIncludeEndKeyValue,
+        const std::function<bool(const VaultRecordRef& ref)>& requestPredicat, const std::function<bool(VaultRecord* record)>& func) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res = CheckRequestKey(key, typeid(T));
+        if (!res.IsOperationSuccess) return res;
+
+        // Pointer to store positions of records inside the key structures
+        KeyIndexHandles<T>* TtoVaultRecordIndexHandles = nullptr;
+
+        // Get structures
+        BuildLazyKeyIndex(key);
+        VaultIndexHandlesStructure.GetData(key, TtoVaultRecordIndexHandles);
+
+        // The default predicat accepts all records, so there is no need to call it
+        bool isDefaultPredicat = requestPredicat.target_type() == DefaultRequestPredicat.target_type();
+        Vault* vlt = const_cast<Vault*>(this);
+
+        FindRecords(requestType, TtoVaultRecordIndexHandles, key, beginKeyValue, endKeyValue, isIncludeBeginKeyValue, isIncludeEndKeyValue,
+            [&](VaultRecord* record)
             {
-                if (counter >= amountOfRecords) break;
+                if (!isDefaultPredicat && !requestPredicat(VaultRecordRef(record, vlt))) return true;
+                return func(record);
+            });
 
-                // Check if it is not default predicate
-                if (&requestPredicat != &DefaultRequestPredicat)
-                {
-                    if (requestPredicat(VaultRecordRef((*TtoVaultRecordMapIt).second, const_cast<Vault*>(this))))
-                        vaultRecords.emplace((*TtoVaultRecordMapIt).second);
-                }
-                else
-                    vaultRecords.emplace((*TtoVaultRecordMapIt).second);
+        return res;
+    }
 
-                ++counter;
+    template <class T, class F>
+    void Vault::FindEqualRecords(KeyIndexHandles<T>* TtoVaultRecordIndexHandles, const std::string& key, const T& keyValue, const F& func) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        if (TtoVaultRecordIndexHandles->IsHashIndexed())
+        {
+            // Pair with begin and end iterator with T type and keyValue value
+            auto equalRange = TtoVaultRecordIndexHandles->TtoVaultRecordHashMap->EqualRange(keyValue);
+            for (auto equalRangeIt = equalRange.first; equalRangeIt != equalRange.second; ++equalRangeIt)
+                if (!func((*equalRangeIt).second)) break;
+        }
+        else if (TtoVaultRecordIndexHandles->IsOrderedIndexed())
+        {
+            // Pair with begin and end iterator with T type and keyValue value
+            auto equalRange = TtoVaultRecordIndexHandles->TtoVaultRecordMap->EqualRange(keyValue);
+            for (auto equalRangeIt = equalRange.first; equalRangeIt != equalRange.second; ++equalRangeIt)
+                if (!func((*equalRangeIt).second)) break;
+        }
+        else
+        {
+            // The key has no structures, so check values of all records
+            for (VaultRecord* record : RecordsSet)
+            {
+                T value{};
+                record->GetData(key, value);
+                if (value == keyValue && !func(record)) break;
             }
         }
+    }
 
-        res.ResultCode = VaultOperationResultCode::Success;
-        res.SavedType = res.RequestedType;
-        res.IsOperationSuccess = true;
+    template <class T>
+    std::size_t Vault::CountRecords(const VaultRequestType& requestType, const std::string& key, const T& keyValue) const noexcept
+    {
+        DBG_LOG_ENTER();
 
-        return res;
+        // Pointer to store positions of records inside the key structures
+        KeyIndexHandles<T>* TtoVaultRecordIndexHandles = nullptr;
+        BuildLazyKeyIndex(key);
+        VaultIndexHandlesStructure.GetData(key, TtoVaultRecordIndexHandles);
+
+        // The hash map knows the number of records with the value
+        if (requestType == VaultRequestType::Equal && TtoVaultRecordIndexHandles->IsHashIndexed())
+            return TtoVaultRecordIndexHandles->TtoVaultRecordHashMap->Count(keyValue);
+
+        std::size_t counter = 0;
+
+        if (!TtoVaultRecordIndexHandles->IsOrderedIndexed())
+        {
+            // The key has no structure for the request, so check values of all records
+            FindRecords(requestType, TtoVaultRecordIndexHandles, key, keyValue, keyValue, false, false, [&](VaultRecord*)
+                {
+                    ++counter;
+                    return true;
+                });
+
+            return counter;
+        }
+
+        Map<T, VaultRecord*>* TtoVaultRecordMap = TtoVaultRecordIndexHandles->TtoVaultRecordMap;
+
+        // The map counts records between bounds without reading them
+        switch (requestType)
+        {
+        case VaultRequestType::Equal:
+            counter = TtoVaultRecordMap->Distance(TtoVaultRecordMap->LowerBound(keyValue), TtoVaultRecordMap->UpperBound(keyValue));
+            break;
+
+        case VaultRequestType::GreaterOrEqual:
+            counter = TtoVaultRecordMap->Distance(TtoVaultRecordMap->LowerBound(keyValue), TtoVaultRecordMap->End());
+            break;
+
+        case VaultRequestType::Greater:
+            counter = TtoVaultRecordMap->Distance(TtoVaultRecordMap->UpperBound(keyValue), TtoVaultRecordMap->End());
+            break;
+
+        case VaultRequestType::Less:
+            counter = TtoVaultRecordMap->Distance(TtoVaultRecordMap->Begin(), TtoVaultRecordMap->LowerBound(keyValue));
+            break;
+
+        case VaultRequestType::LessOrEqual:
+            counter = TtoVaultRecordMap->Distance(TtoVaultRecordMap->Begin(), TtoVaultRecordMap->UpperBound(keyValue));
+            break;
+
+        case VaultRequestType::Interval:
+        case VaultRequestType::Or:
+        case VaultRequestType::And:
+        default:
+            break;
+        }
+
+        return counter;
+    }
+
+    template <class T>
+    std::size_t Vault::EstimateRecords(const VaultRequestType& requestType, const std::string& key, const T& keyValue) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        // Pointer to store positions of records inside the key structures
+        KeyIndexHandles<T>* TtoVaultRecordIndexHandles = nullptr;
+        BuildLazyKeyIndex(key);
+        VaultIndexHandlesStructure.GetData(key, TtoVaultRecordIndexHandles);
+
+        // Without structures the request checks all records
+        if (!TtoVaultRecordIndexHandles->IsOrderedIndexed() &&
+            (requestType != VaultRequestType::Equal || !TtoVaultRecordIndexHandles->IsHashIndexed()))
+            return RecordsSet.size();
+
+        return CountRecords(requestType, key, keyValue);
+    }
+
+    template <class T>
+    bool Vault::IsRecordMatch(VaultRecord* record, const VaultRequestType& requestType, const std::string& key, const T& keyValue,
+        const std::function<bool(const VaultRecordRef& ref)>* requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        T value{};
+        record->GetData(key, value);
+
+        bool isMatch = false;
+
+        switch (requestType)
+        {
+        case VaultRequestType::GreaterOrEqual:
+            isMatch = !(value < keyValue);
+            break;
+
+        case VaultRequestType::Greater:
+            isMatch = keyValue < value;
+            break;
+
+        case VaultRequestType::Equal:
+            isMatch = value == keyValue;
+            break;
+
+        case VaultRequestType::LessOrEqual:
+            isMatch = !(keyValue < value);
+            break;
+
+        case VaultRequestType::Less:
+            isMatch = value < keyValue;
+            break;
+
+        case VaultRequestType::Interval:
+        case VaultRequestType::Or:
+        case VaultRequestType::And:
+        default:
+            break;
+        }
+
+        if (isMatch && requestPredicat != nullptr)
+            isMatch = (*requestPredicat)(VaultRecordRef(record, const_cast<Vault*>(this)));
+
+        return isMatch;
     }
 
     template <class T>
@@ -280,34 +548,59 @@ namespace mvlt
         // Lock Vault to read
         ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
 
-        // If it is Vault object
-        if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
+        // Attach vaultRecordSet to this and remove old data from it
+        PrepareRecordSet(vaultRecordSet);
+
+        res = RequestRecordsSet(requestType, key, beginKeyValue, endKeyValue, vaultRecordSet.RecordsSet, isIncludeBeginKeyValue, isIncludeEndKeyValue, amountOfRecords, requestPredicat);
+
+        // Records are shared with sets of other readers
+        std::lock_guard<std::mutex> dependentSetsLock(vaultRecordSet.ParentVault->DependentSetsMtx);
+
+        for (VaultRecord* record : vaultRecordSet.RecordsSet)
         {
-            // Save vaultRecordSet
-            RecordSetsSet.emplace(&vaultRecordSet);
+            // Add pointer to record to vaultRecordSet structure
+            for (auto& adder : vaultRecordSet.VaultRecordAdders)
+                adder.second(record);
+            
+            record->AddToDependentSets(&vaultRecordSet);
+        }
 
-            // Remove old data from vaultRecordSet
-            if (vaultRecordSet.ParentVault != this)
-            {
-                vaultRecordSet.Reset();
+        return res;
+    }
 
-                // Set new parent vault to vaultRecordSet
-                vaultRecordSet.ParentVault = const_cast<Vault*>(this);
+    template <class T>
+    VaultOperationResult Vault::RequestRecords(const VaultRequestType& requestType, const KeyHandle<T>& keyHandle, const T& beginKeyValue,
+        const T& endKeyValue, VaultRecordSet& vaultRecordSet, const bool& isIncludeBeginKeyValue, 
+        const bool& isIncludeEndKeyValue, const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
 
-                // Copy keys from this to vaultRecordSet
-                for (auto& keyCopierIt : VaultKeyCopiers)
-                    keyCopierIt.second(&vaultRecordSet);
+        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value.");
 
-                // Set proper key order
-                vaultRecordSet.KeysOrder = KeysOrder;
+        // Fill res info known at start
+        VaultOperationResult res;
+        res.Key = keyHandle.Key;
+        res.RequestedType = typeid(T);
 
-                // Set unique keys
-                vaultRecordSet.UniqueKeys = UniqueKeys;
-            }
-            else vaultRecordSet.Clear();
+        // Lock Vault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        // Check if handle valid
+        if (!IsKeyHandleValid(keyHandle))
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongKey;
+            return res;
         }
 
-        res = RequestRecordsSet(requestType, key, beginKeyValue, endKeyValue, vaultRecordSet.RecordsSet, isIncludeBeginKeyValue, isIncludeEndKeyValue, amountOfRecords, requestPredicat);
+        // Attach vaultRecordSet to this and remove old data from it
+        PrepareRecordSet(vaultRecordSet);
+
+        RequestRecordsSet(requestType, keyHandle.TtoVaultRecordIndexHandles, keyHandle.Key, beginKeyValue, endKeyValue, 
+            vaultRecordSet.RecordsSet, isIncludeBeginKeyValue, isIncludeEndKeyValue, amountOfRecords, requestPredicat);
+
+        // Records are shared with sets of other readers
+        std::lock_guard<std::mutex> dependentSetsLock(vaultRecordSet.ParentVault->DependentSetsMtx);
 
         for (VaultRecord* record : vaultRecordSet.RecordsSet)
         {
@@ -318,12 +611,16 @@ namespace mvlt
             record->AddToDependentSets(&vaultRecordSet);
         }
 
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+        res.SavedType = res.RequestedType;
+
         return res;
     }
 
     template <class T>
     VaultOperationResult Vault::AddKey(const std::string& key, const T& defaultKeyValue, const bool& isUniqueKey, const bool& isUniqueKeyWithoutLambda,
-        const std::function<T(const std::size_t& counter, const VaultRecordRef& ref)>& uniqueKeyFunction) noexcept
+        const std::function<T(const std::size_t& counter, const VaultRecordRef& ref)>& uniqueKeyFunction, const VaultIndexPolicy& indexPolicy) noexcept
     {
         DBG_LOG_ENTER();
 
@@ -344,6 +641,14 @@ namespace mvlt
             return res;
         }
 
+        // Unique values are checked using key structures
+        if (isUniqueKey && indexPolicy == VaultIndexPolicy::None)
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::UniqueKeyWithoutIndex;
+            return res;
+        }
+
         // Create new hash map to store data with template T key
         UnorderedMap<T, VaultRecord*>* TtoVaultRecordHashMap = new UnorderedMap<T, VaultRecord*>(!isUniqueKey);
         VaultHashMapStructure.SetData(key, TtoVaultRecordHashMap, [](const void* ptr)
@@ -360,6 +665,18 @@ namespace mvlt
             }
         );
 
+        // Create new structure to store positions of records inside TtoVaultRecordHashMap and TtoVaultRecordMap
+        // VaultRecordSet does not fill the key indexes until the first request with the key. Records are unique in the parent Vault,
+        // so there is nothing to check for unique keys, and requests without indexes read all records of the set
+        bool isLazyIndex = VaultDerivedClass != VaultDerivedClasses::VaultBase && indexPolicy != VaultIndexPolicy::None;
+        KeyIndexHandles<T>* TtoVaultRecordIndexHandles = new KeyIndexHandles<T>(key, TtoVaultRecordHashMap, TtoVaultRecordMap,
+            isLazyIndex ? VaultIndexPolicy::None : indexPolicy);
+        VaultIndexHandlesStructure.SetData(key, TtoVaultRecordIndexHandles, [](const void* ptr)
+            {
+                delete* (KeyIndexHandles<T>**)ptr;
+            }
+        );
+
         // Add new data to record set
         if (isUniqueKey)
         {
@@ -381,9 +698,8 @@ namespace mvlt
                 T value = uniqueKeyFunction(counter, VaultRecordRef(recordsSetIt, this));
                 ++counter;
 
-                auto emplacePair = TtoVaultRecordHashMap->Emplace(value, recordsSetIt);
                 // If failed to emplace unique key then it is duplicate and error in uniqueKeyFunction
-                if (!emplacePair.second)
+                if (!TtoVaultRecordIndexHandles->Emplace(value, recordsSetIt))
                 {
                     isCorrectKey = false;
                     break;
@@ -395,20 +711,25 @@ namespace mvlt
             // If key correct then add data to all places
             if (isCorrectKey)
             {
+                // Add column to store key data. VaultRecordSet records store data in parent Vault columns
+                if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
+                    Storage->AddColumn(key, defaultKeyValue);
+
                 counter = 0;
-                for (VaultRecord* recordsSetIt : RecordsSet)
+                if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
                 {
-                    TtoVaultRecordMap->Emplace(cachedData[counter], recordsSetIt);
-                    if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
+                    for (VaultRecord* recordsSetIt : RecordsSet)
+                    {
                         recordsSetIt->SetData(key, cachedData[counter]);
-
-                    ++counter;
+                        ++counter;
+                    }
                 }
             }
             else
             {
                 VaultHashMapStructure.EraseData(key);
                 VaultMapStructure.EraseData(key);
+                VaultIndexHandlesStructure.EraseData(key);
 
                 res.IsOperationSuccess = false;
                 res.ResultCode = VaultOperationResultCode::UniqueKeyValueAlredyInSet;
@@ -417,12 +738,12 @@ namespace mvlt
         }
         else
         {
+            // Add column filled with default value to store key data. VaultRecordSet records store data in parent Vault columns
+            if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
+                Storage->AddColumn(key, defaultKeyValue);
+
             for (VaultRecord* recordsSetIt : RecordsSet)
-            {
-                recordsSetIt->SetData(key, defaultKeyValue);
-                TtoVaultRecordHashMap->Emplace(defaultKeyValue, recordsSetIt);
-                TtoVaultRecordMap->Emplace(defaultKeyValue, recordsSetIt);
-            }
+                TtoVaultRecordIndexHandles->Emplace(defaultKeyValue, recordsSetIt);
         }
 
         // Add key to list with key order
@@ -441,19 +762,27 @@ namespace mvlt
         // Add function to VaultRecord creation
         VaultRecordAdders.emplace(key, [=](VaultRecord* newRecord)
             {
-                // Make temporary variable to store key value
-                T value = defaultKeyValue;
-                // Try to get key value from new record. If it is not value inside then defaultKeyValue will be used
-                newRecord->GetData(key, value);
-
-                // Try to emplace data into hash table. If it is multi container then it is always emplaced
+                // Try to emplace data into hash table and map. If it is multi container then it is always emplaced
                 // If it is not multi container then data emplaced only if it was not same data alredy in hash table
-                auto emplaceRes = TtoVaultRecordHashMap->Emplace(value, newRecord);
+                return TtoVaultRecordIndexHandles->Emplace(newRecord->GetDataRef<T>(key), newRecord);
+            }
+        );
+
+        // Add function to add many new records at once
+        VaultRecordRangeAdders.emplace(key, [=](const std::vector<VaultRecord*>& newRecords)
+            {
+                std::vector<std::pair<T, VaultRecord*>> items;
+                items.reserve(newRecords.size());
+
+                for (VaultRecord* newRecord : newRecords)
+                {
+                    items.emplace_back(newRecord->GetDataRef<T>(key), newRecord);
+                }
 
-                // Return false if data alredy in hash table
-                if (!emplaceRes.second) return false;
+                // Values of unique key are checked before any of them is added, so nothing to roll back
+                if (!TtoVaultRecordIndexHandles->IsUniqueRange(items)) return false;
 
-                TtoVaultRecordMap->Emplace(value, newRecord);
+                TtoVaultRecordIndexHandles->EmplaceRange(std::move(items));
                 return true;
             }
         );
@@ -461,48 +790,43 @@ namespace mvlt
         // Add function to TtoVaultRecordHashMap clearing
         VaultRecordClearers.emplace(key, [=]()
             {
-                TtoVaultRecordHashMap->Clear();
-                TtoVaultRecordMap->Clear();
+                TtoVaultRecordIndexHandles->Clear();
             }
         );
 
         // Add function to erase record from TtoVaultRecordHashMap
         VaultRecordErasers.emplace(key, [=](VaultRecord* record)
             {
-                // Get T type data with key key
-                T recordTData{};
-                record->GetData(key, recordTData);
+                // Erase record using its positions inside TtoVaultRecordHashMap and TtoVaultRecordMap
+                TtoVaultRecordIndexHandles->Erase(record);
+            }
+        );
 
-                // Find all elements on multi_map with recordTData value
-                auto FirstAndLastIteratorsWithKeyOnHashMap = TtoVaultRecordHashMap->EqualRange(recordTData);
+        VaultRecordSorters.emplace(key, [=](const std::function<bool(const VaultRecordRef& ref)>& functionToSortedData, Vault* vltPtr, const bool& isReverse)
+        {
+            if (!TtoVaultRecordIndexHandles->IsOrderedIndexed())
+            {
+                // The key has no map, so sort all records by key value
+                std::vector<std::pair<T, VaultRecord*>> sortedRecords;
+                sortedRecords.reserve(vltPtr->RecordsSet.size());
 
-                // Find record and erase it from TtoVaultRecordHashMap
-                for (auto pairIt = FirstAndLastIteratorsWithKeyOnHashMap.first; pairIt != FirstAndLastIteratorsWithKeyOnHashMap.second; ++pairIt)
+                for (VaultRecord* record : vltPtr->RecordsSet)
                 {
-                    if ((*pairIt).second == record)
-                    {
-                        TtoVaultRecordHashMap->Erase(pairIt);
-                        break;
-                    }
+                    T value{};
+                    record->GetData(key, value);
+                    sortedRecords.emplace_back(std::move(value), record);
                 }
 
-                // Find all elements on map with recordTData value
-                auto FirstAndLastIteratorsWithKeyOnMap = TtoVaultRecordMap->EqualRange(recordTData);
-                // Find record and erase it from TtoVaultRecordHashMap
-                for (auto pairIt = FirstAndLastIteratorsWithKeyOnMap.first; pairIt != FirstAndLastIteratorsWithKeyOnMap.second; ++pairIt)
+                std::stable_sort(sortedRecords.begin(), sortedRecords.end(), [&](const std::pair<T, VaultRecord*>& a, const std::pair<T, VaultRecord*>& b)
                 {
-                    if ((*pairIt).second == record)
-                    {
-                        TtoVaultRecordMap->Erase((*pairIt).first);
+                    return isReverse ? b.first < a.first : a.first < b.first;
+                });
+
+                for (const auto& sortedRecord : sortedRecords)
+                    if(!functionToSortedData(VaultRecordRef(sortedRecord.second, vltPtr)))
                         break;
-                    }
-                }
             }
-        );
-
-        VaultRecordSorters.emplace(key, [=](const std::function<bool(const VaultRecordRef& ref)>& functionToSortedData, Vault* vltPtr, const bool& isReverse)
-        {
-            if (!isReverse)
+            else if (!isReverse)
             {
                 for (const auto& TtoVaultRecordMapIt : *TtoVaultRecordMap)
                     if(!functionToSortedData(VaultRecordRef(TtoVaultRecordMapIt.second, vltPtr)))
@@ -518,28 +842,47 @@ namespace mvlt
         
         VaultKeyCopiers.emplace(key, [=](Vault* vaultRecordSet)
         {
-            vaultRecordSet->AddKey(key, defaultKeyValue);
+            vaultRecordSet->AddKey(key, defaultKeyValue, indexPolicy);
         });
 
+        if (isLazyIndex)
+        {
+            std::lock_guard<std::mutex> lock(LazyKeyIndexersMtx);
+            LazyKeyIndexers[key] = [=](Vault* vltPtr)
+            {
+                TtoVaultRecordIndexHandles->IndexPolicy = indexPolicy;
+
+                for (VaultRecord* record : vltPtr->RecordsSet)
+                {
+                    T value = defaultKeyValue;
+                    record->GetData(key, value);
+                    TtoVaultRecordIndexHandles->Emplace(value, record);
+                }
+            };
+        }
+
         if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
         {
             for (VaultRecordSet* set : RecordSetsSet)
             {
                 if (isUniqueKey)
-                    set->AddUniqueKey(key, uniqueKeyFunction);
+                    set->AddUniqueKey(key, uniqueKeyFunction, indexPolicy);
                 else
-                    set->AddKey(key, defaultKeyValue);
+                    set->AddKey(key, defaultKeyValue, indexPolicy);
                 set->KeysOrder.emplace_back(key);
             }
         }
 
+        // Snapshots must contain the new key
+        RebuildLockFreeReadIndex();
+
         res.IsOperationSuccess = true;
         res.ResultCode = VaultOperationResultCode::Success;
         return res;
     }
 
     template <class T>
-    bool Vault::AddKey(const std::string& key, const T& defaultKeyValue) noexcept
+    bool Vault::AddKey(const std::string& key, const T& defaultKeyValue, const VaultIndexPolicy& indexPolicy) noexcept
     {
         DBG_LOG_ENTER();
 
@@ -547,11 +890,11 @@ namespace mvlt
             If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
             AddKey<std::string>(\"Key\", \"Value\") or AddKey(\"Key\", std::string(\"Value\"))");
 
-        return AddKey(key, defaultKeyValue, false, false, {[&](std::size_t counter, const VaultRecordRef&) -> T{ return defaultKeyValue; }}).IsOperationSuccess;
+        return AddKey(key, defaultKeyValue, false, false, {[&](std::size_t counter, const VaultRecordRef&) -> T{ return defaultKeyValue; }}, indexPolicy).IsOperationSuccess;
     }
 
     template <class T>
-    VaultOperationResult Vault::AddUniqueKey(const std::string& key) noexcept
+    VaultOperationResult Vault::AddUniqueKey(const std::string& key, const VaultIndexPolicy& indexPolicy) noexcept
     {
         DBG_LOG_ENTER();
 
@@ -559,15 +902,16 @@ namespace mvlt
             If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
             AddUniqueKey<std::string>(\"Key\")");
 
-        return AddKey(key, T{}, true, true, {[&](std::size_t counter, const VaultRecordRef&) -> T{ return T{}; }});
+        return AddKey(key, T{}, true, true, {[&](std::size_t counter, const VaultRecordRef&) -> T{ return T{}; }}, indexPolicy);
     }
 
     template <class T>
-    VaultOperationResult Vault::AddUniqueKey(const std::string& key, const std::function<T(const std::size_t& counter, const VaultRecordRef& ref)>& uniqueKeyFunction) noexcept
+    VaultOperationResult Vault::AddUniqueKey(const std::string& key, const std::function<T(const std::size_t& counter, const VaultRecordRef& ref)>& uniqueKeyFunction,
+        const VaultIndexPolicy& indexPolicy) noexcept
     {
         DBG_LOG_ENTER();
 
-        return AddKey(key, T{}, true, false, uniqueKeyFunction);
+        return AddKey(key, T{}, true, false, uniqueKeyFunction, indexPolicy);
     }
 
     template <class T>
@@ -616,6 +960,10 @@ namespace mvlt
         // Change data in template
         RecordTemplate.SetData(key, defaultKeyValue);
 
+        // Change default value for new rows in column
+        DataColumn* column = Storage->GetColumn(key);
+        if (column != nullptr) column->SetDefaultValue(defaultKeyValue);
+
         res.SavedType = res.RequestedType;
         res.ResultCode = VaultOperationResultCode::Success;
         return res;
@@ -669,15 +1017,12 @@ namespace mvlt
     }
 
     template <class T>
-    VaultOperationResult Vault::GetRecord(const std::string& key, const T& keyValue, VaultRecordRef& vaultRecordRef) const noexcept
+    VaultOperationResult Vault::GetKeyHandle(const std::string& key, KeyHandle<T>& keyHandle) const noexcept
     {
         DBG_LOG_ENTER();
 
-        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
-            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
-            GetRecord<std::string>(\"Key\", \"Value\") or GetRecord(\"Key\", std::string(\"Value\"))");
+        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value.");
 
-        // Fill res info known at start
         VaultOperationResult res;
         res.Key = key;
         res.RequestedType = typeid(T);
@@ -701,255 +1046,278 @@ namespace mvlt
             return res;
         }
 
-        // Pointer to store map inside VaultStructureHashMap
-        UnorderedMap<T, VaultRecord*>* TtoVaultRecordHashMap = nullptr;
+        keyHandle.Vlt = this;
+        keyHandle.Key = key;
+        keyHandle.KeysVersion = KeysVersion;
+        BuildLazyKeyIndex(key);
+        VaultIndexHandlesStructure.GetData(key, keyHandle.TtoVaultRecordIndexHandles);
+        keyHandle.Column = Storage->GetColumn(key);
 
-        // Checking whether such a key exists
-        VaultHashMapStructure.GetData(key, TtoVaultRecordHashMap);
-        
-        // Iterator to element with T type and keyValue value
-        auto TtoVaultRecordIt = TtoVaultRecordHashMap->Find(keyValue);
-        if (TtoVaultRecordIt != TtoVaultRecordHashMap->End())
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        return res;
+    }
+
+    template <class G, class V>
+    VaultOperationResult Vault::AddGroupBy(const std::string& groupKey, const std::string& valueKey) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        res.IsOperationSuccess = false;
+
+        // Lock Vault to write
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        // Check that both keys exist and have requested types
+        const std::pair<std::string, std::type_index> keys[] = { {groupKey, typeid(G)}, {valueKey, typeid(V)} };
+        for (const auto& key : keys)
         {
-            vaultRecordRef.SetRecord((*TtoVaultRecordIt).second, const_cast<Vault*>(this));
-            res.IsOperationSuccess = true;
-            res.ResultCode = VaultOperationResultCode::Success;
+            res.Key = key.first;
+            res.RequestedType = key.second;
+            res.SavedType = typeid(void);
+
+            auto keyTypeIt = KeysTypes.find(key.first);
+            if (keyTypeIt == KeysTypes.end())
+            {
+                res.ResultCode = VaultOperationResultCode::WrongKey;
+                return res;
+            }
+
+            res.SavedType = keyTypeIt->second;
+            if (res.SavedType != res.RequestedType)
+            {
+                res.ResultCode = VaultOperationResultCode::WrongType;
+                return res;
+            }
         }
-        else
+
+        res.Key.clear();
+        res.RequestedType = typeid(void);
+        res.SavedType = typeid(void);
+
+        if (FindGroupAggregate(groupKey, valueKey) != nullptr)
         {
-            vaultRecordRef.SetRecord(nullptr, const_cast<Vault*>(this));
-            res.IsOperationSuccess = false;
-            res.ResultCode = VaultOperationResultCode::WrongValue;
+            res.ResultCode = VaultOperationResultCode::DuplicateGroupBy;
+            return res;
         }
 
+        // Create aggregate and add all records to it
+        GroupAggregate* aggregate = new GroupAggregate(groupKey, valueKey, Storage->GetColumn(groupKey), Storage->GetColumn(valueKey));
+        aggregate->SetTypes<G, V>();
+        for (VaultRecord* record : RecordsSet)
+            aggregate->Emplace(record);
+
+        GroupAggregates.emplace_back(aggregate);
+
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
         return res;
     }
 
-    template <class T>
-    VaultOperationResult Vault::GetRecords(const std::string& key, const T& keyValue, std::vector<VaultRecordRef>& recordsRefs, const std::size_t& amountOfRecords) const noexcept
+    template <class G, class V>
+    VaultOperationResult Vault::GetGroups(const std::string& groupKey, const std::string& valueKey, std::unordered_map<G, VaultGroup<V>>& groups) const noexcept
     {
         DBG_LOG_ENTER();
 
-        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
-            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
-            GetRecords<std::string>(\"Key\", \"Value\") or GetRecords(\"Key\", std::string(\"Value\"))");
-
-        // Fill res info known at start
         VaultOperationResult res;
-        res.Key = key;
-        res.RequestedType = typeid(T);
-
-        recordsRefs.clear();
+        res.IsOperationSuccess = false;
 
         // Lock Vault to read
         ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
 
-        // If key not exist
-        if(!GetKeyType(key, res.SavedType))
+        const GroupAggregate* aggregate = FindGroupAggregate(groupKey, valueKey);
+        if (aggregate == nullptr)
         {
-            res.IsOperationSuccess = false;
-            res.ResultCode = VaultOperationResultCode::WrongKey;
+            res.ResultCode = VaultOperationResultCode::WrongGroupBy;
             return res;
         }
 
-        // Check types
-        if (res.SavedType != res.RequestedType)
+        const std::unordered_map<G, VaultGroup<V>>* aggregateGroups = aggregate->GetGroups<G, V>();
+        if (aggregateGroups == nullptr)
         {
-            res.IsOperationSuccess = false;
-            res.SetOpResult(VaultOperationResultCode::WrongType);
+            bool isGroupTypeWrong = aggregate->GetGroupType() != typeid(G);
+            res.Key = isGroupTypeWrong ? groupKey : valueKey;
+            res.RequestedType = isGroupTypeWrong ? std::type_index(typeid(G)) : std::type_index(typeid(V));
+            res.SavedType = isGroupTypeWrong ? aggregate->GetGroupType() : aggregate->GetValueType();
+            res.ResultCode = VaultOperationResultCode::WrongType;
             return res;
         }
 
-        // Pointer to store map inside VaultStructureHashMap
-        UnorderedMap<T, VaultRecord*>* TtoVaultRecordHashMap = nullptr;
-
-        // Checking whether such a key exists
-        VaultHashMapStructure.GetData(key, TtoVaultRecordHashMap);
-        
-        // Pair with begin and end iterator with T type and keyValue value
-        auto equalRange = TtoVaultRecordHashMap->EqualRange(keyValue);
-        if (equalRange.first != TtoVaultRecordHashMap->end())
-        {
-            std::size_t counter = 0;
-            for (auto equalRangeIt = equalRange.first; equalRangeIt != equalRange.second; ++equalRangeIt)
-            {
-                ++counter;
-                recordsRefs.emplace_back(VaultRecordRef((*equalRangeIt).second, const_cast<Vault*>(this)));
-                if (counter >= amountOfRecords) break;
-            }
-
-            res.IsOperationSuccess = true;
-            res.ResultCode = VaultOperationResultCode::Success;
-        }
-        else
-        {
-            res.IsOperationSuccess = false;
-            res.ResultCode = VaultOperationResultCode::WrongValue;
-        }
+        groups = *aggregateGroups;
 
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
         return res;
     }
 
-    template <class T>
-    VaultOperationResult Vault::RequestEqual(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
-        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    template <class G, class V>
+    VaultOperationResult Vault::GetGroup(const std::string& groupKey, const std::string& valueKey, const G& groupValue, VaultGroup<V>& group) const noexcept
     {
         DBG_LOG_ENTER();
 
-        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
-            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
-            RequestEqual<std::string>(\"Key\", \"Value\") or RequestEqual(\"Key\", std::string(\"Value\"))");
+        VaultOperationResult res;
+        res.IsOperationSuccess = false;
 
-        return RequestRecords(VaultRequestType::Equal, key, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
-    }
+        // Lock Vault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
 
-    template <class T>
-    VaultOperationResult Vault::RequestGreater(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
-        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
-    {
-        DBG_LOG_ENTER();
+        const GroupAggregate* aggregate = FindGroupAggregate(groupKey, valueKey);
+        if (aggregate == nullptr)
+        {
+            res.ResultCode = VaultOperationResultCode::WrongGroupBy;
+            return res;
+        }
 
-        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
-            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
-            RequestGreater<std::string>(\"Key\", \"Value\") or RequestGreater(\"Key\", std::string(\"Value\"))");
+        const std::unordered_map<G, VaultGroup<V>>* aggregateGroups = aggregate->GetGroups<G, V>();
+        if (aggregateGroups == nullptr)
+        {
+            bool isGroupTypeWrong = aggregate->GetGroupType() != typeid(G);
+            res.Key = isGroupTypeWrong ? groupKey : valueKey;
+            res.RequestedType = isGroupTypeWrong ? std::type_index(typeid(G)) : std::type_index(typeid(V));
+            res.SavedType = isGroupTypeWrong ? aggregate->GetGroupType() : aggregate->GetValueType();
+            res.ResultCode = VaultOperationResultCode::WrongType;
+            return res;
+        }
 
-        return RequestRecords(VaultRequestType::Greater, key, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
-    }
+        res.Key = groupKey;
+        res.RequestedType = typeid(G);
+        res.SavedType = typeid(G);
 
-    template <class T>
-    VaultOperationResult Vault::RequestGreaterOrEqual(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
-        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
-    {
-        DBG_LOG_ENTER();
+        auto groupIt = aggregateGroups->find(groupValue);
+        if (groupIt == aggregateGroups->end())
+        {
+            res.ResultCode = VaultOperationResultCode::WrongValue;
+            return res;
+        }
 
-        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
-            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
-            RequestGreaterOrEqual<std::string>(\"Key\", \"Value\") or RequestGreaterOrEqual(\"Key\", std::string(\"Value\"))");
+        group = groupIt->second;
 
-        return RequestRecords(VaultRequestType::GreaterOrEqual, key, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+        return res;
     }
 
     template <class T>
-    VaultOperationResult Vault::RequestLess(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
-        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    VaultOperationResult Vault::AddLockFreeReadKey(const std::string& key) noexcept
     {
         DBG_LOG_ENTER();
 
-        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
-            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
-            RequestLess<std::string>(\"Key\", \"Value\") or RequestLess(\"Key\", std::string(\"Value\"))");
+        VaultOperationResult res;
+        res.Key = key;
+        res.RequestedType = typeid(T);
+        res.IsOperationSuccess = false;
 
-        return RequestRecords(VaultRequestType::Less, key, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
-    }
+        // Lock Vault to write
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
 
-    template <class T>
-    VaultOperationResult Vault::RequestLessOrEqual(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
-        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
-    {
-        DBG_LOG_ENTER();
+        auto keyTypeIt = KeysTypes.find(key);
+        if (keyTypeIt == KeysTypes.end())
+        {
+            res.ResultCode = VaultOperationResultCode::WrongKey;
+            return res;
+        }
 
-        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
-            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
-            RequestLessOrEqual<std::string>(\"Key\", \"Value\") or RequestLessOrEqual(\"Key\", std::string(\"Value\"))");
+        res.SavedType = keyTypeIt->second;
 
-        return RequestRecords(VaultRequestType::LessOrEqual, key, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
-    }
+        if (res.SavedType != res.RequestedType)
+        {
+            res.ResultCode = VaultOperationResultCode::WrongType;
+            return res;
+        }
 
-    template <class T>
-    VaultOperationResult Vault::RequestInterval(const std::string& key, const T& beginKeyValue,
-        const T& endKeyValue, VaultRecordSet& vaultRecordSet, const bool& isIncludeBeginKeyValue, 
-        const bool& isIncludeEndKeyValue, const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
-    {
-        DBG_LOG_ENTER();
+        // Only unique key values allow to find one snapshot
+        if (UniqueKeys.find(key) == UniqueKeys.end())
+        {
+            res.ResultCode = VaultOperationResultCode::NonUniqueKey;
+            return res;
+        }
 
-        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
-            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
-            RequestInterval<std::string>(\"Key\", \"Value\") or RequestInterval(\"Key\", std::string(\"Value\"))");
+        if (LockFreeIndex.load() != nullptr)
+        {
+            res.ResultCode = VaultOperationResultCode::DuplicateKey;
+            return res;
+        }
 
-        return RequestRecords(VaultRequestType::Interval, key, beginKeyValue, 
-            endKeyValue, vaultRecordSet, isIncludeBeginKeyValue, isIncludeEndKeyValue, 
-            amountOfRecords, requestPredicat);
+        if (Epochs.load() == nullptr) Epochs.store(new EpochManager);
+
+        LockFreeReadIndex<T>* index = new LockFreeReadIndex<T>(key, Epochs.load());
+        index->SetKeys(KeysOrder);
+        for (VaultRecord* record : RecordsSet)
+            index->AddRecord(record);
+
+        // Readers can see the index only when it is filled
+        LockFreeIndex.store(index);
+
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+        return res;
     }
 
-    template <VaultRequestType Type>
-    VaultOperationResult Vault::Request(const VaultRequest<Type>& request, VaultRecordSet& vaultRecordSet) const
+    template <class T, class F>
+    VaultOperationResult Vault::ReadRecord(const std::string& key, const T& keyValue, F&& func) const noexcept
     {
         DBG_LOG_ENTER();
 
         VaultOperationResult res;
-        res.IsOperationSuccess = true;
-        res.ResultCode = VaultOperationResultCode::Success;
-
-        // Lock Vault to read
-        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+        res.Key = key;
+        res.RequestedType = typeid(T);
+        res.IsOperationSuccess = false;
 
-        // If it is Vault object
-        if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
+        // Epoch manager is created with the first index and is deleted only with Vault
+        EpochManager* epochs = Epochs.load();
+        if (epochs == nullptr)
         {
-            // Save vaultRecordSet
-            RecordSetsSet.emplace(&vaultRecordSet);
-
-            // Remove old data from vaultRecordSet
-            if (vaultRecordSet.ParentVault != this)
-            {
-                vaultRecordSet.Reset();
-
-                // Set new parent vault to vaultRecordSet
-                vaultRecordSet.ParentVault = const_cast<Vault*>(this);
-
-                // Copy keys from this to vaultRecordSet
-                for (auto& keyCopierIt : VaultKeyCopiers)
-                    keyCopierIt.second(&vaultRecordSet);
-
-                // Set proper key order
-                vaultRecordSet.KeysOrder = KeysOrder;
-
-                // Set unique keys
-                vaultRecordSet.UniqueKeys = UniqueKeys;
-            }
-            else vaultRecordSet.Clear();
+            res.ResultCode = VaultOperationResultCode::WrongKey;
+            return res;
         }
 
-        // Try to make complex request 
-        try
+        // No locks are taken, the index and snapshots can not be deleted until the guard is destroyed
+        EpochGuard epochGuard(*epochs);
+
+        const LockFreeReadIndexBase* index = LockFreeIndex.load();
+        if (index == nullptr || index->GetKey() != key)
         {
-            request.Request(const_cast<Vault*>(this), vaultRecordSet.RecordsSet);
+            res.ResultCode = VaultOperationResultCode::WrongKey;
+            return res;
+        }
 
-            for (VaultRecord* record : vaultRecordSet.RecordsSet)
-            {
-                // Add pointer to record from this to vaultRecordSet structure
-                for (auto& adder : vaultRecordSet.VaultRecordAdders)
-                    adder.second(record);
+        res.SavedType = index->GetKeyType();
 
-                // Lock VaultRecord to thread safety add new dependent VaultRecordSet
-                record->AddToDependentSets(&vaultRecordSet);
-            }
+        if (res.SavedType != res.RequestedType)
+        {
+            res.ResultCode = VaultOperationResultCode::WrongType;
+            return res;
         }
-        catch(VaultOperationResult& result) // Catch complex request errors
+
+        if (!static_cast<const LockFreeReadIndex<T>*>(index)->ReadRecord(keyValue, std::forward<F>(func)))
         {
-            vaultRecordSet.Clear();
-            res = result;
+            res.ResultCode = VaultOperationResultCode::WrongValue;
+            return res;
         }
 
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
         return res;
     }
 
     template <class T>
-    VaultOperationResult Vault::EraseRecord(const std::string& key, const T& keyValue) noexcept
+    VaultOperationResult Vault::GetRecord(const std::string& key, const T& keyValue, VaultRecordRef& vaultRecordRef) const noexcept
     {
         DBG_LOG_ENTER();
 
         static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
             If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
-            EraseRecord<std::string>(\"Key\", \"Value\") or EraseRecord(\"Key\", std::string(\"Value\"))");
+            GetRecord<std::string>(\"Key\", \"Value\") or GetRecord(\"Key\", std::string(\"Value\"))");
 
         // Fill res info known at start
         VaultOperationResult res;
         res.Key = key;
         res.RequestedType = typeid(T);
 
-        // Lock Vault to write
-        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+        // Lock Vault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
 
         // If key not exist
         if(!GetKeyType(key, res.SavedType))
@@ -967,20 +1335,798 @@ namespace mvlt
             return res;
         }
 
-        // Pointer to store map inside VaultStructureHashMap
-        UnorderedMap<T, VaultRecord*>* TtoVaultRecordHashMap = nullptr;
-
-        // Checking whether such a key exists
-        VaultHashMapStructure.GetData(key, TtoVaultRecordHashMap);
-        
-        // Iterator to element with T type and keyValue value
-        auto TtoVaultRecordIt = TtoVaultRecordHashMap->Find(keyValue);
-        if (TtoVaultRecordIt != TtoVaultRecordHashMap->end())
-        {
-            VaultRecord* tmpRec = (*TtoVaultRecordIt).second;
+        // Pointer to store positions of records inside the key structures
+        KeyIndexHandles<T>* TtoVaultRecordIndexHandles = nullptr;
+        BuildLazyKeyIndex(key);
+        VaultIndexHandlesStructure.GetData(key, TtoVaultRecordIndexHandles);
 
-            for (auto& eraser : VaultRecordErasers)
-                eraser.second(tmpRec);
+        // Find first record with keyValue value
+        VaultRecord* foundRecord = nullptr;
+        FindEqualRecords(TtoVaultRecordIndexHandles, key, keyValue, [&](VaultRecord* record)
+            {
+                foundRecord = record;
+                return false;
+            });
+
+        if (foundRecord != nullptr)
+        {
+            vaultRecordRef.SetRecord(foundRecord, const_cast<Vault*>(this));
+            res.IsOperationSuccess = true;
+            res.ResultCode = VaultOperationResultCode::Success;
+        }
+        else
+        {
+            vaultRecordRef.SetRecord(nullptr, const_cast<Vault*>(this));
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongValue;
+        }
+
+        return res;
+    }
+
+    template <class T>
+    VaultOperationResult Vault::GetRecord(const KeyHandle<T>& keyHandle, const T& keyValue, VaultRecordRef& vaultRecordRef) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        // Fill res info known at start
+        VaultOperationResult res;
+        res.Key = keyHandle.Key;
+        res.RequestedType = typeid(T);
+
+        // Lock Vault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        // Check if handle valid
+        if (!IsKeyHandleValid(keyHandle))
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongKey;
+            return res;
+        }
+
+        res.SavedType = res.RequestedType;
+
+        // Find first record with keyValue value
+        VaultRecord* foundRecord = nullptr;
+        FindEqualRecords(keyHandle.TtoVaultRecordIndexHandles, keyHandle.Key, keyValue, [&](VaultRecord* record)
+            {
+                foundRecord = record;
+                return false;
+            });
+
+        if (foundRecord != nullptr)
+        {
+            vaultRecordRef.SetRecord(foundRecord, const_cast<Vault*>(this));
+            res.IsOperationSuccess = true;
+            res.ResultCode = VaultOperationResultCode::Success;
+        }
+        else
+        {
+            vaultRecordRef.SetRecord(nullptr, const_cast<Vault*>(this));
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongValue;
+        }
+
+        return res;
+    }
+
+    template <class T>
+    VaultOperationResult Vault::GetRecords(const std::string& key, const T& keyValue, std::vector<VaultRecordRef>& recordsRefs, const std::size_t& amountOfRecords) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
+            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
+            GetRecords<std::string>(\"Key\", \"Value\") or GetRecords(\"Key\", std::string(\"Value\"))");
+
+        // Fill res info known at start
+        VaultOperationResult res;
+        res.Key = key;
+        res.RequestedType = typeid(T);
+
+        recordsRefs.clear();
+
+        // Lock Vault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        // If key not exist
+        if(!GetKeyType(key, res.SavedType))
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongKey;
+            return res;
+        }
+
+        // Check types
+        if (res.SavedType != res.RequestedType)
+        {
+            res.IsOperationSuccess = false;
+            res.SetOpResult(VaultOperationResultCode::WrongType);
+            return res;
+        }
+
+        // Pointer to store positions of records inside the key structures
+        KeyIndexHandles<T>* TtoVaultRecordIndexHandles = nullptr;
+        BuildLazyKeyIndex(key);
+        VaultIndexHandlesStructure.GetData(key, TtoVaultRecordIndexHandles);
+
+        // Find all records with keyValue value
+        FindEqualRecords(TtoVaultRecordIndexHandles, key, keyValue, [&](VaultRecord* record)
+            {
+                recordsRefs.emplace_back(VaultRecordRef(record, const_cast<Vault*>(this)));
+                return recordsRefs.size() < amountOfRecords;
+            });
+
+        if (!recordsRefs.empty())
+        {
+            res.IsOperationSuccess = true;
+            res.ResultCode = VaultOperationResultCode::Success;
+        }
+        else
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongValue;
+        }
+
+        return res;
+    }
+
+    template <class T>
+    VaultOperationResult Vault::GetRecords(const KeyHandle<T>& keyHandle, const T& keyValue, std::vector<VaultRecordRef>& recordsRefs, const std::size_t& amountOfRecords) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        // Fill res info known at start
+        VaultOperationResult res;
+        res.Key = keyHandle.Key;
+        res.RequestedType = typeid(T);
+
+        recordsRefs.clear();
+
+        // Lock Vault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        // Check if handle valid
+        if (!IsKeyHandleValid(keyHandle))
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongKey;
+            return res;
+        }
+
+        res.SavedType = res.RequestedType;
+
+        // Find all records with keyValue value
+        FindEqualRecords(keyHandle.TtoVaultRecordIndexHandles, keyHandle.Key, keyValue, [&](VaultRecord* record)
+            {
+                recordsRefs.emplace_back(VaultRecordRef(record, const_cast<Vault*>(this)));
+                return recordsRefs.size() < amountOfRecords;
+            });
+
+        if (!recordsRefs.empty())
+        {
+            res.IsOperationSuccess = true;
+            res.ResultCode = VaultOperationResultCode::Success;
+        }
+        else
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongValue;
+        }
+
+        return res;
+    }
+
+    template <class T>
+    VaultOperationResult Vault::RequestEqual(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
+        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
+            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
+            RequestEqual<std::string>(\"Key\", \"Value\") or RequestEqual(\"Key\", std::string(\"Value\"))");
+
+        return RequestRecords(VaultRequestType::Equal, key, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
+    }
+
+    template <class T>
+    VaultOperationResult Vault::RequestEqual(const KeyHandle<T>& keyHandle, const T& keyValue, VaultRecordSet& vaultRecordSet,
+        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        return RequestRecords(VaultRequestType::Equal, keyHandle, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
+    }
+
+    template <class T>
+    VaultOperationResult Vault::RequestGreater(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
+        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
+            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
+            RequestGreater<std::string>(\"Key\", \"Value\") or RequestGreater(\"Key\", std::string(\"Value\"))");
+
+        return RequestRecords(VaultRequestType::Greater, key, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
+    }
+
+    template <class T>
+    VaultOperationResult Vault::RequestGreater(const KeyHandle<T>& keyHandle, const T& keyValue, VaultRecordSet& vaultRecordSet,
+        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        return RequestRecords(VaultRequestType::Greater, keyHandle, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
+    }
+
+    template <class T>
+    VaultOperationResult Vault::RequestGreaterOrEqual(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
+        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
+            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
+            RequestGreaterOrEqual<std::string>(\"Key\", \"Value\") or RequestGreaterOrEqual(\"Key\", std::string(\"Value\"))");
+
+        return RequestRecords(VaultRequestType::GreaterOrEqual, key, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
+    }
+
+    template <class T>
+    VaultOperationResult Vault::RequestGreaterOrEqual(const KeyHandle<T>& keyHandle, const T& keyValue, VaultRecordSet& vaultRecordSet,
+        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        return RequestRecords(VaultRequestType::GreaterOrEqual, keyHandle, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
+    }
+
+    template <class T>
+    VaultOperationResult Vault::RequestLess(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
+        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
+            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
+            RequestLess<std::string>(\"Key\", \"Value\") or RequestLess(\"Key\", std::string(\"Value\"))");
+
+        return RequestRecords(VaultRequestType::Less, key, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
+    }
+
+    template <class T>
+    VaultOperationResult Vault::RequestLess(const KeyHandle<T>& keyHandle, const T& keyValue, VaultRecordSet& vaultRecordSet,
+        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        return RequestRecords(VaultRequestType::Less, keyHandle, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
+    }
+
+    template <class T>
+    VaultOperationResult Vault::RequestLessOrEqual(const std::string& key, const T& keyValue, VaultRecordSet& vaultRecordSet,
+        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
+            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
+            RequestLessOrEqual<std::string>(\"Key\", \"Value\") or RequestLessOrEqual(\"Key\", std::string(\"Value\"))");
+
+        return RequestRecords(VaultRequestType::LessOrEqual, key, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
+    }
+
+    template <class T>
+    VaultOperationResult Vault::RequestLessOrEqual(const KeyHandle<T>& keyHandle, const T& keyValue, VaultRecordSet& vaultRecordSet,
+        const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        return RequestRecords(VaultRequestType::LessOrEqual, keyHandle, keyValue, keyValue, vaultRecordSet, false, false, amountOfRecords, requestPredicat);
+    }
+
+    template <class T>
+    VaultOperationResult Vault::RequestInterval(const std::string& key, const T& beginKeyValue,
+        const T& endKeyValue, VaultRecordSet& vaultRecordSet, const bool& isIncludeBeginKeyValue, 
+        const bool& isIncludeEndKeyValue, const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
+            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
+            RequestInterval<std::string>(\"Key\", \"Value\") or RequestInterval(\"Key\", std::string(\"Value\"))");
+
+        return RequestRecords(VaultRequestType::Interval, key, beginKeyValue, 
+            endKeyValue, vaultRecordSet, isIncludeBeginKeyValue, isIncludeEndKeyValue, 
+            amountOfRecords, requestPredicat);
+    }
+
+    template <class T>
+    VaultOperationResult Vault::RequestInterval(const KeyHandle<T>& keyHandle, const T& beginKeyValue,
+        const T& endKeyValue, VaultRecordSet& vaultRecordSet, const bool& isIncludeBeginKeyValue, 
+        const bool& isIncludeEndKeyValue, const std::size_t& amountOfRecords, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        return RequestRecords(VaultRequestType::Interval, keyHandle, beginKeyValue, 
+            endKeyValue, vaultRecordSet, isIncludeBeginKeyValue, isIncludeEndKeyValue, 
+            amountOfRecords, requestPredicat);
+    }
+
+    template <VaultRequestType Type>
+    VaultOperationResult Vault::Request(const VaultRequest<Type>& request, VaultRecordSet& vaultRecordSet) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        // Lock Vault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        // Attach vaultRecordSet to this and remove old data from it
+        PrepareRecordSet(vaultRecordSet);
+
+        // Try to make complex request 
+        try
+        {
+            request.Request(const_cast<Vault*>(this), vaultRecordSet.RecordsSet);
+
+            // Records are shared with sets of other readers
+            std::lock_guard<std::mutex> dependentSetsLock(vaultRecordSet.ParentVault->DependentSetsMtx);
+
+            for (VaultRecord* record : vaultRecordSet.RecordsSet)
+            {
+                // Add pointer to record from this to vaultRecordSet structure
+                for (auto& adder : vaultRecordSet.VaultRecordAdders)
+                    adder.second(record);
+
+                record->AddToDependentSets(&vaultRecordSet);
+            }
+        }
+        catch(VaultOperationResult& result) // Catch complex request errors
+        {
+            vaultRecordSet.Clear();
+            res = result;
+        }
+
+        return res;
+    }
+
+    template <VaultRequestType Type>
+    VaultOperationResult Vault::Scan(const VaultRequest<Type>& request, const std::function<bool(const VaultRecordRef& ref)>& func) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        // Lock Vault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        Vault* vlt = const_cast<Vault*>(this);
+
+        // Try to make complex request 
+        try
+        {
+            request.Scan(vlt, [&](VaultRecord* record)
+                {
+                    return func(VaultRecordRef(record, vlt));
+                });
+        }
+        catch(VaultOperationResult& result) // Catch complex request errors
+        {
+            res = result;
+        }
+
+        return res;
+    }
+
+    template <VaultRequestType Type>
+    VaultOperationResult Vault::Count(const VaultRequest<Type>& request, std::size_t& count) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        // Lock Vault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        // Try to make complex request 
+        try
+        {
+            count = request.Count(const_cast<Vault*>(this));
+        }
+        catch(VaultOperationResult& result) // Catch complex request errors
+        {
+            res = result;
+        }
+
+        return res;
+    }
+
+    template <class T>
+    VaultOperationResult Vault::Min(const std::string& key, T& minValue) const
+    {
+        DBG_LOG_ENTER();
+
+        return FindExtremum<T, VaultRequestType::Equal>(key, nullptr, false, minValue);
+    }
+
+    template <class T, VaultRequestType Type>
+    VaultOperationResult Vault::Min(const std::string& key, const VaultRequest<Type>& request, T& minValue) const
+    {
+        DBG_LOG_ENTER();
+
+        return FindExtremum(key, &request, false, minValue);
+    }
+
+    template <class T>
+    VaultOperationResult Vault::Max(const std::string& key, T& maxValue) const
+    {
+        DBG_LOG_ENTER();
+
+        return FindExtremum<T, VaultRequestType::Equal>(key, nullptr, true, maxValue);
+    }
+
+    template <class T, VaultRequestType Type>
+    VaultOperationResult Vault::Max(const std::string& key, const VaultRequest<Type>& request, T& maxValue) const
+    {
+        DBG_LOG_ENTER();
+
+        return FindExtremum(key, &request, true, maxValue);
+    }
+
+    template <class T>
+    VaultOperationResult Vault::Sum(const std::string& key, T& sum) const
+    {
+        DBG_LOG_ENTER();
+
+        std::size_t counter = 0;
+        return Accumulate<T, VaultRequestType::Equal>(key, nullptr, sum, counter);
+    }
+
+    template <class T, VaultRequestType Type>
+    VaultOperationResult Vault::Sum(const std::string& key, const VaultRequest<Type>& request, T& sum) const
+    {
+        DBG_LOG_ENTER();
+
+        std::size_t counter = 0;
+        return Accumulate(key, &request, sum, counter);
+    }
+
+    template <class T>
+    VaultOperationResult Vault::Avg(const std::string& key, double& avg) const
+    {
+        DBG_LOG_ENTER();
+
+        return FindAverage<T, VaultRequestType::Equal>(key, nullptr, avg);
+    }
+
+    template <class T, VaultRequestType Type>
+    VaultOperationResult Vault::Avg(const std::string& key, const VaultRequest<Type>& request, double& avg) const
+    {
+        DBG_LOG_ENTER();
+
+        return FindAverage<T>(key, &request, avg);
+    }
+
+    template <class T, VaultRequestType Type>
+    VaultOperationResult Vault::FindExtremum(const std::string& key, const VaultRequest<Type>* request, const bool& isMax, T& value) const
+    {
+        DBG_LOG_ENTER();
+
+        // Lock Vault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        VaultOperationResult res = CheckRequestKey(key, typeid(T));
+        if (!res.IsOperationSuccess) return res;
+
+        Vault* vlt = const_cast<Vault*>(this);
+
+        // Pointer to store positions of records inside the key structures
+        KeyIndexHandles<T>* TtoVaultRecordIndexHandles = nullptr;
+        BuildLazyKeyIndex(key);
+        VaultIndexHandlesStructure.GetData(key, TtoVaultRecordIndexHandles);
+
+        // All records share the storage of the parent Vault, so the column is taken from the first record
+        const DataColumn* column = nullptr;
+        bool isFound = false;
+
+        // Function to check the value of found record
+        auto checkRecord = [&](VaultRecord* record)
+        {
+            if (column == nullptr) column = record->Storage->GetColumn(key);
+
+            T recordValue{};
+            column->GetData(record->Row, recordValue);
+            if (!isFound || (isMax ? value < recordValue : recordValue < value))
+            {
+                value = recordValue;
+                isFound = true;
+            }
+            return true;
+        };
+
+        // Function to check the record from the map
+        auto checkMapRecord = [&](const T& recordValue, VaultRecord* record)
+        {
+            if (request != nullptr && !request->IsMatch(vlt, record)) return true;
+
+            value = recordValue;
+            isFound = true;
+            return false;
+        };
+
+        try
+        {
+            if (request != nullptr) request->Check(vlt);
+
+            // Reading the map until the first found record takes about RecordsSet.size() / estimate steps,
+            // so it is used if it is cheaper than reading all estimate records of the request
+            std::size_t estimate = request != nullptr ? request->Estimate(vlt) : RecordsSet.size();
+            if (TtoVaultRecordIndexHandles->IsOrderedIndexed() && estimate * estimate >= RecordsSet.size())
+            {
+                Map<T, VaultRecord*>* TtoVaultRecordMap = TtoVaultRecordIndexHandles->TtoVaultRecordMap;
+
+                if (isMax)
+                {
+                    for (auto it = TtoVaultRecordMap->Rbegin(); it != TtoVaultRecordMap->Rend(); ++it)
+                        if (!checkMapRecord(it->first, it->second)) break;
+                }
+                else
+                {
+                    for (auto it = TtoVaultRecordMap->Begin(); it != TtoVaultRecordMap->End(); ++it)
+                        if (!checkMapRecord(it->first, it->second)) break;
+                }
+            }
+            else if (request != nullptr) request->Scan(vlt, checkRecord);
+            else
+            {
+                for (VaultRecord* record : RecordsSet)
+                    checkRecord(record);
+            }
+        }
+        catch(VaultOperationResult& result) // Catch complex request errors
+        {
+            return result;
+        }
+
+        if (!isFound)
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongValue;
+        }
+
+        return res;
+    }
+
+    template <class T, VaultRequestType Type>
+    VaultOperationResult Vault::FindAverage(const std::string& key, const VaultRequest<Type>* request, double& avg) const
+    {
+        DBG_LOG_ENTER();
+
+        T sum{};
+        std::size_t counter = 0;
+        VaultOperationResult res = Accumulate(key, request, sum, counter);
+
+        if (res.IsOperationSuccess)
+        {
+            if (counter == 0)
+            {
+                res.IsOperationSuccess = false;
+                res.ResultCode = VaultOperationResultCode::WrongValue;
+            }
+            else avg = static_cast<double>(sum) / static_cast<double>(counter);
+        }
+
+        return res;
+    }
+
+    template <class T, VaultRequestType Type>
+    VaultOperationResult Vault::Accumulate(const std::string& key, const VaultRequest<Type>* request, T& sum, std::size_t& counter) const
+    {
+        DBG_LOG_ENTER();
+
+        // Lock Vault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        VaultOperationResult res = CheckRequestKey(key, typeid(T));
+        if (!res.IsOperationSuccess) return res;
+
+        // All records share the storage of the parent Vault, so the column is taken from the first record
+        const DataColumn* column = nullptr;
+        T resSum{};
+        std::size_t resCounter = 0;
+
+        // Function to add the value of found record
+        auto addRecord = [&](VaultRecord* record)
+        {
+            if (column == nullptr) column = record->Storage->GetColumn(key);
+
+            T recordValue{};
+            column->GetData(record->Row, recordValue);
+            resSum += recordValue;
+            ++resCounter;
+            return true;
+        };
+
+        try
+        {
+            if (request != nullptr)
+            {
+                request->Check(const_cast<Vault*>(this));
+                request->Scan(const_cast<Vault*>(this), addRecord);
+            }
+            else
+            {
+                for (VaultRecord* record : RecordsSet)
+                    addRecord(record);
+            }
+        }
+        catch(VaultOperationResult& result) // Catch complex request errors
+        {
+            return result;
+        }
+
+        sum = resSum;
+        counter = resCounter;
+        return res;
+    }
+
+    template <class T>
+    VaultOperationResult Vault::GetSortedPage(const std::string& key, VaultPageCursor<T>& cursor, const std::size_t& pageSize, std::vector<VaultRecordRef>& records,
+        const bool& isReverse, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        // Lock Vault to read
+        ReadLock<RecursiveReadWriteMutex> readLock(RecursiveReadWriteMtx);
+
+        VaultOperationResult res = CheckRequestKey(key, typeid(T));
+        if (!res.IsOperationSuccess) return res;
+
+        records.clear();
+        if (pageSize == 0) return res;
+
+        // Pointer to store positions of records inside the key structures
+        KeyIndexHandles<T>* TtoVaultRecordIndexHandles = nullptr;
+
+        // Get structures
+        BuildLazyKeyIndex(key);
+        VaultIndexHandlesStructure.GetData(key, TtoVaultRecordIndexHandles);
+
+        // The default predicat accepts all records, so there is no need to call it
+        bool isDefaultPredicat = requestPredicat.target_type() == DefaultRequestPredicat.target_type();
+        Vault* vlt = const_cast<Vault*>(this);
+
+        // Function to move the cursor to the record and add it to the page. Returns false when the page is full
+        auto addRecord = [&](const T& value, VaultRecord* record)
+        {
+            cursor.IsSet = true;
+            cursor.KeyValue = value;
+            cursor.Record = record;
+
+            VaultRecordRef ref(record, vlt);
+            if (isDefaultPredicat || requestPredicat(ref)) records.emplace_back(ref);
+
+            return records.size() < pageSize;
+        };
+
+        if (TtoVaultRecordIndexHandles->IsOrderedIndexed())
+        {
+            Map<T, VaultRecord*>* TtoVaultRecordMap = TtoVaultRecordIndexHandles->TtoVaultRecordMap;
+
+            if (!isReverse)
+            {
+                auto startIt = cursor.IsSet ? TtoVaultRecordMap->UpperBound(cursor.KeyValue, cursor.Record) : TtoVaultRecordMap->Begin();
+                for (auto TtoVaultRecordMapIt = startIt; TtoVaultRecordMapIt != TtoVaultRecordMap->End(); ++TtoVaultRecordMapIt)
+                    if (!addRecord((*TtoVaultRecordMapIt).first, (*TtoVaultRecordMapIt).second)) break;
+            }
+            else
+            {
+                auto startIt = cursor.IsSet ? TtoVaultRecordMap->RupperBound(cursor.KeyValue, cursor.Record) : TtoVaultRecordMap->Rbegin();
+                for (auto TtoVaultRecordMapIt = startIt; TtoVaultRecordMapIt != TtoVaultRecordMap->Rend(); ++TtoVaultRecordMapIt)
+                    if (!addRecord((*TtoVaultRecordMapIt).first, (*TtoVaultRecordMapIt).second)) break;
+            }
+        }
+        else
+        {
+            // Records are ordered by key value and records with the same value by address, in the same way as in the B+tree
+            auto isLess = [](const std::pair<T, VaultRecord*>& a, const std::pair<T, VaultRecord*>& b)
+            {
+                if (a.first < b.first) return true;
+                if (b.first < a.first) return false;
+                return std::less<VaultRecord*>()(a.second, b.second);
+            };
+
+            // The key has no map, so sort all records after the cursor
+            std::pair<T, VaultRecord*> cursorRecord(cursor.KeyValue, cursor.Record);
+            std::vector<std::pair<T, VaultRecord*>> sortedRecords;
+
+            for (VaultRecord* record : RecordsSet)
+            {
+                std::pair<T, VaultRecord*> sortedRecord(T{}, record);
+                record->GetData(key, sortedRecord.first);
+
+                if (!cursor.IsSet || (isReverse ? isLess(sortedRecord, cursorRecord) : isLess(cursorRecord, sortedRecord)))
+                    sortedRecords.emplace_back(std::move(sortedRecord));
+            }
+
+            std::sort(sortedRecords.begin(), sortedRecords.end(), [&](const std::pair<T, VaultRecord*>& a, const std::pair<T, VaultRecord*>& b)
+            {
+                return isReverse ? isLess(b, a) : isLess(a, b);
+            });
+
+            for (const auto& sortedRecord : sortedRecords)
+                if (!addRecord(sortedRecord.first, sortedRecord.second)) break;
+        }
+
+        return res;
+    }
+
+    template <class T>
+    VaultOperationResult Vault::EraseRecord(const std::string& key, const T& keyValue) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
+            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
+            EraseRecord<std::string>(\"Key\", \"Value\") or EraseRecord(\"Key\", std::string(\"Value\"))");
+
+        // Fill res info known at start
+        VaultOperationResult res;
+        res.Key = key;
+        res.RequestedType = typeid(T);
+
+        // Lock Vault to write
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        // If key not exist
+        if(!GetKeyType(key, res.SavedType))
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongKey;
+            return res;
+        }
+
+        // Check types
+        if (res.SavedType != res.RequestedType)
+        {
+            res.IsOperationSuccess = false;
+            res.SetOpResult(VaultOperationResultCode::WrongType);
+            return res;
+        }
+
+        // Pointer to store positions of records inside the key structures
+        KeyIndexHandles<T>* TtoVaultRecordIndexHandles = nullptr;
+        BuildLazyKeyIndex(key);
+        VaultIndexHandlesStructure.GetData(key, TtoVaultRecordIndexHandles);
+
+        // Find first record with keyValue value
+        VaultRecord* tmpRec = nullptr;
+        FindEqualRecords(TtoVaultRecordIndexHandles, key, keyValue, [&](VaultRecord* record)
+            {
+                tmpRec = record;
+                return false;
+            });
+
+        if (tmpRec != nullptr)
+        {
+
+            for (auto& eraser : VaultRecordErasers)
+                eraser.second(tmpRec);
+
+            EraseFromCompositeIndexes(tmpRec);
+            EraseFromGroupAggregates(tmpRec);
+            EraseFromLockFreeReadIndex(tmpRec);
 
             RecordsSet.erase(tmpRec);
             
@@ -989,6 +2135,7 @@ namespace mvlt
             if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
             {
                 tmpRec->RemoveFromDependentSets();
+                Storage->FreeRow(tmpRec->Row);
                 tmpRec->Invalidate();
             }
 
@@ -1004,6 +2151,53 @@ namespace mvlt
         return res;
     }
 
+    template <class T>
+    VaultOperationResult Vault::EraseRecord(const KeyHandle<T>& keyHandle, const T& keyValue) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        // Fill res info known at start
+        VaultOperationResult res;
+        res.Key = keyHandle.Key;
+        res.RequestedType = typeid(T);
+
+        // Lock Vault to write
+        WriteLock<RecursiveReadWriteMutex> writeLock(RecursiveReadWriteMtx);
+
+        // Check if handle valid
+        if (!IsKeyHandleValid(keyHandle))
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongKey;
+            return res;
+        }
+
+        res.SavedType = res.RequestedType;
+
+        // Find first record with keyValue value
+        VaultRecord* foundRecord = nullptr;
+        FindEqualRecords(keyHandle.TtoVaultRecordIndexHandles, keyHandle.Key, keyValue, [&](VaultRecord* record)
+            {
+                foundRecord = record;
+                return false;
+            });
+
+        if (foundRecord != nullptr)
+        {
+            RemoveRecord(foundRecord, nullptr);
+
+            res.IsOperationSuccess = true;
+            res.ResultCode = VaultOperationResultCode::Success;
+        }
+        else
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongValue;
+        }
+
+        return res;
+    }
+
     template <class T>
     VaultOperationResult Vault::EraseRecords(const std::string& key, const T& keyValue, const std::size_t& amountOfRecords) noexcept
     {
@@ -1037,32 +2231,33 @@ namespace mvlt
             return res;
         }
 
-        // Pointer to store map inside VaultStructureHashMap
-        UnorderedMap<T, VaultRecord*>* TtoVaultRecordHashMap = nullptr;
+        // Pointer to store positions of records inside the key structures
+        KeyIndexHandles<T>* TtoVaultRecordIndexHandles = nullptr;
+        BuildLazyKeyIndex(key);
+        VaultIndexHandlesStructure.GetData(key, TtoVaultRecordIndexHandles);
 
-        // Checking whether such a key exists
-        VaultHashMapStructure.GetData(key, TtoVaultRecordHashMap);
-        
-        // Pair with begin and end iterator with T type and keyValue value
-        auto equalRange = TtoVaultRecordHashMap->EqualRange(keyValue);
-        if (equalRange.first != TtoVaultRecordHashMap->end())
+        // Find records to erase. They are erased after search because erasing changes the key structures
+        std::vector<VaultRecord*> recordsToErase;
+        FindEqualRecords(TtoVaultRecordIndexHandles, key, keyValue, [&](VaultRecord* record)
+            {
+                recordsToErase.emplace_back(record);
+                return recordsToErase.size() < amountOfRecords;
+            });
+
+        if (!recordsToErase.empty())
         {
             res.IsOperationSuccess = true;
             res.ResultCode = VaultOperationResultCode::Success;
 
-            std::size_t counter = 0;
-            for (auto equalRangeIt = equalRange.first; equalRangeIt != equalRange.second;)
+            for (VaultRecord* tmpRec : recordsToErase)
             {
-                // Save next iterator
-                auto nextIt = equalRangeIt;
-                ++nextIt;
-
-                ++counter;
-
-                VaultRecord* tmpRec = (*equalRangeIt).second;
                 for (auto& eraser : VaultRecordErasers)
                     eraser.second(tmpRec);
 
+                EraseFromCompositeIndexes(tmpRec);
+                EraseFromGroupAggregates(tmpRec);
+                EraseFromLockFreeReadIndex(tmpRec);
+
                 RecordsSet.erase(tmpRec);
 
                 // Check if it is delete. By now it is deletion when EraseRecord called from vault.
@@ -1070,12 +2265,9 @@ namespace mvlt
                 if (VaultDerivedClass == VaultDerivedClasses::VaultBase)
                 {
                     tmpRec->RemoveFromDependentSets();
+                    Storage->FreeRow(tmpRec->Row);
                     tmpRec->Invalidate();
                 }
-                
-                if (counter >= amountOfRecords) break;
-                
-                equalRangeIt = nextIt;
             }
         }
         else
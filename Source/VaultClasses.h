@@ -21,15 +21,37 @@ namespace mvlt
         And            ///< A request with a logical operation and
     };
 
+    /// \brief An enum with the sets of structures used to search records by key
+    enum class VaultIndexPolicy : std::uint8_t
+    {
+        HashAndOrdered,///< The key has a hash table for equality requests and a B+tree for range requests and sorting
+        HashOnly,      ///< The key has only a hash table. Range requests and sorting scan all records
+        OrderedOnly,   ///< The key has only a B+tree. Equality requests use it in O(log n)
+        None           ///< The key has no structures. All requests and sorting scan all records
+    };
+
     // MVault classes
     class Vault;
     class VaultRecord;
     class VaultRecordRef;
     class VaultRecordSet;
+    class VaultRecordArena;
+    class VaultRecordBitmap;
     class VaultParamInput;
+    class ShardedVault;
+    class VaultTransaction;
+    class CompositeIndex;
+    class GroupAggregate;
+
+    template <class T>
+    class KeyHandle;
+
+    template <class T>
+    class KeyIndexHandles;
     
     // MVault structs
     struct VaultOperationResult;
+    struct VaultRequestCondition;
     
     // MVault requests
     template <VaultRequestType Type>
@@ -0,0 +1,85 @@
+#include "VaultColumnStorage.h"
+
+namespace mvlt
+{
+    void VaultColumnStorage::RemoveColumn(const std::string& key) noexcept
+    {
+        Columns.erase(key);
+    }
+
+    DataColumn* VaultColumnStorage::GetColumn(const std::string& key) noexcept
+    {
+        auto findResIt = Columns.find(key);
+        if (findResIt == Columns.end()) return nullptr;
+        return &findResIt->second;
+    }
+
+    const DataColumn* VaultColumnStorage::GetColumn(const std::string& key) const noexcept
+    {
+        auto findResIt = Columns.find(key);
+        if (findResIt == Columns.end()) return nullptr;
+        return &findResIt->second;
+    }
+
+    std::size_t VaultColumnStorage::AllocateRow(VaultRecord* record) noexcept
+    {
+        std::size_t row;
+
+        if (!FreeRows.empty())
+        {
+            row = FreeRows.back();
+            FreeRows.pop_back();
+
+            for (auto& column : Columns)
+                column.second.ResetRow(row);
+        }
+        else
+        {
+            row = RowsCount;
+            ++RowsCount;
+
+            for (auto& column : Columns)
+                column.second.Resize(RowsCount);
+
+            RowRecords.resize(RowsCount, nullptr);
+        }
+
+        RowRecords[row] = record;
+        return row;
+    }
+
+    void VaultColumnStorage::ReserveRows(const std::size_t& rowsCount) noexcept
+    {
+        // Free rows are reused first, so only the rest of rows grows the columns
+        if (rowsCount <= FreeRows.size()) return;
+
+        for (auto& column : Columns)
+            column.second.Reserve(RowsCount + rowsCount - FreeRows.size());
+
+        RowRecords.reserve(RowsCount + rowsCount - FreeRows.size());
+    }
+
+    void VaultColumnStorage::FreeRow(const std::size_t& row) noexcept
+    {
+        RowRecords[row] = nullptr;
+        FreeRows.emplace_back(row);
+    }
+
+    void VaultColumnStorage::ClearRows() noexcept
+    {
+        RowsCount = 0;
+        FreeRows.clear();
+        RowRecords.clear();
+
+        for (auto& column : Columns)
+            column.second.Resize(0);
+    }
+
+    void VaultColumnStorage::Clear() noexcept
+    {
+        RowsCount = 0;
+        FreeRows.clear();
+        RowRecords.clear();
+        Columns.clear();
+    }
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "DataColumn.h"
+#include "VaultClasses.h"
+
+namespace mvlt
+{
+    /**
+        \brief A class for storing records data of Vault by columns
+
+        Each key of Vault owns one DataColumn with values of all records, and each record owns one row in all columns.
+        Rows of erased records are reused by new records, so columns do not grow while the number of records is stable.
+        The storage also keeps the record owning each row, so sets of records can be stored as bitmaps of rows.
+    */
+    class VaultColumnStorage
+    {
+    private:
+        // Unordered map with keys names and their columns
+        std::unordered_map<std::string, DataColumn> Columns;
+
+        // Number of rows in each column
+        std::size_t RowsCount = 0;
+
+        // Rows released by erased records
+        std::vector<std::size_t> FreeRows;
+
+        // Records owning the rows. Nullptr for free rows and rows without a record
+        std::vector<VaultRecord*> RowRecords;
+
+    public:
+        /// \brief Default constructor
+        VaultColumnStorage() noexcept = default;
+
+        /// \brief Deleted copy constructor
+        VaultColumnStorage(const VaultColumnStorage& other) noexcept = delete;
+
+        /// \brief Deleted assignment operator
+        VaultColumnStorage& operator=(const VaultColumnStorage& other) noexcept = delete;
+
+        /**
+            \brief A template method for adding a new column
+
+            All existing rows will be filled with the default value.
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] key column name
+            \param [in] defaultValue value to fill rows
+        */
+        template <class T>
+        void AddColumn(const std::string& key, const T& defaultValue) noexcept
+        {
+            Columns[key].SetType(defaultValue, RowsCount);
+        }
+
+        /**
+            \brief A method for removing a column
+
+            \param [in] key column name
+        */
+        void RemoveColumn(const std::string& key) noexcept;
+
+        /**
+            \brief A method for getting a column
+
+            \param [in] key column name
+
+            \return pointer to column or nullptr if there is no such column
+        */
+        DataColumn* GetColumn(const std::string& key) noexcept;
+
+        /**
+            \brief A method for getting a column
+
+            \param [in] key column name
+
+            \return pointer to column or nullptr if there is no such column
+        */
+        const DataColumn* GetColumn(const std::string& key) const noexcept;
+
+        /**
+            \brief A method for getting a row for a new record
+
+            All values in the row will be set to the columns default values.
+
+            \param [in] record record owning the row. Nullptr for rows used as temporary copies of other rows
+
+            \return row number
+        */
+        std::size_t AllocateRow(VaultRecord* record = nullptr) noexcept;
+
+        /**
+            \brief A method for getting the record owning the row
+
+            \param [in] row row number
+
+            \return pointer to record or nullptr if the row has no record
+        */
+        VaultRecord* GetRowRecord(const std::size_t& row) const noexcept
+        {
+            return RowRecords[row];
+        }
+
+        /**
+            \brief A method for allocating memory in all columns for new rows
+
+            \param [in] rowsCount number of rows which will be allocated
+        */
+        void ReserveRows(const std::size_t& rowsCount) noexcept;
+
+        /**
+            \brief A method for releasing a row of an erased record
+
+            \param [in] row row number
+        */
+        void FreeRow(const std::size_t& row) noexcept;
+
+        /// \brief A method for deleting all rows. Columns will be saved
+        void ClearRows() noexcept;
+
+        /// \brief A method for deleting all rows and columns
+        void Clear() noexcept;
+
+        /// \brief Default destructor
+        ~VaultColumnStorage() noexcept = default;
+    };
+}
@@ -39,6 +39,24 @@ namespace mvlt
         case VaultOperationResultCode::UniqueKey:
             return "The key is unique and you can not update it default value.";
 
+        case VaultOperationResultCode::UniqueKeyWithoutIndex:
+            return "The unique key must have at least one index.";
+
+        case VaultOperationResultCode::NonUniqueKey:
+            return "The operation requires an unique key.";
+
+        case VaultOperationResultCode::DuplicateCompositeIndex:
+            return "This composite index is alredy in vault.";
+
+        case VaultOperationResultCode::WrongCompositeIndex:
+            return "The composite index must have at least two different keys and at least one structure.";
+
+        case VaultOperationResultCode::DuplicateGroupBy:
+            return "This group aggregate is alredy in vault.";
+
+        case VaultOperationResultCode::WrongGroupBy:
+            return "The requested group aggregate was not found.";
+
         case VaultOperationResultCode::RecordAlredyInSet:
             return "The record is already in VaultRecordSet.";
 
@@ -25,6 +25,12 @@ namespace mvlt
         TryToAddUniqueKeyInNonEmptyVaultWithoutLambda, ///< This code is returned when trying to add unique key without lamda in non-empty vault
         DuplicateKey,                                  ///< This code is returned when trying to add key which alredy in vault
         UniqueKey,                                     ///< This code is returned when trying to update default value in an unique key
+        UniqueKeyWithoutIndex,                         ///< This code is returned when trying to add unique key with VaultIndexPolicy::None
+        NonUniqueKey,                                  ///< This code is returned when the operation requires an unique key, but the key is not unique
+        DuplicateCompositeIndex,                       ///< This code is returned when trying to add composite index which alredy in vault
+        WrongCompositeIndex,                           ///< This code is returned when trying to add composite index with less than two different keys or with VaultIndexPolicy::None
+        DuplicateGroupBy,                              ///< This code is returned when trying to add group aggregate which alredy in vault
+        WrongGroupBy,                                  ///< This code is returned when requesting group aggregate which is not in vault
         RecordAlredyInSet,                             ///< This code is returned when trying to add an record to the set when it is already in it
         ParentVaultNotMatch,                           ///< This code is returned during operations on VaultRecordSet when objects depend on different Vaults
         ParentVaultNotValid,                           ///< This code is returned when calling VaultRecordSet operations when the parent Vault is not valid
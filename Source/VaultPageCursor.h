@@ -0,0 +1,58 @@
+#pragma once
+
+#include "VaultClasses.h"
+
+namespace mvlt
+{
+    /**
+        \brief A class for storing the position of the page of sorted records
+
+        The cursor is filled by Vault::GetSortedPage with the key value of the last read record and the record itself.
+        The next page starts right after this pair inside the key B+tree, so it does not read records of previous pages.
+        Records with the same key value are ordered by their addresses, so the position stays correct
+        when records are added, changed or erased between pages.
+
+        \tparam <T> Key type
+    */
+    template <class T>
+    class VaultPageCursor
+    {
+    private:
+        // Is the cursor points to the record
+        bool IsSet = false;
+
+        // Key value of the last read record
+        T KeyValue{};
+
+        // The last read record. It is used only to order records with the same key value and never read
+        VaultRecord* Record = nullptr;
+
+    public:
+        /// Making the Vault class friendly so that it has access to the internal members of the VaultPageCursor class
+        friend Vault;
+
+        /// \brief Default constructor. The cursor points to the beginning of the sorted records
+        VaultPageCursor() noexcept = default;
+
+        /**
+            \brief A method for checking that the cursor points to the record
+
+            \return Returns false if the next page is the first page, otherwise returns true
+        */
+        bool GetIsSet() const noexcept
+        {
+            return IsSet;
+        }
+
+        /// \brief A method for moving the cursor to the beginning of the sorted records
+        void Reset() noexcept
+        {
+            IsSet = false;
+            KeyValue = T{};
+            Record = nullptr;
+        }
+
+        /// \brief Default destructor
+        ~VaultPageCursor() noexcept = default;
+    };
+}
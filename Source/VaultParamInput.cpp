@@ -2,24 +2,107 @@
 
 namespace mvlt
 {
-    VaultOperationResult VaultParamInput::SetDataToRef(const std::string& key, VaultRecordRef& refToSetData) const noexcept
+    VaultParamInput::VaultParamInput(const VaultParamInput& other) noexcept
     {
         DBG_LOG_ENTER();
 
-        return SetDataToRefFunc(key, refToSetData);
+        *this = other;
     }
 
-    void VaultParamInput::SetDataToRecord(const std::string& key, VaultRecord* recordToSetData) const noexcept
+    VaultParamInput::VaultParamInput(VaultParamInput&& other) noexcept
     {
         DBG_LOG_ENTER();
 
-        SetDataToRecordFunc(key, recordToSetData);
+        *this = std::move(other);
+    }
+
+    VaultParamInput& VaultParamInput::operator=(const VaultParamInput& other) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        if (&other != this)
+        {
+            DeleteData();
+
+            if (other.VTablePtr != nullptr)
+            {
+                other.VTablePtr->CopyFunc(*this, other.GetDataPtr());
+                VTablePtr = other.VTablePtr;
+            }
+        }
+
+        return *this;
+    }
+
+    VaultParamInput& VaultParamInput::operator=(VaultParamInput&& other) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        if (&other != this)
+        {
+            DeleteData();
+
+            if (other.VTablePtr != nullptr)
+            {
+                // Heap data is taken from other without moving the data itself
+                if (other.VTablePtr->IsInline)
+                    other.VTablePtr->MoveFunc(*this, other.GetDataPtr());
+                else
+                    Ptr = other.Ptr;
+
+                VTablePtr = other.VTablePtr;
+
+                if (VTablePtr->IsInline)
+                    other.DeleteData();
+                else
+                    other.VTablePtr = nullptr;
+            }
+        }
+
+        return *this;
+    }
+
+    void* VaultParamInput::GetDataPtr() noexcept
+    {
+        if (VTablePtr->IsInline) return static_cast<void*>(&InlineBuffer);
+        return Ptr;
+    }
+
+    const void* VaultParamInput::GetDataPtr() const noexcept
+    {
+        if (VTablePtr->IsInline) return static_cast<const void*>(&InlineBuffer);
+        return Ptr;
+    }
+
+    void VaultParamInput::DeleteData() noexcept
+    {
+        if (VTablePtr != nullptr)
+        {
+            VTablePtr->DeleteFunc(*this);
+            VTablePtr = nullptr;
+        }
+    }
+
+    void VaultParamInput::SetDataToRecord(const std::string& key, VaultRecord* recordToSetData, const bool& isMoveData) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        // Data is moved only from params that are not used after it
+        VTablePtr->SetDataToRecordFunc(key, recordToSetData, const_cast<void*>(GetDataPtr()), isMoveData);
     }
 
     std::type_index VaultParamInput::GetDataType() const noexcept
     {
         DBG_LOG_ENTER();
 
-        return DataType;
+        if (VTablePtr == nullptr) return typeid(void);
+        return VTablePtr->DataType;
+    }
+
+    VaultParamInput::~VaultParamInput() noexcept
+    {
+        DBG_LOG_ENTER();
+
+        DeleteData();
     }
-}
\ No newline at end of file
+}
@@ -1,65 +1,203 @@
 #pragma once
 
+#include <new>
 #include <string>
+#include <utility>
 #include <typeindex>
-#include <functional>
+#include <type_traits>
 
 #include "VaultClasses.h"
-#include "VaultRecordRef.h"
+#include "VaultOperationResult.h"
 
 namespace mvlt
 {
     /**
         \brief A class for transferring data to the Vault
 
-        It is used for multiple data additions when creating a record in Vault and for multiple data changes when setting data in VaultRecordRef
+        It is used for multiple data additions when creating a record in Vault and for multiple data changes when setting data in VaultRecordRef.
+        Small types and strings are stored inside the object without heap allocation, and all functions to work with the stored type
+        are kept in one static table per type. Rvalue data is moved inside the object.
     */
     class VaultParamInput
     {
     private:
-        // Pointer to data type saver
-        std::type_index DataType;
+        // Table with functions to work with a specific data type. One static table is shared by all VaultParamInputs storing this type
+        struct VaultParamInputVTable
+        {
+            // Stored data type
+            const std::type_info& DataType;
 
-        // Function for setting data to VaultRecordRef
-        std::function<VaultOperationResult(const std::string& data, VaultRecordRef& ref)> SetDataToRefFunc;
+            // Is data stored inside InlineBuffer instead of heap
+            bool IsInline;
 
-        // Function for settind data to VaultRecord
-        std::function<void(const std::string& data, VaultRecord* record)> SetDataToRecordFunc;
+            // Pointer to copy function. Data will be placed to dst storage
+            void (*CopyFunc)(VaultParamInput& dst, const void* src);
+
+            // Pointer to move function. Data will be moved to dst storage
+            void (*MoveFunc)(VaultParamInput& dst, void* src);
+
+            // Pointer to delete function. Required to delete data since it is not possibly to delete void*
+            void (*DeleteFunc)(VaultParamInput& paramToDelete);
+
+            // Pointer to function to copy or move data to VaultRecord
+            void (*SetDataToRecordFunc)(const std::string& key, VaultRecord* record, void* data, const bool& isMoveData);
+        };
+
+        // Struct to store static function table for T type
+        template <class T>
+        struct TypeVTable
+        {
+            // Function table for T type
+            static const VaultParamInputVTable VTable;
+        };
+
+        // Size of buffer to store small data without heap allocation
+        static constexpr std::size_t InlineBufferSize = sizeof(std::string);
+
+        // Type of buffer to store small data without heap allocation
+        typedef std::aligned_storage<InlineBufferSize>::type InlineBufferType;
+
+        // Struct to check if T type will be stored inside InlineBuffer
+        template <class T>
+        struct IsInlineType
+        {
+            static constexpr bool value = sizeof(T) <= InlineBufferSize && alignof(T) <= alignof(InlineBufferType) &&
+                std::is_nothrow_move_constructible<T>::value;
+        };
+
+        union
+        {
+            // Void pointer to save pointer to any data stored in heap
+            void* Ptr;
+
+            // Buffer to save small data
+            InlineBufferType InlineBuffer;
+        };
+
+        // Pointer to function table of stored data type. Nullptr if data was moved out of the object
+        const VaultParamInputVTable* VTablePtr = nullptr;
 
         /**
-            \brief Method for setting key data in VaultRecordRef
+            \brief A method for getting a pointer to stored data
 
-            \param [in] key data key
-            \param [in] refToSetData ref to set data
+            \return pointer to data inside InlineBuffer or inside heap
+        */
+        void* GetDataPtr() noexcept;
+
+        /**
+            \brief A method for getting a pointer to stored data
+
+            \return pointer to data inside InlineBuffer or inside heap
+        */
+        const void* GetDataPtr() const noexcept;
+
+        /**
+            \brief A template method for placing a copy of data to VaultParamInput storage
+
+            \tparam <T> Any type of data except for c arrays
 
-            \return VaultRecordRef::SetData status
+            \param [out] dst VaultParamInput to place data in. Must be empty
+            \param [in] src pointer to data to copy
         */
-        VaultOperationResult SetDataToRef(const std::string& key, VaultRecordRef& refToSetData) const noexcept;
+        template <class T>
+        static void CopyData(VaultParamInput& dst, const void* src) noexcept;
+
+        /**
+            \brief A template method for moving data to VaultParamInput storage
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [out] dst VaultParamInput to place data in. Must be empty
+            \param [in] src pointer to data to move
+        */
+        template <class T>
+        static void MoveData(VaultParamInput& dst, void* src) noexcept;
+
+        /**
+            \brief A template method for deleting data from VaultParamInput storage
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] paramToDelete VaultParamInput to delete data from
+        */
+        template <class T>
+        static void DeleteData(VaultParamInput& paramToDelete) noexcept;
+
+        /**
+            \brief A template method for setting data to VaultRecord
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] key data key
+            \param [in] record pointer to VaultRecord
+            \param [in] data pointer to data
+            \param [in] isMoveData should data be moved to the record instead of copying
+        */
+        template <class T>
+        static void DataToRecord(const std::string& key, VaultRecord* record, void* data, const bool& isMoveData) noexcept;
+
+        /// \brief A method for deleting data
+        void DeleteData() noexcept;
 
         /**
             \brief Method for setting key data in VaultRecord
+
             \param [in] key data key
             \param [in] recordToSetData pointer to VaultRecord
+            \param [in] isMoveData should data be moved to the record instead of copying.
+            It must be true only if the object is not used after this call
         */
-        void SetDataToRecord(const std::string& key, VaultRecord* recordToSetData) const noexcept;
+        void SetDataToRecord(const std::string& key, VaultRecord* recordToSetData, const bool& isMoveData = false) const noexcept;
 
     public:
         /// Making the Vault class friendly so that it has access to the internal members of the VaultParamInput class
         friend Vault;
 
-        /// Making the VaultRecordRef class friendly so that it has access to the internal members of the VaultParamInput class
-        friend VaultRecordRef;
+        /// Making the ShardedVault class friendly so that it has access to the internal members of the VaultParamInput class
+        friend ShardedVault;
 
         /**
             \brief A template constructor that accepts a variable to store inside VaultParamInput
 
             \tparam <T> Any type of data except for c arrays
 
-            \param [in] data data to be stored inside VaultParamInput
+            \param [in] data data to be stored inside VaultParamInput. It is moved inside the object if it is rvalue
         */
-        template <class T>
+        template <class T, class = typename std::enable_if<!std::is_same<typename std::decay<T>::type, VaultParamInput>::value>::type>
         // codechecker_intentional [all] its not explicit to simplify code
-        VaultParamInput(const T& data) noexcept;
+        VaultParamInput(T&& data) noexcept;
+
+        /**
+            \brief Copy constructor
+
+            \param [in] other object to be copied
+        */
+        VaultParamInput(const VaultParamInput& other) noexcept;
+
+        /**
+            \brief Move constructor
+
+            \param [in] other object to be moved
+        */
+        VaultParamInput(VaultParamInput&& other) noexcept;
+
+        /**
+            \brief Assignment operator
+
+            \param [in] other object to be copied
+
+            \return returns a new object, with data from other
+        */
+        VaultParamInput& operator=(const VaultParamInput& other) noexcept;
+
+        /**
+            \brief Move assignment operator
+
+            \param [in] other object to be moved
+
+            \return returns a new object, with data from other
+        */
+        VaultParamInput& operator=(VaultParamInput&& other) noexcept;
 
         /**
             \brief A method for getting the type of saved data.
@@ -67,5 +205,8 @@ namespace mvlt
             \return std::type_index object with saved data type
         */
         std::type_index GetDataType() const noexcept;
+
+        /// \brief Destructor
+        ~VaultParamInput() noexcept;
     };
-}
\ No newline at end of file
+}
@@ -2,27 +2,74 @@
 
 #include "VaultParamInput.h"
 
-#include "VaultRecordRef.hpp"
+#include "VaultRecord.h"
 
 namespace mvlt
 {
     template <class T>
-    VaultParamInput::VaultParamInput(const T& data) noexcept : DataType(typeid(T))
+    void VaultParamInput::CopyData(VaultParamInput& dst, const void* src) noexcept
+    {
+        if (IsInlineType<T>::value)
+            new (&dst.InlineBuffer) T(*static_cast<const T*>(src));
+        else
+            dst.Ptr = static_cast<void*>(new T(*static_cast<const T*>(src)));
+    }
+
+    template <class T>
+    void VaultParamInput::MoveData(VaultParamInput& dst, void* src) noexcept
+    {
+        if (IsInlineType<T>::value)
+            new (&dst.InlineBuffer) T(std::move(*static_cast<T*>(src)));
+        else
+            dst.Ptr = static_cast<void*>(new T(std::move(*static_cast<T*>(src))));
+    }
+
+    template <class T>
+    void VaultParamInput::DeleteData(VaultParamInput& paramToDelete) noexcept
+    {
+        if (IsInlineType<T>::value)
+            reinterpret_cast<T*>(&paramToDelete.InlineBuffer)->~T();
+        else
+            delete static_cast<T*>(paramToDelete.Ptr);
+    }
+
+    template <class T>
+    void VaultParamInput::DataToRecord(const std::string& key, VaultRecord* record, void* data, const bool& isMoveData) noexcept
+    {
+        if (isMoveData)
+            record->SetData(key, std::move(*static_cast<T*>(data)));
+        else
+            record->SetData(key, *static_cast<const T*>(data));
+    }
+
+    template <class T, class>
+    VaultParamInput::VaultParamInput(T&& data) noexcept
     {
         DBG_LOG_ENTER();
 
-        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
+        typedef typename std::decay<T>::type Type;
+
+        static_assert(!std::is_array<typename std::remove_reference<T>::type>::value, "It is not possible to use a c array as a key value. \n\
             If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
             CreateRecord({{\"Key\", std::string(\"Value\")}});");
 
-        SetDataToRefFunc = [=](const std::string& key, VaultRecordRef& refToSetData)
-        {
-            return refToSetData.SetData(key, data);
-        };
+        // Move rvalue data and copy lvalue data
+        if (std::is_lvalue_reference<T>::value)
+            CopyData<Type>(*this, &data);
+        else
+            MoveData<Type>(*this, const_cast<Type*>(&data));
 
-        SetDataToRecordFunc = [=](const std::string& key, VaultRecord* recordToSetData)
-        {
-            recordToSetData->SetData(key, data);
-        };
+        VTablePtr = &TypeVTable<Type>::VTable;
     }
-}
\ No newline at end of file
+
+    template <class T>
+    const VaultParamInput::VaultParamInputVTable VaultParamInput::TypeVTable<T>::VTable =
+    {
+        typeid(T),
+        VaultParamInput::IsInlineType<T>::value,
+        &VaultParamInput::CopyData<T>,
+        &VaultParamInput::MoveData<T>,
+        &VaultParamInput::DeleteData<T>,
+        &VaultParamInput::DataToRecord<T>
+    };
+}
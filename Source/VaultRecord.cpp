@@ -1,5 +1,6 @@
 #include "VaultRecord.h"
 #include "VaultRecord.hpp"
+#include "VaultRecordArena.h"
 
 namespace mvlt
 {
@@ -8,134 +9,126 @@ namespace mvlt
         DBG_LOG_ENTER();
     }
 
-    // codechecker_intentional [all] its not call parent class copy constructor because it is mutexes inside this class
-    VaultRecord::VaultRecord(const VaultRecord& other) noexcept
+    VaultRecord::VaultRecord(VaultColumnStorage* storage) noexcept
     {
         DBG_LOG_ENTER();
 
-        other.VaultRecordMutex.lock();
-        for (const auto& containerIt : other.Container)
-            Container.emplace(containerIt);
-        other.VaultRecordMutex.unlock();
+        Storage = storage;
+        Row = Storage->AllocateRow(this);
     }
 
-    VaultRecord& VaultRecord::operator=(const VaultRecord& other) noexcept
+    bool VaultRecord::GetDataSaver(const std::string& key, DataSaver& dataSaver) const noexcept
     {
         DBG_LOG_ENTER();
 
-        if (&other != this)
-        {
-            IsValid = true;
-            RefCounter = 0;
-
-            other.VaultRecordMutex.lock();
-            Container.clear();
-            for (const auto& containerIt : other.Container)
-                Container.emplace(containerIt);
-            other.VaultRecordMutex.unlock();
-        }
+        if (Storage == nullptr) return false;
+
+        const DataColumn* column = Storage->GetColumn(key);
+        if (column == nullptr) return false;
+
+        column->GetDataSaver(Row, dataSaver);
+        return true;
+    }
+
+    bool VaultRecord::GetDataAsString(const std::string& key, std::string& str) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        if (Storage == nullptr) return false;
+
+        const DataColumn* column = Storage->GetColumn(key);
+        if (column == nullptr) return false;
 
-        return *this;
+        str = column->GetDataAsString(Row);
+        return true;
     }
 
-    VaultRecord::VaultRecord(VaultRecord&& other) noexcept
+    bool VaultRecord::SetDataFromString(const std::string& key, const std::string& str) noexcept
     {
         DBG_LOG_ENTER();
 
-        other.VaultRecordMutex.lock();
-        Container = std::move(other.Container);
-        other.VaultRecordMutex.unlock();
+        if (Storage == nullptr) return false;
+
+        DataColumn* column = Storage->GetColumn(key);
+        if (column == nullptr) return false;
+
+        return column->SetDataFromString(Row, str);
     }
 
-    VaultRecord& VaultRecord::operator=(VaultRecord&& other) noexcept
+    void VaultRecord::CopyData(const VaultRecord& other, const std::list<std::string>& keys) noexcept
     {
         DBG_LOG_ENTER();
 
-        if (&other != this)
+        if (Storage == nullptr || other.Storage == nullptr) return;
+
+        for (const std::string& key : keys)
         {
-            IsValid = true;
-            RefCounter = 0;
+            DataColumn* column = Storage->GetColumn(key);
+            const DataColumn* otherColumn = other.Storage->GetColumn(key);
 
-            other.VaultRecordMutex.lock();
-            Container = std::move(other.Container);
-            other.VaultRecordMutex.unlock();
+            if (column != nullptr && otherColumn != nullptr)
+                column->CopyRow(Row, *otherColumn, other.Row);
         }
+    }
+
+    void VaultRecord::Release() noexcept
+    {
+        DBG_LOG_ENTER();
 
-        return *this;
+        if (Arena != nullptr) Arena->ReleaseRecord(this);
+        else delete this;
     }
 
     void VaultRecord::AddRef() noexcept
     {
         DBG_LOG_ENTER();
 
-        VaultRecordMutex.lock();
-        ++RefCounter;
-        VaultRecordMutex.unlock();
+        // The caller already has access to the record, so it can not be released at the same time
+        RefState.fetch_add(RefUnit, std::memory_order_relaxed);
     }
 
     void VaultRecord::RemoveRef() noexcept
     {
         DBG_LOG_ENTER();
 
-        bool isEnd = false;
-        VaultRecordMutex.lock();
-        --RefCounter;
-        if (!IsValid && RefCounter == 0) isEnd = true;
-        VaultRecordMutex.unlock();
-
-        if (isEnd) delete this;
+        // Release the record if it was the last reference to the invalid record
+        if (RefState.fetch_sub(RefUnit, std::memory_order_acq_rel) == RefUnit) Release();
     }
 
     void VaultRecord::Invalidate() noexcept
     {
         DBG_LOG_ENTER();
 
-        bool isEnd = false;
-        VaultRecordMutex.lock();
-        IsValid = false;
-        if (RefCounter == 0) isEnd = true;
-        VaultRecordMutex.unlock();
-
-        if (isEnd) delete this;
+        // Release the record if it was valid and had no references
+        if (RefState.fetch_and(~ValidFlag, std::memory_order_acq_rel) == ValidFlag) Release();
     }
 
     bool VaultRecord::GetIsValid() const noexcept
     {
         DBG_LOG_ENTER();
 
-        bool res;
-        VaultRecordMutex.lock();
-        res = IsValid;
-        VaultRecordMutex.unlock();
-        return res;
+        return (RefState.load(std::memory_order_acquire) & ValidFlag) != 0;
     }
 
     void VaultRecord::RemoveFromDependentSets() noexcept
     {
         DBG_LOG_ENTER();
 
-        VaultRecordMutex.lock();
         for (VaultRecordSet* set : dependentVaultRecordSets)
             set->RemoveRecord(this, nullptr);
-
-        VaultRecordMutex.unlock();
     }
 
     void VaultRecord::AddToDependentSets(VaultRecordSet* vaultRecordSet) noexcept
     {
         DBG_LOG_ENTER();
 
-        VaultRecordMutex.lock();
         dependentVaultRecordSets.emplace(vaultRecordSet);
-        VaultRecordMutex.unlock();
     }
 
     void VaultRecord::EraseDependentSet(VaultRecordSet* vaultRecordSet) noexcept
     {
         DBG_LOG_ENTER();
 
-        VaultRecordMutex.lock();
         dependentVaultRecordSets.erase(vaultRecordSet);
-        VaultRecordMutex.unlock();
     }
 }
\ No newline at end of file
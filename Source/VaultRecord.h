@@ -1,32 +1,49 @@
 #pragma once
 
+#include <list>
+#include <atomic>
 #include <vector>
 #include <sstream>
-#include <mutex>
 
 #include "VaultClasses.h"
+#include "VaultColumnStorage.h"
 
 namespace mvlt
 {
     /**
         \brief A class for storing data inside Vault
 
-        It is a wrapper over the Data Hash Map, but adds a functionality to invalidate VaultRecordRef's pointing to an object of this class.
-        The functionality from HashMap stores allows you to store data of any type and provide access to them using string keys.
+        The record data is not stored inside the object. The record owns one row in the column storage of Vault,
+        and provides access to the data of this row using string keys. It also adds a functionality to invalidate
+        VaultRecordRef's pointing to an object of this class.
     */
-    class VaultRecord : public DataHashMap
+    class VaultRecord
     {
     private:
-        // Variable to store object validity
-        bool IsValid = true;
+        // Pointer to the column storage with record data
+        VaultColumnStorage* Storage = nullptr;
 
-        // Validity counter
-        std::size_t RefCounter = 0;
+        // Row number inside the column storage
+        std::size_t Row = 0;
 
-        // Mutex for thread safety
-        mutable std::recursive_mutex VaultRecordMutex;
+        // Arena in which the record is placed. If it is nullptr, the record is created with new
+        VaultRecordArena* Arena = nullptr;
 
-        // Set with all dependent VaultRecordSets
+        // Slot number inside the arena
+        std::size_t Slot = 0;
+
+        // Flag of the object validity inside RefState
+        static constexpr std::size_t ValidFlag = 1;
+
+        // Increment of RefState for one reference
+        static constexpr std::size_t RefUnit = 2;
+
+        // Object validity in the lowest bit and number of references in the other bits.
+        // They are changed together by one atomic operation, so the last of RemoveRef and Invalidate releases the record
+        std::atomic<std::size_t> RefState{ValidFlag};
+
+        // Set with all dependent VaultRecordSets. It is changed under the write lock of Vault
+        // or under the read lock of Vault with locked Vault::DependentSetsMtx
         std::unordered_set<VaultRecordSet*> dependentVaultRecordSets;
 
     public:
@@ -39,40 +56,138 @@ namespace mvlt
         /// Making the VaultRecordSet class friendly so that it has access to the internal members of the VaultRecord class
         friend VaultRecordSet;
 
+        /// Making the VaultRecordArena class friendly so that it has access to the internal members of the VaultRecord class
+        friend VaultRecordArena;
+
+        /// Making the VaultRecordBitmap class friendly so that it has access to the internal members of the VaultRecord class
+        friend VaultRecordBitmap;
+
+        /// Making the KeyIndexHandles class friendly so that it has access to the internal members of the VaultRecord class
+        template <class T>
+        friend class KeyIndexHandles;
+
+        /// Making the CompositeIndex class friendly so that it has access to the internal members of the VaultRecord class
+        friend CompositeIndex;
+
+        /// Making the GroupAggregate class friendly so that it has access to the internal members of the VaultRecord class
+        friend GroupAggregate;
+
         /// \brief Default constructor
         VaultRecord() noexcept;
 
         /**
-            \brief Copy constructor
+            \brief A constructor that allocates a new row in the column storage
+
+            \param [in] storage column storage to allocate row in
+        */
+        explicit VaultRecord(VaultColumnStorage* storage) noexcept;
+
+        /// \brief Deleted copy constructor
+        VaultRecord(const VaultRecord& other) noexcept = delete;
+
+        /// \brief Deleted assignment operator
+        VaultRecord& operator=(const VaultRecord& other) noexcept = delete;
+
+        /**
+            \brief Method for getting data from a record using a key
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] key key for getting data
+            \param [out] data a reference to data of type T to write data from the record there.
+            If the data was not found, then nothing will be written to the data
+
+            \return Returns false if the key was not found or type is not match, and otherwise returns true.
+        */
+        template <class T>
+        bool GetData(const std::string& key, T& data) const noexcept
+        {
+            if (Storage == nullptr) return false;
+
+            const DataColumn* column = Storage->GetColumn(key);
+            if (column == nullptr) return false;
+
+            return column->GetData(Row, data);
+        }
+
+        /**
+            \brief Method for getting reference to data of a record using a key without copying it
 
-            \param [in] other object to copy data from
+            \tparam <T> Type of the key
+
+            \param [in] key key for getting data. It must be the key of the record with T type
+
+            \return Returns const reference to the data. For bool key the value is returned
         */
-        VaultRecord(const VaultRecord& other) noexcept;
+        template <class T>
+        typename std::vector<T>::const_reference GetDataRef(const std::string& key) const noexcept
+        {
+            return Storage->GetColumn(key)->GetDataRef<T>(Row);
+        }
 
         /**
-            \brief Assignment operator
+            \brief Method for setting data to a record using a key
 
-            \param [in] other object to copy data from
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] key key for setting data
+            \param [in] data data to be stored inside the record. It is moved to the record if it is rvalue
 
-            \return reference to copied object
+            \return Returns false if the key was not found or type is not match, and otherwise returns true.
         */
-        VaultRecord& operator=(const VaultRecord& other) noexcept;
+        template <class T>
+        bool SetData(const std::string& key, T&& data) noexcept
+        {
+            if (Storage == nullptr) return false;
+
+            DataColumn* column = Storage->GetColumn(key);
+            if (column == nullptr) return false;
+
+            return column->SetData(Row, std::forward<T>(data));
+        }
 
         /**
-            \brief Move constructor
+            \brief Method for getting a copy of data inside DataSaver from a record using a key
+
+            \param [in] key key for getting data
+            \param [out] dataSaver a reference to DataSaver to write data from the record there
 
-            \param [in] other object to move data from
+            \return Returns false if the key was not found, and otherwise returns true.
         */
-        VaultRecord(VaultRecord&& other) noexcept;
+        bool GetDataSaver(const std::string& key, DataSaver& dataSaver) const noexcept;
 
         /**
-            \brief Move assignment operator
+            \brief Method for getting data converted to string from a record using a key
 
-            \param [in] other object to move data from
+            \param [in] key key for getting data
+            \param [out] str a reference to string to write data from the record there
 
-            \return reference to moved object
+            \return Returns false if the key was not found, and otherwise returns true.
         */
-        VaultRecord& operator=(VaultRecord&& other) noexcept;
+        bool GetDataAsString(const std::string& key, std::string& str) const noexcept;
+
+        /**
+            \brief Method for setting data from string to a record using a key
+
+            \param [in] key key for setting data
+            \param [in] str a string with data
+
+            \return Returns false if the key was not found or the conversion failed, and otherwise returns true.
+        */
+        bool SetDataFromString(const std::string& key, const std::string& str) noexcept;
+
+        /**
+            \brief A method for copying all data from the other record
+
+            Columns are matched by key names, so records can be from different column storages.
+
+            \param [in] other record to copy data from
+            \param [in] keys names of keys to copy
+        */
+        void CopyData(const VaultRecord& other, const std::list<std::string>& keys) noexcept;
+
+        /// \brief A method for deleting the record when it is no longer valid and has no references
+        void Release() noexcept;
 
         /// \brief A method for increasing the number of references to an object
         void AddRef() noexcept;
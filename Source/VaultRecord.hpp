@@ -10,11 +10,7 @@ namespace mvlt
     {
         DBG_LOG_ENTER();
 
-        VaultRecordMutex.lock();
-
         for (VaultRecordSet* vaultRecordSet : dependentVaultRecordSets)
             vaultRecordSet->SetDataToRecord(this, key, data);
-
-        VaultRecordMutex.unlock();
     }
 }
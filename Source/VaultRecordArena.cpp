@@ -0,0 +1,117 @@
+#include "VaultRecordArena.h"
+
+#include <new>
+
+#include "VaultRecord.h"
+
+namespace mvlt
+{
+    constexpr std::size_t VaultRecordArena::ChunkSize;
+
+    VaultRecord* VaultRecordArena::GetSlot(const std::size_t& slot) const noexcept
+    {
+        return static_cast<VaultRecord*>(Chunks[slot / ChunkSize]) + slot % ChunkSize;
+    }
+
+    void VaultRecordArena::DestroyRecord(VaultRecord* record) noexcept
+    {
+        std::size_t slot = record->Slot;
+
+        record->~VaultRecord();
+        LiveSlots[slot] = false;
+        --LiveRecordsCount;
+        FreeSlots.emplace_back(slot);
+    }
+
+    VaultRecord* VaultRecordArena::CreateRecord(VaultColumnStorage* storage) noexcept
+    {
+        std::size_t slot;
+
+        {
+            std::lock_guard<std::mutex> lock(ArenaMutex);
+
+            if (!FreeSlots.empty())
+            {
+                slot = FreeSlots.back();
+                FreeSlots.pop_back();
+            }
+            else
+            {
+                // All chunks are full so allocate new one
+                if (UsedSlotsCount == Chunks.size() * ChunkSize)
+                    Chunks.emplace_back(::operator new(ChunkSize * sizeof(VaultRecord)));
+
+                slot = UsedSlotsCount;
+                ++UsedSlotsCount;
+                LiveSlots.emplace_back(false);
+            }
+
+            LiveSlots[slot] = true;
+            ++LiveRecordsCount;
+        }
+
+        VaultRecord* record = new (GetSlot(slot)) VaultRecord(storage);
+        record->Arena = this;
+        record->Slot = slot;
+
+        return record;
+    }
+
+    void VaultRecordArena::ReleaseRecord(VaultRecord* record) noexcept
+    {
+        bool isEnd = false;
+
+        {
+            std::lock_guard<std::mutex> lock(ArenaMutex);
+
+            DestroyRecord(record);
+            isEnd = IsOwnerReleased && LiveRecordsCount == 0;
+        }
+
+        if (isEnd) delete this;
+    }
+
+    void VaultRecordArena::InvalidateAll() noexcept
+    {
+        std::lock_guard<std::mutex> lock(ArenaMutex);
+
+        for (std::size_t slot = 0; slot < UsedSlotsCount; ++slot)
+        {
+            if (!LiveSlots[slot]) continue;
+
+            VaultRecord* record = GetSlot(slot);
+
+            // Destroy the record if it was valid and had no references
+            if (record->RefState.fetch_and(~VaultRecord::ValidFlag, std::memory_order_acq_rel) == VaultRecord::ValidFlag)
+                DestroyRecord(record);
+        }
+
+        // Release all slots in bulk, so new records will be placed from the beginning of the first chunk
+        if (LiveRecordsCount == 0)
+        {
+            UsedSlotsCount = 0;
+            FreeSlots.clear();
+            LiveSlots.clear();
+        }
+    }
+
+    void VaultRecordArena::ReleaseOwner() noexcept
+    {
+        bool isEnd = false;
+
+        {
+            std::lock_guard<std::mutex> lock(ArenaMutex);
+
+            IsOwnerReleased = true;
+            isEnd = LiveRecordsCount == 0;
+        }
+
+        if (isEnd) delete this;
+    }
+
+    VaultRecordArena::~VaultRecordArena() noexcept
+    {
+        for (void* chunk : Chunks)
+            ::operator delete(chunk);
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "VaultClasses.h"
+#include "VaultColumnStorage.h"
+
+namespace mvlt
+{
+    /**
+        \brief A class for allocating VaultRecord objects of one Vault
+
+        Records are placed in chunks of memory, one after another, so they are dense in memory and creating a record
+        does not call malloc while there are free slots. Slots of released records are reused by new records.
+
+        Records can outlive Vault when there are VaultRecordRef's pointing to them, so the arena is not deleted by Vault directly.
+        Vault calls ReleaseOwner in its destructor, and the arena deletes itself when the last record is released.
+    */
+    class VaultRecordArena
+    {
+    private:
+        // Number of records in one chunk
+        static constexpr std::size_t ChunkSize = 1024;
+
+        // Chunks of memory for records
+        std::vector<void*> Chunks;
+
+        // Number of slots ever used. Slots after it are not initialized
+        std::size_t UsedSlotsCount = 0;
+
+        // Slots released by records
+        std::vector<std::size_t> FreeSlots;
+
+        // Is slot occupied by a record
+        std::vector<bool> LiveSlots;
+
+        // Number of records in the arena
+        std::size_t LiveRecordsCount = 0;
+
+        // Is Vault owning the arena destroyed
+        bool IsOwnerReleased = false;
+
+        // Mutex for thread safety. Records can be released from VaultRecordRef in any thread
+        std::mutex ArenaMutex;
+
+        // A method for getting the record pointer by slot number
+        VaultRecord* GetSlot(const std::size_t& slot) const noexcept;
+
+        // A method for destroying the record and marking its slot as free. ArenaMutex must be locked
+        void DestroyRecord(VaultRecord* record) noexcept;
+
+    public:
+        /// \brief Default constructor
+        VaultRecordArena() noexcept = default;
+
+        /// \brief Deleted copy constructor
+        VaultRecordArena(const VaultRecordArena& other) noexcept = delete;
+
+        /// \brief Deleted assignment operator
+        VaultRecordArena& operator=(const VaultRecordArena& other) noexcept = delete;
+
+        /**
+            \brief A method for creating a new record
+
+            \param [in] storage column storage to allocate row in
+
+            \return pointer to the new record
+        */
+        VaultRecord* CreateRecord(VaultColumnStorage* storage) noexcept;
+
+        /**
+            \brief A method for releasing the record slot
+
+            If the owner Vault is destroyed and it was the last record, the arena deletes itself.
+
+            \param [in] record record created by this arena
+        */
+        void ReleaseRecord(VaultRecord* record) noexcept;
+
+        /**
+            \brief A method for invalidating all records
+
+            Records without references are released immediately. If no records are left, all slots are released in bulk.
+        */
+        void InvalidateAll() noexcept;
+
+        /**
+            \brief A method to indicate that the owner Vault is destroyed
+
+            If there are no records left, the arena deletes itself, otherwise it will be deleted with the last record.
+        */
+        void ReleaseOwner() noexcept;
+
+        /// \brief Destructor
+        ~VaultRecordArena() noexcept;
+    };
+}
@@ -0,0 +1,615 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <iterator>
+
+#include "VaultClasses.h"
+#include "VaultRecord.h"
+#include "VaultColumnStorage.h"
+
+namespace mvlt
+{
+    /**
+        \brief A class for storing a set of records of one Vault as a bitmap of their rows
+
+        Each record owns one row in the column storage of Vault, and rows are dense, so the set is stored as bits over row numbers.
+        Bits are grouped in blocks of 4096 rows. Blocks are allocated on the first record and deleted with the last one,
+        so sets with a few records of a big Vault stay small. The record of each row is taken from the column storage.
+
+        Union, intersection and difference of two sets are made word by word, and only records whose bit changes are visited.
+
+        The interface repeats the used part of std::unordered_set, so the bitmap replaces it in Vault and requests.
+        Iterators store the row number and are not invalidated by erasing other records.
+        Records are iterated in the order of their rows.
+    */
+    class VaultRecordBitmap
+    {
+    private:
+        // Number of bits in one word
+        static constexpr std::size_t WordBits = 64;
+
+        // Number of words in one block
+        static constexpr std::size_t BlockWords = 64;
+
+        // Number of rows in one block
+        static constexpr std::size_t BlockBits = WordBits * BlockWords;
+
+        // Block of bits with the number of set bits
+        struct Block
+        {
+            std::uint64_t Words[BlockWords] = {};
+            std::size_t Count = 0;
+        };
+
+        // Blocks of bits. Nullptr if there are no records in the block
+        std::vector<Block*> Blocks;
+
+        // Number of records in the set
+        std::size_t RecordsCount = 0;
+
+        // Column storage of the records. It is taken from the first added record
+        const VaultColumnStorage* Storage = nullptr;
+
+        // A function for getting the number of the lowest set bit. The word must not be zero
+        static std::size_t LowestBit(std::uint64_t word) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+            std::size_t res = 0;
+            while ((word & 1) == 0)
+            {
+                word >>= 1;
+                ++res;
+            }
+            return res;
+#endif
+        }
+
+        // A function for getting the number of set bits
+        static std::size_t BitsCount(std::uint64_t word) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+            std::size_t res = 0;
+            for (; word != 0; ++res)
+                word &= word - 1;
+            return res;
+#endif
+        }
+
+        // A method for getting the word with the row. Nullptr if the block with the row is not allocated
+        const std::uint64_t* GetWord(const std::size_t& blockIndex, const std::size_t& wordIndex) const noexcept
+        {
+            if (blockIndex >= Blocks.size() || Blocks[blockIndex] == nullptr) return nullptr;
+            return &Blocks[blockIndex]->Words[wordIndex];
+        }
+
+        // A method for getting the first row in the set which is not less than row. Returns End if there is no such row
+        std::size_t FindNextRow(const std::size_t& row) const noexcept
+        {
+            std::size_t blockIndex = row / BlockBits;
+            std::size_t wordIndex = (row % BlockBits) / WordBits;
+            std::size_t bit = row % WordBits;
+
+            for (; blockIndex < Blocks.size(); ++blockIndex, wordIndex = 0, bit = 0)
+            {
+                const Block* block = Blocks[blockIndex];
+                if (block == nullptr) continue;
+
+                for (; wordIndex < BlockWords; ++wordIndex, bit = 0)
+                {
+                    std::uint64_t word = block->Words[wordIndex] & (~std::uint64_t(0) << bit);
+                    if (word != 0) return blockIndex * BlockBits + wordIndex * WordBits + LowestBit(word);
+                }
+            }
+
+            return End;
+        }
+
+        // A method for setting the bit of the row. Returns false if the bit is already set
+        bool SetRow(const std::size_t& row) noexcept
+        {
+            std::size_t blockIndex = row / BlockBits;
+
+            if (blockIndex >= Blocks.size()) Blocks.resize(blockIndex + 1, nullptr);
+            if (Blocks[blockIndex] == nullptr) Blocks[blockIndex] = new Block;
+
+            Block* block = Blocks[blockIndex];
+            std::uint64_t& word = block->Words[(row % BlockBits) / WordBits];
+            std::uint64_t mask = std::uint64_t(1) << (row % WordBits);
+
+            if ((word & mask) != 0) return false;
+
+            word |= mask;
+            ++block->Count;
+            ++RecordsCount;
+            return true;
+        }
+
+        // A method for clearing the bit of the row. The bit must be set
+        void ResetRow(const std::size_t& row) noexcept
+        {
+            std::size_t blockIndex = row / BlockBits;
+            Block* block = Blocks[blockIndex];
+
+            block->Words[(row % BlockBits) / WordBits] &= ~(std::uint64_t(1) << (row % WordBits));
+            --RecordsCount;
+
+            if (--block->Count == 0)
+            {
+                delete block;
+                Blocks[blockIndex] = nullptr;
+            }
+        }
+
+        // A method for copying blocks from other bitmap
+        void CopyBlocks(const VaultRecordBitmap& other) noexcept
+        {
+            Blocks.resize(other.Blocks.size(), nullptr);
+
+            for (std::size_t i = 0; i < other.Blocks.size(); ++i)
+                if (other.Blocks[i] != nullptr) Blocks[i] = new Block(*other.Blocks[i]);
+
+            RecordsCount = other.RecordsCount;
+            Storage = other.Storage;
+        }
+
+    public:
+        /// \brief Row number of the end iterator
+        static constexpr std::size_t End = static_cast<std::size_t>(-1);
+
+        /// \brief A class for iterating over records in the set
+        class iterator
+        {
+        private:
+            // Bitmap with records
+            const VaultRecordBitmap* Bitmap = nullptr;
+
+            // Row of the current record
+            std::size_t Row = End;
+
+        public:
+            /// Making the VaultRecordBitmap class friendly so that it has access to the internal members of the iterator class
+            friend VaultRecordBitmap;
+
+            /// \brief Iterator category
+            typedef std::forward_iterator_tag iterator_category;
+
+            /// \brief Type of the iterated values
+            typedef VaultRecord* value_type;
+
+            /// \brief Type of the difference between iterators
+            typedef std::ptrdiff_t difference_type;
+
+            /// \brief Pointer to the iterated values
+            typedef VaultRecord* const* pointer;
+
+            /// \brief Reference to the iterated values
+            typedef VaultRecord* reference;
+
+            /// \brief Default constructor
+            iterator() noexcept = default;
+
+            /**
+                \brief Constructor
+
+                \param [in] bitmap bitmap with records
+                \param [in] row row of the record
+            */
+            iterator(const VaultRecordBitmap* bitmap, std::size_t row) noexcept : Bitmap(bitmap), Row(row) {}
+
+            /**
+                \brief Dereference operator
+
+                \return pointer to the record
+            */
+            VaultRecord* operator*() const noexcept
+            {
+                return Bitmap->Storage->GetRowRecord(Row);
+            }
+
+            /**
+                \brief Prefix increment operator
+
+                \return reference to this iterator
+            */
+            iterator& operator++() noexcept
+            {
+                Row = Bitmap->FindNextRow(Row + 1);
+                return *this;
+            }
+
+            /**
+                \brief Postfix increment operator
+
+                \return iterator before increment
+            */
+            iterator operator++(int) noexcept
+            {
+                iterator res = *this;
+                ++(*this);
+                return res;
+            }
+
+            /**
+                \brief Comparison operator
+
+                \param [in] other other iterator
+
+                \return true if iterators point to the same record
+            */
+            bool operator==(const iterator& other) const noexcept
+            {
+                return Row == other.Row;
+            }
+
+            /**
+                \brief Comparison operator
+
+                \param [in] other other iterator
+
+                \return true if iterators point to different records
+            */
+            bool operator!=(const iterator& other) const noexcept
+            {
+                return Row != other.Row;
+            }
+        };
+
+        /// \brief Const iterator. Records are not changed through iterators, so it is the same as iterator
+        typedef iterator const_iterator;
+
+        /// \brief Default constructor
+        VaultRecordBitmap() noexcept = default;
+
+        /**
+            \brief Copy constructor
+
+            \param [in] other other bitmap
+        */
+        VaultRecordBitmap(const VaultRecordBitmap& other) noexcept
+        {
+            CopyBlocks(other);
+        }
+
+        /**
+            \brief Move constructor
+
+            \param [in] other other bitmap
+        */
+        VaultRecordBitmap(VaultRecordBitmap&& other) noexcept
+        {
+            *this = std::move(other);
+        }
+
+        /**
+            \brief Assignment operator
+
+            \param [in] other other bitmap
+
+            \return reference to this
+        */
+        VaultRecordBitmap& operator=(const VaultRecordBitmap& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                CopyBlocks(other);
+            }
+
+            return *this;
+        }
+
+        /**
+            \brief Move assignment operator
+
+            \param [in] other other bitmap
+
+            \return reference to this
+        */
+        VaultRecordBitmap& operator=(VaultRecordBitmap&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+
+                Blocks = std::move(other.Blocks);
+                RecordsCount = other.RecordsCount;
+                Storage = other.Storage;
+
+                other.Blocks.clear();
+                other.RecordsCount = 0;
+                other.Storage = nullptr;
+            }
+
+            return *this;
+        }
+
+        /**
+            \brief A method for getting iterator to the first record
+
+            \return iterator to the first record
+        */
+        iterator begin() const noexcept
+        {
+            return iterator(this, FindNextRow(0));
+        }
+
+        /**
+            \brief A method for getting iterator after the last record
+
+            \return end iterator
+        */
+        iterator end() const noexcept
+        {
+            return iterator(this, End);
+        }
+
+        /**
+            \brief A method for getting the number of records
+
+            \return number of records
+        */
+        std::size_t size() const noexcept
+        {
+            return RecordsCount;
+        }
+
+        /**
+            \brief A method for checking whether the set is empty
+
+            \return true if there are no records
+        */
+        bool empty() const noexcept
+        {
+            return RecordsCount == 0;
+        }
+
+        /**
+            \brief A method for finding the record
+
+            A record of other Vault or an erased record whose row is owned by another record is not found.
+
+            \param [in] record record to find
+
+            \return iterator to the record or end iterator
+        */
+        iterator find(const VaultRecord* record) const noexcept
+        {
+            if (record == nullptr || Storage == nullptr || record->Storage != Storage) return end();
+
+            const std::uint64_t* word = GetWord(record->Row / BlockBits, (record->Row % BlockBits) / WordBits);
+            if (word == nullptr || (*word & (std::uint64_t(1) << (record->Row % WordBits))) == 0) return end();
+
+            if (Storage->GetRowRecord(record->Row) != record) return end();
+
+            return iterator(this, record->Row);
+        }
+
+        /**
+            \brief A method for adding the record
+
+            \param [in] record record to add. It must be a valid record of the same Vault as other records in the set
+
+            \return pair with iterator to the record and flag which is true if the record was added
+        */
+        std::pair<iterator, bool> emplace(VaultRecord* record) noexcept
+        {
+            if (Storage == nullptr) Storage = record->Storage;
+
+            bool isAdded = SetRow(record->Row);
+            return std::pair<iterator, bool>(iterator(this, record->Row), isAdded);
+        }
+
+        /**
+            \brief A method for erasing the record
+
+            \param [in] record record to erase
+
+            \return number of erased records
+        */
+        std::size_t erase(const VaultRecord* record) noexcept
+        {
+            if (find(record) == end()) return 0;
+
+            ResetRow(record->Row);
+            return 1;
+        }
+
+        /**
+            \brief A method for erasing the record
+
+            \param [in] it iterator to the record to erase
+
+            \return iterator to the next record
+        */
+        iterator erase(const iterator& it) noexcept
+        {
+            ResetRow(it.Row);
+            return iterator(this, FindNextRow(it.Row + 1));
+        }
+
+        /// \brief A method for erasing all records
+        void clear() noexcept
+        {
+            for (Block* block : Blocks)
+                delete block;
+
+            Blocks.clear();
+            RecordsCount = 0;
+            Storage = nullptr;
+        }
+
+        /**
+            \brief A method for adding all records of other set
+
+            The sets are joined word by word, and func is called only for the records which were not in this set.
+
+            \tparam <F> function type. It takes VaultRecord*
+
+            \param [in] other set of records of the same Vault
+            \param [in] func function called for each added record after adding it
+        */
+        template <class F>
+        void Join(const VaultRecordBitmap& other, const F& func) noexcept
+        {
+            if (other.RecordsCount == 0) return;
+            if (Storage == nullptr) Storage = other.Storage;
+            if (Blocks.size() < other.Blocks.size()) Blocks.resize(other.Blocks.size(), nullptr);
+
+            for (std::size_t blockIndex = 0; blockIndex < other.Blocks.size(); ++blockIndex)
+            {
+                const Block* otherBlock = other.Blocks[blockIndex];
+                if (otherBlock == nullptr) continue;
+
+                if (Blocks[blockIndex] == nullptr) Blocks[blockIndex] = new Block;
+                Block* block = Blocks[blockIndex];
+
+                for (std::size_t wordIndex = 0; wordIndex < BlockWords; ++wordIndex)
+                {
+                    std::uint64_t added = otherBlock->Words[wordIndex] & ~block->Words[wordIndex];
+                    if (added == 0) continue;
+
+                    block->Words[wordIndex] |= added;
+
+                    std::size_t addedCount = BitsCount(added);
+                    block->Count += addedCount;
+                    RecordsCount += addedCount;
+
+                    for (; added != 0; added &= added - 1)
+                        func(Storage->GetRowRecord(blockIndex * BlockBits + wordIndex * WordBits + LowestBit(added)));
+                }
+            }
+        }
+
+        /**
+            \brief A method for adding records which are in both sets
+
+            The sets are intersected word by word.
+
+            \tparam <F> function type. It takes VaultRecord*
+
+            \param [in] a first set of records
+            \param [in] b second set of records of the same Vault
+            \param [in] func function called for each added record after adding it
+        */
+        template <class F>
+        void JoinIntersection(const VaultRecordBitmap& a, const VaultRecordBitmap& b, const F& func) noexcept
+        {
+            if (a.RecordsCount == 0 || b.RecordsCount == 0) return;
+            if (Storage == nullptr) Storage = a.Storage;
+
+            std::size_t blocksCount = a.Blocks.size() < b.Blocks.size() ? a.Blocks.size() : b.Blocks.size();
+            if (Blocks.size() < blocksCount) Blocks.resize(blocksCount, nullptr);
+
+            for (std::size_t blockIndex = 0; blockIndex < blocksCount; ++blockIndex)
+            {
+                const Block* aBlock = a.Blocks[blockIndex];
+                const Block* bBlock = b.Blocks[blockIndex];
+                if (aBlock == nullptr || bBlock == nullptr) continue;
+
+                for (std::size_t wordIndex = 0; wordIndex < BlockWords; ++wordIndex)
+                {
+                    std::uint64_t common = aBlock->Words[wordIndex] & bBlock->Words[wordIndex];
+                    if (common == 0) continue;
+
+                    if (Blocks[blockIndex] == nullptr) Blocks[blockIndex] = new Block;
+                    Block* block = Blocks[blockIndex];
+
+                    std::uint64_t added = common & ~block->Words[wordIndex];
+                    block->Words[wordIndex] |= added;
+
+                    std::size_t addedCount = BitsCount(added);
+                    block->Count += addedCount;
+                    RecordsCount += addedCount;
+
+                    for (; added != 0; added &= added - 1)
+                        func(Storage->GetRowRecord(blockIndex * BlockBits + wordIndex * WordBits + LowestBit(added)));
+                }
+            }
+        }
+
+        /**
+            \brief A method for visiting records of this set which are or are not in other set
+
+            The sets are compared word by word. func can erase records from this set.
+
+            \tparam <F> function type. It takes VaultRecord*
+
+            \param [in] other set of records of the same Vault
+            \param [in] isInOther visit records which are in other if true, and records which are not in other if false
+            \param [in] func function called for each visited record
+        */
+        template <class F>
+        void ForEachCompared(const VaultRecordBitmap& other, const bool& isInOther, const F& func) noexcept
+        {
+            for (std::size_t blockIndex = 0; blockIndex < Blocks.size(); ++blockIndex)
+            {
+                for (std::size_t wordIndex = 0; wordIndex < BlockWords; ++wordIndex)
+                {
+                    // Block is taken again for each word because func can delete it
+                    const std::uint64_t* word = GetWord(blockIndex, wordIndex);
+                    if (word == nullptr) break;
+
+                    const std::uint64_t* otherWord = other.GetWord(blockIndex, wordIndex);
+                    std::uint64_t otherBits = otherWord == nullptr ? 0 : *otherWord;
+                    std::uint64_t visited = *word & (isInOther ? otherBits : ~otherBits);
+
+                    for (; visited != 0; visited &= visited - 1)
+                        func(Storage->GetRowRecord(blockIndex * BlockBits + wordIndex * WordBits + LowestBit(visited)));
+                }
+            }
+        }
+
+        /**
+            \brief Comparison operator
+
+            \param [in] other other bitmap
+
+            \return true if sets contain the same records
+        */
+        bool operator==(const VaultRecordBitmap& other) const noexcept
+        {
+            if (RecordsCount != other.RecordsCount) return false;
+            if (RecordsCount == 0) return true;
+            if (Storage != other.Storage) return false;
+
+            std::size_t blocksCount = Blocks.size() > other.Blocks.size() ? Blocks.size() : other.Blocks.size();
+
+            for (std::size_t blockIndex = 0; blockIndex < blocksCount; ++blockIndex)
+            {
+                for (std::size_t wordIndex = 0; wordIndex < BlockWords; ++wordIndex)
+                {
+                    const std::uint64_t* word = GetWord(blockIndex, wordIndex);
+                    const std::uint64_t* otherWord = other.GetWord(blockIndex, wordIndex);
+
+                    if ((word == nullptr ? 0 : *word) != (otherWord == nullptr ? 0 : *otherWord)) return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+            \brief Comparison operator
+
+            \param [in] other other bitmap
+
+            \return true if sets contain different records
+        */
+        bool operator!=(const VaultRecordBitmap& other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+        /// \brief Destructor
+        ~VaultRecordBitmap() noexcept
+        {
+            clear();
+        }
+    };
+}
@@ -8,15 +8,12 @@ namespace mvlt
     {
         DBG_LOG_ENTER();
 
-        vlt->RecursiveReadWriteMtx.ReadLock();
-
+        // Vault is already locked by the caller, so the record can not be released while the reference is added
         if (vaultRecord != nullptr) vaultRecord->AddRef();
         if (VaultRecordPtr != nullptr) VaultRecordPtr->RemoveRef();
 
         VaultRecordPtr = vaultRecord;
         Vlt = vlt;
-
-        vlt->RecursiveReadWriteMtx.ReadUnlock();
     }
 
     VaultRecordRef::VaultRecordRef() noexcept
@@ -154,15 +151,34 @@ namespace mvlt
 
         VaultOperationResult res;
 
-        WriteLock<RecursiveReadWriteMutex> writeLock(Vlt->RecursiveReadWriteMtx);
+        if (VaultRecordPtr == nullptr)
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::DataRecordNotValid;
+            return res;
+        }
+
+        // All params are set at once, so the record is changed only if all of them are correct
+        res = Vlt->SetDataToRecord(VaultRecordPtr, params, false);
+
+        return res;
+    }
+
+    VaultOperationResult VaultRecordRef::SetData(std::vector<std::pair<std::string, VaultParamInput>>&& params) noexcept
+    {
+        DBG_LOG_ENTER();
 
-        // Copy data from function parametrs
-        for (const auto& paramsIt : params)
+        VaultOperationResult res;
+
+        if (VaultRecordPtr == nullptr)
         {
-            res = paramsIt.second.SetDataToRef(paramsIt.first, *this);
-            if (!res.IsOperationSuccess) break;
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::DataRecordNotValid;
+            return res;
         }
 
+        res = Vlt->SetDataToRecord(VaultRecordPtr, params, true);
+
         return res;
     }
 
@@ -252,13 +268,12 @@ namespace mvlt
 
         if (VaultRecordPtr != nullptr)
         {
-            VaultRecordPtr->VaultRecordMutex.lock();
+            // Lock Vault to read, so the record can not be erased while its data is read
+            ReadLock<RecursiveReadWriteMutex> readLock(Vlt->RecursiveReadWriteMtx);
 
             // Check if Vault still accessable
             if (VaultRecordPtr->GetIsValid())
             {
-                Vlt->RecursiveReadWriteMtx.ReadLock();
-
                 std::cout << "Vault record " << VaultRecordPtr << ":" << "\n";
 
                 for (const auto& keyPair : Vlt->VaultHashMapStructure)
@@ -268,12 +283,8 @@ namespace mvlt
 
                     std::cout << "\t" << keyPair.first << " = " << dataSaver.Str() << "\n";
                 }
-
-                Vlt->RecursiveReadWriteMtx.ReadUnlock();
             }
             else std::cout << "VaultRecordRef not valid!" << "\n";
-
-            VaultRecordPtr->VaultRecordMutex.unlock();
         }
         else std::cout << "VaultRecordRef not valid!" << "\n";
     }
@@ -299,13 +310,12 @@ namespace mvlt
 
         if (VaultRecordPtr != nullptr)
         {
-            VaultRecordPtr->VaultRecordMutex.lock();
+            // Lock Vault to read, so the record can not be erased while its data is read
+            ReadLock<RecursiveReadWriteMutex> readLock(Vlt->RecursiveReadWriteMtx);
 
             // Check if Vault still accessable
             if (VaultRecordPtr->GetIsValid())
             {
-                Vlt->RecursiveReadWriteMtx.ReadLock();
-
                 for (const std::string& key : Vlt->KeysOrder)
                 {
                     if (isFormat) res += "\n" + tab;
@@ -321,11 +331,7 @@ namespace mvlt
                     ++keyCounter;
                     if (keyCounter != Vlt->KeysOrder.size()) res += ",";
                 }
-
-                Vlt->RecursiveReadWriteMtx.ReadUnlock();
             }
-
-            VaultRecordPtr->VaultRecordMutex.unlock();
         }
 
         if (isFormat) res += "\n";
@@ -342,13 +348,12 @@ namespace mvlt
 
         if (VaultRecordPtr != nullptr)
         {
-            VaultRecordPtr->VaultRecordMutex.lock();
+            // Lock Vault to read, so the record can not be erased while its data is read
+            ReadLock<RecursiveReadWriteMutex> readLock(Vlt->RecursiveReadWriteMtx);
 
             // Check if Vault still accessable
             if (VaultRecordPtr->GetIsValid())
             {
-                Vlt->RecursiveReadWriteMtx.ReadLock();
-
                 for (const std::string& key : Vlt->KeysOrder)
                 {
                     DataSaver dataSaver;
@@ -356,11 +361,7 @@ namespace mvlt
 
                     res.emplace_back(std::pair<std::string, std::string>(key, dataSaver.Str()));
                 }
-
-                Vlt->RecursiveReadWriteMtx.ReadUnlock();
             }
-
-            VaultRecordPtr->VaultRecordMutex.unlock();
         }
 
         return res;
@@ -42,6 +42,33 @@ namespace mvlt
             \param [in] vlt A pointer to Vault
         */
         VaultRecordRef(VaultRecord* vaultRecord, Vault* vlt) noexcept;
+
+        /**
+            \brief Method for updating data inside Vault
+
+            \tparam <T> Any type of data except for c arrays or reference to it
+
+            \param [in] key the key whose value needs to be changed
+            \param [in] data new key data value. It is moved to the record if it is rvalue
+
+            \return VaultOperationResult object with SetData result.
+        */
+        template <class T>
+        VaultOperationResult SetDataToRecord(const std::string& key, T&& data) noexcept;
+
+        /**
+            \brief Method for updating data inside Vault using KeyHandle
+
+            \tparam <T> Any type of data except for c arrays
+            \tparam <D> T or reference to T
+
+            \param [in] keyHandle handle of the key whose value needs to be changed
+            \param [in] data new key data value. It is moved to the record if it is rvalue
+
+            \return VaultOperationResult object with SetData result.
+        */
+        template <class T, class D>
+        VaultOperationResult SetDataToRecord(const KeyHandle<T>& keyHandle, D&& data) noexcept;
     public:
         /// Making the Vault class friendly so that it has access to the internal members of the VaultRecordRef class
         friend Vault;
@@ -49,6 +76,12 @@ namespace mvlt
         /// Making the VaultRecordSet class friendly so that it has access to the internal members of the VaultRecordRef class
         friend VaultRecordSet;
 
+        /// Making the ShardedVault class friendly so that it has access to the internal members of the VaultRecordRef class
+        friend ShardedVault;
+
+        /// Making the VaultTransaction class friendly so that it has access to the internal members of the VaultRecordRef class
+        friend VaultTransaction;
+
         /// Making the std::hash<VaultRecordRef> struct friendly so that it has access to the internal members of the VaultRecordRef class
         friend std::hash<VaultRecordRef>;
 
@@ -126,6 +159,47 @@ namespace mvlt
         template <class T>
         VaultOperationResult SetData(const std::string& key, const T& data) noexcept;
 
+        /**
+            \brief Method for updating data inside Vault without copying rvalue data
+
+            \tparam <T> Any type of data except for c arrays
+
+            The data is copied to the indexes of the key and then moved to the record
+
+            \param [in] key the key whose value needs to be changed
+            \param [in] data new key data value
+
+            \return VaultOperationResult object with SetData result.
+        */
+        template <class T>
+        VaultOperationResult SetData(const std::string& key, T&& data) noexcept;
+
+        /**
+            \brief Method for updating data inside Vault using KeyHandle
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] keyHandle handle of the key whose value needs to be changed
+            \param [in] data new key data value
+
+            \return VaultOperationResult object with SetData result.
+        */
+        template <class T>
+        VaultOperationResult SetData(const KeyHandle<T>& keyHandle, const T& data) noexcept;
+
+        /**
+            \brief Method for updating data inside Vault using KeyHandle without copying rvalue data
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] keyHandle handle of the key whose value needs to be changed
+            \param [in] data new key data value
+
+            \return VaultOperationResult object with SetData result.
+        */
+        template <class T>
+        VaultOperationResult SetData(const KeyHandle<T>& keyHandle, T&& data) noexcept;
+
         /**
             \brief Method for updating data inside Vault
 
@@ -134,10 +208,22 @@ namespace mvlt
 
             \param [in] params a vector of pairs with data to be put in the Vault
 
-            \return If one of the parameters is incorrect, it returns an error when setting this parameter, and all subsequent parameters will not be set
+            \return If one of the parameters is incorrect, it returns an error when setting this parameter, and none of the parameters will be set
         */
         VaultOperationResult SetData(const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept;
 
+        /**
+            \brief Method for updating data inside Vault with moving data from params
+
+            The same as SetData(const std::vector<std::pair<std::string, VaultParamInput>>& params),
+            but the values inside params are moved to the record
+
+            \param [in] params a vector of pairs with data to be put in the Vault
+
+            \return If one of the parameters is incorrect, it returns an error when setting this parameter, and none of the parameters will be set
+        */
+        VaultOperationResult SetData(std::vector<std::pair<std::string, VaultParamInput>>&& params) noexcept;
+
         /**
             \brief A method for getting data using a key
 
@@ -151,6 +237,19 @@ namespace mvlt
         template <class T>
         VaultOperationResult GetData(const std::string& key, T& data) const noexcept;
 
+        /**
+            \brief A method for getting data using KeyHandle
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] keyHandle handle of the key whose value should be obtained
+            \param [in] data reference to record the received data
+
+            \return VaultOperationResult object with GetData result.
+        */
+        template <class T>
+        VaultOperationResult GetData(const KeyHandle<T>& keyHandle, T& data) const noexcept;
+
         /**
             \brief Method for getting data converted to string from a container using a key
 
@@ -7,16 +7,43 @@
 namespace mvlt 
 {
     template <class T>
-    VaultOperationResult VaultRecordRef::SetData(const std::string& key, const T& data) noexcept
+    VaultOperationResult VaultRecordRef::SetDataToRecord(const std::string& key, T&& data) noexcept
     {
         DBG_LOG_ENTER();
 
-        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
-            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
-            SetData<std::string>(\"Key\", \"Value\") or SetData(\"Key\", std::string(\"Value\"))");
-
         VaultOperationResult res;
         res.Key = key;
+        res.RequestedType = typeid(typename std::decay<T>::type);
+
+        if (VaultRecordPtr == nullptr)
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::DataRecordNotValid;
+            return res;
+        }
+
+        WriteLock<RecursiveReadWriteMutex> Lock(Vlt->RecursiveReadWriteMtx);
+
+        // Check if Vault still accessable
+        if (!VaultRecordPtr->GetIsValid())
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::DataRecordNotValid;
+            return res;
+        }
+
+        res = Vlt->SetDataToRecord(VaultRecordPtr, key, std::forward<T>(data));
+
+        return res;
+    }
+
+    template <class T, class D>
+    VaultOperationResult VaultRecordRef::SetDataToRecord(const KeyHandle<T>& keyHandle, D&& data) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        res.Key = keyHandle.Key;
         res.RequestedType = typeid(T);
 
         if (VaultRecordPtr == nullptr)
@@ -36,11 +63,35 @@ namespace mvlt
             return res;
         }
 
-        res = Vlt->SetDataToRecord(VaultRecordPtr, key, data);
+        res = Vlt->SetDataToRecord(VaultRecordPtr, keyHandle, std::forward<D>(data));
 
         return res;
     }
 
+    template <class T>
+    VaultOperationResult VaultRecordRef::SetData(const std::string& key, const T& data) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
+            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
+            SetData<std::string>(\"Key\", \"Value\") or SetData(\"Key\", std::string(\"Value\"))");
+
+        return SetDataToRecord(key, data);
+    }
+
+    template <class T>
+    VaultOperationResult VaultRecordRef::SetData(const std::string& key, T&& data) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        static_assert(!std::is_array<typename std::remove_reference<T>::type>::value, "It is not possible to use a c array as a key value. \n\
+            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
+            SetData<std::string>(\"Key\", \"Value\") or SetData(\"Key\", std::string(\"Value\"))");
+
+        return SetDataToRecord(key, std::forward<T>(data));
+    }
+
     template <class T>
     VaultOperationResult VaultRecordRef::GetData(const std::string& key, T& data) const noexcept
     {
@@ -95,4 +146,63 @@ namespace mvlt
         res.ResultCode = VaultOperationResultCode::Success;
         return res;
     }
+
+    template <class T>
+    VaultOperationResult VaultRecordRef::SetData(const KeyHandle<T>& keyHandle, const T& data) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        return SetDataToRecord(keyHandle, data);
+    }
+
+    template <class T>
+    VaultOperationResult VaultRecordRef::SetData(const KeyHandle<T>& keyHandle, T&& data) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        return SetDataToRecord(keyHandle, std::move(data));
+    }
+
+    template <class T>
+    VaultOperationResult VaultRecordRef::GetData(const KeyHandle<T>& keyHandle, T& data) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        // Fill res info known at start
+        VaultOperationResult res;
+        res.Key = keyHandle.Key;
+        res.RequestedType = typeid(T);
+
+        if (VaultRecordPtr == nullptr)
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::DataRecordNotValid;
+
+            return res;
+        }
+
+        ReadLock<RecursiveReadWriteMutex> readLock(Vlt->RecursiveReadWriteMtx);
+
+        // Check if Vault still accessable
+        if (!VaultRecordPtr->GetIsValid())
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::DataRecordNotValid;
+            return res;
+        }
+
+        // Check if handle valid
+        if (!Vlt->IsKeyHandleValid(keyHandle))
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongKey;
+            return res;
+        }
+
+        keyHandle.Column->GetDataUnchecked(VaultRecordPtr->Row, data);
+        res.SavedType = res.RequestedType;
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+        return res;
+    }
 }
\ No newline at end of file
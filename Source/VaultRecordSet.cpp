@@ -3,7 +3,7 @@
 
 namespace mvlt
 {
-    std::unordered_set<VaultRecord*>::iterator VaultRecordSet::RemoveRecord(VaultRecord* recordToErase, bool* wasDeleted) noexcept
+    VaultRecordBitmap::iterator VaultRecordSet::RemoveRecord(VaultRecord* recordToErase, bool* wasDeleted) noexcept
     {
         DBG_LOG_ENTER();
 
@@ -68,6 +68,11 @@ namespace mvlt
         RecordsSet = std::move(other.RecordsSet);
         RecordSetsSet = std::move(other.RecordSetsSet);
 
+        // Add records to the key structures created by key copiers
+        for (VaultRecord* record : RecordsSet)
+            for (auto& adder : VaultRecordAdders)
+                adder.second(record);
+
         ParentVault->RecordSetsSet.erase(&other);
         ParentVault->RecordSetsSet.emplace(this);
 
@@ -189,6 +194,9 @@ namespace mvlt
             // Check if vault record ref depends on same vault as this
             if (recordRef.Vlt == ParentVault && recordRef.IsValid())
             {
+                // Record is shared with sets of other readers
+                std::lock_guard<std::mutex> dependentSetsLock(ParentVault->DependentSetsMtx);
+
                 // Add pointer to record from recordRef to this
                 std::pair<decltype(RecordsSet.begin()), bool> emplaceRes = RecordsSet.emplace(recordRef.VaultRecordPtr);
 
@@ -198,7 +206,6 @@ namespace mvlt
                     for (auto& adder : VaultRecordAdders)
                         adder.second(recordRef.VaultRecordPtr);
 
-                    // Lock VaultRecord to thread safety add new dependent VaultRecordSet
                     recordRef.VaultRecordPtr->AddToDependentSets(this);
 
                     res.IsOperationSuccess = true;
@@ -262,9 +269,15 @@ namespace mvlt
 
         if (GetIsParentVaultValid())
         {
+            // Lock Vault to read, records are shared with sets of other readers
+            ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
+
             // Remove this from records
-            for (VaultRecord* record : RecordsSet)
-                record->EraseDependentSet(this);
+            {
+                std::lock_guard<std::mutex> dependentSetsLock(ParentVault->DependentSetsMtx);
+                for (VaultRecord* record : RecordsSet)
+                    record->EraseDependentSet(this);
+            }
 
             // Clear structure
             for (const auto& vaultRecordClearersIt : VaultRecordClearers)
@@ -339,6 +352,22 @@ namespace mvlt
         return res;
     }
 
+    std::vector<VaultRecordRef> VaultRecordSet::GetTopRecords(const std::string& key, const std::size_t& amountOfRecords,
+        const std::function<bool(const VaultRecordRef& ref)>& requestPredicat, const bool& isReverse) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        std::vector<VaultRecordRef> res;
+
+        if (GetIsParentVaultValid())
+        {
+            ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
+            res = Vault::GetTopRecords(key, amountOfRecords, requestPredicat, isReverse);
+        }
+
+        return res;
+    }
+
     std::string VaultRecordSet::ToJson(const bool& isFormat, const std::size_t& tabSize, const bool& isUseRecordTemplate,
         const std::string& recordTemplate, const bool& isArray) const noexcept
     {
@@ -417,16 +446,17 @@ namespace mvlt
         {
             ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
 
-            for (VaultRecord* record : a.RecordsSet)
+            // Records are shared with sets of other readers
+            std::lock_guard<std::mutex> dependentSetsLock(ParentVault->DependentSetsMtx);
+
+            // Sets are joined word by word, and only records which were not in this are visited
+            RecordsSet.Join(a.RecordsSet, [&](VaultRecord* record)
             {
-                if (RecordsSet.find(record) == RecordsSet.end())
-                {
-                    RecordsSet.emplace(record);
+                for (auto& adder : VaultRecordAdders)
+                    adder.second(record);
 
-                    for (auto& adder : VaultRecordAdders)
-                        adder.second(record);
-                }
-            }
+                record->AddToDependentSets(this);
+            });
         }
 
         return res;
@@ -469,14 +499,11 @@ namespace mvlt
         {
             ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
 
-            for (auto recordsSetIt = RecordsSet.begin(); recordsSetIt != RecordsSet.end();)
+            // Delete records which are in a. They are found word by word
+            RecordsSet.ForEachCompared(a.RecordsSet, true, [&](VaultRecord* record)
             {
-                // if found record in a then delete it here
-                if (a.RecordsSet.find(*recordsSetIt) != a.RecordsSet.end())
-                    recordsSetIt = RemoveRecord(*recordsSetIt, nullptr);
-                else
-                    ++recordsSetIt;
-            }
+                RemoveRecord(record, nullptr);
+            });
         }
 
         return res;
@@ -519,14 +546,11 @@ namespace mvlt
         {
             ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
 
-            for (auto recordsSetIt = RecordsSet.begin(); recordsSetIt != RecordsSet.end();)
+            // Delete records which are not in a. They are found word by word
+            RecordsSet.ForEachCompared(a.RecordsSet, false, [&](VaultRecord* record)
             {
-                // if not found record in a then delete it here
-                if (a.RecordsSet.find(*recordsSetIt) == a.RecordsSet.end())
-                    recordsSetIt = RemoveRecord(*recordsSetIt, nullptr);
-                else
-                    ++recordsSetIt;
-            }
+                RemoveRecord(record, nullptr);
+            });
         }
 
         return res;
@@ -659,39 +683,19 @@ namespace mvlt
             // Set unique keys
             res.UniqueKeys = a.UniqueKeys;
 
+            // Records and RecordSetsSet are shared with other readers
+            std::lock_guard<std::mutex> dependentSetsLock(a.ParentVault->DependentSetsMtx);
+
             a.ParentVault->RecordSetsSet.emplace(&res);
 
-            // Pick less set to iterate
-            if (a.RecordsSet.size() < b.RecordsSet.size())
-            {
-                // Iterate over all records in a
-                for (VaultRecord* record : a.RecordsSet)
-                {
-                    // if record in b then add it to the res
-                    if (b.RecordsSet.find(record) != b.RecordsSet.end())
-                    {
-                        res.RecordsSet.emplace(record);
-
-                        for (auto& adder : res.VaultRecordAdders)
-                            adder.second(record);
-                    }
-                }
-            }
-            else
+            // Sets are intersected word by word
+            res.RecordsSet.JoinIntersection(a.RecordsSet, b.RecordsSet, [&](VaultRecord* record)
             {
-                // Iterate over all records in b
-                for (VaultRecord* record : b.RecordsSet)
-                {
-                    // if record in b then add it to the res
-                    if (a.RecordsSet.find(record) != a.RecordsSet.end())
-                    {
-                        res.RecordsSet.emplace(record);
-
-                        for (auto& adder : res.VaultRecordAdders)
-                            adder.second(record);
-                    }
-                }
-            }
+                for (auto& adder : res.VaultRecordAdders)
+                    adder.second(record);
+
+                record->AddToDependentSets(&res);
+            });
 
             a.ParentVault->RecursiveReadWriteMtx.ReadUnlock();
         }
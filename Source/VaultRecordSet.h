@@ -49,7 +49,7 @@ namespace mvlt
 
             \return Returns an iterator to the RecordSet element immediately following the one being deleted. If the element to be deleted is not found, it returns RecordSet->end()
         */
-        std::unordered_set<VaultRecord*>::iterator RemoveRecord(VaultRecord* recordToErase, bool* wasDeleted) noexcept;
+        VaultRecordBitmap::iterator RemoveRecord(VaultRecord* recordToErase, bool* wasDeleted) noexcept;
 
         /**
             \brief An internal method for copying objects
@@ -321,6 +321,141 @@ namespace mvlt
         template <VaultRequestType Type>
         VaultOperationResult Request(const VaultRequest<Type>& request, VaultRecordSet& vaultRecordSet) const;
 
+        /**
+            \brief A method for iterating over the result of the request without saving it
+
+            \param [in] request The request
+            \param [in] func A function takes const VaultRecordRef& as a parameter. To get the next record it must return true,
+            to stop the iteration it must return false. The function must not change the Vault.
+
+            \return VaultOperationResult object with the same result as Request would return
+        */
+        template <VaultRequestType Type>
+        VaultOperationResult Scan(const VaultRequest<Type>& request, const std::function<bool(const VaultRecordRef& ref)>& func) const;
+
+        /**
+            \brief A method for counting records found by the request
+
+            \param [in] request The request
+            \param [out] count number of found records. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the same result as Request would return
+        */
+        template <VaultRequestType Type>
+        VaultOperationResult Count(const VaultRequest<Type>& request, std::size_t& count) const;
+
+        /**
+            \brief A method for getting the minimum key value
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] key the name of the key
+            \param [out] minValue the minimum value. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result. If there are no records the ResultCode is WrongValue
+        */
+        template <class T>
+        VaultOperationResult Min(const std::string& key, T& minValue) const;
+
+        /**
+            \brief A method for getting the minimum key value among records found by the request
+
+            \tparam <T> Any type of data except for c arrays
+            \tparam <Type> Request type
+
+            \param [in] key the name of the key
+            \param [in] request The request
+            \param [out] minValue the minimum value. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result. If no records are found the ResultCode is WrongValue
+        */
+        template <class T, VaultRequestType Type>
+        VaultOperationResult Min(const std::string& key, const VaultRequest<Type>& request, T& minValue) const;
+
+        /**
+            \brief A method for getting the maximum key value
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] key the name of the key
+            \param [out] maxValue the maximum value. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result. If there are no records the ResultCode is WrongValue
+        */
+        template <class T>
+        VaultOperationResult Max(const std::string& key, T& maxValue) const;
+
+        /**
+            \brief A method for getting the maximum key value among records found by the request
+
+            \tparam <T> Any type of data except for c arrays
+            \tparam <Type> Request type
+
+            \param [in] key the name of the key
+            \param [in] request The request
+            \param [out] maxValue the maximum value. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result. If no records are found the ResultCode is WrongValue
+        */
+        template <class T, VaultRequestType Type>
+        VaultOperationResult Max(const std::string& key, const VaultRequest<Type>& request, T& maxValue) const;
+
+        /**
+            \brief A method for summing key values of all records
+
+            \tparam <T> Any type of data except for c arrays. It must support operator+=
+
+            \param [in] key the name of the key
+            \param [out] sum sum of values. It is T() if there are no records. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result
+        */
+        template <class T>
+        VaultOperationResult Sum(const std::string& key, T& sum) const;
+
+        /**
+            \brief A method for summing key values of records found by the request
+
+            \tparam <T> Any type of data except for c arrays. It must support operator+=
+            \tparam <Type> Request type
+
+            \param [in] key the name of the key
+            \param [in] request The request
+            \param [out] sum sum of values. It is T() if no records are found. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result
+        */
+        template <class T, VaultRequestType Type>
+        VaultOperationResult Sum(const std::string& key, const VaultRequest<Type>& request, T& sum) const;
+
+        /**
+            \brief A method for getting the average key value of all records
+
+            \tparam <T> Any type of data except for c arrays. It must support operator+= and conversion to double
+
+            \param [in] key the name of the key
+            \param [out] avg the average value. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result. If there are no records the ResultCode is WrongValue
+        */
+        template <class T>
+        VaultOperationResult Avg(const std::string& key, double& avg) const;
+
+        /**
+            \brief A method for getting the average key value of records found by the request
+
+            \tparam <T> Any type of data except for c arrays. It must support operator+= and conversion to double
+            \tparam <Type> Request type
+
+            \param [in] key the name of the key
+            \param [in] request The request
+            \param [out] avg the average value. It is not changed if the operation fails
+
+            \return VaultOperationResult object with the result. If no records are found the ResultCode is WrongValue
+        */
+        template <class T, VaultRequestType Type>
+        VaultOperationResult Avg(const std::string& key, const VaultRequest<Type>& request, double& avg) const;
+
         /**
             \brief A method for checking for an entry in set
 
@@ -444,6 +579,42 @@ namespace mvlt
         template <class F>
         void SortBy(const std::string& key, F&& func, const bool& isReverse = false, const std::size_t& amountOfRecords = -1) const noexcept;
 
+        /**
+            \brief Method for getting first sorted records that match the predicat
+
+            \param [in] key The key by which the data should be sorted
+            \param [in] amountOfRecords The number of records
+            \param [in] requestPredicat The function which is called for each record in sorted order. The record is added if it returns true
+            \param [in] isReverse Sort in descending order or descending order. By default, ascending
+
+            If the parent Vault is not valid, it will return an empty vector
+            If the key is missing in the vault, the result vector will be empty
+            \return A vector with links to records
+        */
+        std::vector<VaultRecordRef> GetTopRecords(const std::string& key, const std::size_t& amountOfRecords,
+            const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat, const bool& isReverse = false) const noexcept;
+
+        /**
+            \brief Method for getting the next page of sorted records
+
+            The page starts right after the record saved in the cursor and the cursor is moved to the last read record.
+            If the page has less than pageSize records, then it is the last page.
+
+            \tparam <T> Key type
+
+            \param [in] key The key by which the data should be sorted
+            \param [in] cursor The position of the page. Default constructed cursor points to the first page
+            \param [in] pageSize The maximum number of records on the page
+            \param [out] records The vector to store links to records of the page
+            \param [in] isReverse Sort in descending order or descending order. By default, ascending
+            \param [in] requestPredicat The function which is called for each record in sorted order. The record is added if it returns true
+
+            \return VaultOperationResult object with GetSortedPage result
+        */
+        template <class T>
+        VaultOperationResult GetSortedPage(const std::string& key, VaultPageCursor<T>& cursor, const std::size_t& pageSize, std::vector<VaultRecordRef>& records,
+            const bool& isReverse = false, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat = DefaultRequestPredicat) const noexcept;
+
         /**
             \brief Method for saving the contents of the VaultRecordSet in json
 
@@ -45,8 +45,11 @@ namespace mvlt
                 }
                 else vaultRecordSet.Clear();
 
-                // Save vaultRecordSet
-                ParentVault->RecordSetsSet.emplace(&vaultRecordSet);
+                // Save vaultRecordSet. Other readers can save their sets at the same time
+                {
+                    std::lock_guard<std::mutex> lock(ParentVault->DependentSetsMtx);
+                    ParentVault->RecordSetsSet.emplace(&vaultRecordSet);
+                }
 
                 res = Vault::RequestRecords(requestType, key, beginKeyValue, endKeyValue, vaultRecordSet, isIncludeBeginKeyValue, isIncludeEndKeyValue, amountOfRecords, requestPredicat);
                 vaultRecordSet.ParentVault = ParentVault;
@@ -233,8 +236,11 @@ namespace mvlt
                 }
                 else vaultRecordSet.Clear();
 
-                // Save vaultRecordSet
-                ParentVault->RecordSetsSet.emplace(&vaultRecordSet);
+                // Save vaultRecordSet. Other readers can save their sets at the same time
+                {
+                    std::lock_guard<std::mutex> lock(ParentVault->DependentSetsMtx);
+                    ParentVault->RecordSetsSet.emplace(&vaultRecordSet);
+                }
 
                 res = Vault::Request(std::move(request), vaultRecordSet);
                 vaultRecordSet.ParentVault = ParentVault;
@@ -249,6 +255,232 @@ namespace mvlt
         return res;
     }
 
+    template <VaultRequestType Type>
+    VaultOperationResult VaultRecordSet::Scan(const VaultRequest<Type>& request, const std::function<bool(const VaultRecordRef& ref)>& func) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+
+        if (GetIsParentVaultValid())
+        {
+            ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
+            res = Vault::Scan(request, func);
+        }
+        else
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::ParentVaultNotValid;
+        }
+
+        return res;
+    }
+
+    template <VaultRequestType Type>
+    VaultOperationResult VaultRecordSet::Count(const VaultRequest<Type>& request, std::size_t& count) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+
+        if (GetIsParentVaultValid())
+        {
+            ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
+            res = Vault::Count(request, count);
+        }
+        else
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::ParentVaultNotValid;
+        }
+
+        return res;
+    }
+
+    template <class T>
+    VaultOperationResult VaultRecordSet::Min(const std::string& key, T& minValue) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+
+        if (GetIsParentVaultValid())
+        {
+            ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
+            res = Vault::Min(key, minValue);
+        }
+        else
+        {
+            res.Key = key;
+            res.RequestedType = typeid(T);
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::ParentVaultNotValid;
+        }
+
+        return res;
+    }
+
+    template <class T, VaultRequestType Type>
+    VaultOperationResult VaultRecordSet::Min(const std::string& key, const VaultRequest<Type>& request, T& minValue) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+
+        if (GetIsParentVaultValid())
+        {
+            ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
+            res = Vault::Min(key, request, minValue);
+        }
+        else
+        {
+            res.Key = key;
+            res.RequestedType = typeid(T);
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::ParentVaultNotValid;
+        }
+
+        return res;
+    }
+
+    template <class T>
+    VaultOperationResult VaultRecordSet::Max(const std::string& key, T& maxValue) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+
+        if (GetIsParentVaultValid())
+        {
+            ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
+            res = Vault::Max(key, maxValue);
+        }
+        else
+        {
+            res.Key = key;
+            res.RequestedType = typeid(T);
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::ParentVaultNotValid;
+        }
+
+        return res;
+    }
+
+    template <class T, VaultRequestType Type>
+    VaultOperationResult VaultRecordSet::Max(const std::string& key, const VaultRequest<Type>& request, T& maxValue) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+
+        if (GetIsParentVaultValid())
+        {
+            ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
+            res = Vault::Max(key, request, maxValue);
+        }
+        else
+        {
+            res.Key = key;
+            res.RequestedType = typeid(T);
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::ParentVaultNotValid;
+        }
+
+        return res;
+    }
+
+    template <class T>
+    VaultOperationResult VaultRecordSet::Sum(const std::string& key, T& sum) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+
+        if (GetIsParentVaultValid())
+        {
+            ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
+            res = Vault::Sum(key, sum);
+        }
+        else
+        {
+            res.Key = key;
+            res.RequestedType = typeid(T);
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::ParentVaultNotValid;
+        }
+
+        return res;
+    }
+
+    template <class T, VaultRequestType Type>
+    VaultOperationResult VaultRecordSet::Sum(const std::string& key, const VaultRequest<Type>& request, T& sum) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+
+        if (GetIsParentVaultValid())
+        {
+            ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
+            res = Vault::Sum(key, request, sum);
+        }
+        else
+        {
+            res.Key = key;
+            res.RequestedType = typeid(T);
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::ParentVaultNotValid;
+        }
+
+        return res;
+    }
+
+    template <class T>
+    VaultOperationResult VaultRecordSet::Avg(const std::string& key, double& avg) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+
+        if (GetIsParentVaultValid())
+        {
+            ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
+            res = Vault::Avg<T>(key, avg);
+        }
+        else
+        {
+            res.Key = key;
+            res.RequestedType = typeid(T);
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::ParentVaultNotValid;
+        }
+
+        return res;
+    }
+
+    template <class T, VaultRequestType Type>
+    VaultOperationResult VaultRecordSet::Avg(const std::string& key, const VaultRequest<Type>& request, double& avg) const
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+
+        if (GetIsParentVaultValid())
+        {
+            ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
+            res = Vault::Avg<T>(key, request, avg);
+        }
+        else
+        {
+            res.Key = key;
+            res.RequestedType = typeid(T);
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::ParentVaultNotValid;
+        }
+
+        return res;
+    }
+
     template <class T>
     VaultOperationResult VaultRecordSet::RemoveRecord(const std::string& key, const T& keyValue) noexcept
     {
@@ -314,4 +546,28 @@ namespace mvlt
             Vault::SortBy(key, func, isReverse, amountOfRecords);
         }
     }
+
+    template <class T>
+    VaultOperationResult VaultRecordSet::GetSortedPage(const std::string& key, VaultPageCursor<T>& cursor, const std::size_t& pageSize, std::vector<VaultRecordRef>& records,
+        const bool& isReverse, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+
+        if (GetIsParentVaultValid())
+        {
+            ReadLock<RecursiveReadWriteMutex> readLock(ParentVault->RecursiveReadWriteMtx);
+            res = Vault::GetSortedPage(key, cursor, pageSize, records, isReverse, requestPredicat);
+        }
+        else
+        {
+            res.Key = key;
+            res.RequestedType = typeid(T);
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::ParentVaultNotValid;
+        }
+
+        return res;
+    }
 }
\ No newline at end of file
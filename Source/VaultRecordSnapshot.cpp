@@ -0,0 +1,21 @@
+#include "VaultRecordSnapshot.h"
+#include "VaultRecord.h"
+
+namespace mvlt
+{
+    VaultRecordSnapshot::VaultRecordSnapshot(const std::shared_ptr<const std::unordered_map<std::string, std::size_t>>& keysPositions, const VaultRecord* record) noexcept :
+        KeysPositions(keysPositions), Values(keysPositions->size())
+    {
+        DBG_LOG_ENTER();
+
+        for (const auto& keyPosition : *KeysPositions)
+            record->GetDataSaver(keyPosition.first, Values[keyPosition.second]);
+    }
+
+    bool VaultRecordSnapshot::IsKeyExist(const std::string& key) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        return KeysPositions->find(key) != KeysPositions->end();
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "DataSaver.h"
+#include "VaultClasses.h"
+#include "VaultOperationResult.h"
+
+namespace mvlt
+{
+    /**
+        \brief A class for storing an immutable copy of the record data
+
+        It is used by the lock-free reads of Vault. The snapshot is never changed after creation,
+        so it is read without locks. When the record is changed, a new snapshot replaces the old one.
+    */
+    class VaultRecordSnapshot
+    {
+    private:
+        // Positions of keys values inside Values. It is shared by all snapshots of one Vault
+        std::shared_ptr<const std::unordered_map<std::string, std::size_t>> KeysPositions;
+
+        // Values of all keys of the record
+        std::vector<DataSaver> Values;
+
+    public:
+        /**
+            \brief Constructor
+
+            \param [in] keysPositions positions of keys values
+            \param [in] record record to copy data from
+        */
+        VaultRecordSnapshot(const std::shared_ptr<const std::unordered_map<std::string, std::size_t>>& keysPositions, const VaultRecord* record) noexcept;
+
+        /// \brief Deleted copy constructor
+        VaultRecordSnapshot(const VaultRecordSnapshot& other) noexcept = delete;
+
+        /// \brief Deleted assignment operator
+        VaultRecordSnapshot& operator=(const VaultRecordSnapshot& other) noexcept = delete;
+
+        /**
+            \brief The method for checking the existence of the key
+
+            \param [in] key the name of the key to search for
+
+            \return returns true if the key was found otherwise returns false
+        */
+        bool IsKeyExist(const std::string& key) const noexcept;
+
+        /**
+            \brief A method for getting data from the snapshot
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] key the key whose data needs to be received
+            \param [out] data the variable where the data will be written
+
+            \return VaultOperationResult object with GetData result
+        */
+        template <class T>
+        VaultOperationResult GetData(const std::string& key, T& data) const noexcept;
+    };
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "VaultRecordSnapshot.h"
+
+// This file contains an implementation of the VaultRecordSnapshot template methods
+namespace mvlt
+{
+    template <class T>
+    VaultOperationResult VaultRecordSnapshot::GetData(const std::string& key, T& data) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        static_assert(!std::is_array<T>::value, "It is not possible to use a c array as a key value. \n\
+            If you want to use a string as a key, you must specialize the function with a string. Like this: \n\
+            GetData<std::string>(\"Key\", \"Value\") or GetData(\"Key\", std::string(\"Value\"))");
+
+        VaultOperationResult res;
+        res.Key = key;
+        res.RequestedType = typeid(T);
+
+        auto keyPositionIt = KeysPositions->find(key);
+        if (keyPositionIt == KeysPositions->end())
+        {
+            res.IsOperationSuccess = false;
+            res.ResultCode = VaultOperationResultCode::WrongKey;
+            return res;
+        }
+
+        const DataSaver& value = Values[keyPositionIt->second];
+        res.SavedType = value.GetDataType();
+
+        if (res.SavedType != res.RequestedType)
+        {
+            res.IsOperationSuccess = false;
+            res.SetOpResult(VaultOperationResultCode::WrongType);
+            return res;
+        }
+
+        value.GetData(data);
+
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        return res;
+    }
+}
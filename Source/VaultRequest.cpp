@@ -6,4 +6,25 @@ namespace mvlt
 {
     // Set value to DefaultRequestPredicat global variable
     std::function<bool(const VaultRecordRef& ref)> DefaultRequestPredicat = [](const VaultRecordRef&){return true;};
+
+    bool VaultRequestCondition::IsMatch(const CompositeKeyPart& keyValue) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        switch (RequestType)
+        {
+        case VaultRequestType::Greater:
+            return Value < keyValue;
+        case VaultRequestType::GreaterOrEqual:
+            return !(keyValue < Value);
+        case VaultRequestType::Equal:
+            return keyValue == Value;
+        case VaultRequestType::LessOrEqual:
+            return !(Value < keyValue);
+        case VaultRequestType::Less:
+            return keyValue < Value;
+        default:
+            return false;
+        }
+    }
 }
\ No newline at end of file
@@ -1,11 +1,38 @@
 #pragma once
 
+#include <vector>
 #include <functional>
 
 #include "VaultClasses.h"
+#include "CompositeKey.h"
 
 namespace mvlt
 {
+    /// \brief A structure for storing the condition of the simple request. It is used to find composite index for the And request
+    struct VaultRequestCondition
+    {
+        /// Requested key
+        std::string Key;
+
+        /// Request type
+        VaultRequestType RequestType = VaultRequestType::Equal;
+
+        /// Requested key value
+        CompositeKeyPart Value;
+
+        /// Pointer to request predicat. It is nullptr if the request has no predicat
+        const std::function<bool(const VaultRecordRef& ref)>* RequestPredicat = nullptr;
+
+        /**
+            \brief A method for checking that the key value matches the condition
+
+            \param [in] keyValue key value of the record
+
+            \return Returns true if the key value matches the condition
+        */
+        bool IsMatch(const CompositeKeyPart& keyValue) const noexcept;
+    };
+
     /**
         \brief A class for requests to Vault
 
@@ -19,10 +46,16 @@ namespace mvlt
         VaultRequestType RequestType = Type;
 
         /// Function for requesting data
-        void (*DataRequestFunc)(const std::string&, Vault*, std::unordered_set<VaultRecord*>&, void*, void*, bool, bool, const std::function<bool(const VaultRecordRef& ref)>&);
+        void (*DataRequestFunc)(const std::string&, Vault*, VaultRecordBitmap&, void*, void*, bool, bool, const std::function<bool(const VaultRecordRef& ref)>&);
+
+        /// Function for finding data without saving it
+        bool (*DataScanFunc)(const std::string&, Vault*, void*, void*, bool, bool, const std::function<bool(const VaultRecordRef& ref)>&, const std::function<bool(VaultRecord* record)>&) = nullptr;
 
-        /// A variable for storing a logical request function
-        std::function<void(Vault* vlt, std::unordered_set<VaultRecord*>& setWithRecords)> LogicalRequestFunction;
+        /// A variable for storing a logical request function of the Or request
+        std::function<void(Vault* vlt, VaultRecordBitmap& setWithRecords)> LogicalRequestFunction;
+
+        /// A variable for storing a function that finds records of the logical request without saving them
+        std::function<bool(Vault* vlt, const std::function<bool(VaultRecord* record)>& func)> LogicalScanFunction;
 
         /// A pointer to a function that delete data
         void (*DeleteFunc)(void*) = nullptr;
@@ -36,6 +69,42 @@ namespace mvlt
         /// Variable to store predicat function
         std::function<bool(const VaultRecordRef& ref)> RequestPredicat;
 
+        /// Function for copying saved data to CompositeKeyPart
+        void (*GetKeyPartFunc)(const void*, CompositeKeyPart&) = nullptr;
+
+        /// A variable for storing a function that collects conditions of the logical request
+        std::function<bool(std::vector<VaultRequestCondition>& conditions)> GetConditionsFunction;
+
+        /// Function for checking requested key and type. It throws VaultOperationResult if they are wrong
+        void (*CheckFunc)(const std::string&, Vault*) = nullptr;
+
+        /// Function for estimating the number of found records
+        std::size_t (*EstimateFunc)(const std::string&, Vault*, void*) = nullptr;
+
+        /// Function for counting found records using key structures
+        std::size_t (*CountFunc)(const std::string&, Vault*, void*) = nullptr;
+
+        /// Function for checking that the record is found by the request
+        bool (*MatchFunc)(const std::string&, Vault*, VaultRecord*, void*, const std::function<bool(const VaultRecordRef& ref)>*) = nullptr;
+
+        /// A variable for storing a function that checks keys and types of the logical request
+        std::function<void(Vault* vlt)> CheckFunction;
+
+        /// A variable for storing a function that estimates the number of records found by the logical request
+        std::function<std::size_t(Vault* vlt)> EstimateFunction;
+
+        /// A variable for storing a function that checks that the record is found by the logical request
+        std::function<bool(Vault* vlt, VaultRecord* record)> MatchFunction;
+
+        /**
+            \brief Function for collecting conditions of all simple requests inside the request
+
+            \param [out] conditions vector to add conditions to
+
+            \return Returns false if the request contains Or request, otherwise returns true
+        */
+        bool GetConditions(std::vector<VaultRequestCondition>& conditions) const;
+
     public:
         /// Making the all VaultRequest templates friendly
         template <VaultRequestType TType>
@@ -100,9 +169,68 @@ namespace mvlt
             \brief Function for requesting data from Vault
 
             \param [in] vlt A pointer to the Vault from which to request data
-            \param [in] vaultRecords A reference to the std::unordered_set<VaultRecord*> where the recordings will be saved
+            \param [in] vaultRecords A reference to the bitmap where the records will be saved
+        */
+        void Request(Vault* vlt, VaultRecordBitmap& vaultRecords) const;
+
+        /**
+            \brief Function for finding records without saving them
+
+            Simple requests read records directly from the key structures. The And request reads records of the more selective
+            request and checks the other request for each of them. The Or request reads records of the first request and then
+            records of the second request which are not found by the first request, so every record is found only once.
+
+            \param [in] vlt A pointer to the Vault from which to request data
+            \param [in] func function which is called for each found record. The search stops when it returns false
+
+            \return Returns false if func stopped the search, otherwise returns true
+        */
+        bool Scan(Vault* vlt, const std::function<bool(VaultRecord* record)>& func) const;
+
+        /**
+            \brief Function for counting records found by the request
+
+            Simple requests without predicat are counted by key structures without reading records,
+            other requests count records found by Scan.
+
+            \param [in] vlt A pointer to the Vault from which to request data
+
+            \return the number of found records
+        */
+        std::size_t Count(Vault* vlt) const;
+
+        /**
+            \brief Function for estimating the number of records found by the request
+
+            Simple requests count records using key structures without predicats. The And request takes the smaller estimate
+            of its requests, and the Or request takes the sum of them.
+
+            \param [in] vlt A pointer to the Vault from which to request data
+
+            \return the estimated number of found records
+        */
+        std::size_t Estimate(Vault* vlt) const;
+
+        /**
+            \brief Function for checking keys and types of all simple requests inside the request
+
+            It throws VaultOperationResult with the same error as the request would return.
+
+            \param [in] vlt A pointer to the Vault from which to request data
+        */
+        void Check(Vault* vlt) const;
+
+        /**
+            \brief Function for checking that the record is found by the request
+
+            It reads key values of the record, so it is cheaper than the request if there are few records to check.
+
+            \param [in] vlt A pointer to the Vault from which to request data
+            \param [in] record the record to check
+
+            \return Returns true if the record is found by the request
         */
-        void Request(Vault* vlt, std::unordered_set<VaultRecord*>& vaultRecords) const;
+        bool IsMatch(Vault* vlt, VaultRecord* record) const;
 
         /// \brief Default destructor
         ~VaultRequest() noexcept;
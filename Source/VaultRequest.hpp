@@ -21,7 +21,7 @@ namespace mvlt
         DataPtr = static_cast<void*>(new T(keyValue));
 
         // Set Request func
-        DataRequestFunc = [](const std::string& key, Vault* vlt, std::unordered_set<VaultRecord*>& vaultRecordSet, void* beginValue, void* endValue,
+        DataRequestFunc = [](const std::string& key, Vault* vlt, VaultRecordBitmap& vaultRecordSet, void* beginValue, void* endValue,
             bool isIncludeBeginKeyValue, bool isIncludeEndKeyValue, const std::function<bool(const VaultRecordRef& ref)>& requestPredicat)
         {
             VaultOperationResult res;
@@ -35,10 +35,62 @@ namespace mvlt
             if (!res.IsOperationSuccess) throw VaultOperationResult(res);
         };
 
+        // Set Scan func
+        DataScanFunc = [](const std::string& key, Vault* vlt, void* beginValue, void* endValue, bool isIncludeBeginKeyValue, bool isIncludeEndKeyValue,
+            const std::function<bool(const VaultRecordRef& ref)>& requestPredicat, const std::function<bool(VaultRecord* record)>& func)
+        {
+            bool isContinue = true;
+            auto scanFunc = [&](VaultRecord* record)
+            {
+                isContinue = func(record);
+                return isContinue;
+            };
+
+            VaultOperationResult res;
+            // Simple data scan of vlt
+            if (endValue == nullptr)
+                res = vlt->ScanRecords(Type, key, *static_cast<T*>(beginValue), *static_cast<T*>(beginValue), false, false, requestPredicat, scanFunc);
+            else
+                res = vlt->ScanRecords(VaultRequestType::Interval, key, *static_cast<T*>(beginValue), *static_cast<T*>(endValue), isIncludeBeginKeyValue, isIncludeEndKeyValue, requestPredicat, scanFunc);
+
+            // Throw error
+            if (!res.IsOperationSuccess) throw VaultOperationResult(res);
+
+            return isContinue;
+        };
+
         DeleteFunc = [](void* ptrToDelete)
         {
             delete static_cast<T*>(ptrToDelete);
         };
+
+        GetKeyPartFunc = [](const void* data, CompositeKeyPart& part)
+        {
+            part.SetData(*static_cast<const T*>(data));
+        };
+
+        CheckFunc = [](const std::string& key, Vault* vlt)
+        {
+            VaultOperationResult res = vlt->CheckRequestKey(key, typeid(T));
+
+            // Throw error
+            if (!res.IsOperationSuccess) throw VaultOperationResult(res);
+        };
+
+        EstimateFunc = [](const std::string& key, Vault* vlt, void* value)
+        {
+            return vlt->EstimateRecords(Type, key, *static_cast<T*>(value));
+        };
+
+        CountFunc = [](const std::string& key, Vault* vlt, void* value)
+        {
+            return vlt->CountRecords(Type, key, *static_cast<T*>(value));
+        };
+
+        MatchFunc = [](const std::string& key, Vault* vlt, VaultRecord* record, void* value, const std::function<bool(const VaultRecordRef& ref)>* requestPredicat)
+        {
+            return vlt->IsRecordMatch(record, Type, key, *static_cast<T*>(value), requestPredicat);
+        };
     }
 
     template <VaultRequestType Type>
@@ -51,33 +103,102 @@ namespace mvlt
         switch (Type)
         {
         case VaultRequestType::Or:
+            CheckFunction = [&](Vault* vlt)
+            {
+                request1.Check(vlt);
+                request2.Check(vlt);
+            };
+
+            // Records of both requests are found
+            EstimateFunction = [&](Vault* vlt)
+            {
+                return request1.Estimate(vlt) + request2.Estimate(vlt);
+            };
+
+            MatchFunction = [&](Vault* vlt, VaultRecord* record)
+            {
+                return request1.IsMatch(vlt, record) || request2.IsMatch(vlt, record);
+            };
+
             // Set complex request func
-            LogicalRequestFunction = [&](Vault* vlt, std::unordered_set<VaultRecord*>& vaultRecordSet)
+            LogicalRequestFunction = [&](Vault* vlt, VaultRecordBitmap& vaultRecordSet)
             {
-                std::unordered_set<VaultRecord*> req1Result, req2Result;
+                // Make requests in Or(req1, req2). Both requests set bits of their records in the same bitmap,
+                // so the union is made without temporary sets
+                request1.Request(vlt, vaultRecordSet);
+                request2.Request(vlt, vaultRecordSet);
+            };
 
-                // Make requests in Or(req1, req2)
-                request1.Request(vlt, req1Result);
-                request2.Request(vlt, req2Result);
+            // Set complex scan func
+            LogicalScanFunction = [&](Vault* vlt, const std::function<bool(VaultRecord* record)>& func)
+            {
+                // Report wrong keys and types before any record is found
+                request1.Check(vlt);
+                request2.Check(vlt);
 
-                // Union requests
-                for (VaultRecord* record : req1Result)
-                    vaultRecordSet.emplace(record);
-                for (VaultRecord* record : req2Result)
-                    vaultRecordSet.emplace(record);
+                if (!request1.Scan(vlt, func)) return false;
+
+                // Skip records which are already found by the first request
+                return request2.Scan(vlt, [&](VaultRecord* record)
+                    {
+                        return request1.IsMatch(vlt, record) || func(record);
+                    });
             };
             break;
         
         case VaultRequestType::And:
-            // Set complex request func
-            LogicalRequestFunction = [&](Vault* vlt, std::unordered_set<VaultRecord*>& vaultRecordSet)
+            // Set function to collect conditions of both requests
+            GetConditionsFunction = [&](std::vector<VaultRequestCondition>& conditions)
+            {
+                return request1.GetConditions(conditions) && request2.GetConditions(conditions);
+            };
+
+            CheckFunction = [&](Vault* vlt)
+            {
+                request1.Check(vlt);
+                request2.Check(vlt);
+            };
+
+            // Only records of the more selective request may be found
+            EstimateFunction = [&](Vault* vlt)
+            {
+                std::size_t estimate1 = request1.Estimate(vlt);
+                std::size_t estimate2 = request2.Estimate(vlt);
+                return estimate1 < estimate2 ? estimate1 : estimate2;
+            };
+
+            MatchFunction = [&](Vault* vlt, VaultRecord* record)
+            {
+                return request1.IsMatch(vlt, record) && request2.IsMatch(vlt, record);
+            };
+
+            // Set complex scan func
+            LogicalScanFunction = [&](Vault* vlt, const std::function<bool(VaultRecord* record)>& func)
             {
+                // Try to find records using composite index
+                if (!vlt->CompositeIndexes.empty())
+                {
+                    std::vector<VaultRequestCondition> conditions;
+                    bool isContinue = true;
+                    if (request1.GetConditions(conditions) && request2.GetConditions(conditions) &&
+                        vlt->RequestByCompositeIndex(conditions, [&](VaultRecord* record)
+                            {
+                                isContinue = func(record);
+                                return isContinue;
+                            }))
+                        return isContinue;
+                }
+
+                // Report wrong keys and types before any request is made
+                request1.Check(vlt);
+                request2.Check(vlt);
+
                 // Handle interval situation
                 if (request1.Key == request2.Key && 
                     (request1.RequestType == VaultRequestType::Greater || request1.RequestType == VaultRequestType::GreaterOrEqual) &&
-                    (request2.RequestType == VaultRequestType::Less || request1.RequestType == VaultRequestType::LessOrEqual))
+                    (request2.RequestType == VaultRequestType::Less || request2.RequestType == VaultRequestType::LessOrEqual))
                 {
-                    request1.DataRequestFunc(request1.Key, vlt, vaultRecordSet, request1.DataPtr, request2.DataPtr, 
+                    return request1.DataScanFunc(request1.Key, vlt, request1.DataPtr, request2.DataPtr, 
                         (request1.RequestType == VaultRequestType::GreaterOrEqual),
                         (request2.RequestType == VaultRequestType::LessOrEqual), [&](const VaultRecordRef& ref) 
                             {
@@ -85,24 +206,25 @@ namespace mvlt
                                     return true;
                                 else
                                     return false;
-                            });
+                            }, func);
                 }
                 else // Standart and request
                 {
-                    std::unordered_set<VaultRecord*> req1Result, req2Result;
-
-                    // Make requests in And(req1, req2)
-                    request1.Request(vlt, req1Result);
-                    request2.Request(vlt, req2Result);
-
-                    // Set less request to iterate
-                    if (req1Result.size() > req2Result.size())
-                        std::swap(req1Result, req2Result);
-
-                    // Find intersection
-                    for (VaultRecord* record : req1Result)
-                        if (req2Result.find(record) != req2Result.end())
-                            vaultRecordSet.emplace(record);
+                    // Find records of the more selective request and check the other request on them
+                    if (request1.Estimate(vlt) <= request2.Estimate(vlt))
+                    {
+                        return request1.Scan(vlt, [&](VaultRecord* record)
+                            {
+                                return !request2.IsMatch(vlt, record) || func(record);
+                            });
+                    }
+                    else
+                    {
+                        return request2.Scan(vlt, [&](VaultRecord* record)
+                            {
+                                return !request1.IsMatch(vlt, record) || func(record);
+                            });
+                    }
                 }
             };
             break;
@@ -110,7 +232,7 @@ namespace mvlt
     }
 
     template <VaultRequestType Type>
-    void VaultRequest<Type>::Request(Vault* vlt, std::unordered_set<VaultRecord*>& vaultRecords) const
+    void VaultRequest<Type>::Request(Vault* vlt, VaultRecordBitmap& vaultRecords) const
     {
         DBG_LOG_ENTER();
 
@@ -124,9 +246,143 @@ namespace mvlt
             DataRequestFunc(Key, vlt, vaultRecords, DataPtr, nullptr, false, false, RequestPredicat);
             break;
         case VaultRequestType::Or:
-        case VaultRequestType::And:
             LogicalRequestFunction(vlt, vaultRecords);
             break;
+        case VaultRequestType::And:
+            LogicalScanFunction(vlt, [&](VaultRecord* record)
+                {
+                    vaultRecords.emplace(record);
+                    return true;
+                });
+            break;
+        }
+    }
+
+    template <VaultRequestType Type>
+    bool VaultRequest<Type>::Scan(Vault* vlt, const std::function<bool(VaultRecord* record)>& func) const
+    {
+        DBG_LOG_ENTER();
+
+        switch (Type) 
+        {
+        case VaultRequestType::Or:
+        case VaultRequestType::And:
+            return LogicalScanFunction(vlt, func);
+        default:
+            return DataScanFunc(Key, vlt, DataPtr, nullptr, false, false, RequestPredicat, func);
+        }
+    }
+
+    template <VaultRequestType Type>
+    bool VaultRequest<Type>::GetConditions(std::vector<VaultRequestCondition>& conditions) const
+    {
+        DBG_LOG_ENTER();
+
+        switch (Type)
+        {
+        case VaultRequestType::Less:
+        case VaultRequestType::LessOrEqual:
+        case VaultRequestType::Equal:
+        case VaultRequestType::GreaterOrEqual:
+        case VaultRequestType::Greater:
+        {
+            if (DataPtr == nullptr) return false;
+
+            VaultRequestCondition condition;
+            condition.Key = Key;
+            condition.RequestType = Type;
+            GetKeyPartFunc(DataPtr, condition.Value);
+
+            // The default predicat accepts all records, so there is no need to call it
+            if (RequestPredicat.target_type() != DefaultRequestPredicat.target_type())
+                condition.RequestPredicat = &RequestPredicat;
+
+            conditions.emplace_back(condition);
+            return true;
+        }
+        case VaultRequestType::And:
+            return GetConditionsFunction(conditions);
+        default:
+            return false;
+        }
+    }
+
+    template <VaultRequestType Type>
+    void VaultRequest<Type>::Check(Vault* vlt) const
+    {
+        DBG_LOG_ENTER();
+
+        switch (Type)
+        {
+        case VaultRequestType::Or:
+        case VaultRequestType::And:
+            CheckFunction(vlt);
+            break;
+        default:
+            CheckFunc(Key, vlt);
+            break;
+        }
+    }
+
+    template <VaultRequestType Type>
+    std::size_t VaultRequest<Type>::Count(Vault* vlt) const
+    {
+        DBG_LOG_ENTER();
+
+        switch (Type)
+        {
+        case VaultRequestType::Or:
+        case VaultRequestType::And:
+            break;
+        default:
+            // The default predicat accepts all records, so the key structures know the result
+            if (RequestPredicat.target_type() == DefaultRequestPredicat.target_type())
+            {
+                CheckFunc(Key, vlt);
+                return CountFunc(Key, vlt, DataPtr);
+            }
+            break;
+        }
+
+        std::size_t counter = 0;
+        Scan(vlt, [&](VaultRecord*)
+            {
+                ++counter;
+                return true;
+            });
+
+        return counter;
+    }
+
+    template <VaultRequestType Type>
+    std::size_t VaultRequest<Type>::Estimate(Vault* vlt) const
+    {
+        DBG_LOG_ENTER();
+
+        switch (Type)
+        {
+        case VaultRequestType::Or:
+        case VaultRequestType::And:
+            return EstimateFunction(vlt);
+        default:
+            return EstimateFunc(Key, vlt, DataPtr);
+        }
+    }
+
+    template <VaultRequestType Type>
+    bool VaultRequest<Type>::IsMatch(Vault* vlt, VaultRecord* record) const
+    {
+        DBG_LOG_ENTER();
+
+        switch (Type)
+        {
+        case VaultRequestType::Or:
+        case VaultRequestType::And:
+            return MatchFunction(vlt, record);
+        default:
+            // The default predicat accepts all records, so there is no need to call it
+            return MatchFunc(Key, vlt, record, DataPtr,
+                RequestPredicat.target_type() == DefaultRequestPredicat.target_type() ? nullptr : &RequestPredicat);
         }
     }
 
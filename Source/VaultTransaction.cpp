@@ -0,0 +1,216 @@
+#include <algorithm>
+
+#include "VaultTransaction.h"
+
+#include "VaultTransaction.hpp"
+
+namespace mvlt
+{
+    VaultTransaction::VaultTransaction(Vault* vlt) noexcept : Vlt(vlt) {}
+
+    bool VaultTransaction::CheckRecord(const VaultRecordRef& recordRef, VaultOperationResult& vaultOperationResult) const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        if (recordRef.Vlt != Vlt)
+        {
+            vaultOperationResult.IsOperationSuccess = false;
+            vaultOperationResult.ResultCode = VaultOperationResultCode::ParentVaultNotMatch;
+            return false;
+        }
+
+        // The record may be erased by another thread or by the previous operation of this transaction
+        if (recordRef.VaultRecordPtr == nullptr || Vlt->RecordsSet.find(recordRef.VaultRecordPtr) == Vlt->RecordsSet.end())
+        {
+            vaultOperationResult.IsOperationSuccess = false;
+            vaultOperationResult.ResultCode = VaultOperationResultCode::DataRecordNotValid;
+            return false;
+        }
+
+        return true;
+    }
+
+    VaultTransaction::VaultTransaction(VaultTransaction&& other) noexcept : Vlt(other.Vlt), Operations(std::move(other.Operations))
+    {
+        other.Operations.clear();
+    }
+
+    VaultTransaction& VaultTransaction::operator=(VaultTransaction&& other) noexcept
+    {
+        if (&other != this)
+        {
+            Vlt = other.Vlt;
+            Operations = std::move(other.Operations);
+            other.Operations.clear();
+        }
+
+        return *this;
+    }
+
+    void VaultTransaction::CreateRecord(const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        Operations.push_back({OperationType::CreateRecord, VaultRecordRef(), params});
+    }
+
+    void VaultTransaction::CreateRecord(std::vector<std::pair<std::string, VaultParamInput>>&& params) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        Operations.push_back({OperationType::CreateRecord, VaultRecordRef(), std::move(params)});
+    }
+
+    void VaultTransaction::SetData(const VaultRecordRef& recordRef, const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        Operations.push_back({OperationType::SetData, recordRef, params});
+    }
+
+    void VaultTransaction::EraseRecord(const VaultRecordRef& recordRef) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        Operations.push_back({OperationType::EraseRecord, recordRef, {}});
+    }
+
+    std::size_t VaultTransaction::GetOperationsCount() const noexcept
+    {
+        DBG_LOG_ENTER();
+
+        return Operations.size();
+    }
+
+    VaultOperationResult VaultTransaction::Commit() noexcept
+    {
+        DBG_LOG_ENTER();
+
+        std::vector<VaultRecordRef> createdRecordsRefs;
+        return Commit(createdRecordsRefs);
+    }
+
+    VaultOperationResult VaultTransaction::Commit(std::vector<VaultRecordRef>& createdRecordsRefs) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        VaultOperationResult res;
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        // Operations are removed from the transaction in any case
+        std::vector<Operation> operations;
+        operations.swap(Operations);
+
+        createdRecordsRefs.clear();
+
+        if (operations.empty()) return res;
+
+        // Lock Vault to write. Readers will see the state before or after all operations
+        WriteLock<RecursiveReadWriteMutex> writeLock(Vlt->RecursiveReadWriteMtx);
+
+        // Keys changed by SetData operations and spare rows with their old values
+        std::vector<std::vector<std::string>> changedKeys(operations.size());
+        std::vector<std::size_t> backupRows(operations.size(), 0);
+
+        std::size_t appliedCount = 0;
+        for (; appliedCount < operations.size(); ++appliedCount)
+        {
+            Operation& operation = operations[appliedCount];
+
+            switch (operation.Type)
+            {
+            case OperationType::CreateRecord:
+                res = Vlt->CreateRecord(operation.RecordRef, operation.Params, true);
+                break;
+
+            case OperationType::SetData:
+                if (!CheckRecord(operation.RecordRef, res)) break;
+
+                for (const auto& param : operation.Params)
+                    if (std::find(changedKeys[appliedCount].begin(), changedKeys[appliedCount].end(), param.first) == changedKeys[appliedCount].end())
+                        changedKeys[appliedCount].emplace_back(param.first);
+
+                backupRows[appliedCount] = Vlt->BackupRecordData(operation.RecordRef.VaultRecordPtr, changedKeys[appliedCount]);
+
+                res = Vlt->SetDataToRecord(operation.RecordRef.VaultRecordPtr, operation.Params, true);
+                if (!res.IsOperationSuccess) Vlt->FreeBackupRow(backupRows[appliedCount]);
+                break;
+
+            case OperationType::EraseRecord:
+                if (!CheckRecord(operation.RecordRef, res)) break;
+
+                // The record keeps its data until commit, so the erasure can be undone
+                Vlt->DetachRecord(operation.RecordRef.VaultRecordPtr);
+
+                res.IsOperationSuccess = true;
+                res.ResultCode = VaultOperationResultCode::Success;
+                break;
+            }
+
+            if (!res.IsOperationSuccess) break;
+        }
+
+        if (appliedCount != operations.size())
+        {
+            // Undo applied operations in reverse order, so each old unique value is already free when it is returned
+            while (appliedCount > 0)
+            {
+                --appliedCount;
+                Operation& operation = operations[appliedCount];
+
+                switch (operation.Type)
+                {
+                case OperationType::CreateRecord:
+                    Vlt->RemoveRecord(operation.RecordRef.VaultRecordPtr, nullptr);
+                    break;
+
+                case OperationType::SetData:
+                    Vlt->RestoreRecordData(operation.RecordRef.VaultRecordPtr, changedKeys[appliedCount], backupRows[appliedCount]);
+                    break;
+
+                case OperationType::EraseRecord:
+                    Vlt->AttachRecord(operation.RecordRef.VaultRecordPtr);
+                    break;
+                }
+            }
+
+            return res;
+        }
+
+        for (std::size_t i = 0; i < operations.size(); ++i)
+        {
+            Operation& operation = operations[i];
+
+            switch (operation.Type)
+            {
+            case OperationType::CreateRecord:
+                createdRecordsRefs.emplace_back(operation.RecordRef);
+                break;
+
+            case OperationType::SetData:
+                Vlt->FreeBackupRow(backupRows[i]);
+                break;
+
+            case OperationType::EraseRecord:
+                Vlt->ReleaseDetachedRecord(operation.RecordRef.VaultRecordPtr);
+                break;
+            }
+        }
+
+        res.Key.clear();
+        res.RequestedType = typeid(void);
+        res.SavedType = typeid(void);
+        res.IsOperationSuccess = true;
+        res.ResultCode = VaultOperationResultCode::Success;
+
+        return res;
+    }
+
+    void VaultTransaction::Rollback() noexcept
+    {
+        DBG_LOG_ENTER();
+
+        Operations.clear();
+    }
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "Vault.h"
+#include "VaultRecordRef.h"
+#include "VaultParamInput.h"
+#include "VaultOperationResult.h"
+
+namespace mvlt
+{
+    /**
+        \brief A class for changing Vault by several operations at once
+
+        The object is created by Vault::BeginTransaction. CreateRecord, SetData and EraseRecord do not change Vault,
+        they only save operations inside the transaction. Commit applies all operations in the same order under one write lock of Vault.
+        If one of the operations fails, for example the new value of the unique key is already in Vault,
+        all previous operations are rolled back and Vault stays the same as before Commit.
+
+        Readers take the read lock of Vault, so they see either the state before the transaction or the state after it.
+        ReadRecord does not take locks and sees each record snapshot separately.
+
+        Operations can not refer to records created by the same transaction. Vault must not be destroyed before the transaction.
+    */
+    class VaultTransaction
+    {
+    private:
+        // Types of saved operations
+        enum class OperationType : std::uint8_t
+        {
+            CreateRecord,
+            SetData,
+            EraseRecord
+        };
+
+        // Saved operation
+        struct Operation
+        {
+            // Operation type
+            OperationType Type;
+
+            // Record to change or erase. After Commit it is the created record
+            VaultRecordRef RecordRef;
+
+            // Keys with values of the new record or the changed keys
+            std::vector<std::pair<std::string, VaultParamInput>> Params;
+        };
+
+        // Vault to change
+        Vault* Vlt = nullptr;
+
+        // Saved operations in the order of calls
+        std::vector<Operation> Operations;
+
+        /**
+            \brief Constructor
+
+            \param [in] vlt Vault to change
+        */
+        explicit VaultTransaction(Vault* vlt) noexcept;
+
+        /**
+            \brief A method for checking that the record can be changed by the operation. Must be called under Vault write lock
+
+            \param [in] recordRef reference to the record
+            \param [out] vaultOperationResult result of the operation. It is changed only if the record can not be changed
+
+            \return true if the record is inside Vault, otherwise false
+        */
+        bool CheckRecord(const VaultRecordRef& recordRef, VaultOperationResult& vaultOperationResult) const noexcept;
+
+    public:
+        /// Making the Vault class friendly so that it can create transactions
+        friend Vault;
+
+        /// \brief Deleted copy constructor
+        VaultTransaction(const VaultTransaction& other) noexcept = delete;
+
+        /**
+            \brief Move constructor
+
+            \param [in] other other transaction. It will have no operations after moving
+        */
+        VaultTransaction(VaultTransaction&& other) noexcept;
+
+        /// \brief Deleted assignment operator
+        VaultTransaction& operator=(const VaultTransaction& other) noexcept = delete;
+
+        /**
+            \brief Move assignment operator
+
+            Operations of this transaction are discarded.
+
+            \param [in] other other transaction. It will have no operations after moving
+
+            \return reference to this
+        */
+        VaultTransaction& operator=(VaultTransaction&& other) noexcept;
+
+        /**
+            \brief A method for saving the creation of the record
+
+            \param [in] params vector of pairs with key and value like in Vault::CreateRecord
+        */
+        void CreateRecord(const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept;
+
+        /**
+            \brief A method for saving the creation of the record
+
+            \param [in] params vector of pairs with key and value like in Vault::CreateRecord. Values are moved to the transaction
+        */
+        void CreateRecord(std::vector<std::pair<std::string, VaultParamInput>>&& params) noexcept;
+
+        /**
+            \brief A template method for saving the change of the record data
+
+            \tparam <T> Any type of data except for c arrays
+
+            \param [in] recordRef reference to the record to change
+            \param [in] key the key whose value needs to be changed
+            \param [in] data new key data value. It is moved to the transaction if it is rvalue
+        */
+        template <class T>
+        void SetData(const VaultRecordRef& recordRef, const std::string& key, T&& data) noexcept;
+
+        /**
+            \brief A method for saving the change of several values of the record
+
+            All values are set at once like in VaultRecordRef::SetData.
+
+            \param [in] recordRef reference to the record to change
+            \param [in] params vector of pairs with key and value
+        */
+        void SetData(const VaultRecordRef& recordRef, const std::vector<std::pair<std::string, VaultParamInput>>& params) noexcept;
+
+        /**
+            \brief A method for saving the erasure of the record
+
+            \param [in] recordRef reference to the record to erase
+        */
+        void EraseRecord(const VaultRecordRef& recordRef) noexcept;
+
+        /**
+            \brief A method for getting the number of saved operations
+
+            \return number of saved operations
+        */
+        std::size_t GetOperationsCount() const noexcept;
+
+        /**
+            \brief A method for applying all saved operations
+
+            Operations are removed from the transaction whether Commit succeeds or not.
+
+            \return VaultOperationResult object with the result of the first failed operation or success if all operations were applied
+        */
+        VaultOperationResult Commit() noexcept;
+
+        /**
+            \brief A method for applying all saved operations and getting the created records
+
+            \param [out] createdRecordsRefs references to the created records in the order of CreateRecord calls. It is empty if Commit failed
+
+            \return VaultOperationResult object with the result of the first failed operation or success if all operations were applied
+        */
+        VaultOperationResult Commit(std::vector<VaultRecordRef>& createdRecordsRefs) noexcept;
+
+        /// \brief A method for discarding all saved operations
+        void Rollback() noexcept;
+
+        /// \brief Destructor. Not committed operations are discarded
+        ~VaultTransaction() noexcept = default;
+    };
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "VaultTransaction.h"
+
+#include "Vault.hpp"
+#include "VaultParamInput.hpp"
+
+// This file contains an implementation of the VaultTransaction template methods
+namespace mvlt
+{
+    template <class T>
+    void VaultTransaction::SetData(const VaultRecordRef& recordRef, const std::string& key, T&& data) noexcept
+    {
+        DBG_LOG_ENTER();
+
+        std::vector<std::pair<std::string, VaultParamInput>> params;
+        params.emplace_back(key, VaultParamInput(std::forward<T>(data)));
+
+        Operations.push_back({OperationType::SetData, recordRef, std::move(params)});
+    }
+}
@@ -0,0 +1,504 @@
+#include "ShardedVaultUnitTests.h"
+
+#include <thread>
+#include <algorithm>
+
+namespace ShardedVaultTestNs
+{
+std::vector<std::pair<std::string, std::function<void()>>> Tests;
+
+// Function for getting values of the key from records. Values are sorted if isSort is true
+std::vector<int> GetValues(const std::vector<VaultRecordRef>& records, const std::string& key, const bool& isSort = true)
+{
+    std::vector<int> res;
+
+    for (const VaultRecordRef& record : records)
+    {
+        int value = -1;
+        record.GetData(key, value);
+        res.emplace_back(value);
+    }
+
+    if (isSort) std::sort(res.begin(), res.end());
+
+    return res;
+}
+
+// Function for creating a vault with the shard key "A" and the key "B" and records with A from 0 to recordsCount - 1 and B equal to A % 10
+void FillVault(ShardedVault& vlt, const int& recordsCount)
+{
+    vlt.AddShardKey<int>("A");
+    vlt.AddKey("B", -1);
+
+    for (int i = 0; i < recordsCount; ++i)
+        vlt.CreateRecord({{"A", i}, {"B", i % 10}});
+}
+
+TEST_BODY(Constructor, Default,
+    ShardedVault vlt;
+
+    TEST_ASSERT(vlt.GetShardsCount() == 16);
+    TEST_ASSERT(vlt.Size() == 0);
+    TEST_ASSERT(vlt.GetShardKey().empty());
+)
+
+TEST_BODY(Constructor, ZeroShards,
+    ShardedVault vlt(0);
+
+    TEST_ASSERT(vlt.GetShardsCount() == 1);
+)
+
+TEST_BODY(AddShardKey, Default,
+    ShardedVault vlt(4);
+    VaultOperationResult vor;
+
+    vor = vlt.AddShardKey<int>("A");
+
+    TEST_ASSERT(vor.IsOperationSuccess);
+    TEST_ASSERT(vlt.GetShardKey() == "A");
+    TEST_ASSERT(vlt.IsKeyExist("A"));
+)
+
+TEST_BODY(AddShardKey, DuplicateShardKey,
+    ShardedVault vlt(4);
+    VaultOperationResult vor;
+
+    vlt.AddShardKey<int>("A");
+    vor = vlt.AddShardKey<int>("B");
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::DuplicateKey, SavedType == typeid(void));
+
+    TEST_ASSERT(vlt.GetShardKey() == "A");
+    TEST_ASSERT(!vlt.IsKeyExist("B"));
+)
+
+TEST_BODY(AddShardKey, NonEmptyShards,
+    ShardedVault vlt(4);
+    VaultOperationResult vor;
+
+    vlt.AddKey("B", 0);
+    vlt.CreateRecord({{"B", 1}});
+
+    vor = vlt.AddShardKey<int>("A");
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::TryToAddUniqueKeyInNonEmptyVaultWithoutLambda, SavedType == typeid(void));
+
+    TEST_ASSERT(vlt.GetShardKey().empty());
+    TEST_ASSERT(!vlt.IsKeyExist("A"));
+)
+
+TEST_BODY(CreateRecord, Default,
+    ShardedVault vlt(4);
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+    std::vector<VaultRecordRef> records;
+
+    FillVault(vlt, 99);
+
+    vor = vlt.CreateRecord(vrr, {{"A", 99}, {"B", 9}});
+
+    TEST_ASSERT(vor.IsOperationSuccess);
+    TEST_ASSERT(vlt.Size() == 100);
+
+    int a = -1;
+    vrr.GetData("A", a);
+    TEST_ASSERT(a == 99);
+
+    // Records are placed in different shards, but all of them are found by the request
+    vlt.Request(GreaterOrEqual("A", 0), records);
+
+    std::vector<int> expected;
+    for (int i = 0; i < 100; ++i) expected.emplace_back(i);
+    TEST_ASSERT(GetValues(records, "A") == expected);
+)
+
+TEST_BODY(CreateRecord, DuplicateShardKeyValue,
+    ShardedVault vlt(4);
+    VaultOperationResult vor;
+
+    FillVault(vlt, 10);
+
+    vor = vlt.CreateRecord({{"A", 5}, {"B", 100}});
+
+    TEST_ASSERT(vor.IsOperationSuccess == false);
+    TEST_ASSERT(vor.ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet);
+    TEST_ASSERT(vlt.Size() == 10);
+)
+
+TEST_BODY(CreateRecord, WrongShardKeyType,
+    ShardedVault vlt(4);
+    VaultOperationResult vor;
+
+    FillVault(vlt, 10);
+
+    vor = vlt.CreateRecord({{"A", std::string("a")}, {"B", 100}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+
+    TEST_ASSERT(vlt.Size() == 10);
+)
+
+TEST_BODY(CreateRecord, WithoutShardKeyValue,
+    ShardedVault vlt(4);
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+
+    vlt.AddShardKey<int>("A");
+    vlt.AddKey("B", -1);
+
+    vor = vlt.CreateRecord({{"B", 1}});
+    TEST_ASSERT(vor.IsOperationSuccess);
+
+    // The default value of the shard key is used, so it is found in the shard of the default value
+    vlt.GetRecord("A", 0, vrr);
+    int b = -1;
+    vrr.GetData("B", b);
+    TEST_ASSERT(b == 1);
+
+    vor = vlt.CreateRecord({{"B", 2}});
+    TEST_ASSERT(vor.ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet);
+    TEST_ASSERT(vlt.Size() == 1);
+)
+
+TEST_BODY(CreateRecord, MoveParams,
+    ShardedVault vlt(4);
+    VaultRecordRef vrr;
+    std::vector<std::pair<std::string, VaultParamInput>> params;
+
+    vlt.AddShardKey<std::string>("A");
+
+    params.emplace_back("A", std::string(100, 'a'));
+    TEST_ASSERT(vlt.CreateRecord(vrr, std::move(params)).IsOperationSuccess);
+
+    std::string a;
+    vrr.GetData("A", a);
+    TEST_ASSERT(a == std::string(100, 'a'));
+
+    TEST_ASSERT(vlt.GetRecord("A", std::string(100, 'a'), vrr).IsOperationSuccess);
+)
+
+TEST_BODY(GetRecord, ByShardKey,
+    ShardedVault vlt(4);
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+
+    FillVault(vlt, 20);
+
+    vor = vlt.GetRecord("A", 13, vrr);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    int b = -1;
+    vrr.GetData("B", b);
+    TEST_ASSERT(b == 3);
+)
+
+TEST_BODY(GetRecord, ByOtherKey,
+    ShardedVault vlt(4);
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+
+    FillVault(vlt, 20);
+    vlt.AddKey("C", 0);
+    vlt.CreateRecord({{"A", 100}, {"C", 7}});
+
+    vor = vlt.GetRecord("C", 7, vrr);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "C",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    int a = -1;
+    vrr.GetData("A", a);
+    TEST_ASSERT(a == 100);
+)
+
+TEST_BODY(GetRecord, WrongValue,
+    ShardedVault vlt(4);
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+
+    FillVault(vlt, 20);
+
+    vor = vlt.GetRecord("A", 100, vrr);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
+
+    vor = vlt.GetRecord("B", 100, vrr);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
+)
+
+TEST_BODY(GetRecord, WrongKey,
+    ShardedVault vlt(4);
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+
+    FillVault(vlt, 20);
+
+    vor = vlt.GetRecord("Z", 1, vrr);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+)
+
+TEST_BODY(GetRecords, Default,
+    ShardedVault vlt(4);
+    std::vector<VaultRecordRef> records;
+    VaultOperationResult vor;
+
+    FillVault(vlt, 50);
+
+    vor = vlt.GetRecords("B", 3, records);
+
+    TEST_ASSERT(vor.IsOperationSuccess);
+    TEST_ASSERT(GetValues(records, "A") == std::vector<int>({3, 13, 23, 33, 43}));
+
+    vor = vlt.GetRecords("B", 100, records);
+
+    TEST_ASSERT(vor.ResultCode == VaultOperationResultCode::WrongValue);
+    TEST_ASSERT(records.empty());
+)
+
+TEST_BODY(GetRecords, AmountOfRecords,
+    ShardedVault vlt(4);
+    std::vector<VaultRecordRef> records;
+
+    FillVault(vlt, 50);
+
+    vlt.GetRecords("B", 3, records, 2);
+
+    TEST_ASSERT(records.size() == 2);
+    for (int a : GetValues(records, "A")) TEST_ASSERT(a % 10 == 3);
+)
+
+TEST_BODY(Request, Default,
+    ShardedVault vlt(4);
+    std::vector<VaultRecordRef> records;
+    VaultOperationResult vor;
+
+    FillVault(vlt, 50);
+
+    vor = vlt.Request(Greater("A", 10) && Less("A", 20), records);
+
+    TEST_ASSERT(vor.IsOperationSuccess);
+    TEST_ASSERT(GetValues(records, "A") == std::vector<int>({11, 12, 13, 14, 15, 16, 17, 18, 19}));
+
+    vor = vlt.Request(Equal("B", 5, [](const VaultRecordRef& ref) -> bool
+    {
+        int a = 0;
+        ref.GetData("A", a);
+        return a > 20;
+    }), records);
+
+    TEST_ASSERT(vor.IsOperationSuccess);
+    TEST_ASSERT(GetValues(records, "A") == std::vector<int>({25, 35, 45}));
+)
+
+TEST_BODY(Request, WrongKey,
+    ShardedVault vlt(4);
+    std::vector<VaultRecordRef> records;
+    VaultOperationResult vor;
+
+    FillVault(vlt, 50);
+    vlt.Request(Less("A", 3), records);
+
+    vor = vlt.Request(Greater("Z", 1), records);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+
+    TEST_ASSERT(GetValues(records, "A") == std::vector<int>({0, 1, 2}));
+)
+
+TEST_BODY(Count, Default,
+    ShardedVault vlt(4);
+    std::size_t count = 0;
+    VaultOperationResult vor;
+
+    FillVault(vlt, 50);
+
+    vor = vlt.Count(GreaterOrEqual("A", 10), count);
+    TEST_ASSERT(vor.IsOperationSuccess);
+    TEST_ASSERT(count == 40);
+
+    vlt.Count(Equal("B", 1) || Equal("B", 2), count);
+    TEST_ASSERT(count == 10);
+)
+
+TEST_BODY(GetSortedRecords, Default,
+    ShardedVault vlt(4);
+    std::vector<VaultRecordRef> records;
+    VaultOperationResult vor;
+
+    FillVault(vlt, 30);
+
+    vor = vlt.GetSortedRecords<int>("A", records);
+
+    TEST_ASSERT(vor.IsOperationSuccess);
+
+    std::vector<int> expected;
+    for (int i = 0; i < 30; ++i) expected.emplace_back(i);
+    TEST_ASSERT(GetValues(records, "A", false) == expected);
+
+    vlt.GetSortedRecords<int>("B", records);
+
+    std::vector<int> values = GetValues(records, "B", false);
+    TEST_ASSERT(values.size() == 30);
+    TEST_ASSERT(std::is_sorted(values.begin(), values.end()));
+)
+
+TEST_BODY(GetSortedRecords, Reverse,
+    ShardedVault vlt(4);
+    std::vector<VaultRecordRef> records;
+
+    FillVault(vlt, 30);
+
+    vlt.GetSortedRecords<int>("A", records, true);
+
+    std::vector<int> expected;
+    for (int i = 29; i >= 0; --i) expected.emplace_back(i);
+    TEST_ASSERT(GetValues(records, "A", false) == expected);
+)
+
+TEST_BODY(GetSortedRecords, AmountOfRecords,
+    ShardedVault vlt(4);
+    std::vector<VaultRecordRef> records;
+
+    FillVault(vlt, 30);
+
+    vlt.GetSortedRecords<int>("A", records, false, 5);
+    TEST_ASSERT(GetValues(records, "A", false) == std::vector<int>({0, 1, 2, 3, 4}));
+
+    vlt.GetSortedRecords<int>("A", records, true, 3);
+    TEST_ASSERT(GetValues(records, "A", false) == std::vector<int>({29, 28, 27}));
+)
+
+TEST_BODY(GetSortedRecords, WrongType,
+    ShardedVault vlt(4);
+    std::vector<VaultRecordRef> records;
+    VaultOperationResult vor;
+
+    FillVault(vlt, 30);
+    vlt.GetSortedRecords<int>("A", records, false, 5);
+
+    vor = vlt.GetSortedRecords<std::string>("A", records);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+
+    vor = vlt.GetSortedRecords<int>("Z", records);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+
+    TEST_ASSERT(records.size() == 5);
+)
+
+TEST_BODY(EraseRecord, ByRecord,
+    ShardedVault vlt(4);
+    VaultRecordRef vrr;
+
+    FillVault(vlt, 20);
+
+    vlt.GetRecord("A", 7, vrr);
+    TEST_ASSERT(vlt.EraseRecord(vrr));
+    TEST_ASSERT(vlt.Size() == 19);
+    TEST_ASSERT(!vlt.GetRecord("A", 7, vrr).IsOperationSuccess);
+
+    // Record from other Vault is not erased
+    Vault otherVlt;
+    otherVlt.AddKey("A", 0);
+    otherVlt.CreateRecord(vrr, {{"A", 1}});
+    TEST_ASSERT(!vlt.EraseRecord(vrr));
+    TEST_ASSERT(vlt.Size() == 19);
+)
+
+TEST_BODY(EraseRecord, ByKeyValue,
+    ShardedVault vlt(4);
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+
+    FillVault(vlt, 20);
+
+    vor = vlt.EraseRecord("A", 7);
+    TEST_ASSERT(vor.IsOperationSuccess);
+    TEST_ASSERT(!vlt.GetRecord("A", 7, vrr).IsOperationSuccess);
+
+    vor = vlt.EraseRecord("B", 8);
+    TEST_ASSERT(vor.IsOperationSuccess);
+    TEST_ASSERT(vlt.Size() == 18);
+
+    vor = vlt.EraseRecord("A", 100);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
+
+    TEST_ASSERT(vlt.Size() == 18);
+)
+
+TEST_BODY(DropData, Default,
+    ShardedVault vlt(4);
+
+    FillVault(vlt, 20);
+
+    vlt.DropData();
+
+    TEST_ASSERT(vlt.Size() == 0);
+    TEST_ASSERT(vlt.IsKeyExist("B"));
+    TEST_ASSERT(vlt.CreateRecord({{"A", 1}}).IsOperationSuccess);
+)
+
+TEST_BODY(Multithreading, ParallelWriters,
+    ShardedVault vlt(8);
+    std::vector<std::thread> threads;
+    const int writersCount = 8, recordsCount = 500;
+
+    vlt.AddShardKey<int>("A");
+    vlt.AddKey("B", 0);
+
+    for (int i = 0; i < writersCount; ++i)
+    {
+        threads.emplace_back([&, i]()
+        {
+            for (int j = 0; j < recordsCount; ++j)
+            {
+                VaultRecordRef vrr;
+                vlt.CreateRecord(vrr, {{"A", i * recordsCount + j}});
+                vrr.SetData("B", i * recordsCount + j);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    TEST_ASSERT(vlt.Size() == writersCount * recordsCount);
+
+    for (int i = 0; i < writersCount * recordsCount; ++i)
+    {
+        VaultRecordRef vrr;
+        int b = -1;
+        vlt.GetRecord("A", i, vrr);
+        vrr.GetData("B", b);
+        TEST_ASSERT(b == i);
+    }
+)
+}
+
+void ShardedVaultUnitTests(const std::string& testName)
+{
+    DBG_LOG_ENTER();
+    SetBackTraceFormat(BackTraceFormat::None);
+
+    for (const auto& test : ShardedVaultTestNs::Tests)
+    {
+        if (testName.empty() || testName == test.first)
+            test.second();
+    }
+}
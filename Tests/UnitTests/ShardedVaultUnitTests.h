@@ -0,0 +1,103 @@
+#pragma once
+
+#include "../../Source/MVault.h"
+
+#include "../MTests/TestLog.h"
+#include "../MTests/TestCout.h"
+#include "../MTests/TestSuite.h"
+#include "../MTests/TestAssert.h"
+#include "../MTests/CompareVaultOperationResult.h"
+
+using namespace mvlt;
+
+namespace ShardedVaultTestNs
+{
+    TEST_SUITE(Constructor,
+
+        TEST_CASE(Default)
+
+        TEST_CASE(ZeroShards)
+    )
+
+    TEST_SUITE(AddShardKey,
+
+        TEST_CASE(Default)
+
+        TEST_CASE(DuplicateShardKey)
+
+        TEST_CASE(NonEmptyShards)
+    )
+
+    TEST_SUITE(CreateRecord,
+
+        TEST_CASE(Default)
+
+        TEST_CASE(DuplicateShardKeyValue)
+
+        TEST_CASE(WrongShardKeyType)
+
+        TEST_CASE(WithoutShardKeyValue)
+
+        TEST_CASE(MoveParams)
+    )
+
+    TEST_SUITE(GetRecord,
+
+        TEST_CASE(ByShardKey)
+
+        TEST_CASE(ByOtherKey)
+
+        TEST_CASE(WrongValue)
+
+        TEST_CASE(WrongKey)
+    )
+
+    TEST_SUITE(GetRecords,
+
+        TEST_CASE(Default)
+
+        TEST_CASE(AmountOfRecords)
+    )
+
+    TEST_SUITE(Request,
+
+        TEST_CASE(Default)
+
+        TEST_CASE(WrongKey)
+    )
+
+    TEST_SUITE(Count,
+
+        TEST_CASE(Default)
+    )
+
+    TEST_SUITE(GetSortedRecords,
+
+        TEST_CASE(Default)
+
+        TEST_CASE(Reverse)
+
+        TEST_CASE(AmountOfRecords)
+
+        TEST_CASE(WrongType)
+    )
+
+    TEST_SUITE(EraseRecord,
+
+        TEST_CASE(ByRecord)
+
+        TEST_CASE(ByKeyValue)
+    )
+
+    TEST_SUITE(DropData,
+
+        TEST_CASE(Default)
+    )
+
+    TEST_SUITE(Multithreading,
+
+        TEST_CASE(ParallelWriters)
+    )
+}
+
+void ShardedVaultUnitTests(const std::string& testName);
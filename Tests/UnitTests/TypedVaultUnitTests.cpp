@@ -0,0 +1,357 @@
+#include "TypedVaultUnitTests.h"
+
+#include <algorithm>
+
+namespace TypedVaultTestNs
+{
+std::vector<std::pair<std::string, std::function<void()>>> Tests;
+
+// Function for getting sorted ids of records
+std::vector<int> GetIds(const std::vector<const TestVault::Record*>& records)
+{
+    std::vector<int> res;
+
+    for (const TestVault::Record* record : records)
+        res.emplace_back(record->GetData<Id>());
+
+    std::sort(res.begin(), res.end());
+
+    return res;
+}
+
+TEST_BODY(CreateRecord, Default,
+    TestVault vlt;
+    const TestVault::Record* record = nullptr;
+    VaultOperationResult vor;
+
+    vor = vlt.CreateRecord(1, 20, "a");
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+
+    vor = vlt.CreateRecord(record, 2, 30, "b");
+
+    TEST_ASSERT(vor.IsOperationSuccess);
+    TEST_ASSERT(vlt.Size() == 2);
+    TEST_ASSERT(record->GetData<Id>() == 2);
+    TEST_ASSERT(record->GetData<Age>() == 30);
+    TEST_ASSERT(record->GetData<UserName>() == "b");
+)
+
+TEST_BODY(CreateRecord, DuplicateUniqueKeyValue,
+    TestVault vlt;
+    VaultOperationResult vor;
+
+    vlt.CreateRecord(1, 20, "a");
+    vor = vlt.CreateRecord(1, 30, "b");
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Id",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(void));
+
+    TEST_ASSERT(vlt.Size() == 1);
+)
+
+TEST_BODY(CopyConstructor, Default,
+    TestVault vlt1;
+    const TestVault::Record* record = nullptr;
+
+    vlt1.CreateRecord(1, 20, "a");
+    vlt1.CreateRecord(2, 30, "b");
+
+    TestVault vlt2(vlt1);
+
+    vlt1.EraseRecord<Id>(1);
+
+    TEST_ASSERT(vlt1.Size() == 1);
+    TEST_ASSERT(vlt2.Size() == 2);
+
+    TEST_ASSERT(vlt2.GetRecord<Id>(1, record).IsOperationSuccess);
+    TEST_ASSERT(record->GetData<UserName>() == "a");
+)
+
+TEST_BODY(GetRecord, Default,
+    TestVault vlt;
+    const TestVault::Record* record = nullptr;
+    VaultOperationResult vor;
+
+    vlt.CreateRecord(1, 20, "a");
+    vlt.CreateRecord(2, 30, "b");
+
+    vor = vlt.GetRecord<UserName>("b", record);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "UserName",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(std::string));
+
+    TEST_ASSERT(record->GetData<Id>() == 2);
+)
+
+TEST_BODY(GetRecord, WrongValue,
+    TestVault vlt;
+    const TestVault::Record* record = nullptr;
+    VaultOperationResult vor;
+
+    vlt.CreateRecord(1, 20, "a");
+
+    vor = vlt.GetRecord<Id>(2, record);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Id",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
+
+    TEST_ASSERT(record == nullptr);
+)
+
+TEST_BODY(GetRecords, Default,
+    TestVault vlt;
+    std::vector<const TestVault::Record*> records;
+    VaultOperationResult vor;
+
+    vlt.CreateRecord(1, 20, "a");
+    vlt.CreateRecord(2, 30, "b");
+    vlt.CreateRecord(3, 30, "c");
+
+    vor = vlt.GetRecords<Age>(30, records);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "Age",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    TEST_ASSERT(GetIds(records) == std::vector<int>({2, 3}));
+
+    vlt.GetRecords<Age>(30, records, 1);
+
+    TEST_ASSERT(records.size() == 1);
+)
+
+TEST_BODY(GetRecords, WrongValue,
+    TestVault vlt;
+    std::vector<const TestVault::Record*> records;
+    VaultOperationResult vor;
+
+    vlt.CreateRecord(1, 20, "a");
+
+    vor = vlt.GetRecords<Age>(99, records);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Age",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
+
+    TEST_ASSERT(records.empty());
+)
+
+TEST_BODY(Request, Equal,
+    TestVault vlt;
+    std::vector<const TestVault::Record*> records;
+    VaultOperationResult vor;
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord(i, i % 3, std::to_string(i));
+
+    vor = vlt.RequestEqual<Age>(1, records);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "Age",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    TEST_ASSERT(GetIds(records) == std::vector<int>({1, 4, 7}));
+
+    vlt.RequestEqual<Age>(5, records);
+
+    TEST_ASSERT(records.empty());
+)
+
+TEST_BODY(Request, GreaterAndLess,
+    TestVault vlt;
+    std::vector<const TestVault::Record*> records;
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord(i, i * 10, std::to_string(i));
+
+    vlt.RequestGreater<Age>(70, records);
+    TEST_ASSERT(GetIds(records) == std::vector<int>({8, 9}));
+
+    vlt.RequestGreaterOrEqual<Age>(70, records);
+    TEST_ASSERT(GetIds(records) == std::vector<int>({7, 8, 9}));
+
+    vlt.RequestLess<Age>(20, records);
+    TEST_ASSERT(GetIds(records) == std::vector<int>({0, 1}));
+
+    vlt.RequestLessOrEqual<Age>(20, records);
+    TEST_ASSERT(GetIds(records) == std::vector<int>({0, 1, 2}));
+)
+
+TEST_BODY(Request, Interval,
+    TestVault vlt;
+    std::vector<const TestVault::Record*> records;
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord(i, i * 10, std::to_string(i));
+
+    vlt.RequestInterval<Age>(20, 50, records);
+    TEST_ASSERT(GetIds(records) == std::vector<int>({2, 3, 4, 5}));
+
+    vlt.RequestInterval<Age>(20, 50, records, false, false);
+    TEST_ASSERT(GetIds(records) == std::vector<int>({3, 4}));
+
+    vlt.RequestInterval<Age>(50, 20, records);
+    TEST_ASSERT(records.empty());
+
+    vlt.RequestInterval<Age>(20, 50, records, true, true, 2);
+    TEST_ASSERT(GetIds(records) == std::vector<int>({2, 3}));
+)
+
+TEST_BODY(Request, WithPredicat,
+    TestVault vlt;
+    std::vector<const TestVault::Record*> records;
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord(i, i * 10, std::to_string(i));
+
+    vlt.RequestGreater<Age>(0, records, -1, [](const TestVault::Record& record)
+    {
+        return record.GetData<Id>() % 2 == 0;
+    });
+
+    TEST_ASSERT(GetIds(records) == std::vector<int>({2, 4, 6, 8}));
+)
+
+TEST_BODY(SetData, Default,
+    TestVault vlt;
+    const TestVault::Record* record = nullptr;
+    std::vector<const TestVault::Record*> records;
+    VaultOperationResult vor;
+
+    vlt.CreateRecord(record, 1, 20, "a");
+    vlt.CreateRecord(2, 30, "b");
+
+    vor = vlt.SetData<Age>(record, 30);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "Age",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    TEST_ASSERT(record->GetData<Age>() == 30);
+
+    vlt.RequestEqual<Age>(30, records);
+    TEST_ASSERT(GetIds(records) == std::vector<int>({1, 2}));
+
+    vlt.RequestLess<Age>(30, records);
+    TEST_ASSERT(records.empty());
+
+    vlt.SetData<Id>(record, 10);
+    TEST_ASSERT(vlt.GetRecord<Id>(10, record).IsOperationSuccess);
+    TEST_ASSERT(vlt.GetRecord<Id>(1, record).IsOperationSuccess == false);
+)
+
+TEST_BODY(SetData, DuplicateUniqueKeyValue,
+    TestVault vlt;
+    const TestVault::Record* record = nullptr;
+    VaultOperationResult vor;
+
+    vlt.CreateRecord(record, 1, 20, "a");
+    vlt.CreateRecord(2, 30, "b");
+
+    vor = vlt.SetData<Id>(record, 2);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Id",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(int));
+
+    TEST_ASSERT(record->GetData<Id>() == 1);
+)
+
+TEST_BODY(SetData, InvalidRecord,
+    TestVault vlt1, vlt2;
+    const TestVault::Record* record = nullptr;
+    VaultOperationResult vor;
+
+    vlt1.CreateRecord(record, 1, 20, "a");
+
+    vor = vlt2.SetData<Age>(record, 30);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Age",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::DataRecordNotValid, SavedType == typeid(int));
+
+    TEST_ASSERT(record->GetData<Age>() == 20);
+)
+
+TEST_BODY(EraseRecord, ByRecord,
+    TestVault vlt;
+    const TestVault::Record* record = nullptr;
+    std::vector<const TestVault::Record*> records;
+    VaultOperationResult vor;
+
+    vlt.CreateRecord(record, 1, 20, "a");
+    vlt.CreateRecord(2, 20, "b");
+
+    vor = vlt.EraseRecord(record);
+
+    TEST_ASSERT(vor.IsOperationSuccess);
+    TEST_ASSERT(vlt.Size() == 1);
+
+    vlt.RequestEqual<Age>(20, records);
+    TEST_ASSERT(GetIds(records) == std::vector<int>({2}));
+
+    vlt.RequestGreaterOrEqual<Age>(20, records);
+    TEST_ASSERT(GetIds(records) == std::vector<int>({2}));
+
+    vor = vlt.EraseRecord(record);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::DataRecordNotValid, SavedType == typeid(void));
+)
+
+TEST_BODY(EraseRecord, ByKeyValue,
+    TestVault vlt;
+    VaultOperationResult vor;
+
+    for (int i = 0; i < 100; ++i) vlt.CreateRecord(i, i, std::to_string(i));
+
+    for (int i = 0; i < 100; ++i)
+    {
+        vor = vlt.EraseRecord<UserName>(std::to_string(i));
+        TEST_ASSERT(vor.IsOperationSuccess);
+    }
+
+    TEST_ASSERT(vlt.Size() == 0);
+
+    vor = vlt.EraseRecord<Id>(0);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Id",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
+)
+
+TEST_BODY(EraseRecord, EraseRecords,
+    TestVault vlt;
+    std::vector<const TestVault::Record*> records;
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord(i, i % 2, std::to_string(i));
+
+    vlt.EraseRecords<Age>(0, 2);
+    TEST_ASSERT(vlt.Size() == 8);
+
+    vlt.EraseRecords<Age>(0);
+    TEST_ASSERT(vlt.Size() == 5);
+
+    vlt.RequestGreaterOrEqual<Age>(0, records);
+    TEST_ASSERT(GetIds(records) == std::vector<int>({1, 3, 5, 7, 9}));
+)
+
+TEST_BODY(DropData, Default,
+    TestVault vlt;
+    std::vector<const TestVault::Record*> records;
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord(i, i, std::to_string(i));
+
+    vlt.DropData();
+
+    TEST_ASSERT(vlt.Size() == 0);
+
+    vlt.RequestGreaterOrEqual<Age>(0, records);
+    TEST_ASSERT(records.empty());
+
+    TEST_ASSERT(vlt.CreateRecord(1, 1, "1").IsOperationSuccess);
+)
+}
+
+void TypedVaultUnitTests(const std::string& testName)
+{
+    DBG_LOG_ENTER();
+    SetBackTraceFormat(BackTraceFormat::None);
+
+    for (const auto& test : TypedVaultTestNs::Tests)
+    {
+        if (testName.empty() || testName == test.first)
+            test.second();
+    }
+}
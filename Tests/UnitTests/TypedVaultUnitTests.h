@@ -0,0 +1,82 @@
+#pragma once
+
+#include "../../Source/MVault.h"
+
+#include "../MTests/TestLog.h"
+#include "../MTests/TestCout.h"
+#include "../MTests/TestSuite.h"
+#include "../MTests/TestAssert.h"
+#include "../MTests/CompareVaultOperationResult.h"
+
+using namespace mvlt;
+
+namespace TypedVaultTestNs
+{
+    struct Id : TypedField<int, TypedKeyKind::Unique> { static const char* Name() noexcept { return "Id"; } };
+    struct Age : TypedField<int> { static const char* Name() noexcept { return "Age"; } };
+    struct UserName : TypedField<std::string> { static const char* Name() noexcept { return "UserName"; } };
+
+    using TestVault = TypedVault<Id, Age, UserName>;
+
+    TEST_SUITE(CreateRecord,
+
+        TEST_CASE(Default)
+
+        TEST_CASE(DuplicateUniqueKeyValue)
+    )
+
+    TEST_SUITE(CopyConstructor,
+
+        TEST_CASE(Default)
+    )
+
+    TEST_SUITE(GetRecord,
+
+        TEST_CASE(Default)
+
+        TEST_CASE(WrongValue)
+    )
+
+    TEST_SUITE(GetRecords,
+
+        TEST_CASE(Default)
+
+        TEST_CASE(WrongValue)
+    )
+
+    TEST_SUITE(Request,
+
+        TEST_CASE(Equal)
+
+        TEST_CASE(GreaterAndLess)
+
+        TEST_CASE(Interval)
+
+        TEST_CASE(WithPredicat)
+    )
+
+    TEST_SUITE(SetData,
+
+        TEST_CASE(Default)
+
+        TEST_CASE(DuplicateUniqueKeyValue)
+
+        TEST_CASE(InvalidRecord)
+    )
+
+    TEST_SUITE(EraseRecord,
+
+        TEST_CASE(ByRecord)
+
+        TEST_CASE(ByKeyValue)
+
+        TEST_CASE(EraseRecords)
+    )
+
+    TEST_SUITE(DropData,
+
+        TEST_CASE(Default)
+    )
+}
+
+void TypedVaultUnitTests(const std::string& testName);
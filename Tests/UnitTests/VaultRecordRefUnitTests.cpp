@@ -395,6 +395,194 @@ TEST_BODY(SetDataByKeyAndValue, DuplicateUniqueKeyValue,
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(int));
 )
 
+TEST_BODY(SetDataByKeyAndValue, UniqueKeyNewValue,
+    Vault vlt;
+    VaultRecordRef vrr1, vrr2;
+    VaultOperationResult vor;
+
+    vlt.AddUniqueKey<int>("A");
+    vlt.CreateRecord({{"A", 0}});
+    vlt.CreateRecord({{"A", 1}});
+    vlt.GetRecord("A", 0, vrr1);
+
+    // Check set new data
+    vor = vrr1.SetData("A", 2);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    // Check set same data
+    vor = vrr1.SetData("A", 2);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    COMPARE_VAULT(vlt, {{{"A", 2}}, {{"A", 1}}});
+
+    // Check that old value is free
+    vor = vlt.GetRecord("A", 0, vrr2);
+    TEST_ASSERT(vor.ResultCode == VaultOperationResultCode::WrongValue);
+
+    vlt.GetRecord("A", 2, vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+)
+
+TEST_BODY(SetDataByKeyAndValue, SameKeyValue,
+    Vault vlt;
+    VaultRecordSet vrs1, vrs2;
+    VaultRecordRef vrr;
+
+    vlt.AddKey("A", false);
+    vlt.AddKey("B", 0);
+
+    for (int i = 0; i < 100; ++i) vlt.CreateRecord({{"B", i}});
+
+    vlt.RequestEqual("A", false, vrs1);
+
+    // Change half of records, all other records with same A value must stay in both structures
+    for (int i = 0; i < 50; ++i)
+    {
+        vlt.GetRecord("B", i, vrr);
+        vrr.SetData("A", true);
+    }
+
+    vlt.RequestEqual("A", false, vrs2);
+    TEST_ASSERT(vrs2.Size() == 50);
+
+    vlt.RequestGreater("A", false, vrs2);
+    TEST_ASSERT(vrs2.Size() == 50);
+
+    // Check dependent set
+    TEST_ASSERT(vrs1.Size() == 100);
+    vrs1.RequestEqual("A", true, vrs2);
+    TEST_ASSERT(vrs2.Size() == 50);
+
+    vrs1.RequestLess("A", true, vrs2);
+    TEST_ASSERT(vrs2.Size() == 50);
+)
+
+TEST_BODY(SetDataByKeyAndValue, MoveData,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultRecordRef vrr1, vrr2;
+    VaultOperationResult vor;
+    KeyHandle<std::string> keyHandle;
+    std::string longValue(1000, 'a');
+    std::string value;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey<std::string>("B", "");
+    vlt.GetKeyHandle("B", keyHandle);
+
+    vlt.CreateRecord(vrr1, {{"A", 1}});
+    vlt.Request(Equal("A", 1), vrs);
+
+    vor = vrr1.SetData("B", std::string(longValue));
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(std::string));
+
+    vrr1.GetData("B", value);
+    TEST_ASSERT(value == longValue);
+
+    // Indexes of Vault and dependent set get the value before it is moved to the record
+    vlt.GetRecord("B", longValue, vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+
+    vrs.GetRecord("B", longValue, vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+
+    vor = vrr1.SetData(keyHandle, std::string(longValue + "b"));
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(std::string));
+
+    vrs.GetRecord("B", longValue + "b", vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+
+    // Lvalue is copied
+    vrr1.SetData("B", longValue);
+    TEST_ASSERT(longValue.size() == 1000);
+
+    vlt.GetRecord("B", longValue, vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+)
+
+TEST_BODY(SetDataByKeyHandle, Default,
+    Vault vlt;
+    VaultRecordSet vrs1, vrs2;
+    VaultRecordRef vrr1, vrr2, vrr3, vrr4;
+    KeyHandle<int> handle;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.CreateRecord({{"A", -10}});
+    vlt.GetRecord("A", -10, vrr1);
+    vlt.GetKeyHandle("A", handle);
+
+    // Check set data
+    vor = vrr1.SetData(handle, 1);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    
+    // Check get record
+    vlt.GetRecord("A", 1, vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+
+    // Check hash table request
+    vlt.RequestEqual("A", 1, vrs1);
+    vrs1.GetRecord("A", 1, vrr3);
+    TEST_ASSERT(vrr1 == vrr3);
+
+    // Check map request
+    vlt.RequestGreater("A", 0, vrs2);
+    vrs2.GetRecord("A", 1, vrr4);
+    TEST_ASSERT(vrr1 == vrr4);
+)
+
+TEST_BODY(SetDataByKeyHandle, InvalidHandle,
+    Vault vlt;
+    VaultRecordRef vrr;
+    KeyHandle<int> handle;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+    vlt.CreateRecord({{"A", -10}});
+    vlt.GetRecord("A", -10, vrr);
+
+    // Check empty handle
+    vor = vrr.SetData(handle, 1);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+
+    // Check handle after key removing
+    vlt.GetKeyHandle("A", handle);
+    vlt.RemoveKey("B");
+
+    vor = vrr.SetData(handle, 1);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+
+    COMPARE_VAULT(vlt, {{{"A", -10}}});
+)
+
+TEST_BODY(SetDataByKeyHandle, DuplicateUniqueKeyValue,
+    Vault vlt;
+    VaultRecordRef vrr;
+    KeyHandle<int> handle;
+    VaultOperationResult vor;
+
+    vlt.AddUniqueKey<int>("A");
+    vlt.CreateRecord({{"A", 0}});
+    vlt.CreateRecord({{"A", 1}});
+    vlt.GetRecord("A", 0, vrr);
+    vlt.GetKeyHandle("A", handle);
+
+    // Check set data
+    vor = vrr.SetData(handle, 1);
+
+    COMPARE_VAULT(vlt, {{{"A", 0}}, {{"A", 1}}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(int));
+)
+
 TEST_BODY(SetDataByVectorOfParams, Default,
     Vault vlt;
     VaultRecordSet vrs1, vrs2;
@@ -502,15 +690,15 @@ TEST_BODY(SetDataByVectorOfParams, WrongSecondKey,
         RequestedType == typeid(int64_t), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
     
     // Check get record
-    vlt.GetRecord("A", 1, vrr2);
+    vlt.GetRecord("A", 10, vrr2);
     TEST_ASSERT(vrr1 == vrr2);
 
     vlt.GetRecord("B", int64_t(-10), vrr3);
     TEST_ASSERT(vrr1 == vrr3);
 
     // Check hash table request
-    vlt.RequestEqual("A", 1, vrs1);
-    vrs1.GetRecord("A", 1, vrr4);
+    vlt.RequestEqual("A", 10, vrs1);
+    vrs1.GetRecord("A", 10, vrr4);
     TEST_ASSERT(vrr1 == vrr4);
 
     vlt.RequestEqual("B", int64_t(-10), vrs1);
@@ -519,7 +707,7 @@ TEST_BODY(SetDataByVectorOfParams, WrongSecondKey,
 
     // Check map request
     vlt.RequestGreater("A", 0, vrs2);
-    vrs2.GetRecord("A", 1, vrr6);
+    vrs2.GetRecord("A", 10, vrr6);
     TEST_ASSERT(vrr1 == vrr6);
 
     vlt.RequestLess("B", int64_t(0), vrs2);
@@ -634,15 +822,15 @@ TEST_BODY(SetDataByVectorOfParams, WrongTypeOnSecondKey,
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int64_t));
     
     // Check get record
-    vlt.GetRecord("A", 1, vrr2);
+    vlt.GetRecord("A", 10, vrr2);
     TEST_ASSERT(vrr1 == vrr2);
 
     vlt.GetRecord("B", int64_t(-10), vrr3);
     TEST_ASSERT(vrr1 == vrr3);
 
     // Check hash table request
-    vlt.RequestEqual("A", 1, vrs1);
-    vrs1.GetRecord("A", 1, vrr4);
+    vlt.RequestEqual("A", 10, vrs1);
+    vrs1.GetRecord("A", 10, vrr4);
     TEST_ASSERT(vrr1 == vrr4);
 
     vlt.RequestEqual("B", int64_t(-10), vrs1);
@@ -651,7 +839,7 @@ TEST_BODY(SetDataByVectorOfParams, WrongTypeOnSecondKey,
 
     // Check map request
     vlt.RequestGreater("A", 0, vrs2);
-    vrs2.GetRecord("A", 1, vrr6);
+    vrs2.GetRecord("A", 10, vrr6);
     TEST_ASSERT(vrr1 == vrr6);
 
     vlt.RequestLess("B", int64_t(0), vrs2);
@@ -703,6 +891,138 @@ TEST_BODY(SetDataByVectorOfParams, WrongTypeOnBothKeys,
     TEST_ASSERT(vrr1 == vrr7);
 )
 
+TEST_BODY(SetDataByVectorOfParams, DuplicateUniqueKeyValueOnSecondKey,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultRecordRef vrr1, vrr2;
+    VaultOperationResult vor;
+    int a = 0;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<int64_t>("B");
+
+    vlt.CreateRecord({{"A", 10}, {"B", int64_t(-10)}});
+    vlt.CreateRecord({{"A", 20}, {"B", int64_t(-20)}});
+    vlt.GetRecord("A", 10, vrr1);
+    vlt.Request(Equal("A", 10), vrs);
+
+    // Check set data
+    vor = vrr1.SetData({{"A", 1}, {"B", int64_t(-20)}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B",
+        RequestedType == typeid(int64_t), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(int64_t));
+
+    // Check that the first key was not changed
+    vrr1.GetData("A", a);
+    TEST_ASSERT(a == 10);
+
+    vlt.GetRecord("A", 10, vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+
+    vlt.GetRecord("B", int64_t(-10), vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+
+    TEST_ASSERT(vlt.GetRecord("A", 1, vrr2).ResultCode == VaultOperationResultCode::WrongValue);
+
+    vrs.GetRecord("A", 10, vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+
+    vrs.GetRecord("B", int64_t(-10), vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+
+    // Unique key still works after rollback
+    vor = vrr1.SetData({{"A", 1}, {"B", int64_t(-1)}});
+    TEST_ASSERT(vor.IsOperationSuccess == true);
+
+    vlt.GetRecord("B", int64_t(-1), vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+
+    TEST_ASSERT(vlt.GetRecord("B", int64_t(-10), vrr2).ResultCode == VaultOperationResultCode::WrongValue);
+)
+
+TEST_BODY(SetDataByVectorOfParams, DependentStructures,
+    Vault vlt;
+    VaultRecordSet vrs1, vrs2;
+    VaultRecordRef vrr1, vrr2;
+    VaultOperationResult vor;
+    VaultGroup<int> group;
+    std::vector<std::string> keys = {"A", "B"};
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey<std::string>("B", "");
+    vlt.AddKey("C", 0);
+    vlt.AddCompositeIndex(keys);
+    vlt.AddGroupBy<std::string, int>("B", "C");
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", std::string("b")}, {"C", i}});
+
+    vlt.GetRecord("A", 5, vrr1);
+    vlt.Request(GreaterOrEqual("A", 5), vrs1);
+
+    // Same key in params is set to the last value
+    vor = vrr1.SetData({{"A", 50}, {"B", std::string("c")}, {"C", 7}, {"A", 100}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    // Check dependent set
+    vrs1.GetRecord("A", 100, vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+
+    vrs1.GetRecord("B", std::string("c"), vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+
+    TEST_ASSERT(vrs1.GetRecord("A", 5, vrr2).ResultCode == VaultOperationResultCode::WrongValue);
+
+    // Check composite index
+    vlt.Request(Equal("A", 100) && Equal("B", std::string("c")), vrs2);
+    TEST_ASSERT(vrs2.Size() == 1);
+
+    vlt.Request(Equal("A", 5) && Equal("B", std::string("b")), vrs2);
+    TEST_ASSERT(vrs2.Size() == 0);
+
+    // Check group aggregate
+    vlt.GetGroup("B", "C", std::string("c"), group);
+    TEST_ASSERT(group.Count == 1 && group.Sum == 7);
+
+    vlt.GetGroup("B", "C", std::string("b"), group);
+    TEST_ASSERT(group.Count == 9 && group.Sum == 40);
+)
+
+TEST_BODY(SetDataByVectorOfParams, MoveParams,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultRecordRef vrr1, vrr2;
+    VaultOperationResult vor;
+    std::vector<std::pair<std::string, VaultParamInput>> params;
+    std::string longValue(1000, 'a');
+    std::string value;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord(vrr1, {{"A", 1}, {"B", std::string("b")}});
+    vlt.Request(Equal("A", 1), vrs);
+
+    params.emplace_back("A", 2);
+    params.emplace_back("B", std::string(longValue));
+
+    vor = vrr1.SetData(std::move(params));
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(std::string));
+
+    vrr1.GetData("B", value);
+    TEST_ASSERT(value == longValue);
+
+    vlt.GetRecord("B", longValue, vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+
+    vrs.GetRecord("A", 2, vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+
+    vrs.GetRecord("B", longValue, vrr2);
+    TEST_ASSERT(vrr1 == vrr2);
+)
+
 TEST_BODY(GetData, Invalid,
     VaultRecordRef vrr;
     VaultOperationResult vor;
@@ -820,6 +1140,64 @@ TEST_BODY(GetData, WrongType,
     TEST_ASSERT(s.empty());
 )
 
+TEST_BODY(GetDataByKeyHandle, Default,
+    Vault vlt;
+    VaultRecordRef vrr;
+    KeyHandle<int> handleA;
+    KeyHandle<std::string> handleB;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", -1);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("b")}});
+    vlt.GetRecord("A", 1, vrr);
+    vlt.GetKeyHandle("A", handleA);
+    vlt.GetKeyHandle("B", handleB);
+
+    int a = 0;
+    std::string b;
+
+    // Get A
+    vor = vrr.GetData(handleA, a);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    TEST_ASSERT(a == 1);
+
+    // Get B
+    vor = vrr.GetData(handleB, b);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(std::string));
+
+    TEST_ASSERT(b == "b");
+)
+
+TEST_BODY(GetDataByKeyHandle, InvalidHandle,
+    Vault vlt1, vlt2;
+    VaultRecordRef vrr;
+    KeyHandle<int> handle;
+    VaultOperationResult vor;
+
+    vlt1.AddKey("A", -1);
+    vlt2.AddKey("A", -1);
+
+    vlt1.CreateRecord({{"A", 1}});
+    vlt1.GetRecord("A", 1, vrr);
+    vlt2.GetKeyHandle("A", handle);
+
+    int a = 0;
+
+    vor = vrr.GetData(handle, a);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+
+    TEST_ASSERT(a == 0);
+)
+
 TEST_BODY(GetDataAsString, Invalid,
     VaultRecordRef vrr;
     VaultOperationResult vor;
@@ -95,6 +95,21 @@ namespace VaultRecordRefTestNs
         TEST_CASE(WrongType)
 
         TEST_CASE(DuplicateUniqueKeyValue)
+
+        TEST_CASE(UniqueKeyNewValue)
+
+        TEST_CASE(SameKeyValue)
+
+        TEST_CASE(MoveData)
+    )
+
+    TEST_SUITE(SetDataByKeyHandle,
+
+        TEST_CASE(Default)
+
+        TEST_CASE(InvalidHandle)
+
+        TEST_CASE(DuplicateUniqueKeyValue)
     )
 
     TEST_SUITE(SetDataByVectorOfParams,
@@ -112,6 +127,12 @@ namespace VaultRecordRefTestNs
         TEST_CASE(WrongTypeOnSecondKey)
 
         TEST_CASE(WrongTypeOnBothKeys)
+
+        TEST_CASE(DuplicateUniqueKeyValueOnSecondKey)
+
+        TEST_CASE(DependentStructures)
+
+        TEST_CASE(MoveParams)
     )
 
     TEST_SUITE(GetData,
@@ -127,6 +148,13 @@ namespace VaultRecordRefTestNs
         TEST_CASE(WrongType)
     )
 
+    TEST_SUITE(GetDataByKeyHandle,
+
+        TEST_CASE(Default)
+
+        TEST_CASE(InvalidHandle)
+    )
+
     TEST_SUITE(GetDataAsString,
 
         TEST_CASE(Invalid)
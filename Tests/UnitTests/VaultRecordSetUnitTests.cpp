@@ -3777,6 +3777,146 @@ TEST_BODY(Request, Self,
         RequestedType == typeid(void), ResultCode == VaultOperationResultCode::ParentVaultNotValid, SavedType == typeid(void));
  )
 
+TEST_BODY(Scan, CorrectScan,
+    Vault vlt;
+    GENERATE_SET(parentVrs);
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+    std::vector<int> found;
+
+    vlt.AddKey("A", 0);
+
+    // Only even records are in the set
+    for (int i = 0; i < 10; ++i) 
+    {
+        vlt.CreateRecord(vrr, {{"A", i}});
+        if (i % 2 == 0) parentVrs.AddRecord(vrr);
+    }
+
+    vor = parentVrs.Scan(Greater("A", 3), [&](const VaultRecordRef& ref)
+        {
+            int a = 0;
+            ref.GetData("A", a);
+            found.emplace_back(a);
+            return true;
+        });
+
+    std::vector<int> expected = {4, 6, 8};
+    TEST_ASSERT(found == expected);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+)
+
+TEST_BODY(Scan, InvalidParent,
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    std::size_t counter = 0;
+
+    vor = vrs.Scan(Equal("A", 2), [&](const VaultRecordRef&)
+        {
+            ++counter;
+            return true;
+        });
+
+    TEST_ASSERT(counter == 0);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::ParentVaultNotValid, SavedType == typeid(void));
+)
+
+TEST_BODY(Count, CorrectCount,
+    Vault vlt;
+    GENERATE_SET(parentVrs);
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+    std::size_t count = 0;
+
+    vlt.AddKey("A", 0);
+
+    // Only even records are in the set
+    for (int i = 0; i < 10; ++i) 
+    {
+        vlt.CreateRecord(vrr, {{"A", i}});
+        if (i % 2 == 0) parentVrs.AddRecord(vrr);
+    }
+
+    vor = parentVrs.Count(Greater("A", 3), count);
+    TEST_ASSERT(count == 3);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+)
+
+TEST_BODY(Count, InvalidParent,
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    std::size_t count = 7;
+
+    vor = vrs.Count(Equal("A", 2), count);
+    TEST_ASSERT(count == 7);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::ParentVaultNotValid, SavedType == typeid(void));
+)
+
+TEST_BODY(Aggregates, CorrectAggregates,
+    Vault vlt;
+    GENERATE_SET(parentVrs);
+    VaultRecordRef vrr;
+    int value = 0;
+    double avg = 0;
+
+    vlt.AddKey("A", 0);
+
+    // Only even records are in the set
+    for (int i = 0; i < 10; ++i) 
+    {
+        vlt.CreateRecord(vrr, {{"A", i}});
+        if (i % 2 == 0) parentVrs.AddRecord(vrr);
+    }
+
+    parentVrs.Min("A", value);
+    TEST_ASSERT(value == 0);
+
+    parentVrs.Min("A", Greater("A", 3), value);
+    TEST_ASSERT(value == 4);
+
+    parentVrs.Max("A", value);
+    TEST_ASSERT(value == 8);
+
+    parentVrs.Max("A", Less("A", 5), value);
+    TEST_ASSERT(value == 4);
+
+    parentVrs.Sum("A", value);
+    TEST_ASSERT(value == 20);
+
+    parentVrs.Sum("A", Less("A", 5), value);
+    TEST_ASSERT(value == 6);
+
+    parentVrs.Avg<int>("A", avg);
+    TEST_ASSERT(avg == 4.0);
+
+    parentVrs.Avg<int>("A", Greater("A", 3), avg);
+    TEST_ASSERT(avg == 6.0);
+)
+
+TEST_BODY(Aggregates, InvalidParent,
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    int value = -1;
+
+    vor = vrs.Max("A", value);
+    TEST_ASSERT(value == -1);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::ParentVaultNotValid, SavedType == typeid(void));
+
+    vor = vrs.Sum("A", Less("A", 5), value);
+    TEST_ASSERT(value == -1);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::ParentVaultNotValid, SavedType == typeid(void));
+)
+
 TEST_BODY(CheckRecord, InvalidSet,
     VaultRecordSet vrs;
     VaultRecordRef vrr;
@@ -4469,6 +4609,188 @@ TEST_BODY(SortBy, WrongKey,
     TEST_ASSERT(counter == 0);
 )
 
+TEST_BODY(GetSortedPage, Invalid,
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    VaultPageCursor<int> cursor;
+    std::vector<VaultRecordRef> page;
+
+    vor = vrs.GetSortedPage("A", cursor, 5, page);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::ParentVaultNotValid, SavedType == typeid(void));
+
+    TEST_ASSERT(vrs.GetTopRecords("A", 5).empty());
+)
+
+TEST_BODY(GetSortedPage, AllPages,
+    Vault vlt;
+    GENERATE_SET(vrs);
+    VaultRecordRef vrf;
+    VaultPageCursor<int> cursor;
+    std::vector<VaultRecordRef> page;
+    std::vector<int> values;
+
+    vlt.AddKey("A", 0);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        vlt.CreateRecord(vrf, {{"A", i}});
+        if (i % 2 == 1) vrs.AddRecord(vrf);
+    }
+
+    do
+    {
+        vrs.GetSortedPage("A", cursor, 15, page, true);
+
+        for (const VaultRecordRef& ref : page)
+        {
+            int a = -1;
+            ref.GetData("A", a);
+            values.emplace_back(a);
+        }
+    } while (page.size() == 15);
+
+    TEST_ASSERT(values.size() == 50);
+    for (std::size_t i = 0; i < values.size(); ++i)
+        TEST_ASSERT(values[i] == 99 - static_cast<int>(i) * 2);
+
+    std::vector<VaultRecordRef> records = vrs.GetTopRecords("A", 3);
+    TEST_ASSERT(records.size() == 3);
+)
+
+TEST_BODY(LazyIndex, RequestAfterChanges,
+    Vault vlt;
+    GENERATE_SET(vrs);
+    VaultRecordSet res;
+    VaultRecordRef vrf;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        vlt.CreateRecord(vrf, {{"A", i}, {"B", i % 2}});
+        vrs.AddRecord(vrf);
+    }
+
+    // Change data before the first request with the key
+    vrs.GetRecord("A", 3, vrf);
+    vrf.SetData("B", 5);
+
+    vor = vrs.RequestEqual("B", 5, res);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    TEST_ASSERT(res.Size() == 1);
+
+    // Change data after the key indexes were filled
+    vrs.GetRecord("A", 4, vrf);
+    vrf.SetData("B", 5);
+
+    vrs.RequestEqual("B", 5, res);
+    TEST_ASSERT(res.Size() == 2);
+
+    vrs.RequestGreater("B", 0, res);
+    TEST_ASSERT(res.Size() == 6);
+
+    vlt.EraseRecord("A", 3);
+    vrs.RequestEqual("B", 5, res);
+    TEST_ASSERT(res.Size() == 1);
+)
+
+TEST_BODY(LazyIndex, SortAfterChanges,
+    Vault vlt;
+    GENERATE_SET(vrs);
+    VaultRecordRef vrf;
+
+    vlt.AddKey("A", 0);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        vlt.CreateRecord(vrf, {{"A", i}});
+        vrs.AddRecord(vrf);
+    }
+
+    vrs.GetRecord("A", 0, vrf);
+    vrf.SetData("A", 20);
+
+    std::vector<VaultRecordRef> records = vrs.GetSortedRecords("A", true);
+    TEST_ASSERT(records.size() == 10);
+
+    int a = -1;
+    records.front().GetData("A", a);
+    TEST_ASSERT(a == 20);
+
+    vrf.SetData("A", -1);
+    vlt.CreateRecord(vrf, {{"A", 30}});
+    vrs.AddRecord(vrf);
+
+    records = vrs.GetSortedRecords("A");
+    TEST_ASSERT(records.size() == 11);
+
+    records.front().GetData("A", a);
+    TEST_ASSERT(a == -1);
+    records.back().GetData("A", a);
+    TEST_ASSERT(a == 30);
+)
+
+TEST_BODY(LazyIndex, CopyAndClear,
+    Vault vlt;
+    GENERATE_SET(vrs);
+    VaultRecordRef vrf;
+
+    vlt.AddKey("A", 0);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        vlt.CreateRecord(vrf, {{"A", i}});
+        vrs.AddRecord(vrf);
+    }
+
+    // Fill the key indexes of the set and copy it
+    TEST_ASSERT(vrs.GetRecord("A", 5, vrf).IsOperationSuccess);
+
+    VaultRecordSet copy = vrs;
+    TEST_ASSERT(copy.GetRecord("A", 5, vrf).IsOperationSuccess);
+    TEST_ASSERT(copy.GetSortedRecords("A").size() == 10);
+
+    copy.Clear();
+    TEST_ASSERT(!copy.GetRecord("A", 5, vrf).IsOperationSuccess);
+
+    vlt.GetRecord("A", 7, vrf);
+    copy.AddRecord(vrf);
+    TEST_ASSERT(copy.GetRecord("A", 7, vrf).IsOperationSuccess);
+    TEST_ASSERT(copy.Size() == 1);
+)
+
+TEST_BODY(LazyIndex, UniqueKey,
+    Vault vlt;
+    GENERATE_SET(vrs);
+    VaultRecordRef vrf;
+    VaultOperationResult vor;
+
+    vlt.AddUniqueKey<int>("A");
+
+    for (int i = 0; i < 10; ++i)
+    {
+        vlt.CreateRecord(vrf, {{"A", i}});
+        vrs.AddRecord(vrf);
+    }
+
+    vor = vrs.GetRecord("A", 5, vrf);
+    TEST_ASSERT(vor.IsOperationSuccess);
+
+    // Uniqueness is still checked by the parent Vault
+    vor = vrf.SetData("A", 6);
+    TEST_ASSERT(!vor.IsOperationSuccess);
+
+    vor = vrf.SetData("A", 16);
+    TEST_ASSERT(vor.IsOperationSuccess);
+
+    TEST_ASSERT(vrs.GetRecord("A", 16, vrf).IsOperationSuccess);
+    TEST_ASSERT(!vrs.GetRecord("A", 5, vrf).IsOperationSuccess);
+)
+
 TEST_BODY(ToJson, Invalid,
     VaultRecordSet vrs;
     TEST_ASSERT(vrs.ToJson() == "{}");
@@ -5043,6 +5365,37 @@ TEST_BODY(Join, JoinFilled,
         RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 )
 
+TEST_BODY(Join, ChangesAfterJoin,
+    Vault vlt;
+    GENERATE_SET(vrs1);
+    GENERATE_SET(vrs2);
+    VaultRecordRef vrf;
+
+    vlt.AddKey("A", 0);
+
+    vlt.CreateRecord(vrf, {{"A", 1}});
+    vrs1.AddRecord(vrf);
+    vlt.CreateRecord(vrf, {{"A", 2}});
+    vrs2.AddRecord(vrf);
+    vlt.CreateRecord(vrf, {{"A", 3}});
+    vrs2.AddRecord(vrf);
+
+    vrs1.Join(vrs2);
+    TEST_ASSERT(vrs1.Size() == 3);
+
+    // Records added by join follow the changes in the parent Vault
+    vrf.SetData("A", 30);
+    TEST_ASSERT(vrs1.GetRecord("A", 30, vrf).IsOperationSuccess);
+
+    vlt.EraseRecord("A", 2);
+    TEST_ASSERT(vrs1.Size() == 2);
+
+    COMPARE_VAULT(vrs1, {
+        {{"A", 1}},
+        {{"A", 30}}
+    });
+)
+
 TEST_BODY(Join, WrongParentVault,
     Vault vlt1, vlt2;
     VaultRecordSet vrs1, vrs2;
@@ -5854,6 +6207,94 @@ TEST_BODY(IntersectionSets, Filled,
     TEST_ASSERT(vrs3.Size() == 1);
 )
 
+TEST_BODY(IntersectionSets, ChangesAfterIntersection,
+    Vault vlt;
+    GENERATE_SET(vrs1);
+    GENERATE_SET(vrs2);
+    VaultRecordSet vrs3;
+    VaultRecordRef vrf;
+
+    vlt.AddKey("A", 0);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        vlt.CreateRecord(vrf, {{"A", i}});
+        vrs1.AddRecord(vrf);
+        if (i % 2 == 0) vrs2.AddRecord(vrf);
+    }
+
+    Intersection(vrs1, vrs2, vrs3);
+    TEST_ASSERT(vrs3.Size() == 5);
+
+    // Records of the intersection follow the changes in the parent Vault
+    vlt.GetRecord("A", 4, vrf);
+    vrf.SetData("A", 40);
+    TEST_ASSERT(vrs3.GetRecord("A", 40, vrf).IsOperationSuccess);
+
+    vlt.EraseRecord("A", 40);
+    TEST_ASSERT(vrs3.Size() == 4);
+
+    // Exclude the smaller set
+    vrs1.Exclude(vrs3);
+    TEST_ASSERT(vrs1.Size() == 5);
+    TEST_ASSERT(!vrs1.GetRecord("A", 2, vrf).IsOperationSuccess);
+    TEST_ASSERT(vrs1.GetRecord("A", 3, vrf).IsOperationSuccess);
+)
+
+TEST_BODY(IntersectionSets, ManyRecords,
+    Vault vlt;
+    VaultRecordSet vrs1, vrs2, vrs3, vrs4;
+    VaultRecordRef vrf;
+
+    vlt.AddKey("A", 0);
+
+    // Records take rows of several bitmap blocks
+    for (int i = 0; i < 10000; ++i)
+        vlt.CreateRecord({{"A", i}});
+
+    vlt.Request(Less("A", 6000), vrs1);
+    vlt.Request(GreaterOrEqual("A", 3000), vrs2);
+
+    Intersection(vrs1, vrs2, vrs3);
+    TEST_ASSERT(vrs3.Size() == 3000);
+    TEST_ASSERT(vrs3.GetRecord("A", 3000, vrf).IsOperationSuccess);
+    TEST_ASSERT(!vrs3.GetRecord("A", 2999, vrf).IsOperationSuccess);
+
+    Union(vrs1, vrs2, vrs4);
+    TEST_ASSERT(vrs4.Size() == 10000);
+
+    vlt.Request(GreaterOrEqual("A", 0), vrs3);
+    TEST_ASSERT(vrs3 == vrs4);
+
+    vrs1.Exclude(vrs2);
+    TEST_ASSERT(vrs1.Size() == 3000);
+    TEST_ASSERT(!vrs1.GetRecord("A", 3000, vrf).IsOperationSuccess);
+
+    vrs2.Intersect(vrs1);
+    TEST_ASSERT(vrs2.Size() == 0);
+
+    // Erased records leave all sets, and their rows are reused by new records which are not in the sets
+    for (int i = 0; i < 10000; i += 2)
+        vlt.EraseRecord("A", i);
+
+    for (int i = 0; i < 5000; ++i)
+        vlt.CreateRecord({{"A", -1}});
+
+    TEST_ASSERT(vrs1.Size() == 1500);
+    TEST_ASSERT(vrs4.Size() == 5000);
+    TEST_ASSERT(!vrs4.GetRecord("A", -1, vrf).IsOperationSuccess);
+
+    std::size_t counter = 0;
+    int a = 0;
+    for (const VaultRecordRef& ref : vrs4.GetSortedRecords("A"))
+    {
+        ref.GetData("A", a);
+        if (a % 2 == 0) break;
+        ++counter;
+    }
+    TEST_ASSERT(counter == 5000);
+)
+
 TEST_BODY(IntersectionSets, DifferentParents,
     Vault vlt1, vlt2;
     VaultRecordSet vrs1, vrs2, vrs3;
@@ -318,6 +318,27 @@ namespace VaultRecordSetTestNs
         TEST_CASE(InvalidParent)
     )
 
+    TEST_SUITE(Scan,
+
+        TEST_CASE(CorrectScan)
+
+        TEST_CASE(InvalidParent)
+    )
+
+    TEST_SUITE(Count,
+
+        TEST_CASE(CorrectCount)
+
+        TEST_CASE(InvalidParent)
+    )
+
+    TEST_SUITE(Aggregates,
+
+        TEST_CASE(CorrectAggregates)
+
+        TEST_CASE(InvalidParent)
+    )
+
     TEST_SUITE(CheckRecord,
         
         TEST_CASE(InvalidSet)
@@ -437,6 +458,24 @@ namespace VaultRecordSetTestNs
         TEST_CASE(WrongKey)
     )
 
+    TEST_SUITE(GetSortedPage,
+
+        TEST_CASE(Invalid)
+
+        TEST_CASE(AllPages)
+    )
+
+    TEST_SUITE(LazyIndex,
+
+        TEST_CASE(RequestAfterChanges)
+
+        TEST_CASE(SortAfterChanges)
+
+        TEST_CASE(CopyAndClear)
+
+        TEST_CASE(UniqueKey)
+    )
+
     TEST_SUITE(ToJson,
 
         TEST_CASE(Invalid)
@@ -504,6 +543,8 @@ namespace VaultRecordSetTestNs
 
         TEST_CASE(JoinFilled)
 
+        TEST_CASE(ChangesAfterJoin)
+
         TEST_CASE(WrongParentVault)
 
         TEST_CASE(Self)
@@ -632,6 +673,10 @@ namespace VaultRecordSetTestNs
 
         TEST_CASE(Filled)
 
+        TEST_CASE(ChangesAfterIntersection)
+
+        TEST_CASE(ManyRecords)
+
         TEST_CASE(DifferentParents)
 
         TEST_CASE(RewriteTarget)
@@ -89,6 +89,57 @@ TEST_BODY(CopyConstructor, CopyFilledVault,
         {{"A", 3}, {"B",  std::string("c")}},
     });
 )
+TEST_BODY(CopyConstructor, CopyCompositeIndexes,
+    Vault vlt1;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
+    std::vector<std::string> keys = {"A", "B"};
+
+    vlt1.AddKey("A", 0);
+    vlt1.AddKey("B", 0);
+    vlt1.AddCompositeIndex(keys);
+
+    for (int i = 0; i < 10; ++i) vlt1.CreateRecord({{"A", i % 2}, {"B", i}});
+
+    Vault vlt(vlt1);
+    vlt1.DropData();
+
+    TEST_ASSERT(vlt.IsCompositeIndexExist(keys));
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 1) && Equal("B", 3), {{{"A", 1}, {"B", 3}}});
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 0) && Greater("B", 5), {{{"A", 0}, {"B", 6}}, {{"A", 0}, {"B", 8}}});
+)
+
+TEST_BODY(CopyConstructor, CopyGroupAggregates,
+    Vault vlt1;
+    std::unordered_map<std::string, VaultGroup<long long>> groups;
+
+    vlt1.AddKey<std::string>("host", "");
+    vlt1.AddKey<long long>("bytes", 0);
+    vlt1.AddGroupBy<std::string, long long>("host", "bytes");
+
+    for (long long i = 0; i < 10; ++i) vlt1.CreateRecord({{"host", std::string(i % 2 == 0 ? "a" : "b")}, {"bytes", i}});
+
+    Vault vlt(vlt1);
+    vlt1.DropData();
+
+    TEST_ASSERT(vlt.IsGroupByExist("host", "bytes"));
+
+    vlt.GetGroups("host", "bytes", groups);
+    TEST_ASSERT(groups.size() == 2);
+    TEST_ASSERT(groups["a"].Count == 5 && groups["a"].Sum == 20);
+    TEST_ASSERT(groups["b"].Count == 5 && groups["b"].Sum == 25);
+
+    vlt.EraseRecord("bytes", 9LL);
+    vlt.GetGroups("host", "bytes", groups);
+    TEST_ASSERT(groups["b"].Count == 4 && groups["b"].Sum == 16);
+
+    vlt1.GetGroups("host", "bytes", groups);
+    TEST_ASSERT(groups.empty());
+)
+
 
 TEST_BODY(AssignmentOperator, AssignEmptyVault,
     Vault vlt1;
@@ -355,6 +406,175 @@ TEST_BODY(AddKey, IncorrectAddKeyWithDependentSets,
     });
 )
 
+TEST_BODY(AddKey, HashOnlyIndexPolicy,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultRecordRef vrr;
+    std::vector<VaultRecordRef> refs;
+
+    TEST_ASSERT(vlt.AddKey("A", 0, VaultIndexPolicy::HashOnly));
+    vlt.AddKey("B", 0);
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i % 5}, {"B", i}});
+
+    // Check equality requests
+    vlt.GetRecords("A", 2, refs);
+    TEST_ASSERT(refs.size() == 2);
+
+    vlt.RequestEqual("A", 2, vrs);
+    TEST_ASSERT(vrs.Size() == 2);
+
+    // Check range requests
+    vlt.RequestGreater("A", 2, vrs);
+    TEST_ASSERT(vrs.Size() == 4);
+
+    vlt.RequestInterval("A", 1, 3, vrs, true, false);
+    TEST_ASSERT(vrs.Size() == 4);
+
+    // Check sorting
+    refs = vlt.GetSortedRecords("A", true);
+    TEST_ASSERT(refs.size() == 10);
+
+    for (std::size_t i = 0; i < refs.size(); ++i)
+    {
+        int a = 0;
+        refs[i].GetData("A", a);
+        TEST_ASSERT(a == 4 - static_cast<int>(i / 2));
+    }
+
+    // Check update and erase
+    vlt.GetRecord("B", 0, vrr);
+    vrr.SetData("A", 10);
+    vlt.EraseRecord("A", 4);
+
+    vlt.RequestLessOrEqual("A", 4, vrs);
+    TEST_ASSERT(vrs.Size() == 8);
+
+    vlt.RequestEqual("A", 10, vrs);
+    TEST_ASSERT(vrs.Size() == 1);
+)
+
+TEST_BODY(AddKey, OrderedOnlyIndexPolicy,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultRecordRef vrr;
+    std::vector<VaultRecordRef> refs;
+
+    TEST_ASSERT(vlt.AddKey("A", 0, VaultIndexPolicy::OrderedOnly));
+    vlt.AddKey("B", 0);
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i % 5}, {"B", i}});
+
+    // Check equality requests
+    vlt.GetRecords("A", 2, refs);
+    TEST_ASSERT(refs.size() == 2);
+
+    vlt.RequestEqual("A", 2, vrs);
+    TEST_ASSERT(vrs.Size() == 2);
+
+    // Check range requests
+    vlt.RequestGreater("A", 2, vrs);
+    TEST_ASSERT(vrs.Size() == 4);
+
+    vlt.RequestInterval("A", 1, 3, vrs, true, false);
+    TEST_ASSERT(vrs.Size() == 4);
+
+    // Check sorting
+    refs = vlt.GetSortedRecords("A", true);
+    TEST_ASSERT(refs.size() == 10);
+
+    for (std::size_t i = 0; i < refs.size(); ++i)
+    {
+        int a = 0;
+        refs[i].GetData("A", a);
+        TEST_ASSERT(a == 4 - static_cast<int>(i / 2));
+    }
+
+    // Check update and erase
+    vlt.GetRecord("B", 0, vrr);
+    vrr.SetData("A", 10);
+    vlt.EraseRecord("A", 4);
+
+    vlt.RequestLessOrEqual("A", 4, vrs);
+    TEST_ASSERT(vrs.Size() == 8);
+
+    vlt.RequestEqual("A", 10, vrs);
+    TEST_ASSERT(vrs.Size() == 1);
+)
+
+TEST_BODY(AddKey, NoneIndexPolicy,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultRecordRef vrr;
+    std::vector<VaultRecordRef> refs;
+
+    TEST_ASSERT(vlt.AddKey("A", 0, VaultIndexPolicy::None));
+    vlt.AddKey("B", 0);
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i % 5}, {"B", i}});
+
+    // Check equality requests
+    vlt.GetRecords("A", 2, refs);
+    TEST_ASSERT(refs.size() == 2);
+
+    vlt.RequestEqual("A", 2, vrs);
+    TEST_ASSERT(vrs.Size() == 2);
+
+    // Check range requests
+    vlt.RequestGreater("A", 2, vrs);
+    TEST_ASSERT(vrs.Size() == 4);
+
+    vlt.RequestInterval("A", 1, 3, vrs, true, false);
+    TEST_ASSERT(vrs.Size() == 4);
+
+    // Check sorting
+    refs = vlt.GetSortedRecords("A", true);
+    TEST_ASSERT(refs.size() == 10);
+
+    for (std::size_t i = 0; i < refs.size(); ++i)
+    {
+        int a = 0;
+        refs[i].GetData("A", a);
+        TEST_ASSERT(a == 4 - static_cast<int>(i / 2));
+    }
+
+    // Check update and erase
+    vlt.GetRecord("B", 0, vrr);
+    vrr.SetData("A", 10);
+    vlt.EraseRecord("A", 4);
+
+    vlt.RequestLessOrEqual("A", 4, vrs);
+    TEST_ASSERT(vrs.Size() == 8);
+
+    vlt.RequestEqual("A", 10, vrs);
+    TEST_ASSERT(vrs.Size() == 1);
+)
+
+TEST_BODY(AddKey, IndexPolicyWithDependentSets,
+    Vault vlt;
+    VaultRecordSet vrs1, vrs2;
+
+    vlt.AddKey("A", 0, VaultIndexPolicy::None);
+    vlt.AddKey("B", 0);
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
+
+    vlt.RequestEqual("B", 0, vrs1);
+
+    // Key added after set creation
+    vlt.AddKey("C", 1, VaultIndexPolicy::HashOnly);
+
+    // Check that requests to set work without key structures
+    vrs1.RequestLess("A", 5, vrs2);
+    TEST_ASSERT(vrs2.Size() == 5);
+
+    vrs1.RequestGreaterOrEqual("C", 1, vrs2);
+    TEST_ASSERT(vrs2.Size() == 10);
+
+    vrs1.RequestEqual("A", 9, vrs2);
+    COMPARE_VAULT(vrs2, {{{"A", 9}, {"B", 0}, {"C", 1}}});
+)
+
 TEST_BODY(AddUniqueKey, CorrectAddKeyToEmptyVault,
     Vault vlt;
     VaultOperationResult vor;
@@ -562,6 +782,38 @@ TEST_BODY(AddUniqueKey, CorrectAddKeyWithDependentSetsWithDuplicate,
         RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(void));
 )
 
+TEST_BODY(AddUniqueKey, IndexPolicy,
+    Vault vlt;
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+
+    // Unique key without structures is not allowed
+    vor = vlt.AddUniqueKey<int>("A", VaultIndexPolicy::None);
+
+    TEST_ASSERT(vlt.GetKeys().size() == 0);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::UniqueKeyWithoutIndex, SavedType == typeid(void));
+
+    // Unique values are checked using map
+    vor = vlt.AddUniqueKey<int>("A", VaultIndexPolicy::OrderedOnly);
+    TEST_ASSERT(vor.IsOperationSuccess);
+
+    vlt.CreateRecord({{"A", 1}});
+    vlt.CreateRecord({{"A", 2}});
+
+    vor = vlt.CreateRecord({{"A", 2}});
+    TEST_ASSERT(vor.ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet);
+
+    vlt.GetRecord("A", 1, vrr);
+    vor = vrr.SetData("A", 2);
+    TEST_ASSERT(vor.ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet);
+
+    vor = vrr.SetData("A", 3);
+    TEST_ASSERT(vor.IsOperationSuccess);
+
+    COMPARE_VAULT(vlt, {{{"A", 3}}, {{"A", 2}}});
+)
+
 TEST_BODY(UpdateKey, CorrectUpdateNonUniqueKey,
     Vault vlt;
     VaultOperationResult vor;
@@ -717,6 +969,115 @@ TEST_BODY(GetKeyType, NonExistingKey,
     TEST_ASSERT(type == typeid(void));
 )
 
+TEST_BODY(GetKeyHandle, CorrectHandle,
+    Vault vlt;
+    KeyHandle<int> handle;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+
+    vor = vlt.GetKeyHandle("A", handle);
+
+    TEST_ASSERT(handle.GetKey() == "A");
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(GetKeyHandle, WrongKey,
+    Vault vlt;
+    KeyHandle<int> handle;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+
+    vor = vlt.GetKeyHandle("Z", handle);
+
+    TEST_ASSERT(handle.GetKey() == "");
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+)
+
+TEST_BODY(GetKeyHandle, WrongType,
+    Vault vlt;
+    KeyHandle<std::string> handle;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+
+    vor = vlt.GetKeyHandle("A", handle);
+
+    TEST_ASSERT(handle.GetKey() == "");
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+)
+
+TEST_BODY(GetKeyHandle, InvalidAfterRemoveKey,
+    Vault vlt;
+    KeyHandle<int> handle;
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+    vlt.CreateRecord({{"A", 1}, {"B", 1}});
+
+    vlt.GetKeyHandle("A", handle);
+    vlt.RemoveKey("B");
+
+    vor = vlt.GetRecord(handle, 1, vrr);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+
+    vlt.GetKeyHandle("A", handle);
+    vor = vlt.GetRecord(handle, 1, vrr);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(GetKeyHandle, InvalidAfterDropVault,
+    Vault vlt;
+    KeyHandle<int> handle;
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.CreateRecord({{"A", 1}});
+
+    vlt.GetKeyHandle("A", handle);
+    vlt.DropVault();
+
+    vlt.AddKey("A", 0);
+    vlt.CreateRecord({{"A", 1}});
+
+    vor = vlt.GetRecord(handle, 1, vrr);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+)
+
+TEST_BODY(GetKeyHandle, WrongVault,
+    Vault vlt1, vlt2;
+    KeyHandle<int> handle;
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+
+    vlt1.AddKey("A", 0);
+    vlt2.AddKey("A", 0);
+    vlt2.CreateRecord({{"A", 1}});
+
+    vlt1.GetKeyHandle("A", handle);
+
+    vor = vlt2.GetRecord(handle, 1, vrr);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+)
+
 TEST_BODY(GetKeys, Keys,
     Vault vlt;
 
@@ -840,1211 +1201,1472 @@ TEST_BODY(RemoveKey, IncorrectRemoveFromNonEmptyVault,
     })
 )
 
-TEST_BODY(CreateRecord, CorrectParamsWithoutUniqueKey,
+TEST_BODY(RemoveKey, AddRemovedKeyWithOtherType,
     Vault vlt;
-    VaultRecordRef vrr;
-    VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
-    vlt.AddKey<std::string>("B", "none");
+    vlt.AddKey("B", 0);
 
-    vlt.CreateRecord({});
-    vlt.CreateRecord({});
-    vlt.CreateRecord({{"A", 2}});
-    vlt.CreateRecord({{"B", std::string("c")}});
-    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
-    vor = vlt.CreateRecord({{"B", std::string("e")}, {"A", 5}});
+    vlt.CreateRecord({{"A", 1}, {"B", 1}});
+    vlt.CreateRecord({{"A", 2}, {"B", 2}});
+
+    TEST_ASSERT(vlt.RemoveKey("B"));
+    TEST_ASSERT(vlt.AddKey<std::string>("B", "none"));
+
+    vlt.CreateRecord({{"A", 3}});
 
     COMPARE_VAULT(vlt, {
-        {{"A", 0}, {"B", std::string("none")}},
-        {{"A", 0}, {"B", std::string("none")}},
+        {{"A", 1}, {"B", std::string("none")}},
         {{"A", 2}, {"B", std::string("none")}},
-        {{"A", 0}, {"B", std::string("c")}},
-        {{"A", 4}, {"B", std::string("d")}},
-        {{"A", 5}, {"B", std::string("e")}},
+        {{"A", 3}, {"B", std::string("none")}},
     })
+)
+TEST_BODY(RemoveKey, RemoveKeyWithCompositeIndex,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
+    std::vector<std::string> keysAB = {"A", "B"};
+    std::vector<std::string> keysBC = {"B", "C"};
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+    vlt.AddKey("C", 0);
+    vlt.AddCompositeIndex(keysAB);
+    vlt.AddCompositeIndex(keysBC);
 
-    // Function version with VaultRecordRef
-    vor = vlt.CreateRecord(vrr, {{"A", 10}, {"B", std::string("z")}});
-    
-    int a = 0;
-    std::string b;
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i % 2}, {"B", i % 3}, {"C", i}});
 
-    vrr.GetData("A", a);
-    TEST_ASSERT(a == 10);
+    TEST_ASSERT(vlt.RemoveKey("A"));
 
-    vrr.GetData("B", b);
-    TEST_ASSERT(b == "z");
+    TEST_ASSERT(vlt.GetCompositeIndexes().size() == 1);
+    TEST_ASSERT(vlt.IsCompositeIndexExist(keysAB) == false);
+    TEST_ASSERT(vlt.IsCompositeIndexExist(keysBC));
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B", 
-        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+    COMPARE_CORRECT_REQUEST(Equal("B", 1) && Equal("C", 4), {{{"B", 1}, {"C", 4}}});
 )
 
-TEST_BODY(CreateRecord, CorrectParamsWithUniqueKey,
+TEST_BODY(AddCompositeIndex, CorrectAdd,
     Vault vlt;
-    VaultRecordRef vrr;
     VaultOperationResult vor;
+    std::vector<std::string> keysAB = {"A", "B"};
+    std::vector<std::string> keysBA = {"B", "A"};
+    std::vector<std::string> keysABC = {"A", "B", "C"};
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
-
-    vlt.CreateRecord({{"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("b")}});
-    vor = vlt.CreateRecord({{"B", std::string("c")}, {"A", 2}});
-
-    COMPARE_VAULT(vlt, {
-        {{"A", 0}, {"B", std::string("a")}},
-        {{"A", 1}, {"B", std::string("b")}},
-        {{"A", 2}, {"B", std::string("c")}},
-    })
-
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+    vlt.AddKey("B", 0);
+    vlt.AddKey<std::string>("C", "");
 
-    // Function version with VaultRecordRef
-    vor = vlt.CreateRecord(vrr, {{"A", 10}, {"B", std::string("z")}});
-    
-    int a = 0;
-    std::string b;
+    vor = vlt.AddCompositeIndex(keysAB);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    vrr.GetData("A", a);
-    TEST_ASSERT(a == 10);
+    vor = vlt.AddCompositeIndex(keysBA, VaultIndexPolicy::HashOnly);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    vrr.GetData("B", b);
-    TEST_ASSERT(b == "z");
+    vor = vlt.AddCompositeIndex(keysABC, VaultIndexPolicy::OrderedOnly);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B", 
-        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+    TEST_ASSERT(vlt.GetCompositeIndexes().size() == 3);
+    TEST_ASSERT(vlt.IsCompositeIndexExist(keysAB));
+    TEST_ASSERT(vlt.IsCompositeIndexExist(keysBA));
+    TEST_ASSERT(vlt.IsCompositeIndexExist(keysABC));
 )
 
-TEST_BODY(CreateRecord, DuplicateParams,
+TEST_BODY(AddCompositeIndex, AddToNonEmptyVault,
     Vault vlt;
-    VaultRecordRef vrr;
+    VaultRecordSet vrs;
     VaultOperationResult vor;
+    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
+    std::vector<std::string> keys = {"A", "B"};
 
     vlt.AddKey("A", 0);
+    vlt.AddKey<std::string>("B", "");
 
-    vlt.CreateRecord({{"A", 1}, {"A", 2}});
-    vlt.CreateRecord({{"A", 1}, {"A", 2}, {"A", 3}});
-    vor = vlt.CreateRecord({{"A", 2}, {"A", 1}});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i % 3}, {"B", std::to_string(i % 2)}});
 
-    COMPARE_VAULT(vlt, {
-        {{"A", 1}},
-        {{"A", 2}},
-        {{"A", 3}},
-    })
+    vor = vlt.AddCompositeIndex(keys);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+    COMPARE_CORRECT_REQUEST(Equal("A", 1) && Equal("B", std::string("1")), {
+        {{"A", 1}, {"B", std::string("1")}},
+        {{"A", 1}, {"B", std::string("1")}},
+    });
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 2) && Equal("B", std::string("1")), {
+        {{"A", 2}, {"B", std::string("1")}},
+    });
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 3) && Equal("B", std::string("1")), {});
 )
 
-TEST_BODY(CreateRecord, WrongKeyWithoutUniqueKey,
+TEST_BODY(AddCompositeIndex, WrongKey,
     Vault vlt;
-    VaultRecordRef vrr;
     VaultOperationResult vor;
+    std::vector<std::string> keys = {"A", "C"};
 
     vlt.AddKey("A", 0);
-    vlt.AddKey<std::string>("B", "none");
-
-    vor = vlt.CreateRecord({{"C", 0}});
+    vlt.AddKey("B", 0);
 
-    COMPARE_VAULT(vlt, {});
+    vor = vlt.AddCompositeIndex(keys);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "C",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(int));
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "C", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+    TEST_ASSERT(vlt.GetCompositeIndexes().size() == 0);
 )
 
-TEST_BODY(CreateRecord, WrongTypeWithoutUniqueKey,
+TEST_BODY(AddCompositeIndex, WrongCompositeIndex,
     Vault vlt;
-    VaultRecordRef vrr;
     VaultOperationResult vor;
+    std::vector<std::string> keysA = {"A"};
+    std::vector<std::string> keysAA = {"A", "A"};
+    std::vector<std::string> keysAB = {"A", "B"};
 
     vlt.AddKey("A", 0);
-    vlt.AddKey<std::string>("B", "none");
+    vlt.AddKey("B", 0);
 
-    vor = vlt.CreateRecord({{"B", 0}});
+    vor = vlt.AddCompositeIndex(keysA);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::WrongCompositeIndex, SavedType == typeid(void));
 
-    COMPARE_VAULT(vlt, {});
+    vor = vlt.AddCompositeIndex(keysAA);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::WrongCompositeIndex, SavedType == typeid(int));
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
+    vor = vlt.AddCompositeIndex(keysAB, VaultIndexPolicy::None);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::WrongCompositeIndex, SavedType == typeid(void));
+
+    TEST_ASSERT(vlt.GetCompositeIndexes().size() == 0);
 )
 
-TEST_BODY(CreateRecord, WrongKeyWithUniqueKey,
+TEST_BODY(AddCompositeIndex, DuplicateCompositeIndex,
     Vault vlt;
-    VaultRecordRef vrr;
     VaultOperationResult vor;
+    std::vector<std::string> keys = {"A", "B"};
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddKey("B", 0);
 
-    vor = vlt.CreateRecord({{"C", 0}});
+    vlt.AddCompositeIndex(keys);
 
-    COMPARE_VAULT(vlt, {});
+    vor = vlt.AddCompositeIndex(keys, VaultIndexPolicy::OrderedOnly);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::DuplicateCompositeIndex, SavedType == typeid(void));
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "C", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+    TEST_ASSERT(vlt.GetCompositeIndexes().size() == 1);
 )
 
-TEST_BODY(CreateRecord, WrongTypeWithUniqueKey,
+TEST_BODY(RemoveCompositeIndex, CorrectRemove,
     Vault vlt;
-    VaultRecordRef vrr;
+    VaultRecordSet vrs;
     VaultOperationResult vor;
+    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
+    std::vector<std::string> keys = {"A", "B"};
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddKey("B", 0);
+    vlt.AddCompositeIndex(keys);
 
-    vor = vlt.CreateRecord({{"B", 0}});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i % 2}, {"B", i}});
 
-    COMPARE_VAULT(vlt, {});
+    TEST_ASSERT(vlt.RemoveCompositeIndex(keys));
+    TEST_ASSERT(vlt.IsCompositeIndexExist(keys) == false);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
+    COMPARE_CORRECT_REQUEST(Equal("A", 1) && Less("B", 4), {{{"A", 1}, {"B", 1}}, {{"A", 1}, {"B", 3}}});
 )
 
-TEST_BODY(CreateRecord, DuplicateUniqueKeyValue,
+TEST_BODY(RemoveCompositeIndex, IncorrectRemove,
     Vault vlt;
-    VaultRecordRef vrr;
-    VaultOperationResult vor;
+    std::vector<std::string> keysAB = {"A", "B"};
+    std::vector<std::string> keysBA = {"B", "A"};
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
-    vlt.AddUniqueKey<int>("C");
+    vlt.AddKey("B", 0);
+    vlt.AddCompositeIndex(keysAB);
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("none")}, {"C", 0}});
+    TEST_ASSERT(vlt.RemoveCompositeIndex(keysBA) == false);
+    TEST_ASSERT(vlt.IsCompositeIndexExist(keysAB));
+)
 
+TEST_BODY(AddGroupBy, CorrectAdd,
+    Vault vlt;
+    VaultOperationResult vor;
+    std::unordered_map<int, VaultGroup<double>> groups;
 
-    vor = vlt.CreateRecord({{"B", std::string("none")}});
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0.0);
 
-    COMPARE_VAULT(vlt, {{{"A", 1}, {"B", std::string("none")}, {"C", 0}}});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i % 3}, {"B", i * 0.5}});
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
-        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(void));
+    vor = vlt.AddGroupBy<int, double>("A", "B");
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
+    TEST_ASSERT(vlt.IsGroupByExist("A", "B"));
+    TEST_ASSERT(vlt.IsGroupByExist("B", "A") == false);
 
-    vor = vlt.CreateRecord({{"A", 2}, {"B", std::string("none")}});
+    vlt.CreateRecord({{"A", 1}, {"B", 10.0}});
 
-    COMPARE_VAULT(vlt, {{{"A", 1}, {"B", std::string("none")}, {"C", 0}}});
+    vlt.GetGroups("A", "B", groups);
+    TEST_ASSERT(groups.size() == 3);
+    TEST_ASSERT(groups[0].Count == 4 && groups[0].Sum == 9.0);
+    TEST_ASSERT(groups[1].Count == 4 && groups[1].Sum == 16.0);
+    TEST_ASSERT(groups[2].Count == 3 && groups[2].Sum == 7.5);
+)
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
-        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(void));
+TEST_BODY(AddGroupBy, WrongKey,
+    Vault vlt;
+    VaultOperationResult vor;
 
+    vlt.AddKey("A", 0);
 
-    vor = vlt.CreateRecord({{"A", 2}, {"B", std::string("none2")}, {"C", 0}});
+    vor = vlt.AddGroupBy<int, int>("A", "Z");
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 
-    COMPARE_VAULT(vlt, {{{"A", 1}, {"B", std::string("none")}, {"C", 0}}});
+    vor = vlt.AddGroupBy<int, int>("Z", "A");
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "C", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(void));
+    TEST_ASSERT(vlt.IsGroupByExist("A", "Z") == false);
 )
 
-TEST_BODY(CreateRecord, EmptyUniqueKeyValue,
+TEST_BODY(AddGroupBy, WrongType,
     Vault vlt;
-    VaultRecordRef vrr;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddKey<std::string>("B", "");
 
-    vor = vlt.CreateRecord({{"A", 1}});
+    vor = vlt.AddGroupBy<int, int>("B", "A");
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
 
-    COMPARE_VAULT(vlt, {{{"A", 1}, {"B", std::string("")}}});
+    vor = vlt.AddGroupBy<std::string, long long>("B", "A");
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(long long), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
-    
+    TEST_ASSERT(vlt.IsGroupByExist("B", "A") == false);
+)
 
-    vor = vlt.CreateRecord({{"A", 1}});
+TEST_BODY(AddGroupBy, DuplicateGroupBy,
+    Vault vlt;
+    VaultOperationResult vor;
 
-    COMPARE_VAULT(vlt, {{{"A", 1}, {"B", std::string("")}}});
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
-        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(void));
+    vlt.AddGroupBy<int, int>("A", "B");
+
+    vor = vlt.AddGroupBy<int, int>("A", "B");
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::DuplicateGroupBy, SavedType == typeid(void));
+
+    vor = vlt.AddGroupBy<int, int>("B", "A");
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 )
 
-TEST_BODY(GetRecord, CorrectGetRecord,
+TEST_BODY(GetGroups, AfterChanges,
     Vault vlt;
     VaultRecordRef vrr;
-    VaultOperationResult vor;
+    KeyHandle<int> keyHandle;
+    std::unordered_map<std::string, VaultGroup<int>> groups;
 
-    vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddKey<std::string>("host", "");
+    vlt.AddKey("bytes", 0);
+    vlt.AddKey("id", -1);
+    vlt.AddGroupBy<std::string, int>("host", "bytes");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    for (int i = 0; i < 6; ++i) vlt.CreateRecord({{"host", std::string(i < 3 ? "a" : "b")}, {"bytes", 10}, {"id", i}});
 
-    vor = vlt.GetRecord("A", 1, vrr);
-    
-    COMPARE_REF(vrr, {{{"A", 1}, {"B", std::string("a")}}});
+    // Change the value inside the group
+    vlt.GetRecord("id", 0, vrr);
+    vrr.SetData("bytes", 100);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    // Move the record to the other group
+    vlt.GetRecord("id", 1, vrr);
+    vrr.SetData("host", std::string("b"));
 
+    // Move the record to the new group using key handle
+    vlt.GetKeyHandle("bytes", keyHandle);
+    vlt.GetRecord("id", 3, vrr);
+    vrr.SetData({{"host", std::string("c")}});
+    vrr.SetData(keyHandle, 5);
 
-    vor = vlt.GetRecord<std::string>("B", "c", vrr);
-    
-    COMPARE_REF(vrr, {{{"A", 3}, {"B", std::string("c")}}});
+    // Changing other key does not change groups
+    vrr.SetData("id", 10);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B", 
-        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(std::string));
+    vlt.EraseRecord("id", 4);
+
+    vlt.GetGroups("host", "bytes", groups);
+    TEST_ASSERT(groups.size() == 3);
+    TEST_ASSERT(groups["a"].Count == 2 && groups["a"].Sum == 110);
+    TEST_ASSERT(groups["b"].Count == 2 && groups["b"].Sum == 20);
+    TEST_ASSERT(groups["c"].Count == 1 && groups["c"].Sum == 5);
+
+    // Empty group is removed
+    vlt.EraseRecord("id", 10);
+    vlt.GetGroups("host", "bytes", groups);
+    TEST_ASSERT(groups.size() == 2);
+    TEST_ASSERT(groups.find("c") == groups.end());
 )
 
-TEST_BODY(GetRecord, WrongKey,
+TEST_BODY(GetGroups, AfterDropData,
     Vault vlt;
-    VaultRecordRef vrr;
-    VaultOperationResult vor;
+    std::unordered_map<int, VaultGroup<int>> groups;
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddKey("B", 0);
+    vlt.AddGroupBy<int, int>("A", "B");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i % 2}, {"B", i}});
 
-    vor = vlt.GetRecord("Z", 1, vrr);
+    vlt.DropData();
+    vlt.GetGroups("A", "B", groups);
+    TEST_ASSERT(groups.empty());
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+    vlt.CreateRecord({{"A", 1}, {"B", 2}});
+    vlt.GetGroups("A", "B", groups);
+    TEST_ASSERT(groups.size() == 1);
+    TEST_ASSERT(groups[1].Count == 1 && groups[1].Sum == 2);
+
+    vlt.DropVault();
+    TEST_ASSERT(vlt.IsGroupByExist("A", "B") == false);
 )
 
-TEST_BODY(GetRecord, WrongType,
+TEST_BODY(GetGroups, GetGroup,
     Vault vlt;
-    VaultRecordRef vrr;
     VaultOperationResult vor;
+    VaultGroup<int> group;
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddKey("B", 0);
+    vlt.AddGroupBy<int, int>("A", "B");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i % 2}, {"B", i}});
 
-    vor = vlt.GetRecord("B", 1, vrr);
+    vor = vlt.GetGroup("A", "B", 1, group);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    TEST_ASSERT(group.Count == 5 && group.Sum == 25);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
+    vor = vlt.GetGroup("A", "B", 2, group);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
 )
 
-TEST_BODY(GetRecord, WrongValue,
+TEST_BODY(GetGroups, WrongGroupBy,
     Vault vlt;
-    VaultRecordRef vrr;
     VaultOperationResult vor;
+    std::unordered_map<int, VaultGroup<int>> groups;
+    VaultGroup<int> group;
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
-
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.AddKey("B", 0);
+    vlt.AddGroupBy<int, int>("A", "B");
 
-    vor = vlt.GetRecord("A", 99, vrr);
+    vor = vlt.GetGroups("B", "A", groups);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::WrongGroupBy, SavedType == typeid(void));
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
+    vor = vlt.GetGroup("Z", "B", 0, group);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::WrongGroupBy, SavedType == typeid(void));
 )
 
-TEST_BODY(GetRecords, CorrectGetRecords,
+TEST_BODY(GetGroups, WrongType,
     Vault vlt;
-    std::vector<VaultRecordRef> records;
     VaultOperationResult vor;
+    std::unordered_map<long long, VaultGroup<int>> wrongGroupTypeGroups;
+    VaultGroup<double> group;
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddKey("B", 0);
+    vlt.AddGroupBy<int, int>("A", "B");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
+    vor = vlt.GetGroups("A", "B", wrongGroupTypeGroups);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(long long), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
 
-    vor = vlt.GetRecords("A", 1, records);
-    
-    TEST_ASSERT(records.size() == 1);
-    COMPARE_REF(records[0], {{{"A", 1}, {"B", std::string("a")}}});
+    vor = vlt.GetGroup("A", "B", 0, group);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B",
+        RequestedType == typeid(double), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+)
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+TEST_BODY(RemoveGroupBy, CorrectRemove,
+    Vault vlt;
+    VaultOperationResult vor;
+    std::unordered_map<int, VaultGroup<int>> groups;
 
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+    vlt.AddGroupBy<int, int>("A", "B");
 
-    vor = vlt.GetRecords("A", 2, records);
-    
-    TEST_ASSERT(records.size() == 3);
+    TEST_ASSERT(vlt.RemoveGroupBy("B", "A") == false);
+    TEST_ASSERT(vlt.RemoveGroupBy("A", "B"));
+    TEST_ASSERT(vlt.IsGroupByExist("A", "B") == false);
 
-    int resI = 0;
-    std::string resS;
+    vlt.CreateRecord({{"A", 1}, {"B", 2}});
 
-    for (const VaultRecordRef& ref : records)
-    {
-        int i = 0;
-        std::string s;
+    vor = vlt.GetGroups("A", "B", groups);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::WrongGroupBy, SavedType == typeid(void));
+)
 
-        ref.GetData("A", i);
-        ref.GetData("B", s);
+TEST_BODY(RemoveGroupBy, RemoveKeyWithGroupBy,
+    Vault vlt;
 
-        resI += i;
-        resS += s;
-    }
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+    vlt.AddKey("C", 0);
+    vlt.AddGroupBy<int, int>("A", "B");
+    vlt.AddGroupBy<int, int>("C", "C");
 
-    TEST_ASSERT(resI == 6);
-    TEST_ASSERT(resS == "bbbbbb");
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i % 2}, {"B", i}, {"C", i}});
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    vlt.RemoveKey("B");
+    TEST_ASSERT(vlt.IsGroupByExist("A", "B") == false);
+    TEST_ASSERT(vlt.IsGroupByExist("C", "C"));
+
+    vlt.EraseRecord("C", 3);
+    vlt.AddKey("B", 0);
+    TEST_ASSERT(vlt.IsGroupByExist("A", "B") == false);
 )
 
-TEST_BODY(GetRecords, CorrectGetNotAllRecords,
+TEST_BODY(AddLockFreeReadKey, CorrectAdd,
     Vault vlt;
-    std::vector<VaultRecordRef> records;
     VaultOperationResult vor;
+    std::string b;
 
-    vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddUniqueKey<int>("A");
+    vlt.AddKey<std::string>("B", "none");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
+    for (int i = 0; i < 100; ++i) vlt.CreateRecord({{"A", i}, {"B", std::to_string(i)}});
 
-    vor = vlt.GetRecords("A", 1, records, 2);
-    
-    TEST_ASSERT(records.size() == 1);
-    COMPARE_REF(records[0], {{{"A", 1}, {"B", std::string("a")}}});
-
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-    RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
-
-
-    vor = vlt.GetRecords("A", 2, records, 2);
-
-    TEST_ASSERT(records.size() == 2);
-
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+    vor = vlt.AddLockFreeReadKey<int>("A");
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A",
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    TEST_ASSERT(vlt.GetLockFreeReadKey() == "A");
+
+    for (int i = 0; i < 100; ++i)
+    {
+        vor = vlt.ReadRecord("A", i, [&](const VaultRecordSnapshot& snapshot)
+        {
+            snapshot.GetData("B", b);
+        });
+        COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A",
+            RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+        TEST_ASSERT(b == std::to_string(i));
+    }
 )
 
-TEST_BODY(GetRecords, WrongKey,
+TEST_BODY(AddLockFreeReadKey, WrongKey,
     Vault vlt;
-    std::vector<VaultRecordRef> records;
     VaultOperationResult vor;
 
-    vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
-
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-
-    vor = vlt.GetRecords("Z", 1, records);
-    
-    TEST_ASSERT(records.size() == 0);
-
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+    vor = vlt.AddLockFreeReadKey<int>("A");
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+    TEST_ASSERT(vlt.GetLockFreeReadKey().empty());
 )
 
-TEST_BODY(GetRecords, WrongType,
+TEST_BODY(AddLockFreeReadKey, WrongType,
     Vault vlt;
-    std::vector<VaultRecordRef> records;
     VaultOperationResult vor;
 
-    vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
-
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-
-    vor = vlt.GetRecords("B", 1, records);
-    
-    TEST_ASSERT(records.size() == 0);
+    vlt.AddUniqueKey<int>("A");
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
+    vor = vlt.AddLockFreeReadKey<long long>("A");
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(long long), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
 )
 
-TEST_BODY(GetRecords, WrongValue,
+TEST_BODY(AddLockFreeReadKey, NonUniqueKey,
     Vault vlt;
-    std::vector<VaultRecordRef> records;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
-
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-
-    vor = vlt.GetRecords("A", 99, records);
-    
-    TEST_ASSERT(records.size() == 0);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
+    vor = vlt.AddLockFreeReadKey<int>("A");
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::NonUniqueKey, SavedType == typeid(int));
 )
 
-TEST_BODY(RequestEqual, CorrectRequest,
+TEST_BODY(AddLockFreeReadKey, DuplicateKey,
     Vault vlt;
-    VaultRecordSet vrs;
     VaultOperationResult vor;
 
-    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<int>("A");
     vlt.AddUniqueKey<std::string>("B");
+    vlt.AddLockFreeReadKey<int>("A");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-
-    vor = vlt.RequestEqual("A", 1, vrs);
+    vor = vlt.AddLockFreeReadKey<std::string>("B");
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::DuplicateKey, SavedType == typeid(std::string));
+    TEST_ASSERT(vlt.GetLockFreeReadKey() == "A");
+)
 
-    TEST_ASSERT(vrs.Size() == 1);
+TEST_BODY(ReadRecord, AfterChanges,
+    Vault vlt;
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+    int b = 0;
+    std::string c;
 
-    COMPARE_VAULT(vrs, {{{"A", 1}, {"B", std::string("a")}}});
+    vlt.AddUniqueKey<int>("A");
+    vlt.AddKey("B", 0);
+    vlt.AddKey<std::string>("C", "none");
+    vlt.AddLockFreeReadKey<int>("A");
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    vlt.CreateRecord(vrr, {{"A", 1}, {"B", 10}});
 
+    vor = vlt.ReadRecord("A", 1, [&](const VaultRecordSnapshot& snapshot)
+    {
+        snapshot.GetData("B", b);
+        snapshot.GetData("C", c);
+    });
+    TEST_ASSERT(vor.IsOperationSuccess && b == 10 && c == "none");
 
-    vor = vlt.RequestEqual("A", 2, vrs);
+    // Snapshot is replaced by SetData
+    vrr.SetData("B", 20);
+    vrr.SetData({{"B", 30}, {"C", std::string("c")}});
+    vlt.ReadRecord("A", 1, [&](const VaultRecordSnapshot& snapshot)
+    {
+        snapshot.GetData("B", b);
+        snapshot.GetData("C", c);
+    });
+    TEST_ASSERT(b == 30 && c == "c");
 
-    TEST_ASSERT(vrs.Size() == 3);
+    // Change of the key value moves snapshot to the new value
+    vrr.SetData("A", 2);
+    vor = vlt.ReadRecord("A", 1, [&](const VaultRecordSnapshot&) {});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
 
-    COMPARE_VAULT(vrs, {
-        {{"A", 2}, {"B", std::string("b")}},
-        {{"A", 2}, {"B", std::string("bb")}},
-        {{"A", 2}, {"B", std::string("bbb")}},
+    b = 0;
+    vor = vlt.ReadRecord("A", 2, [&](const VaultRecordSnapshot& snapshot)
+    {
+        snapshot.GetData("B", b);
     });
+    TEST_ASSERT(vor.IsOperationSuccess && b == 30);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    // Snapshot has typed access like VaultRecordRef
+    vlt.ReadRecord("A", 2, [&](const VaultRecordSnapshot& snapshot)
+    {
+        std::string wrongType;
+        vor = snapshot.GetData("B", wrongType);
+        COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B",
+            RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+
+        vor = snapshot.GetData("Z", b);
+        COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z",
+            RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+    });
 )
 
-TEST_BODY(RequestEqual, CorrectRequestNotAllRecords,
+TEST_BODY(ReadRecord, AfterEraseRecord,
     Vault vlt;
-    VaultRecordSet vrs;
+    VaultRecordRef vrr;
     VaultOperationResult vor;
+    bool isCalled = false;
 
-    vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
-
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-
-    vor = vlt.RequestEqual("A", 1, vrs, 2);
-
-    TEST_ASSERT(vrs.Size() == 1);
-
-    COMPARE_VAULT(vrs, {{{"A", 1}, {"B", std::string("a")}}});
+    vlt.AddUniqueKey<int>("A");
+    vlt.AddLockFreeReadKey<int>("A");
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    for (int i = 0; i < 100; ++i) vlt.CreateRecord({{"A", i}});
 
+    vlt.GetRecord("A", 5, vrr);
+    vlt.EraseRecord(vrr);
+    vlt.EraseRecord("A", 6);
 
-    vor = vlt.RequestEqual("A", 2, vrs, 2);
+    vor = vlt.ReadRecord("A", 5, [&](const VaultRecordSnapshot&) { isCalled = true; });
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
+    vor = vlt.ReadRecord("A", 6, [&](const VaultRecordSnapshot&) { isCalled = true; });
+    TEST_ASSERT(vor.IsOperationSuccess == false && isCalled == false);
 
-    TEST_ASSERT(vrs.Size() == 2);
+    vor = vlt.ReadRecord("A", 7, [&](const VaultRecordSnapshot&) { isCalled = true; });
+    TEST_ASSERT(vor.IsOperationSuccess && isCalled);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    // The value of the erased record can be used again
+    vlt.CreateRecord({{"A", 5}});
+    vor = vlt.ReadRecord("A", 5, [&](const VaultRecordSnapshot&) {});
+    TEST_ASSERT(vor.IsOperationSuccess);
 )
 
-TEST_BODY(RequestEqual, CorrectRequestWithPredicat,
+TEST_BODY(ReadRecord, AfterKeysChanges,
     Vault vlt;
-    VaultRecordSet vrs;
     VaultOperationResult vor;
+    int b = 0;
 
-    vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddUniqueKey<int>("A");
+    vlt.AddKey("C", 0);
+    vlt.AddLockFreeReadKey<int>("A");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
 
-    vor = vlt.RequestEqual("A", 2, vrs, -1, [](const VaultRecordRef& ref) -> bool
+    vlt.AddKey("B", 7);
+    vlt.ReadRecord("A", 3, [&](const VaultRecordSnapshot& snapshot)
     {
-        std::string s;
-        ref.GetData("B", s);
-        if (s.length() <= 2) return true;
-        else return false;
+        snapshot.GetData("B", b);
+        TEST_ASSERT(snapshot.IsKeyExist("C"));
     });
+    TEST_ASSERT(b == 7);
 
-    TEST_ASSERT(vrs.Size() == 2);
-
-    COMPARE_VAULT(vrs, {
-        {{"A", 2}, {"B", std::string("b")}},
-        {{"A", 2}, {"B", std::string("bb")}},
+    vlt.RemoveKey("C");
+    vlt.ReadRecord("A", 3, [&](const VaultRecordSnapshot& snapshot)
+    {
+        TEST_ASSERT(snapshot.IsKeyExist("B"));
+        TEST_ASSERT(snapshot.IsKeyExist("C") == false);
     });
-
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 )
 
-TEST_BODY(RequestEqual, WrongKey,
+TEST_BODY(ReadRecord, AfterDropData,
     Vault vlt;
-    VaultRecordSet vrs;
     VaultOperationResult vor;
 
-    vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
-
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.AddUniqueKey<int>("A");
+    vlt.AddLockFreeReadKey<int>("A");
 
-    vor = vlt.RequestEqual("Z", 1, vrs);
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
 
-    TEST_ASSERT(vrs.Size() == 0);
+    vlt.DropData();
+    vor = vlt.ReadRecord("A", 1, [&](const VaultRecordSnapshot&) {});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
 
-    COMPARE_VAULT(vrs, {});
+    vlt.CreateRecord({{"A", 1}});
+    vor = vlt.ReadRecord("A", 1, [&](const VaultRecordSnapshot&) {});
+    TEST_ASSERT(vor.IsOperationSuccess);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+    vlt.DropVault();
+    TEST_ASSERT(vlt.GetLockFreeReadKey().empty());
+    vor = vlt.ReadRecord("A", 1, [&](const VaultRecordSnapshot&) {});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 )
 
-TEST_BODY(RequestEqual, WrongType,
+TEST_BODY(ReadRecord, WrongKey,
     Vault vlt;
-    VaultRecordSet vrs;
     VaultOperationResult vor;
 
-    vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
-
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.AddUniqueKey<int>("A");
+    vlt.AddUniqueKey<int>("B");
 
-    vor = vlt.RequestEqual("B", 1, vrs);
+    vor = vlt.ReadRecord("A", 1, [&](const VaultRecordSnapshot&) {});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 
-    TEST_ASSERT(vrs.Size() == 0);
+    vlt.AddLockFreeReadKey<int>("A");
 
-    COMPARE_VAULT(vrs, {});
+    vor = vlt.ReadRecord("B", 1, [&](const VaultRecordSnapshot&) {});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
+    vor = vlt.ReadRecord("A", 1ll, [&](const VaultRecordSnapshot&) {});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(long long), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
 )
 
-TEST_BODY(RequestEqual, ValueNotInVault,
+TEST_BODY(ReadRecord, CopyVault,
     Vault vlt;
-    VaultRecordSet vrs;
-    VaultOperationResult vor;
+    int b = 0;
 
-    vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddUniqueKey<int>("A");
+    vlt.AddKey("B", 0);
+    vlt.AddLockFreeReadKey<int>("A");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", i * 2}});
 
-    vor = vlt.RequestEqual("A", 4, vrs);
+    Vault copy(vlt);
+    vlt.EraseRecord("A", 4);
+    TEST_ASSERT(copy.GetLockFreeReadKey() == "A");
+    copy.ReadRecord("A", 4, [&](const VaultRecordSnapshot& snapshot)
+    {
+        snapshot.GetData("B", b);
+    });
+    TEST_ASSERT(b == 8);
 
-    TEST_ASSERT(vrs.Size() == 0);
+    Vault assigned;
+    assigned = copy;
+    b = 0;
+    assigned.ReadRecord("A", 4, [&](const VaultRecordSnapshot& snapshot)
+    {
+        snapshot.GetData("B", b);
+    });
+    TEST_ASSERT(b == 8);
 
-    COMPARE_VAULT(vrs, {});
+    Vault moved(std::move(assigned));
+    TEST_ASSERT(assigned.GetLockFreeReadKey().empty());
+    b = 0;
+    moved.ReadRecord("A", 4, [&](const VaultRecordSnapshot& snapshot)
+    {
+        snapshot.GetData("B", b);
+    });
+    TEST_ASSERT(b == 8);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    assigned = std::move(moved);
+    TEST_ASSERT(assigned.ReadRecord("A", 4, [&](const VaultRecordSnapshot&) {}).IsOperationSuccess);
 )
 
-TEST_BODY(RequestGreater, CorrectRequest,
+TEST_BODY(RemoveLockFreeReadKey, CorrectRemove,
     Vault vlt;
-    VaultRecordSet vrs;
     VaultOperationResult vor;
 
-    vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
-
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-
-    vor = vlt.RequestGreater("A", 1, vrs);
-
-    TEST_ASSERT(vrs.Size() == 4);
+    vlt.AddUniqueKey<int>("A");
+    vlt.CreateRecord({{"A", 1}});
 
-    COMPARE_VAULT(vrs, {
-        {{"A", 2}, {"B", std::string("b")}},
-        {{"A", 2}, {"B", std::string("bb")}},
-        {{"A", 2}, {"B", std::string("bbb")}},
-        {{"A", 3}, {"B", std::string("c")}},
-    });
+    TEST_ASSERT(vlt.RemoveLockFreeReadKey() == false);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    vlt.AddLockFreeReadKey<int>("A");
+    TEST_ASSERT(vlt.RemoveLockFreeReadKey());
+    TEST_ASSERT(vlt.GetLockFreeReadKey().empty());
 
+    vor = vlt.ReadRecord("A", 1, [&](const VaultRecordSnapshot&) {});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 
-    vor = vlt.RequestGreater("A", 2, vrs);
+    // Index can be added again
+    vor = vlt.AddLockFreeReadKey<int>("A");
+    TEST_ASSERT(vor.IsOperationSuccess);
+    TEST_ASSERT(vlt.ReadRecord("A", 1, [&](const VaultRecordSnapshot&) {}).IsOperationSuccess);
+)
 
-    TEST_ASSERT(vrs.Size() == 1);
+TEST_BODY(RemoveLockFreeReadKey, RemoveKeyWithLockFreeRead,
+    Vault vlt;
 
-    COMPARE_VAULT(vrs, {{{"A", 3}, {"B", std::string("c")}}});
+    vlt.AddUniqueKey<int>("A");
+    vlt.AddLockFreeReadKey<int>("A");
+    vlt.CreateRecord({{"A", 1}});
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    vlt.RemoveKey("A");
+    TEST_ASSERT(vlt.GetLockFreeReadKey().empty());
+    TEST_ASSERT(vlt.ReadRecord("A", 1, [&](const VaultRecordSnapshot&) {}).IsOperationSuccess == false);
 )
 
-TEST_BODY(RequestGreater, CorrectRequestNotAllRecords,
+
+TEST_BODY(CreateRecord, CorrectParamsWithoutUniqueKey,
     Vault vlt;
-    VaultRecordSet vrs;
+    VaultRecordRef vrr;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
-
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.AddKey<std::string>("B", "none");
 
-    vor = vlt.RequestGreater("A", 1, vrs, 2);
+    vlt.CreateRecord({});
+    vlt.CreateRecord({});
+    vlt.CreateRecord({{"A", 2}});
+    vlt.CreateRecord({{"B", std::string("c")}});
+    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
+    vor = vlt.CreateRecord({{"B", std::string("e")}, {"A", 5}});
 
-    TEST_ASSERT(vrs.Size() == 2);
+    COMPARE_VAULT(vlt, {
+        {{"A", 0}, {"B", std::string("none")}},
+        {{"A", 0}, {"B", std::string("none")}},
+        {{"A", 2}, {"B", std::string("none")}},
+        {{"A", 0}, {"B", std::string("c")}},
+        {{"A", 4}, {"B", std::string("d")}},
+        {{"A", 5}, {"B", std::string("e")}},
+    })
 
     COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
-
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    vor = vlt.RequestGreater("A", 2, vrs, 4);
+    // Function version with VaultRecordRef
+    vor = vlt.CreateRecord(vrr, {{"A", 10}, {"B", std::string("z")}});
+    
+    int a = 0;
+    std::string b;
 
-    TEST_ASSERT(vrs.Size() == 1);
+    vrr.GetData("A", a);
+    TEST_ASSERT(a == 10);
 
-    COMPARE_VAULT(vrs, {{{"A", 3}, {"B", std::string("c")}}});
+    vrr.GetData("B", b);
+    TEST_ASSERT(b == "z");
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 )
 
-TEST_BODY(RequestGreater, CorrectRequestWithPredicat,
+TEST_BODY(CreateRecord, CorrectParamsWithUniqueKey,
     Vault vlt;
-    VaultRecordSet vrs;
+    VaultRecordRef vrr;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
     vlt.AddUniqueKey<std::string>("B");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.CreateRecord({{"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("b")}});
+    vor = vlt.CreateRecord({{"B", std::string("c")}, {"A", 2}});
 
-    vor = vlt.RequestGreater("A", 0, vrs, -1, [](const VaultRecordRef& ref) -> bool
-    {
-        std::string s;
-        ref.GetData("B", s);
-        if (s.length() > 1) return true;
-        else return false;
-    });
+    COMPARE_VAULT(vlt, {
+        {{"A", 0}, {"B", std::string("a")}},
+        {{"A", 1}, {"B", std::string("b")}},
+        {{"A", 2}, {"B", std::string("c")}},
+    })
 
-    TEST_ASSERT(vrs.Size() == 2);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    COMPARE_VAULT(vrs, {
-        {{"A", 2}, {"B", std::string("bb")}},
-        {{"A", 2}, {"B", std::string("bbb")}},
-    });
+    // Function version with VaultRecordRef
+    vor = vlt.CreateRecord(vrr, {{"A", 10}, {"B", std::string("z")}});
+    
+    int a = 0;
+    std::string b;
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    vrr.GetData("A", a);
+    TEST_ASSERT(a == 10);
+
+    vrr.GetData("B", b);
+    TEST_ASSERT(b == "z");
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 )
 
-TEST_BODY(RequestGreater, BoundaryValues,
+TEST_BODY(CreateRecord, DuplicateParams,
     Vault vlt;
-    VaultRecordSet vrs;
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
 
-    // ...1...3...5...
-    vlt.CreateRecord({{"A", 1}});
-    vlt.CreateRecord({{"A", 3}});
-    vlt.CreateRecord({{"A", 5}});
+    vlt.CreateRecord({{"A", 1}, {"A", 2}});
+    vlt.CreateRecord({{"A", 1}, {"A", 2}, {"A", 3}});
+    vor = vlt.CreateRecord({{"A", 2}, {"A", 1}});
 
-    //  x
-    // ...1...3...5...
-    vlt.RequestGreater("A", 0, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}, {{"A", 5}}});
+    COMPARE_VAULT(vlt, {
+        {{"A", 1}},
+        {{"A", 2}},
+        {{"A", 3}},
+    })
 
-    //    x
-    // ...1...3...5...
-    vlt.RequestGreater("A", 1, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 3}}, {{"A", 5}}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+)
 
-    //      x
-    // ...1...3...5...
-    vlt.RequestGreater("A", 2, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 3}}, {{"A", 5}}});
+TEST_BODY(CreateRecord, WrongKeyWithoutUniqueKey,
+    Vault vlt;
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
 
-    //        x
-    // ...1...3...5...
-    vlt.RequestGreater("A", 3, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 5}}});
+    vlt.AddKey("A", 0);
+    vlt.AddKey<std::string>("B", "none");
 
-    //          x
-    // ...1...3...5...
-    vlt.RequestGreater("A", 4, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 5}}});
+    vor = vlt.CreateRecord({{"C", 0}});
 
-    //            x
-    // ...1...3...5...
-    vlt.RequestGreater("A", 5, vrs);
-    COMPARE_VAULT(vrs, {});
+    COMPARE_VAULT(vlt, {});
 
-    //              x
-    // ...1...3...5...
-    vlt.RequestGreater("A", 6, vrs);
-    COMPARE_VAULT(vrs, {});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "C", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 )
 
-TEST_BODY(RequestGreater, WrongKey,
+TEST_BODY(CreateRecord, WrongTypeWithoutUniqueKey,
     Vault vlt;
-    VaultRecordSet vrs;
+    VaultRecordRef vrr;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
-
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-
-    vor = vlt.RequestGreater("Z", 1, vrs);
+    vlt.AddKey<std::string>("B", "none");
 
-    TEST_ASSERT(vrs.Size() == 0);
+    vor = vlt.CreateRecord({{"B", 0}});
 
-    COMPARE_VAULT(vrs, {});
+    COMPARE_VAULT(vlt, {});
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
 )
 
-TEST_BODY(RequestGreater, WrongType,
+TEST_BODY(CreateRecord, WrongKeyWithUniqueKey,
     Vault vlt;
-    VaultRecordSet vrs;
+    VaultRecordRef vrr;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
     vlt.AddUniqueKey<std::string>("B");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-
-    vor = vlt.RequestGreater("B", 1, vrs);
-
-    TEST_ASSERT(vrs.Size() == 0);
+    vor = vlt.CreateRecord({{"C", 0}});
 
-    COMPARE_VAULT(vrs, {});
+    COMPARE_VAULT(vlt, {});
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "C", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 )
 
-TEST_BODY(RequestGreater, ValueNotInVault,
+TEST_BODY(CreateRecord, WrongTypeWithUniqueKey,
     Vault vlt;
-    VaultRecordSet vrs;
+    VaultRecordRef vrr;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
     vlt.AddUniqueKey<std::string>("B");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-
-    vor = vlt.RequestGreater("A", 4, vrs);
-
-    TEST_ASSERT(vrs.Size() == 0);
+    vor = vlt.CreateRecord({{"B", 0}});
 
-    COMPARE_VAULT(vrs, {});
+    COMPARE_VAULT(vlt, {});
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
 )
 
-TEST_BODY(RequestGreaterOrEqual, CorrectRequest,
+TEST_BODY(CreateRecord, DuplicateUniqueKeyValue,
     Vault vlt;
-    VaultRecordSet vrs;
+    VaultRecordRef vrr;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
     vlt.AddUniqueKey<std::string>("B");
+    vlt.AddUniqueKey<int>("C");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("none")}, {"C", 0}});
 
-    vor = vlt.RequestGreaterOrEqual("A", 1, vrs);
 
-    TEST_ASSERT(vrs.Size() == 5);
+    vor = vlt.CreateRecord({{"B", std::string("none")}});
 
-    COMPARE_VAULT(vrs, {
-        {{"A", 1}, {"B", std::string("a")}},
-        {{"A", 2}, {"B", std::string("b")}},
-        {{"A", 2}, {"B", std::string("bb")}},
-        {{"A", 2}, {"B", std::string("bbb")}},
-        {{"A", 3}, {"B", std::string("c")}},
-    });
+    COMPARE_VAULT(vlt, {{{"A", 1}, {"B", std::string("none")}, {"C", 0}}});
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(void));
 
 
-    vor = vlt.RequestGreaterOrEqual("A", 3, vrs);
+    vor = vlt.CreateRecord({{"A", 2}, {"B", std::string("none")}});
 
-    TEST_ASSERT(vrs.Size() == 1);
+    COMPARE_VAULT(vlt, {{{"A", 1}, {"B", std::string("none")}, {"C", 0}}});
 
-    COMPARE_VAULT(vrs, {{{"A", 3}, {"B", std::string("c")}}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(void));
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    vor = vlt.CreateRecord({{"A", 2}, {"B", std::string("none2")}, {"C", 0}});
+
+    COMPARE_VAULT(vlt, {{{"A", 1}, {"B", std::string("none")}, {"C", 0}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "C", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(void));
 )
 
-TEST_BODY(RequestGreaterOrEqual, CorrectRequestNotAllRecords,
+TEST_BODY(CreateRecord, EmptyUniqueKeyValue,
     Vault vlt;
-    VaultRecordSet vrs;
+    VaultRecordRef vrr;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
     vlt.AddUniqueKey<std::string>("B");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-
-    vor = vlt.RequestGreaterOrEqual("A", 2, vrs, 2);
+    vor = vlt.CreateRecord({{"A", 1}});
 
-    TEST_ASSERT(vrs.Size() == 2);
+    COMPARE_VAULT(vlt, {{{"A", 1}, {"B", std::string("")}}});
 
     COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+    
 
+    vor = vlt.CreateRecord({{"A", 1}});
 
-    vor = vlt.RequestGreaterOrEqual("A", 3, vrs, 4);
-
-    TEST_ASSERT(vrs.Size() == 1);
-
-    COMPARE_VAULT(vrs, {{{"A", 3}, {"B", std::string("c")}}});
+    COMPARE_VAULT(vlt, {{{"A", 1}, {"B", std::string("")}}});
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(void));
 )
 
-TEST_BODY(RequestGreaterOrEqual, CorrectRequestWithPredicat,
+TEST_BODY(CreateRecord, MoveParams,
     Vault vlt;
-    VaultRecordSet vrs;
+    VaultRecordRef vrr;
     VaultOperationResult vor;
+    std::vector<std::pair<std::string, VaultParamInput>> params;
+    std::string longValue(1000, 'a');
+    std::string b;
 
     vlt.AddKey("A", 0);
     vlt.AddUniqueKey<std::string>("B");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    params.emplace_back("A", 1);
+    params.emplace_back("B", std::string(longValue));
 
-    vor = vlt.RequestGreaterOrEqual("A", 2, vrs, -1, [](const VaultRecordRef& ref) -> bool
-    {
-        std::string s;
-        ref.GetData("B", s);
-        if (s.length() > 1) return true;
-        else return false;
-    });
+    vor = vlt.CreateRecord(vrr, std::move(params));
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    TEST_ASSERT(vrs.Size() == 2);
+    vrr.GetData("B", b);
+    TEST_ASSERT(b == longValue);
 
-    COMPARE_VAULT(vrs, {
-        {{"A", 2}, {"B", std::string("bb")}},
-        {{"A", 2}, {"B", std::string("bbb")}},
-    });
+    // Moved value is added to the key indexes
+    vlt.GetRecord("B", longValue, vrr);
+    TEST_ASSERT(vrr.IsValid());
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    vlt.CreateRecord({{"A", 2}, {"B", std::string(longValue + "b")}});
+
+    COMPARE_VAULT(vlt, {
+        {{"A", 1}, {"B", longValue}},
+        {{"A", 2}, {"B", longValue + "b"}},
+    })
 )
 
-TEST_BODY(RequestGreaterOrEqual, BoundaryValues,
+TEST_BODY(CreateRecord, ReuseParams,
+    Vault vlt;
+    VaultOperationResult vor;
+    std::string value = "value";
+    std::vector<std::pair<std::string, VaultParamInput>> params = {{"A", 1}, {"B", value}};
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey<std::string>("B", "");
+
+    // Lvalue params are copied, so they can be used again
+    vlt.CreateRecord(params);
+    vor = vlt.CreateRecord(params);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+
+    TEST_ASSERT(value == "value");
+
+    COMPARE_VAULT(vlt, {
+        {{"A", 1}, {"B", std::string("value")}},
+        {{"A", 1}, {"B", std::string("value")}},
+    })
+)
+
+TEST_BODY(CreateRecords, CorrectParams,
     Vault vlt;
     VaultRecordSet vrs;
+    std::vector<VaultRecordRef> refs;
+    VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
 
-    // ...1...3...5...
-    vlt.CreateRecord({{"A", 1}});
-    vlt.CreateRecord({{"A", 3}});
-    vlt.CreateRecord({{"A", 5}});
+    vor = vlt.CreateRecords(refs, {
+        {{"B", std::string("a")}},
+        {{"A", 1}, {"B", std::string("b")}},
+        {{"B", std::string("c")}, {"A", 1}}
+    });
 
-    //  x
-    // ...1...3...5...
-    vlt.RequestGreaterOrEqual("A", 0, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}, {{"A", 5}}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    //    x
-    // ...1...3...5...
-    vlt.RequestGreaterOrEqual("A", 1, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}, {{"A", 5}}});
+    COMPARE_VAULT(vlt, {
+        {{"A", 0}, {"B", std::string("a")}},
+        {{"A", 1}, {"B", std::string("b")}},
+        {{"A", 1}, {"B", std::string("c")}},
+    })
 
-    //      x
-    // ...1...3...5...
-    vlt.RequestGreaterOrEqual("A", 2, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 3}}, {{"A", 5}}});
+    TEST_ASSERT(refs.size() == 3);
 
-    //        x
-    // ...1...3...5...
-    vlt.RequestGreaterOrEqual("A", 3, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 3}}, {{"A", 5}}});
+    std::string b;
+    refs[2].GetData("B", b);
+    TEST_ASSERT(b == "c");
 
-    //          x
-    // ...1...3...5...
-    vlt.RequestGreaterOrEqual("A", 4, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 5}}});
+    // New records are inside the key structures
+    vlt.RequestEqual("A", 1, vrs);
+    TEST_ASSERT(vrs.Size() == 2);
 
-    //            x
-    // ...1...3...5...
-    vlt.RequestGreaterOrEqual("A", 5, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 5}}});
+    VaultRecordRef vrr;
+    TEST_ASSERT(vlt.GetRecord<std::string>("B", "b", vrr).IsOperationSuccess);
 
-    //              x
-    // ...1...3...5...
-    vlt.RequestGreaterOrEqual("A", 6, vrs);
-    COMPARE_VAULT(vrs, {});
+    // Empty batch
+    vor = vlt.CreateRecords(refs, {});
+    TEST_ASSERT(vor.IsOperationSuccess);
+    TEST_ASSERT(refs.empty());
+    TEST_ASSERT(vlt.Size() == 3);
 )
 
-TEST_BODY(RequestGreaterOrEqual, WrongKey,
+TEST_BODY(CreateRecords, WrongParams,
     Vault vlt;
-    VaultRecordSet vrs;
+    std::vector<VaultRecordRef> refs;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
     vlt.AddUniqueKey<std::string>("B");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vor = vlt.CreateRecords(refs, {
+        {{"A", 1}, {"B", std::string("a")}},
+        {{"Z", 1}, {"B", std::string("b")}}
+    });
 
-    vor = vlt.RequestGreaterOrEqual("Z", 1, vrs);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 
-    TEST_ASSERT(vrs.Size() == 0);
+    vor = vlt.CreateRecords(refs, {
+        {{"A", 1}, {"B", std::string("a")}},
+        {{"A", std::string("1")}, {"B", std::string("b")}}
+    });
 
-    COMPARE_VAULT(vrs, {});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+    // No records are created
+    TEST_ASSERT(refs.empty());
+    TEST_ASSERT(vlt.Size() == 0);
+    TEST_ASSERT(vlt.CreateRecord({{"B", std::string("a")}}).IsOperationSuccess);
 )
 
-TEST_BODY(RequestGreaterOrEqual, WrongType,
+TEST_BODY(CreateRecords, DuplicateUniqueKeyValue,
     Vault vlt;
-    VaultRecordSet vrs;
+    std::vector<VaultRecordRef> refs;
     VaultOperationResult vor;
 
-    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<int>("A");
     vlt.AddUniqueKey<std::string>("B");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.CreateRecord({{"A", 0}, {"B", std::string("a")}});
 
-    vor = vlt.RequestGreaterOrEqual("B", 1, vrs);
+    // Repeated inside the batch
+    vor = vlt.CreateRecords(refs, {
+        {{"A", 1}, {"B", std::string("b")}},
+        {{"A", 2}, {"B", std::string("b")}}
+    });
 
-    TEST_ASSERT(vrs.Size() == 0);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(void));
 
-    COMPARE_VAULT(vrs, {});
+    // Already in the vault
+    vor = vlt.CreateRecords(refs, {
+        {{"A", 1}, {"B", std::string("b")}},
+        {{"A", 2}, {"B", std::string("a")}}
+    });
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(void));
+
+    TEST_ASSERT(refs.empty());
+
+    COMPARE_VAULT(vlt, {
+        {{"A", 0}, {"B", std::string("a")}}
+    })
+
+    // Values of the failed batches are not left inside the key structures
+    vor = vlt.CreateRecords(refs, {
+        {{"A", 1}, {"B", std::string("b")}},
+        {{"A", 2}, {"B", std::string("c")}}
+    });
+
+    TEST_ASSERT(vor.IsOperationSuccess);
+    TEST_ASSERT(vlt.Size() == 3);
 )
 
-TEST_BODY(RequestGreaterOrEqual, ValueNotInVault,
+TEST_BODY(CreateRecords, ManyBatches,
     Vault vlt;
     VaultRecordSet vrs;
-    VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddUniqueKey<int>("B");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    // First batch is loaded into empty structures, the second one is bigger than the vault and the third one is smaller
+    int counter = 0;
+    for (std::size_t batchSize : {1000, 3000, 500})
+    {
+        std::vector<std::vector<std::pair<std::string, VaultParamInput>>> batch;
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            batch.push_back({{"A", counter % 7}, {"B", (counter * 7919) % 10007}});
+            ++counter;
+        }
 
-    vor = vlt.RequestGreaterOrEqual("A", 4, vrs);
+        TEST_ASSERT(vlt.CreateRecords(batch).IsOperationSuccess);
+    }
 
-    TEST_ASSERT(vrs.Size() == 0);
+    TEST_ASSERT(vlt.Size() == 4500);
 
-    COMPARE_VAULT(vrs, {});
+    std::vector<VaultRecordRef> sortedRecords = vlt.GetSortedRecords("B");
+    TEST_ASSERT(sortedRecords.size() == 4500);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    int previous = -1;
+    for (const VaultRecordRef& ref : sortedRecords)
+    {
+        int b = -1;
+        ref.GetData("B", b);
+        TEST_ASSERT(b > previous);
+        previous = b;
+    }
+
+    vlt.RequestEqual("A", 3, vrs);
+    TEST_ASSERT(vrs.Size() == 643);
+
+    vlt.RequestInterval("B", 100, 199, vrs);
+    std::size_t expected = 0;
+    for (int i = 0; i < 4500; ++i)
+        if ((i * 7919) % 10007 >= 100 && (i * 7919) % 10007 <= 199) ++expected;
+    TEST_ASSERT(vrs.Size() == expected);
+
+    // Erase records loaded in bulk
+    vlt.EraseRecords("A", 3);
+    TEST_ASSERT(vlt.Size() == 4500 - 643);
+    TEST_ASSERT(vlt.GetSortedRecords("B").size() == 4500 - 643);
 )
 
-TEST_BODY(RequestLess, CorrectRequest,
+TEST_BODY(Transaction, CorrectCommit,
     Vault vlt;
-    VaultRecordSet vrs;
+    VaultRecordRef first, second;
+    std::vector<VaultRecordRef> refs;
     VaultOperationResult vor;
 
-    vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
-
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.AddUniqueKey<int>("A");
+    vlt.AddKey<std::string>("B", "");
 
-    vor = vlt.RequestLess("A", 3, vrs);
+    vlt.CreateRecord(first, {{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord(second, {{"A", 2}, {"B", std::string("b")}});
 
-    TEST_ASSERT(vrs.Size() == 4);
+    VaultTransaction transaction = vlt.BeginTransaction();
+    transaction.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    transaction.SetData(first, "B", std::string("d"));
+    transaction.SetData(first, {{"A", 4}});
+    transaction.EraseRecord(second);
+    transaction.CreateRecord({{"A", 5}});
 
-    COMPARE_VAULT(vrs, {
+    // Nothing is changed before commit
+    TEST_ASSERT(transaction.GetOperationsCount() == 5);
+    COMPARE_VAULT(vlt, {
         {{"A", 1}, {"B", std::string("a")}},
-        {{"A", 2}, {"B", std::string("b")}},
-        {{"A", 2}, {"B", std::string("bb")}},
-        {{"A", 2}, {"B", std::string("bbb")}},
+        {{"A", 2}, {"B", std::string("b")}}
     });
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    vor = transaction.Commit(refs);
 
-    vor = vlt.RequestLess("A", 2, vrs);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    TEST_ASSERT(vrs.Size() == 1);
+    TEST_ASSERT(transaction.GetOperationsCount() == 0);
+    TEST_ASSERT(refs.size() == 2);
+    int a = 0;
+    refs[0].GetData("A", a);
+    TEST_ASSERT(a == 3);
+    refs[1].GetData("A", a);
+    TEST_ASSERT(a == 5);
+    TEST_ASSERT(second.IsValid() == false);
 
-    COMPARE_VAULT(vrs, {{{"A", 1}, {"B", std::string("a")}}});
+    COMPARE_VAULT(vlt, {
+        {{"A", 4}, {"B", std::string("d")}},
+        {{"A", 3}, {"B", std::string("c")}},
+        {{"A", 5}, {"B", std::string("")}}
+    });
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    TEST_ASSERT(vlt.GetRecord("A", 1, first).ResultCode == VaultOperationResultCode::WrongValue);
+    TEST_ASSERT(vlt.GetRecord("A", 2, first).ResultCode == VaultOperationResultCode::WrongValue);
 )
 
-TEST_BODY(RequestLess, CorrectRequestNotAllRecords,
+TEST_BODY(Transaction, DuplicateUniqueKeyValue,
     Vault vlt;
+    VaultRecordRef first, second, third;
     VaultRecordSet vrs;
+    std::vector<VaultRecordRef> refs;
     VaultOperationResult vor;
 
-    vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddUniqueKey<int>("A");
+    vlt.AddKey("B", 0);
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.CreateRecord(first, {{"A", 1}, {"B", 10}});
+    vlt.CreateRecord(second, {{"A", 2}, {"B", 20}});
+    vlt.CreateRecord(third, {{"A", 3}, {"B", 30}});
+    vlt.RequestEqual("B", 10, vrs);
 
-    vor = vlt.RequestLess("A", 3, vrs, 2);
+    // Every kind of operation is applied before the conflict and must be undone
+    VaultTransaction transaction = vlt.BeginTransaction();
+    transaction.SetData(first, {{"A", 11}, {"B", 11}});
+    transaction.EraseRecord(second);
+    transaction.CreateRecord({{"A", 2}, {"B", 22}});
+    transaction.SetData(third, "A", 1);
+    transaction.CreateRecord({{"A", 11}});
+    transaction.CreateRecord({{"A", 6}});
 
-    TEST_ASSERT(vrs.Size() == 2);
+    vor = transaction.Commit(refs);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet, SavedType == typeid(void));
 
+    TEST_ASSERT(transaction.GetOperationsCount() == 0);
+    TEST_ASSERT(refs.empty());
+    TEST_ASSERT(second.IsValid());
 
-    vor = vlt.RequestLess("A", 2, vrs, 4);
+    COMPARE_VAULT(vlt, {
+        {{"A", 1}, {"B", 10}},
+        {{"A", 2}, {"B", 20}},
+        {{"A", 3}, {"B", 30}}
+    });
 
-    TEST_ASSERT(vrs.Size() == 1);
+    // Key structures contain only the old values
+    VaultRecordRef vrr;
+    int b = 0;
+    for (int a : {1, 2, 3})
+    {
+        TEST_ASSERT(vlt.GetRecord("A", a, vrr).IsOperationSuccess);
+        vrr.GetData("B", b);
+        TEST_ASSERT(b == a * 10);
+    }
 
-    COMPARE_VAULT(vrs, {{{"A", 1}, {"B", std::string("a")}}});
+    TEST_ASSERT(vlt.GetRecord("A", 11, vrr).ResultCode == VaultOperationResultCode::WrongValue);
+    TEST_ASSERT(vlt.GetRecord("A", 6, vrr).ResultCode == VaultOperationResultCode::WrongValue);
+    TEST_ASSERT(vlt.GetRecord("B", 22, vrr).ResultCode == VaultOperationResultCode::WrongValue);
+    TEST_ASSERT(vlt.GetSortedRecords("A").size() == 3);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    // Sets that depend on the records stay the same
+    TEST_ASSERT(vrs.Size() == 1);
+    TEST_ASSERT(vrs.GetRecord("B", 10, vrr).IsOperationSuccess);
+    TEST_ASSERT(vrs.GetRecord("A", 1, vrr).IsOperationSuccess);
+
+    // Old values still can be changed
+    TEST_ASSERT(first.SetData("A", 2).ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet);
+    TEST_ASSERT(first.SetData("A", 11).IsOperationSuccess);
 )
 
-TEST_BODY(RequestLess, CorrectRequestWithPredicat,
+TEST_BODY(Transaction, RollbackIndexes,
     Vault vlt;
-    VaultRecordSet vrs;
-    VaultOperationResult vor;
+    VaultRecordRef first, second;
+    VaultGroup<long long> group;
+    std::vector<std::string> keys = {"host", "port"};
 
-    vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddKey<std::string>("host", "");
+    vlt.AddKey("port", 0);
+    vlt.AddKey<long long>("bytes", 0);
+    vlt.AddUniqueKey<int>("id");
+    vlt.AddCompositeIndex(keys);
+    vlt.AddGroupBy<std::string, long long>("host", "bytes");
+    vlt.AddLockFreeReadKey<int>("id");
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.CreateRecord(first, {{"host", std::string("a")}, {"port", 80}, {"bytes", 10LL}, {"id", 1}});
+    vlt.CreateRecord(second, {{"host", std::string("b")}, {"port", 80}, {"bytes", 20LL}, {"id", 2}});
 
-    vor = vlt.RequestLess("A", 3, vrs, -1, [](const VaultRecordRef& ref) -> bool
-    {
-        std::string s;
-        ref.GetData("B", s);
-        if (s.length() > 1) return true;
-        else return false;
-    });
+    VaultTransaction transaction = vlt.BeginTransaction();
+    transaction.SetData(first, {{"host", std::string("b")}, {"bytes", 15LL}});
+    transaction.EraseRecord(second);
+    transaction.SetData(first, "id", 3);
+    transaction.CreateRecord({{"host", std::string("a")}, {"id", 3}});
 
-    TEST_ASSERT(vrs.Size() == 2);
+    TEST_ASSERT(transaction.Commit().ResultCode == VaultOperationResultCode::UniqueKeyValueAlredyInSet);
 
-    COMPARE_VAULT(vrs, {
-        {{"A", 2}, {"B", std::string("bb")}},
-        {{"A", 2}, {"B", std::string("bbb")}},
-    });
+    std::size_t count = 0;
+    vlt.Count(Equal("host", std::string("a")) && Equal("port", 80), count);
+    TEST_ASSERT(count == 1);
+    vlt.Count(Equal("host", std::string("b")) && Equal("port", 80), count);
+    TEST_ASSERT(count == 1);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    vlt.GetGroup("host", "bytes", std::string("a"), group);
+    TEST_ASSERT(group.Count == 1 && group.Sum == 10);
+    vlt.GetGroup("host", "bytes", std::string("b"), group);
+    TEST_ASSERT(group.Count == 1 && group.Sum == 20);
+
+    std::string host;
+    TEST_ASSERT(vlt.ReadRecord("id", 1, [&](const VaultRecordSnapshot& snapshot) { snapshot.GetData("host", host); }).IsOperationSuccess);
+    TEST_ASSERT(host == "a");
+    TEST_ASSERT(vlt.ReadRecord("id", 2, [&](const VaultRecordSnapshot& snapshot) { snapshot.GetData("host", host); }).IsOperationSuccess);
+    TEST_ASSERT(host == "b");
+    TEST_ASSERT(vlt.ReadRecord("id", 3, [&](const VaultRecordSnapshot&) {}).ResultCode == VaultOperationResultCode::WrongValue);
 )
 
-TEST_BODY(RequestLess, BoundaryValues,
+TEST_BODY(Transaction, EraseAndCreateSameUniqueValue,
     Vault vlt;
-    VaultRecordSet vrs;
-
-    vlt.AddKey("A", 0);
+    VaultRecordRef vrr;
+    std::vector<VaultRecordRef> refs;
 
-    // ...1...3...5...
-    vlt.CreateRecord({{"A", 1}});
-    vlt.CreateRecord({{"A", 3}});
-    vlt.CreateRecord({{"A", 5}});
+    vlt.AddUniqueKey<int>("A");
+    vlt.AddKey("B", 0);
 
-    //  x
-    // ...1...3...5...
-    vlt.RequestLess("A", 0, vrs);
-    COMPARE_VAULT(vrs, {});
+    vlt.CreateRecord(vrr, {{"A", 1}, {"B", 1}});
 
-    //    x
-    // ...1...3...5...
-    vlt.RequestLess("A", 1, vrs);
-    COMPARE_VAULT(vrs, {});
+    // The value becomes free inside the transaction
+    VaultTransaction transaction = vlt.BeginTransaction();
+    transaction.EraseRecord(vrr);
+    transaction.CreateRecord({{"A", 1}, {"B", 2}});
 
-    //      x
-    // ...1...3...5...
-    vlt.RequestLess("A", 2, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}});
+    TEST_ASSERT(transaction.Commit(refs).IsOperationSuccess);
+    TEST_ASSERT(refs.size() == 1);
+    TEST_ASSERT(vrr.IsValid() == false);
 
-    //        x
-    // ...1...3...5...
-    vlt.RequestLess("A", 3, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}});
+    COMPARE_VAULT(vlt, {
+        {{"A", 1}, {"B", 2}}
+    });
+)
 
-    //          x
-    // ...1...3...5...
-    vlt.RequestLess("A", 4, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}});
+TEST_BODY(Transaction, WrongRecord,
+    Vault vlt, otherVlt;
+    VaultRecordRef vrr, otherVrr;
+    VaultOperationResult vor;
 
-    //            x
-    // ...1...3...5...
-    vlt.RequestLess("A", 5, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}});
+    vlt.AddKey("A", 0);
+    otherVlt.AddKey("A", 0);
 
-    //              x
-    // ...1...3...5...
-    vlt.RequestLess("A", 6, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}, {{"A", 5}}});
+    vlt.CreateRecord(vrr, {{"A", 1}});
+    otherVlt.CreateRecord(otherVrr, {{"A", 1}});
+
+    VaultTransaction transaction = vlt.BeginTransaction();
+
+    // Record from other vault
+    transaction.CreateRecord({{"A", 2}});
+    transaction.SetData(otherVrr, "A", 3);
+    vor = transaction.Commit();
+    TEST_ASSERT(vor.IsOperationSuccess == false);
+    TEST_ASSERT(vor.ResultCode == VaultOperationResultCode::ParentVaultNotMatch);
+
+    // Record erased by the previous operation
+    transaction.EraseRecord(vrr);
+    transaction.SetData(vrr, "A", 3);
+    vor = transaction.Commit();
+    TEST_ASSERT(vor.IsOperationSuccess == false);
+    TEST_ASSERT(vor.ResultCode == VaultOperationResultCode::DataRecordNotValid);
+
+    // Wrong type is checked by the vault
+    transaction.SetData(vrr, "A", std::string("a"));
+    vor = transaction.Commit();
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+
+    // Empty reference
+    transaction.EraseRecord(VaultRecordRef());
+    TEST_ASSERT(transaction.Commit().IsOperationSuccess == false);
+
+    COMPARE_VAULT(vlt, {
+        {{"A", 1}}
+    });
+
+    COMPARE_VAULT(otherVlt, {
+        {{"A", 1}}
+    });
 )
 
-TEST_BODY(RequestLess, WrongKey,
+TEST_BODY(Transaction, Rollback,
     Vault vlt;
-    VaultRecordSet vrs;
+    VaultRecordRef vrr;
+
+    vlt.AddKey("A", 0);
+    vlt.CreateRecord(vrr, {{"A", 1}});
+
+    VaultTransaction transaction = vlt.BeginTransaction();
+    transaction.SetData(vrr, "A", 2);
+    transaction.CreateRecord({{"A", 3}});
+    transaction.Rollback();
+
+    TEST_ASSERT(transaction.GetOperationsCount() == 0);
+    TEST_ASSERT(transaction.Commit().IsOperationSuccess);
+
+    // Not committed operations are discarded by the destructor
+    {
+        VaultTransaction otherTransaction = vlt.BeginTransaction();
+        otherTransaction.EraseRecord(vrr);
+
+        // Moved transaction keeps the operations
+        transaction = std::move(otherTransaction);
+        TEST_ASSERT(otherTransaction.GetOperationsCount() == 0);
+        TEST_ASSERT(transaction.GetOperationsCount() == 1);
+
+        VaultTransaction discardedTransaction = vlt.BeginTransaction();
+        discardedTransaction.CreateRecord({{"A", 4}});
+    }
+
+    COMPARE_VAULT(vlt, {
+        {{"A", 1}}
+    });
+
+    TEST_ASSERT(transaction.Commit().IsOperationSuccess);
+    TEST_ASSERT(vlt.Size() == 0);
+)
+
+TEST_BODY(GetRecord, CorrectGetRecord,
+    Vault vlt;
+    VaultRecordRef vrr;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
@@ -2054,19 +2676,25 @@ TEST_BODY(RequestLess, WrongKey,
     vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
     vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
 
-    vor = vlt.RequestLess("Z", 1, vrs);
+    vor = vlt.GetRecord("A", 1, vrr);
+    
+    COMPARE_REF(vrr, {{{"A", 1}, {"B", std::string("a")}}});
 
-    TEST_ASSERT(vrs.Size() == 0);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 
-    COMPARE_VAULT(vrs, {});
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+    vor = vlt.GetRecord<std::string>("B", "c", vrr);
+    
+    COMPARE_REF(vrr, {{{"A", 3}, {"B", std::string("c")}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(std::string));
 )
 
-TEST_BODY(RequestLess, WrongType,
+TEST_BODY(GetRecord, WrongKey,
     Vault vlt;
-    VaultRecordSet vrs;
+    VaultRecordRef vrr;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
@@ -2076,19 +2704,33 @@ TEST_BODY(RequestLess, WrongType,
     vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
     vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
 
-    vor = vlt.RequestLess("B", 1, vrs);
+    vor = vlt.GetRecord("Z", 1, vrr);
 
-    TEST_ASSERT(vrs.Size() == 0);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+)
 
-    COMPARE_VAULT(vrs, {});
+TEST_BODY(GetRecord, WrongType,
+    Vault vlt;
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.GetRecord("B", 1, vrr);
 
     COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
 )
 
-TEST_BODY(RequestLess, ValueNotInVault,
+TEST_BODY(GetRecord, WrongValue,
     Vault vlt;
-    VaultRecordSet vrs;
+    VaultRecordRef vrr;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
@@ -2098,19 +2740,16 @@ TEST_BODY(RequestLess, ValueNotInVault,
     vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
     vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
 
-    vor = vlt.RequestLess("A", 1, vrs);
-
-    TEST_ASSERT(vrs.Size() == 0);
-
-    COMPARE_VAULT(vrs, {});
+    vor = vlt.GetRecord("A", 99, vrr);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
 )
 
-TEST_BODY(RequestLessOrEqual, CorrectRequest,
+TEST_BODY(GetRecord, CorrectByKeyHandle,
     Vault vlt;
-    VaultRecordSet vrs;
+    KeyHandle<std::string> handle;
+    VaultRecordRef vrr;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
@@ -2118,37 +2757,63 @@ TEST_BODY(RequestLessOrEqual, CorrectRequest,
 
     vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
 
-    vor = vlt.RequestLessOrEqual("A", 2, vrs);
+    vlt.GetKeyHandle("B", handle);
 
-    TEST_ASSERT(vrs.Size() == 4);
+    vor = vlt.GetRecord(handle, std::string("b"), vrr);
 
-    COMPARE_VAULT(vrs, {
-        {{"A", 1}, {"B", std::string("a")}},
-        {{"A", 2}, {"B", std::string("b")}},
-        {{"A", 2}, {"B", std::string("bb")}},
-        {{"A", 2}, {"B", std::string("bbb")}},
-    });
+    COMPARE_REF(vrr, {{{"A", 2}, {"B", std::string("b")}}});
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(std::string));
 
-    vor = vlt.RequestLessOrEqual("A", 1, vrs);
+    vor = vlt.GetRecord(handle, std::string("z"), vrr);
 
-    TEST_ASSERT(vrs.Size() == 1);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(std::string));
+)
 
-    COMPARE_VAULT(vrs, {{{"A", 1}, {"B", std::string("a")}}});
+TEST_BODY(GetRecord, ManyRecordsAfterErase,
+    Vault vlt;
+    VaultRecordRef vrr;
+    VaultOperationResult vor;
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    vlt.AddUniqueKey<int>("A");
+    vlt.AddUniqueKey<std::string>("B");
+
+    for (int i = 0; i < 10000; ++i) vlt.CreateRecord({{"A", i}, {"B", std::to_string(i)}});
+
+    // Erase every second record, so values after erased ones are moved inside the hash table
+    for (int i = 0; i < 10000; i += 2) vlt.EraseRecord("A", i);
+
+    TEST_ASSERT(vlt.Size() == 5000);
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        vor = vlt.GetRecord("A", i, vrr);
+        TEST_ASSERT(vor.IsOperationSuccess == (i % 2 == 1));
+
+        vor = vlt.GetRecord("B", std::to_string(i), vrr);
+        TEST_ASSERT(vor.IsOperationSuccess == (i % 2 == 1));
+    }
+
+    // Erased values can be used again
+    for (int i = 0; i < 10000; i += 2) vlt.CreateRecord({{"A", i}, {"B", std::to_string(i)}});
+
+    TEST_ASSERT(vlt.Size() == 10000);
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        int a = -1;
+        vor = vlt.GetRecord("B", std::to_string(i), vrr);
+        vrr.GetData("A", a);
+        TEST_ASSERT(a == i);
+    }
 )
 
-TEST_BODY(RequestLessOrEqual, CorrectRequestNotAllRecords,
+TEST_BODY(GetRecords, CorrectGetRecords,
     Vault vlt;
-    VaultRecordSet vrs;
+    std::vector<VaultRecordRef> records;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
@@ -2158,29 +2823,45 @@ TEST_BODY(RequestLessOrEqual, CorrectRequestNotAllRecords,
     vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-
-    vor = vlt.RequestLessOrEqual("A", 3, vrs, 2);
 
-    TEST_ASSERT(vrs.Size() == 2);
+    vor = vlt.GetRecords("A", 1, records);
+    
+    TEST_ASSERT(records.size() == 1);
+    COMPARE_REF(records[0], {{{"A", 1}, {"B", std::string("a")}}});
 
     COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 
 
-    vor = vlt.RequestLessOrEqual("A", 1, vrs, 4);
+    vor = vlt.GetRecords("A", 2, records);
+    
+    TEST_ASSERT(records.size() == 3);
 
-    TEST_ASSERT(vrs.Size() == 1);
+    int resI = 0;
+    std::string resS;
 
-    COMPARE_VAULT(vrs, {{{"A", 1}, {"B", std::string("a")}}});
+    for (const VaultRecordRef& ref : records)
+    {
+        int i = 0;
+        std::string s;
+
+        ref.GetData("A", i);
+        ref.GetData("B", s);
+
+        resI += i;
+        resS += s;
+    }
+
+    TEST_ASSERT(resI == 6);
+    TEST_ASSERT(resS == "bbbbbb");
 
     COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 )
 
-TEST_BODY(RequestLessOrEqual, CorrectRequestWithPredicat,
+TEST_BODY(GetRecords, CorrectGetNotAllRecords,
     Vault vlt;
-    VaultRecordSet vrs;
+    std::vector<VaultRecordRef> records;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
@@ -2190,77 +2871,69 @@ TEST_BODY(RequestLessOrEqual, CorrectRequestWithPredicat,
     vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
 
-    vor = vlt.RequestLessOrEqual("A", 2, vrs, -1, [](const VaultRecordRef& ref) -> bool
-    {
-        std::string s;
-        ref.GetData("B", s);
-        if (s.length() > 1) return true;
-        else return false;
-    });
+    vor = vlt.GetRecords("A", 1, records, 2);
+    
+    TEST_ASSERT(records.size() == 1);
+    COMPARE_REF(records[0], {{{"A", 1}, {"B", std::string("a")}}});
 
-    TEST_ASSERT(vrs.Size() == 2);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+    RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 
-    COMPARE_VAULT(vrs, {
-        {{"A", 2}, {"B", std::string("bb")}},
-        {{"A", 2}, {"B", std::string("bbb")}},
-    });
+
+    vor = vlt.GetRecords("A", 2, records, 2);
+
+    TEST_ASSERT(records.size() == 2);
 
     COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 )
 
-TEST_BODY(RequestLessOrEqual, BoundaryValues,
+TEST_BODY(GetRecords, WrongKey,
     Vault vlt;
-    VaultRecordSet vrs;
+    std::vector<VaultRecordRef> records;
+    VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
 
-    // ...1...3...5...
-    vlt.CreateRecord({{"A", 1}});
-    vlt.CreateRecord({{"A", 3}});
-    vlt.CreateRecord({{"A", 5}});
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
 
-    //  x
-    // ...1...3...5...
-    vlt.RequestLessOrEqual("A", 0, vrs);
-    COMPARE_VAULT(vrs, {});
+    vor = vlt.GetRecords("Z", 1, records);
+    
+    TEST_ASSERT(records.size() == 0);
 
-    //    x
-    // ...1...3...5...
-    vlt.RequestLessOrEqual("A", 1, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+)
 
-    //      x
-    // ...1...3...5...
-    vlt.RequestLessOrEqual("A", 2, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}});
+TEST_BODY(GetRecords, WrongType,
+    Vault vlt;
+    std::vector<VaultRecordRef> records;
+    VaultOperationResult vor;
 
-    //        x
-    // ...1...3...5...
-    vlt.RequestLessOrEqual("A", 3, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}});
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
 
-    //          x
-    // ...1...3...5...
-    vlt.RequestLessOrEqual("A", 4, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}});
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
 
-    //            x
-    // ...1...3...5...
-    vlt.RequestLessOrEqual("A", 5, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}, {{"A", 5}}});
+    vor = vlt.GetRecords("B", 1, records);
+    
+    TEST_ASSERT(records.size() == 0);
 
-    //              x
-    // ...1...3...5...
-    vlt.RequestLessOrEqual("A", 6, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}, {{"A", 5}}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
 )
 
-TEST_BODY(RequestLessOrEqual, WrongKey,
+TEST_BODY(GetRecords, WrongValue,
     Vault vlt;
-    VaultRecordSet vrs;
+    std::vector<VaultRecordRef> records;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
@@ -2268,21 +2941,21 @@ TEST_BODY(RequestLessOrEqual, WrongKey,
 
     vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-
-    vor = vlt.RequestLessOrEqual("Z", 1, vrs);
-
-    TEST_ASSERT(vrs.Size() == 0);
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
 
-    COMPARE_VAULT(vrs, {});
+    vor = vlt.GetRecords("A", 99, records);
+    
+    TEST_ASSERT(records.size() == 0);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
 )
 
-TEST_BODY(RequestLessOrEqual, WrongType,
+TEST_BODY(GetRecords, CorrectByKeyHandle,
     Vault vlt;
-    VaultRecordSet vrs;
+    KeyHandle<int> handle;
+    std::vector<VaultRecordRef> records;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
@@ -2290,41 +2963,64 @@ TEST_BODY(RequestLessOrEqual, WrongType,
 
     vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
 
-    vor = vlt.RequestLessOrEqual("B", 1, vrs);
+    vlt.GetKeyHandle("A", handle);
 
-    TEST_ASSERT(vrs.Size() == 0);
+    vor = vlt.GetRecords(handle, 2, records);
 
-    COMPARE_VAULT(vrs, {});
+    TEST_ASSERT(records.size() == 2);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    vor = vlt.GetRecords(handle, 99, records);
+
+    TEST_ASSERT(records.size() == 0);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
 )
 
-TEST_BODY(RequestLessOrEqual, ValueNotInVault,
+TEST_BODY(GetRecords, ManyRecordsAfterErase,
     Vault vlt;
-    VaultRecordSet vrs;
-    VaultOperationResult vor;
+    std::vector<VaultRecordRef> records;
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddKey("B", 0);
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    for (int i = 0; i < 10000; ++i) vlt.CreateRecord({{"A", i % 10}, {"B", i}});
 
-    vor = vlt.RequestLessOrEqual("A", 0, vrs);
+    // Erase records from the middle of the records with the same value
+    for (int i = 0; i < 10000; i += 3) vlt.EraseRecord("B", i);
 
-    TEST_ASSERT(vrs.Size() == 0);
+    for (int i = 0; i < 10; ++i)
+    {
+        std::size_t expected = 0;
+        for (int j = i; j < 10000; j += 10)
+            if (j % 3 != 0) ++expected;
 
-    COMPARE_VAULT(vrs, {});
+        vlt.GetRecords("A", i, records);
+        TEST_ASSERT(records.size() == expected);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+        for (const VaultRecordRef& record : records)
+        {
+            int a = -1, b = -1;
+            record.GetData("A", a);
+            record.GetData("B", b);
+            TEST_ASSERT(a == i);
+            TEST_ASSERT(b % 3 != 0);
+        }
+    }
+
+    // Erase all remaining records with one value
+    vlt.EraseRecords("A", 5);
+    vlt.GetRecords("A", 5, records);
+    TEST_ASSERT(records.size() == 0);
+    TEST_ASSERT(vlt.Size() == 6666 - 667);
 )
 
-TEST_BODY(RequestInterval, CorrectRequest,
+TEST_BODY(RequestEqual, CorrectRequest,
     Vault vlt;
     VaultRecordSet vrs;
     VaultOperationResult vor;
@@ -2335,28 +3031,34 @@ TEST_BODY(RequestInterval, CorrectRequest,
     vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
     vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
-    vlt.CreateRecord({{"A", 4}, {"B", std::string("dd")}});
-    vlt.CreateRecord({{"A", 5}, {"B", std::string("ee")}});
 
-    vor = vlt.RequestInterval("A", 2, 4, vrs);
+    vor = vlt.RequestEqual("A", 1, vrs);
 
-    TEST_ASSERT(vrs.Size() == 5);
+    TEST_ASSERT(vrs.Size() == 1);
+
+    COMPARE_VAULT(vrs, {{{"A", 1}, {"B", std::string("a")}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+
+    vor = vlt.RequestEqual("A", 2, vrs);
+
+    TEST_ASSERT(vrs.Size() == 3);
 
     COMPARE_VAULT(vrs, {
         {{"A", 2}, {"B", std::string("b")}},
         {{"A", 2}, {"B", std::string("bb")}},
-        {{"A", 3}, {"B", std::string("c")}},
-        {{"A", 4}, {"B", std::string("d")}},
-        {{"A", 4}, {"B", std::string("dd")}},
+        {{"A", 2}, {"B", std::string("bbb")}},
     });
 
     COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 )
 
-TEST_BODY(RequestInterval, CorrectRequestWithoutLeftBoundary,
+TEST_BODY(RequestEqual, CorrectRequestNotAllRecords,
     Vault vlt;
     VaultRecordSet vrs;
     VaultOperationResult vor;
@@ -2367,26 +3069,28 @@ TEST_BODY(RequestInterval, CorrectRequestWithoutLeftBoundary,
     vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
     vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
-    vlt.CreateRecord({{"A", 4}, {"B", std::string("dd")}});
-    vlt.CreateRecord({{"A", 5}, {"B", std::string("ee")}});
 
-    vor = vlt.RequestInterval("A", 2, 4, vrs, false);
+    vor = vlt.RequestEqual("A", 1, vrs, 2);
 
-    TEST_ASSERT(vrs.Size() == 3);
+    TEST_ASSERT(vrs.Size() == 1);
 
-    COMPARE_VAULT(vrs, {
-        {{"A", 3}, {"B", std::string("c")}},
-        {{"A", 4}, {"B", std::string("d")}},
-        {{"A", 4}, {"B", std::string("dd")}},
-    });
+    COMPARE_VAULT(vrs, {{{"A", 1}, {"B", std::string("a")}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+
+    vor = vlt.RequestEqual("A", 2, vrs, 2);
+
+    TEST_ASSERT(vrs.Size() == 2);
 
     COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 )
 
-TEST_BODY(RequestInterval, CorrectRequestWithoutRightBoundary,
+TEST_BODY(RequestEqual, CorrectRequestWithPredicat,
     Vault vlt;
     VaultRecordSet vrs;
     VaultOperationResult vor;
@@ -2397,26 +3101,29 @@ TEST_BODY(RequestInterval, CorrectRequestWithoutRightBoundary,
     vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
     vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
-    vlt.CreateRecord({{"A", 4}, {"B", std::string("dd")}});
-    vlt.CreateRecord({{"A", 5}, {"B", std::string("ee")}});
 
-    vor = vlt.RequestInterval("A", 2, 4, vrs, true, false);
+    vor = vlt.RequestEqual("A", 2, vrs, -1, [](const VaultRecordRef& ref) -> bool
+    {
+        std::string s;
+        ref.GetData("B", s);
+        if (s.length() <= 2) return true;
+        else return false;
+    });
 
-    TEST_ASSERT(vrs.Size() == 3);
+    TEST_ASSERT(vrs.Size() == 2);
 
     COMPARE_VAULT(vrs, {
         {{"A", 2}, {"B", std::string("b")}},
         {{"A", 2}, {"B", std::string("bb")}},
-        {{"A", 3}, {"B", std::string("c")}},
     });
 
     COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 )
 
-TEST_BODY(RequestInterval, CorrectRequestWithoutBoundaries,
+TEST_BODY(RequestEqual, WrongKey,
     Vault vlt;
     VaultRecordSet vrs;
     VaultOperationResult vor;
@@ -2426,25 +3133,19 @@ TEST_BODY(RequestInterval, CorrectRequestWithoutBoundaries,
 
     vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
     vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
-    vlt.CreateRecord({{"A", 4}, {"B", std::string("dd")}});
-    vlt.CreateRecord({{"A", 5}, {"B", std::string("ee")}});
 
-    vor = vlt.RequestInterval("A", 2, 4, vrs, false, false);
+    vor = vlt.RequestEqual("Z", 1, vrs);
 
-    TEST_ASSERT(vrs.Size() == 1);
+    TEST_ASSERT(vrs.Size() == 0);
 
-    COMPARE_VAULT(vrs, {
-        {{"A", 3}, {"B", std::string("c")}},
-    });
+    COMPARE_VAULT(vrs, {});
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 )
 
-TEST_BODY(RequestInterval, CorrectRequestNotAllRecords,
+TEST_BODY(RequestEqual, WrongType,
     Vault vlt;
     VaultRecordSet vrs;
     VaultOperationResult vor;
@@ -2454,30 +3155,43 @@ TEST_BODY(RequestInterval, CorrectRequestNotAllRecords,
 
     vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
     vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
-    vlt.CreateRecord({{"A", 4}, {"B", std::string("dd")}});
-    vlt.CreateRecord({{"A", 5}, {"B", std::string("ee")}});
 
-    vor = vlt.RequestInterval("A", 2, 4, vrs, true, true, 3);
+    vor = vlt.RequestEqual("B", 1, vrs);
 
-    TEST_ASSERT(vrs.Size() == 3);
+    TEST_ASSERT(vrs.Size() == 0);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    COMPARE_VAULT(vrs, {});
 
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
+)
 
-    vor = vlt.RequestInterval("A", 2, 4, vrs, true, true, 8);
+TEST_BODY(RequestEqual, ValueNotInVault,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
 
-    TEST_ASSERT(vrs.Size() == 5);
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestEqual("A", 4, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
 
     COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 )
 
-TEST_BODY(RequestInterval, CorrectRequestWithPredicat,
+TEST_BODY(RequestEqual, CorrectByKeyHandle,
     Vault vlt;
+    KeyHandle<int> handle;
     VaultRecordSet vrs;
     VaultOperationResult vor;
 
@@ -2488,311 +3202,2057 @@ TEST_BODY(RequestInterval, CorrectRequestWithPredicat,
     vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
     vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
     vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
-    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
-    vlt.CreateRecord({{"A", 4}, {"B", std::string("dd")}});
-    vlt.CreateRecord({{"A", 5}, {"B", std::string("ee")}});
 
-    vor = vlt.RequestInterval("A", 2, 4, vrs, true, true, -1, [](const VaultRecordRef& ref) -> bool
-    {
-        std::string s;
-        ref.GetData("B", s);
-        if (s.length() > 1) return true;
-        else return false;
-    });
+    vlt.GetKeyHandle("A", handle);
+
+    vor = vlt.RequestEqual(handle, 2, vrs);
 
     TEST_ASSERT(vrs.Size() == 2);
 
     COMPARE_VAULT(vrs, {
+        {{"A", 2}, {"B", std::string("b")}},
         {{"A", 2}, {"B", std::string("bb")}},
-        {{"A", 4}, {"B", std::string("dd")}},
     });
 
     COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    vlt.EraseRecord("B", std::string("b"));
+
+    TEST_ASSERT(vrs.Size() == 1);
+
+    COMPARE_VAULT(vrs, {{{"A", 2}, {"B", std::string("bb")}}});
 )
 
-TEST_BODY(RequestInterval, BoundaryValues,
+TEST_BODY(RequestGreater, CorrectRequest,
     Vault vlt;
     VaultRecordSet vrs;
+    VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
 
-    // ....1....5....9....
-    vlt.CreateRecord({{"A", 1}});
-    vlt.CreateRecord({{"A", 5}});
-    vlt.CreateRecord({{"A", 9}});
-
-    //  xx
-    // ....1....5....9....
-    vlt.RequestInterval("A", -1, 0, vrs);
-    COMPARE_VAULT(vrs, {});
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
 
-    vlt.RequestInterval("A", -1, 0, vrs, false);
-    COMPARE_VAULT(vrs, {});
+    vor = vlt.RequestGreater("A", 1, vrs);
 
-    vlt.RequestInterval("A", -1, 0, vrs, true, false);
-    COMPARE_VAULT(vrs, {});
+    TEST_ASSERT(vrs.Size() == 4);
 
-    vlt.RequestInterval("A", -1, 0, vrs, false, false);
-    COMPARE_VAULT(vrs, {});
+    COMPARE_VAULT(vrs, {
+        {{"A", 2}, {"B", std::string("b")}},
+        {{"A", 2}, {"B", std::string("bb")}},
+        {{"A", 2}, {"B", std::string("bbb")}},
+        {{"A", 3}, {"B", std::string("c")}},
+    });
 
-    //  x  x
-    // ....1....5....9....
-    vlt.RequestInterval("A", -1, 1, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 
-    vlt.RequestInterval("A", -1, 1, vrs, false);
-    COMPARE_VAULT(vrs, {{{"A", 1}}});
 
-    vlt.RequestInterval("A", -1, 1, vrs, true, false);
-    COMPARE_VAULT(vrs, {});
+    vor = vlt.RequestGreater("A", 2, vrs);
 
-    vlt.RequestInterval("A", -1, 1, vrs, false, false);
-    COMPARE_VAULT(vrs, {});
+    TEST_ASSERT(vrs.Size() == 1);
 
-    //  x    x
-    // ....1....5....9....
-    vlt.RequestInterval("A", -1, 2, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}});
+    COMPARE_VAULT(vrs, {{{"A", 3}, {"B", std::string("c")}}});
 
-    vlt.RequestInterval("A", -1, 2, vrs, false);
-    COMPARE_VAULT(vrs, {{{"A", 1}}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
 
-    vlt.RequestInterval("A", -1, 2, vrs, true, false);
-    COMPARE_VAULT(vrs, {{{"A", 1}}});
+TEST_BODY(RequestGreater, CorrectRequestNotAllRecords,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
 
-    vlt.RequestInterval("A", -1, 2, vrs, false, false);
-    COMPARE_VAULT(vrs, {{{"A", 1}}});
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
 
-    //     x x
-    // ....1....5....9....
-    vlt.RequestInterval("A", 1, 2, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 1}}});
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
 
-    vlt.RequestInterval("A", 1, 2, vrs, false);
-    COMPARE_VAULT(vrs, {});
+    vor = vlt.RequestGreater("A", 1, vrs, 2);
 
-    vlt.RequestInterval("A", 1, 2, vrs, true, false);
-    COMPARE_VAULT(vrs, {{{"A", 1}}});
+    TEST_ASSERT(vrs.Size() == 2);
 
-    vlt.RequestInterval("A", 1, 2, vrs, false, false);
-    COMPARE_VAULT(vrs, {});
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 
-    //       xx
-    // ....1....5....9....
-    vlt.RequestInterval("A", 2, 3, vrs);
-    COMPARE_VAULT(vrs, {});
 
-    vlt.RequestInterval("A", 2, 3, vrs, false);
-    COMPARE_VAULT(vrs, {});
+    vor = vlt.RequestGreater("A", 2, vrs, 4);
 
-    vlt.RequestInterval("A", 2, 3, vrs, true, false);
-    COMPARE_VAULT(vrs, {});
+    TEST_ASSERT(vrs.Size() == 1);
 
-    vlt.RequestInterval("A", 2, 3, vrs, false, false);
-    COMPARE_VAULT(vrs, {});
+    COMPARE_VAULT(vrs, {{{"A", 3}, {"B", std::string("c")}}});
 
-    //       x  x
-    // ....1....5....9....
-    vlt.RequestInterval("A", 2, 5, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 5}}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
 
-    vlt.RequestInterval("A", 2, 5, vrs, false);
-    COMPARE_VAULT(vrs, {{{"A", 5}}});
+TEST_BODY(RequestGreater, CorrectRequestWithPredicat,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
 
-    vlt.RequestInterval("A", 2, 5, vrs, true, false);
-    COMPARE_VAULT(vrs, {});
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
 
-    vlt.RequestInterval("A", 2, 5, vrs, false, false);
-    COMPARE_VAULT(vrs, {});
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
 
-    //       x    x
-    // ....1....5....9....
-    vlt.RequestInterval("A", 2, 6, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 5}}});
+    vor = vlt.RequestGreater("A", 0, vrs, -1, [](const VaultRecordRef& ref) -> bool
+    {
+        std::string s;
+        ref.GetData("B", s);
+        if (s.length() > 1) return true;
+        else return false;
+    });
 
-    vlt.RequestInterval("A", 2, 6, vrs, false);
-    COMPARE_VAULT(vrs, {{{"A", 5}}});
+    TEST_ASSERT(vrs.Size() == 2);
 
-    vlt.RequestInterval("A", 2, 6, vrs, true, false);
-    COMPARE_VAULT(vrs, {{{"A", 5}}});
+    COMPARE_VAULT(vrs, {
+        {{"A", 2}, {"B", std::string("bb")}},
+        {{"A", 2}, {"B", std::string("bbb")}},
+    });
 
-    vlt.RequestInterval("A", 2, 6, vrs, false, false);
-    COMPARE_VAULT(vrs, {{{"A", 5}}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
 
-    //          x  x
-    // ....1....5....9....
-    vlt.RequestInterval("A", 5, 6, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 5}}});
+TEST_BODY(RequestGreater, BoundaryValues,
+    Vault vlt;
+    VaultRecordSet vrs;
 
-    vlt.RequestInterval("A", 5, 6, vrs, false);
-    COMPARE_VAULT(vrs, {});
+    vlt.AddKey("A", 0);
 
-    vlt.RequestInterval("A", 5, 6, vrs, true, false);
+    // ...1...3...5...
+    vlt.CreateRecord({{"A", 1}});
+    vlt.CreateRecord({{"A", 3}});
+    vlt.CreateRecord({{"A", 5}});
+
+    //  x
+    // ...1...3...5...
+    vlt.RequestGreater("A", 0, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}, {{"A", 5}}});
+
+    //    x
+    // ...1...3...5...
+    vlt.RequestGreater("A", 1, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 3}}, {{"A", 5}}});
+
+    //      x
+    // ...1...3...5...
+    vlt.RequestGreater("A", 2, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 3}}, {{"A", 5}}});
+
+    //        x
+    // ...1...3...5...
+    vlt.RequestGreater("A", 3, vrs);
     COMPARE_VAULT(vrs, {{{"A", 5}}});
 
-    vlt.RequestInterval("A", 5, 6, vrs, false, false);
-    COMPARE_VAULT(vrs, {});
+    //          x
+    // ...1...3...5...
+    vlt.RequestGreater("A", 4, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 5}}});
 
-    //            xx
-    // ....1....5....9....
-    vlt.RequestInterval("A", 6, 7, vrs);
+    //            x
+    // ...1...3...5...
+    vlt.RequestGreater("A", 5, vrs);
     COMPARE_VAULT(vrs, {});
 
-    vlt.RequestInterval("A", 6, 7, vrs, false);
+    //              x
+    // ...1...3...5...
+    vlt.RequestGreater("A", 6, vrs);
     COMPARE_VAULT(vrs, {});
+)
 
-    vlt.RequestInterval("A", 6, 7, vrs, true, false);
-    COMPARE_VAULT(vrs, {});
+TEST_BODY(RequestGreater, WrongKey,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
 
-    vlt.RequestInterval("A", 6, 7, vrs, false, false);
-    COMPARE_VAULT(vrs, {});
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
 
-    //            x  x
-    // ....1....5....9....
-    vlt.RequestInterval("A", 6, 9, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 9}}});
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
 
-    vlt.RequestInterval("A", 6, 9, vrs, false);
-    COMPARE_VAULT(vrs, {{{"A", 9}}});
+    vor = vlt.RequestGreater("Z", 1, vrs);
 
-    vlt.RequestInterval("A", 6, 9, vrs, true, false);
-    COMPARE_VAULT(vrs, {});
+    TEST_ASSERT(vrs.Size() == 0);
 
-    vlt.RequestInterval("A", 6, 9, vrs, false, false);
     COMPARE_VAULT(vrs, {});
 
-    //            x    x
-    // ....1....5....9....
-    vlt.RequestInterval("A", 6, 10, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 9}}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+)
 
-    vlt.RequestInterval("A", 6, 10, vrs, false);
-    COMPARE_VAULT(vrs, {{{"A", 9}}});
+TEST_BODY(RequestGreater, WrongType,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
 
-    vlt.RequestInterval("A", 6, 10, vrs, true, false);
-    COMPARE_VAULT(vrs, {{{"A", 9}}});
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
 
-    vlt.RequestInterval("A", 6, 10, vrs, false, false);
-    COMPARE_VAULT(vrs, {{{"A", 9}}});
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
 
-    //               x x
-    // ....1....5....9....
-    vlt.RequestInterval("A", 9, 10, vrs);
-    COMPARE_VAULT(vrs, {{{"A", 9}}});
+    vor = vlt.RequestGreater("B", 1, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
 
-    vlt.RequestInterval("A", 9, 10, vrs, false);
     COMPARE_VAULT(vrs, {});
 
-    vlt.RequestInterval("A", 9, 10, vrs, true, false);
-    COMPARE_VAULT(vrs, {{{"A", 9}}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
+)
 
-    vlt.RequestInterval("A", 9, 10, vrs, false, false);
-    COMPARE_VAULT(vrs, {});
+TEST_BODY(RequestGreater, ValueNotInVault,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
 
-    //                 xx
-    // ....1....5....9....
-    vlt.RequestInterval("A", 10, 11, vrs);
-    COMPARE_VAULT(vrs, {});
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
 
-    vlt.RequestInterval("A", 10, 11, vrs, false);
-    COMPARE_VAULT(vrs, {});
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
 
-    vlt.RequestInterval("A", 10, 11, vrs, true, false);
-    COMPARE_VAULT(vrs, {});
+    vor = vlt.RequestGreater("A", 4, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
 
-    vlt.RequestInterval("A", 10, 11, vrs, false, false);
     COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestGreaterOrEqual, CorrectRequest,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestGreaterOrEqual("A", 1, vrs);
+
+    TEST_ASSERT(vrs.Size() == 5);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 1}, {"B", std::string("a")}},
+        {{"A", 2}, {"B", std::string("b")}},
+        {{"A", 2}, {"B", std::string("bb")}},
+        {{"A", 2}, {"B", std::string("bbb")}},
+        {{"A", 3}, {"B", std::string("c")}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+
+    vor = vlt.RequestGreaterOrEqual("A", 3, vrs);
+
+    TEST_ASSERT(vrs.Size() == 1);
+
+    COMPARE_VAULT(vrs, {{{"A", 3}, {"B", std::string("c")}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestGreaterOrEqual, CorrectRequestNotAllRecords,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestGreaterOrEqual("A", 2, vrs, 2);
+
+    TEST_ASSERT(vrs.Size() == 2);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+
+    vor = vlt.RequestGreaterOrEqual("A", 3, vrs, 4);
+
+    TEST_ASSERT(vrs.Size() == 1);
+
+    COMPARE_VAULT(vrs, {{{"A", 3}, {"B", std::string("c")}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestGreaterOrEqual, CorrectRequestWithPredicat,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestGreaterOrEqual("A", 2, vrs, -1, [](const VaultRecordRef& ref) -> bool
+    {
+        std::string s;
+        ref.GetData("B", s);
+        if (s.length() > 1) return true;
+        else return false;
+    });
+
+    TEST_ASSERT(vrs.Size() == 2);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 2}, {"B", std::string("bb")}},
+        {{"A", 2}, {"B", std::string("bbb")}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestGreaterOrEqual, BoundaryValues,
+    Vault vlt;
+    VaultRecordSet vrs;
+
+    vlt.AddKey("A", 0);
+
+    // ...1...3...5...
+    vlt.CreateRecord({{"A", 1}});
+    vlt.CreateRecord({{"A", 3}});
+    vlt.CreateRecord({{"A", 5}});
+
+    //  x
+    // ...1...3...5...
+    vlt.RequestGreaterOrEqual("A", 0, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}, {{"A", 5}}});
+
+    //    x
+    // ...1...3...5...
+    vlt.RequestGreaterOrEqual("A", 1, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}, {{"A", 5}}});
+
+    //      x
+    // ...1...3...5...
+    vlt.RequestGreaterOrEqual("A", 2, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 3}}, {{"A", 5}}});
+
+    //        x
+    // ...1...3...5...
+    vlt.RequestGreaterOrEqual("A", 3, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 3}}, {{"A", 5}}});
+
+    //          x
+    // ...1...3...5...
+    vlt.RequestGreaterOrEqual("A", 4, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 5}}});
+
+    //            x
+    // ...1...3...5...
+    vlt.RequestGreaterOrEqual("A", 5, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 5}}});
+
+    //              x
+    // ...1...3...5...
+    vlt.RequestGreaterOrEqual("A", 6, vrs);
+    COMPARE_VAULT(vrs, {});
+)
+
+TEST_BODY(RequestGreaterOrEqual, WrongKey,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestGreaterOrEqual("Z", 1, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+)
+
+TEST_BODY(RequestGreaterOrEqual, WrongType,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestGreaterOrEqual("B", 1, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
+)
+
+TEST_BODY(RequestGreaterOrEqual, ValueNotInVault,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestGreaterOrEqual("A", 4, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestLess, CorrectRequest,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestLess("A", 3, vrs);
+
+    TEST_ASSERT(vrs.Size() == 4);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 1}, {"B", std::string("a")}},
+        {{"A", 2}, {"B", std::string("b")}},
+        {{"A", 2}, {"B", std::string("bb")}},
+        {{"A", 2}, {"B", std::string("bbb")}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    vor = vlt.RequestLess("A", 2, vrs);
+
+    TEST_ASSERT(vrs.Size() == 1);
+
+    COMPARE_VAULT(vrs, {{{"A", 1}, {"B", std::string("a")}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestLess, CorrectRequestNotAllRecords,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestLess("A", 3, vrs, 2);
+
+    TEST_ASSERT(vrs.Size() == 2);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+
+    vor = vlt.RequestLess("A", 2, vrs, 4);
+
+    TEST_ASSERT(vrs.Size() == 1);
+
+    COMPARE_VAULT(vrs, {{{"A", 1}, {"B", std::string("a")}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestLess, CorrectRequestWithPredicat,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestLess("A", 3, vrs, -1, [](const VaultRecordRef& ref) -> bool
+    {
+        std::string s;
+        ref.GetData("B", s);
+        if (s.length() > 1) return true;
+        else return false;
+    });
+
+    TEST_ASSERT(vrs.Size() == 2);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 2}, {"B", std::string("bb")}},
+        {{"A", 2}, {"B", std::string("bbb")}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestLess, BoundaryValues,
+    Vault vlt;
+    VaultRecordSet vrs;
+
+    vlt.AddKey("A", 0);
+
+    // ...1...3...5...
+    vlt.CreateRecord({{"A", 1}});
+    vlt.CreateRecord({{"A", 3}});
+    vlt.CreateRecord({{"A", 5}});
+
+    //  x
+    // ...1...3...5...
+    vlt.RequestLess("A", 0, vrs);
+    COMPARE_VAULT(vrs, {});
+
+    //    x
+    // ...1...3...5...
+    vlt.RequestLess("A", 1, vrs);
+    COMPARE_VAULT(vrs, {});
+
+    //      x
+    // ...1...3...5...
+    vlt.RequestLess("A", 2, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}});
+
+    //        x
+    // ...1...3...5...
+    vlt.RequestLess("A", 3, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}});
+
+    //          x
+    // ...1...3...5...
+    vlt.RequestLess("A", 4, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}});
+
+    //            x
+    // ...1...3...5...
+    vlt.RequestLess("A", 5, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}});
+
+    //              x
+    // ...1...3...5...
+    vlt.RequestLess("A", 6, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}, {{"A", 5}}});
+)
+
+TEST_BODY(RequestLess, WrongKey,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestLess("Z", 1, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+)
+
+TEST_BODY(RequestLess, WrongType,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestLess("B", 1, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
+)
+
+TEST_BODY(RequestLess, ValueNotInVault,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestLess("A", 1, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestLessOrEqual, CorrectRequest,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestLessOrEqual("A", 2, vrs);
+
+    TEST_ASSERT(vrs.Size() == 4);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 1}, {"B", std::string("a")}},
+        {{"A", 2}, {"B", std::string("b")}},
+        {{"A", 2}, {"B", std::string("bb")}},
+        {{"A", 2}, {"B", std::string("bbb")}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    vor = vlt.RequestLessOrEqual("A", 1, vrs);
+
+    TEST_ASSERT(vrs.Size() == 1);
+
+    COMPARE_VAULT(vrs, {{{"A", 1}, {"B", std::string("a")}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestLessOrEqual, CorrectRequestNotAllRecords,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestLessOrEqual("A", 3, vrs, 2);
+
+    TEST_ASSERT(vrs.Size() == 2);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+
+    vor = vlt.RequestLessOrEqual("A", 1, vrs, 4);
+
+    TEST_ASSERT(vrs.Size() == 1);
+
+    COMPARE_VAULT(vrs, {{{"A", 1}, {"B", std::string("a")}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestLessOrEqual, CorrectRequestWithPredicat,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bbb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestLessOrEqual("A", 2, vrs, -1, [](const VaultRecordRef& ref) -> bool
+    {
+        std::string s;
+        ref.GetData("B", s);
+        if (s.length() > 1) return true;
+        else return false;
+    });
+
+    TEST_ASSERT(vrs.Size() == 2);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 2}, {"B", std::string("bb")}},
+        {{"A", 2}, {"B", std::string("bbb")}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestLessOrEqual, BoundaryValues,
+    Vault vlt;
+    VaultRecordSet vrs;
+
+    vlt.AddKey("A", 0);
+
+    // ...1...3...5...
+    vlt.CreateRecord({{"A", 1}});
+    vlt.CreateRecord({{"A", 3}});
+    vlt.CreateRecord({{"A", 5}});
+
+    //  x
+    // ...1...3...5...
+    vlt.RequestLessOrEqual("A", 0, vrs);
+    COMPARE_VAULT(vrs, {});
+
+    //    x
+    // ...1...3...5...
+    vlt.RequestLessOrEqual("A", 1, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}});
+
+    //      x
+    // ...1...3...5...
+    vlt.RequestLessOrEqual("A", 2, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}});
+
+    //        x
+    // ...1...3...5...
+    vlt.RequestLessOrEqual("A", 3, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}});
+
+    //          x
+    // ...1...3...5...
+    vlt.RequestLessOrEqual("A", 4, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}});
+
+    //            x
+    // ...1...3...5...
+    vlt.RequestLessOrEqual("A", 5, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}, {{"A", 5}}});
+
+    //              x
+    // ...1...3...5...
+    vlt.RequestLessOrEqual("A", 6, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}, {{"A", 3}}, {{"A", 5}}});
+)
+
+TEST_BODY(RequestLessOrEqual, WrongKey,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestLessOrEqual("Z", 1, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+)
+
+TEST_BODY(RequestLessOrEqual, WrongType,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestLessOrEqual("B", 1, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
+)
+
+TEST_BODY(RequestLessOrEqual, ValueNotInVault,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestLessOrEqual("A", 0, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestInterval, CorrectRequest,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
+    vlt.CreateRecord({{"A", 4}, {"B", std::string("dd")}});
+    vlt.CreateRecord({{"A", 5}, {"B", std::string("ee")}});
+
+    vor = vlt.RequestInterval("A", 2, 4, vrs);
+
+    TEST_ASSERT(vrs.Size() == 5);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 2}, {"B", std::string("b")}},
+        {{"A", 2}, {"B", std::string("bb")}},
+        {{"A", 3}, {"B", std::string("c")}},
+        {{"A", 4}, {"B", std::string("d")}},
+        {{"A", 4}, {"B", std::string("dd")}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestInterval, CorrectRequestWithoutLeftBoundary,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
+    vlt.CreateRecord({{"A", 4}, {"B", std::string("dd")}});
+    vlt.CreateRecord({{"A", 5}, {"B", std::string("ee")}});
+
+    vor = vlt.RequestInterval("A", 2, 4, vrs, false);
+
+    TEST_ASSERT(vrs.Size() == 3);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 3}, {"B", std::string("c")}},
+        {{"A", 4}, {"B", std::string("d")}},
+        {{"A", 4}, {"B", std::string("dd")}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestInterval, CorrectRequestWithoutRightBoundary,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
+    vlt.CreateRecord({{"A", 4}, {"B", std::string("dd")}});
+    vlt.CreateRecord({{"A", 5}, {"B", std::string("ee")}});
+
+    vor = vlt.RequestInterval("A", 2, 4, vrs, true, false);
+
+    TEST_ASSERT(vrs.Size() == 3);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 2}, {"B", std::string("b")}},
+        {{"A", 2}, {"B", std::string("bb")}},
+        {{"A", 3}, {"B", std::string("c")}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestInterval, CorrectRequestWithoutBoundaries,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
+    vlt.CreateRecord({{"A", 4}, {"B", std::string("dd")}});
+    vlt.CreateRecord({{"A", 5}, {"B", std::string("ee")}});
+
+    vor = vlt.RequestInterval("A", 2, 4, vrs, false, false);
+
+    TEST_ASSERT(vrs.Size() == 1);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 3}, {"B", std::string("c")}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestInterval, CorrectRequestNotAllRecords,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
+    vlt.CreateRecord({{"A", 4}, {"B", std::string("dd")}});
+    vlt.CreateRecord({{"A", 5}, {"B", std::string("ee")}});
+
+    vor = vlt.RequestInterval("A", 2, 4, vrs, true, true, 3);
+
+    TEST_ASSERT(vrs.Size() == 3);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+
+    vor = vlt.RequestInterval("A", 2, 4, vrs, true, true, 8);
+
+    TEST_ASSERT(vrs.Size() == 5);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestInterval, CorrectRequestWithPredicat,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
+    vlt.CreateRecord({{"A", 4}, {"B", std::string("dd")}});
+    vlt.CreateRecord({{"A", 5}, {"B", std::string("ee")}});
+
+    vor = vlt.RequestInterval("A", 2, 4, vrs, true, true, -1, [](const VaultRecordRef& ref) -> bool
+    {
+        std::string s;
+        ref.GetData("B", s);
+        if (s.length() > 1) return true;
+        else return false;
+    });
+
+    TEST_ASSERT(vrs.Size() == 2);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 2}, {"B", std::string("bb")}},
+        {{"A", 4}, {"B", std::string("dd")}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestInterval, BoundaryValues,
+    Vault vlt;
+    VaultRecordSet vrs;
+
+    vlt.AddKey("A", 0);
+
+    // ....1....5....9....
+    vlt.CreateRecord({{"A", 1}});
+    vlt.CreateRecord({{"A", 5}});
+    vlt.CreateRecord({{"A", 9}});
+
+    //  xx
+    // ....1....5....9....
+    vlt.RequestInterval("A", -1, 0, vrs);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", -1, 0, vrs, false);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", -1, 0, vrs, true, false);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", -1, 0, vrs, false, false);
+    COMPARE_VAULT(vrs, {});
+
+    //  x  x
+    // ....1....5....9....
+    vlt.RequestInterval("A", -1, 1, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}});
+
+    vlt.RequestInterval("A", -1, 1, vrs, false);
+    COMPARE_VAULT(vrs, {{{"A", 1}}});
+
+    vlt.RequestInterval("A", -1, 1, vrs, true, false);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", -1, 1, vrs, false, false);
+    COMPARE_VAULT(vrs, {});
+
+    //  x    x
+    // ....1....5....9....
+    vlt.RequestInterval("A", -1, 2, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}});
+
+    vlt.RequestInterval("A", -1, 2, vrs, false);
+    COMPARE_VAULT(vrs, {{{"A", 1}}});
+
+    vlt.RequestInterval("A", -1, 2, vrs, true, false);
+    COMPARE_VAULT(vrs, {{{"A", 1}}});
+
+    vlt.RequestInterval("A", -1, 2, vrs, false, false);
+    COMPARE_VAULT(vrs, {{{"A", 1}}});
+
+    //     x x
+    // ....1....5....9....
+    vlt.RequestInterval("A", 1, 2, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 1}}});
+
+    vlt.RequestInterval("A", 1, 2, vrs, false);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", 1, 2, vrs, true, false);
+    COMPARE_VAULT(vrs, {{{"A", 1}}});
+
+    vlt.RequestInterval("A", 1, 2, vrs, false, false);
+    COMPARE_VAULT(vrs, {});
+
+    //       xx
+    // ....1....5....9....
+    vlt.RequestInterval("A", 2, 3, vrs);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", 2, 3, vrs, false);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", 2, 3, vrs, true, false);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", 2, 3, vrs, false, false);
+    COMPARE_VAULT(vrs, {});
+
+    //       x  x
+    // ....1....5....9....
+    vlt.RequestInterval("A", 2, 5, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 5}}});
+
+    vlt.RequestInterval("A", 2, 5, vrs, false);
+    COMPARE_VAULT(vrs, {{{"A", 5}}});
+
+    vlt.RequestInterval("A", 2, 5, vrs, true, false);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", 2, 5, vrs, false, false);
+    COMPARE_VAULT(vrs, {});
+
+    //       x    x
+    // ....1....5....9....
+    vlt.RequestInterval("A", 2, 6, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 5}}});
+
+    vlt.RequestInterval("A", 2, 6, vrs, false);
+    COMPARE_VAULT(vrs, {{{"A", 5}}});
+
+    vlt.RequestInterval("A", 2, 6, vrs, true, false);
+    COMPARE_VAULT(vrs, {{{"A", 5}}});
+
+    vlt.RequestInterval("A", 2, 6, vrs, false, false);
+    COMPARE_VAULT(vrs, {{{"A", 5}}});
+
+    //          x  x
+    // ....1....5....9....
+    vlt.RequestInterval("A", 5, 6, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 5}}});
+
+    vlt.RequestInterval("A", 5, 6, vrs, false);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", 5, 6, vrs, true, false);
+    COMPARE_VAULT(vrs, {{{"A", 5}}});
+
+    vlt.RequestInterval("A", 5, 6, vrs, false, false);
+    COMPARE_VAULT(vrs, {});
+
+    //            xx
+    // ....1....5....9....
+    vlt.RequestInterval("A", 6, 7, vrs);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", 6, 7, vrs, false);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", 6, 7, vrs, true, false);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", 6, 7, vrs, false, false);
+    COMPARE_VAULT(vrs, {});
+
+    //            x  x
+    // ....1....5....9....
+    vlt.RequestInterval("A", 6, 9, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 9}}});
+
+    vlt.RequestInterval("A", 6, 9, vrs, false);
+    COMPARE_VAULT(vrs, {{{"A", 9}}});
+
+    vlt.RequestInterval("A", 6, 9, vrs, true, false);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", 6, 9, vrs, false, false);
+    COMPARE_VAULT(vrs, {});
+
+    //            x    x
+    // ....1....5....9....
+    vlt.RequestInterval("A", 6, 10, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 9}}});
+
+    vlt.RequestInterval("A", 6, 10, vrs, false);
+    COMPARE_VAULT(vrs, {{{"A", 9}}});
+
+    vlt.RequestInterval("A", 6, 10, vrs, true, false);
+    COMPARE_VAULT(vrs, {{{"A", 9}}});
+
+    vlt.RequestInterval("A", 6, 10, vrs, false, false);
+    COMPARE_VAULT(vrs, {{{"A", 9}}});
+
+    //               x x
+    // ....1....5....9....
+    vlt.RequestInterval("A", 9, 10, vrs);
+    COMPARE_VAULT(vrs, {{{"A", 9}}});
+
+    vlt.RequestInterval("A", 9, 10, vrs, false);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", 9, 10, vrs, true, false);
+    COMPARE_VAULT(vrs, {{{"A", 9}}});
+
+    vlt.RequestInterval("A", 9, 10, vrs, false, false);
+    COMPARE_VAULT(vrs, {});
+
+    //                 xx
+    // ....1....5....9....
+    vlt.RequestInterval("A", 10, 11, vrs);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", 10, 11, vrs, false);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", 10, 11, vrs, true, false);
+    COMPARE_VAULT(vrs, {});
+
+    vlt.RequestInterval("A", 10, 11, vrs, false, false);
+    COMPARE_VAULT(vrs, {});
+)
+
+TEST_BODY(RequestInterval, SameBoundaries,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestInterval("A", 2, 2, vrs);
+
+    TEST_ASSERT(vrs.Size() == 2);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 2}, {"B", std::string("b")}},
+        {{"A", 2}, {"B", std::string("bb")}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+
+    vor = vlt.RequestInterval("A", 2, 2, vrs, false);
+
+    TEST_ASSERT(vrs.Size() == 0);
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+
+    vor = vlt.RequestInterval("A", 2, 2, vrs, true, false);
+
+    TEST_ASSERT(vrs.Size() == 0);
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+
+    vor = vlt.RequestInterval("A", 2, 2, vrs, false, false);
+
+    TEST_ASSERT(vrs.Size() == 0);
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestInterval, IncorrectBoundaries,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestInterval("A", 2, -2, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestInterval, WrongKey,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestInterval("Z", 1, 1, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+)
+
+TEST_BODY(RequestInterval, WrongType,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+
+    vor = vlt.RequestInterval("B", 1, 1, vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
+)
+
+TEST_BODY(RequestInterval, CorrectByKeyHandle,
+    Vault vlt;
+    KeyHandle<int> handle;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddUniqueKey<std::string>("B");
+
+    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
+    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.CreateRecord({{"A", 4}, {"B", std::string("d")}});
+
+    vlt.GetKeyHandle("A", handle);
+
+    vor = vlt.RequestInterval(handle, 2, 3, vrs);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 2}, {"B", std::string("b")}},
+        {{"A", 3}, {"B", std::string("c")}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    vor = vlt.RequestGreater(handle, 2, vrs);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 3}, {"B", std::string("c")}},
+        {{"A", 4}, {"B", std::string("d")}},
+    });
+
+    vor = vlt.RequestLessOrEqual(handle, 2, vrs);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 1}, {"B", std::string("a")}},
+        {{"A", 2}, {"B", std::string("b")}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+)
+
+TEST_BODY(RequestInterval, ManyRecordsAfterErase,
+    Vault vlt;
+    VaultRecordSet vrs;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+
+    for (int i = 0; i < 10000; ++i) vlt.CreateRecord({{"A", i % 1000}, {"B", i}});
+
+    // Erase all records in the middle of the map and every second record around it
+    for (int i = 200; i < 600; ++i) vlt.EraseRecords("A", i);
+    for (int i = 0; i < 10000; i += 2) vlt.EraseRecord("B", i);
+
+    TEST_ASSERT(vlt.Size() == 3000);
+
+    vlt.RequestInterval("A", 100, 700, vrs);
+    TEST_ASSERT(vrs.Size() == 1000);
+
+    vlt.RequestInterval("A", 199, 600, vrs);
+    TEST_ASSERT(vrs.Size() == 10);
+
+    vlt.RequestLess("A", 200, vrs);
+    TEST_ASSERT(vrs.Size() == 1000);
+
+    vlt.RequestGreaterOrEqual("A", 600, vrs);
+    TEST_ASSERT(vrs.Size() == 2000);
+
+    vlt.RequestInterval("A", 200, 599, vrs);
+    TEST_ASSERT(vrs.Size() == 0);
+)
+
+TEST_BODY(Request, CorrectRequest,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
+
+    vlt.AddKey("A", 0);
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
+
+    // Equal
+    COMPARE_CORRECT_REQUEST(Equal("A", 2), {{{"A", 2}}})
+
+    // Greater
+    COMPARE_CORRECT_REQUEST(Greater("A", 7), {{{"A", 8}}, {{"A", 9}}});
+
+    // Greater or equal
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 7), {{{"A", 7}}, {{"A", 8}}, {{"A", 9}}});
+
+    // Less
+    COMPARE_CORRECT_REQUEST(Less("A", 2), {{{"A", 0}}, {{"A", 1}}});
+
+    // Less or equal
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 2), {{{"A", 0}}, {{"A", 1}}, {{"A", 2}}});
+)
+
+TEST_BODY(Request, CorrectRequestWithPredicat,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", 100 - i}});
+
+    for (int i = 0; i < 4; ++i) vlt.CreateRecord({{"A", 5}, {"B", i}});
+
+    // Equal
+    vor = vlt.Request(Equal("A", 5, [](const VaultRecordRef& ref) -> bool
+    {
+        int b = 0;
+        ref.GetData("B", b);
+        if (b % 2 == 0) return true;
+        else return false;
+    }), vrs);
+
+    TEST_ASSERT(vrs.Size() == 2);
+
+    COMPARE_VAULT(vrs, {
+        {{"A", 5}, {"B", 0}},
+        {{"A", 5}, {"B", 2}},
+    });
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+
+
+    // Greater
+    vor = vlt.Request(Greater("A", 7, [](const VaultRecordRef& ref) -> bool
+    {
+        int b = 0;
+        ref.GetData("B", b);
+        if (b % 2 == 0) return true;
+        else return false;
+    }), vrs);
+
+    TEST_ASSERT(vrs.Size() == 1);
+
+    COMPARE_VAULT(vrs, {{{"A", 8}, {"B", 92}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+
+
+    // Greater or equal
+    vor = vlt.Request(GreaterOrEqual("A", 7, [](const VaultRecordRef& ref) -> bool
+    {
+        int b = 0;
+        ref.GetData("B", b);
+        if (b % 2 == 0) return true;
+        else return false;
+    }), vrs);
+
+    TEST_ASSERT(vrs.Size() == 1);
+
+    COMPARE_VAULT(vrs, {{{"A", 8}, {"B", 92}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+
+
+    // Less
+    vor = vlt.Request(Less("A", 2, [](const VaultRecordRef& ref) -> bool
+    {
+        int b = 0;
+        ref.GetData("B", b);
+        if (b % 2 == 0) return true;
+        else return false;
+    }), vrs);
+
+    TEST_ASSERT(vrs.Size() == 1);
+
+    COMPARE_VAULT(vrs, {{{"A", 0}, {"B", 100}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+
+
+    // Less or equal
+    vor = vlt.Request(LessOrEqual("A", 2, [](const VaultRecordRef& ref) -> bool
+    {
+        int b = 0;
+        ref.GetData("B", b);
+        if (b % 2 == 0) return true;
+        else return false;
+    }), vrs);
+
+    TEST_ASSERT(vrs.Size() == 2);
+
+    COMPARE_VAULT(vrs, {{{"A", 0}, {"B", 100}}, {{"A", 2}, {"B", 98}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+)
+
+TEST_BODY(Request, BoundaryValues,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
+
+    vlt.AddKey("A", 0);
+
+    // ...1...3...
+    vlt.CreateRecord({{"A", 1}});
+    vlt.CreateRecord({{"A", 3}});
+
+
+    // Greater
+    //  x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(Greater("A", 0), {{{"A", 1}}, {{"A", 3}}});
+
+    //    x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(Greater("A", 1), {{{"A", 3}}});
+
+    //      x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(Greater("A", 2), {{{"A", 3}}});
+
+    //        x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(Greater("A", 3), {});
+
+    //          x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(Greater("A", 4), {});
+
+
+    // Greater or equal
+    //  x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 0), {{{"A", 1}}, {{"A", 3}}});
+
+    //    x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 1), {{{"A", 1}}, {{"A", 3}}});
+
+    //      x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 2), {{{"A", 3}}});
+
+    //        x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 3), {{{"A", 3}}});
+
+    //          x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 4), {});
+
+
+    // Less
+    //  x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(Less("A", 0), {});
+
+    //    x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(Less("A", 1), {});
+
+    //      x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(Less("A", 2), {{{"A", 1}}});
+
+    //        x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(Less("A", 3), {{{"A", 1}}});
+
+    //          x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(Less("A", 4), {{{"A", 1}}, {{"A", 3}}});
+
+
+    // Less or equal
+    //  x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 0), {});
+
+    //    x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 1), {{{"A", 1}}});
+
+    //      x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 2), {{{"A", 1}}});
+
+    //        x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 3), {{{"A", 1}}, {{"A", 3}}});
+
+    //          x
+    // ...1...3...
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 4), {{{"A", 1}}, {{"A", 3}}});
+)
+
+TEST_BODY(Request, WrongKey,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
+
+    // Equal
+    vor = vlt.Request(Equal("Z", 2), vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+
+
+    // Greater
+    vor = vlt.Request(Greater("Z", 7), vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+
+
+    // Greater or equal
+    vor = vlt.Request(GreaterOrEqual("Z", 7), vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+
+
+    // Less
+    vor = vlt.Request(Less("Z", 2), vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+
+
+    // Less or equal
+    vor = vlt.Request(LessOrEqual("Z", 2), vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+)
+
+TEST_BODY(Request, WrongType,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    std::string s;
+
+    vlt.AddKey("A", 0);
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
+
+    // Equal
+    vor = vlt.Request(Equal("A", s), vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+
+
+    // Greater
+    vor = vlt.Request(Greater("A", s), vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+
+
+    // Greater or equal
+    vor = vlt.Request(GreaterOrEqual("A", s), vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+
+
+    // Less
+    vor = vlt.Request(Less("A", s), vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+
+
+    // Less or equal
+    vor = vlt.Request(LessOrEqual("A", s), vrs);
+
+    TEST_ASSERT(vrs.Size() == 0);
+
+    COMPARE_VAULT(vrs, {});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+)
+
+TEST_BODY(Request, ComplexRequestAnd,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", i}});
+
+    // Equal
+    COMPARE_CORRECT_REQUEST(Equal("A", 2) && Equal("B", 2), {{{"A", 2}, {"B", 2}}});
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 2) && Equal("B", 3), {});
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 2) && Greater("B", 1), {{{"A", 2}, {"B", 2}}});
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 2) && GreaterOrEqual("B", 2), {{{"A", 2}, {"B", 2}}});
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 2) && Less("B", 5), {{{"A", 2}, {"B", 2}}});
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 2) && LessOrEqual("B", 2), {{{"A", 2}, {"B", 2}}});
+
+
+    // Greater
+    COMPARE_CORRECT_REQUEST(Greater("A", 2) && Equal("B", 9), {{{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(Greater("A", 7) && Greater("B", 1), {{{"A", 8}, {"B", 8}}, {{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(Greater("A", 8) && GreaterOrEqual("B", 8), {{{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(Greater("A", 2) && Less("B", 4), {{{"A", 3}, {"B", 3}}});
+
+    COMPARE_CORRECT_REQUEST(Greater("A", 2) && LessOrEqual("B", 3), {{{"A", 3}, {"B", 3}}});
+
+
+    // Greater or equal
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 2) && Equal("B", 5), {{{"A", 5}, {"B", 5}}});
+
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 8) && Greater("B", 1), {{{"A", 8}, {"B", 8}}, {{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 8) && GreaterOrEqual("B", 9), {{{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 2) && Less("B", 4), {{{"A", 2}, {"B", 2}}, {{"A", 3}, {"B", 3}}});
+
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 2) && LessOrEqual("B", 3), {{{"A", 2}, {"B", 2}}, {{"A", 3}, {"B", 3}}});
+
+
+    // Less
+    COMPARE_CORRECT_REQUEST(Less("A", 7) && Equal("B", 5), {{{"A", 5}, {"B", 5}}});
+
+    COMPARE_CORRECT_REQUEST(Less("A", 3) && Greater("B", 1), {{{"A", 2}, {"B", 2}}});
+
+    COMPARE_CORRECT_REQUEST(Less("A", 8) && GreaterOrEqual("B", 7), {{{"A", 7}, {"B", 7}}});
+
+    COMPARE_CORRECT_REQUEST(Less("A", 2) && Less("B", 4), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}});
+
+    COMPARE_CORRECT_REQUEST(Less("A", 2) && LessOrEqual("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}});
+
+
+    // Less or equal
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 7) && Equal("B", 5), {{{"A", 5}, {"B", 5}}});
+
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 3) && Greater("B", 2), {{{"A", 3}, {"B", 3}}});
+
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 8) && GreaterOrEqual("B", 8), {{{"A", 8}, {"B", 8}}});
+
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 2) && Less("B", 4), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 2}, {"B", 2}}});
+
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 2) && LessOrEqual("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}});
+)
+
+TEST_BODY(Request, ComplexRequestOr,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", i}});
+
+    // Equal
+    COMPARE_CORRECT_REQUEST(Equal("A", 2) || Equal("B", 3), {{{"A", 2}, {"B", 2}}, {{"A", 3}, {"B", 3}}});
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 2) || Greater("B", 8), {{{"A", 2}, {"B", 2}}, {{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 2) || GreaterOrEqual("B", 9), {{{"A", 2}, {"B", 2}}, {{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 2) || Less("B", 2), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 2}, {"B", 2}}});
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 2) || LessOrEqual("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 2}, {"B", 2}}});
+
+
+    // Greater
+    COMPARE_CORRECT_REQUEST(Greater("A", 8) || Equal("B", 0), {{{"A", 0}, {"B", 0}}, {{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(Greater("A", 8) || Greater("B", 10), {{{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(Greater("A", 8) || GreaterOrEqual("B", 9), {{{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(Greater("A", 8) || Less("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(Greater("A", 8) || LessOrEqual("B", 0), {{{"A", 0}, {"B", 0}}, {{"A", 9}, {"B", 9}}});
+
+
+    // Greater or equal
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 9) || Equal("B", 5), {{{"A", 5}, {"B", 5}}, {{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 8) || Greater("B", 8), {{{"A", 8}, {"B", 8}}, {{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 8) || GreaterOrEqual("B", 9), {{{"A", 8}, {"B", 8}}, {{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 9) || Less("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 9) || LessOrEqual("B", 0), {{{"A", 0}, {"B", 0}}, {{"A", 9}, {"B", 9}}});
+
+
+    // Less
+    COMPARE_CORRECT_REQUEST(Less("A", 1) || Equal("B", 5), {{{"A", 0}, {"B", 0}}, {{"A", 5}, {"B", 5}}});
+
+    COMPARE_CORRECT_REQUEST(Less("A", 1) || Greater("B", 8), {{{"A", 0}, {"B", 0}}, {{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(Less("A", 1) || GreaterOrEqual("B", 9), {{{"A", 0}, {"B", 0}}, {{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(Less("A", 2) || Less("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}});
+
+    COMPARE_CORRECT_REQUEST(Less("A", 1) || LessOrEqual("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}});
+
+
+    // Less or equal
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 1) || Equal("B", 5), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 5}, {"B", 5}}});
+
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 1) || Greater("B", 8), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 1) || GreaterOrEqual("B", 9), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 9}, {"B", 9}}});
+
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 1) || Less("B", 3), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 2}, {"B", 2}}});
+
+    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 2) || LessOrEqual("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 2}, {"B", 2}}});
+)
+
+TEST_BODY(Request, ComplexRequest,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    VaultRecordRef vrr;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+    vlt.AddKey<std::string>("C", "");
+    vlt.AddKey<bool>("D", false);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        vlt.CreateRecord(vrr, {{"A", i}, {"B", i}, {"C", std::to_string(i)}});
+        if (i == 5 || i == 9) vrr.SetData("D", true);
+    }
+    
+    vlt.Request(Greater("A", 2) && Less("B", 8) && (Equal("C", std::string("3")) || Equal("C", std::string("4"))) || Equal("D", true), vrs);
+    
+    CompareVault(vrs, {
+        {{"A", 3}, {"B", 3}, {"C", std::string("3")}, {"D", false}},
+        {{"A", 4}, {"B", 4}, {"C", std::string("4")}, {"D", false}},
+        {{"A", 5}, {"B", 5}, {"C", std::string("5")}, {"D", true}},
+        {{"A", 9}, {"B", 9}, {"C", std::string("9")}, {"D", true}},
+    });
 )
 
-TEST_BODY(RequestInterval, SameBoundaries,
+TEST_BODY(Request, ComplexRequestInterval,
     Vault vlt;
     VaultRecordSet vrs;
     VaultOperationResult vor;
+    VaultRecordRef vrr;
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
-
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    vlt.AddKey("B", 0);
+    vlt.AddKey<std::string>("C", "");
+    vlt.AddKey<bool>("D", false);
 
-    vor = vlt.RequestInterval("A", 2, 2, vrs);
+    for (int i = 0; i < 10; ++i)
+    {
+        vlt.CreateRecord(vrr, {{"A", i}, {"B", i}, {"C", std::to_string(i)}});
+        if (i == 5 || i == 9) vrr.SetData("D", true);
+    }
 
-    TEST_ASSERT(vrs.Size() == 2);
+    vlt.Request(Greater("A", 3) && Less("A", 7), vrs);
 
-    COMPARE_VAULT(vrs, {
-        {{"A", 2}, {"B", std::string("b")}},
-        {{"A", 2}, {"B", std::string("bb")}},
+    CompareVault(vrs, {
+        {{"A", 4}, {"B", 4}, {"C", std::string("4")}, {"D", false}},
+        {{"A", 5}, {"B", 5}, {"C", std::string("5")}, {"D", true}},
+        {{"A", 6}, {"B", 6}, {"C", std::string("6")}, {"D", false}},
     });
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
-
-
-    vor = vlt.RequestInterval("A", 2, 2, vrs, false);
-
-    TEST_ASSERT(vrs.Size() == 0);
-    COMPARE_VAULT(vrs, {});
-
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
-
-
-    vor = vlt.RequestInterval("A", 2, 2, vrs, true, false);
-
-    TEST_ASSERT(vrs.Size() == 0);
-    COMPARE_VAULT(vrs, {});
-
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
-
-
-    vor = vlt.RequestInterval("A", 2, 2, vrs, false, false);
-
-    TEST_ASSERT(vrs.Size() == 0);
-    COMPARE_VAULT(vrs, {});
+    vlt.Request(Greater("A", 3, [](const VaultRecordRef& ref) -> bool 
+    {
+        bool d = false;
+        ref.GetData("D", d);
+        if (!d) return true;
+        else return false;
+    }) && Less("A", 7), vrs);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+    CompareVault(vrs, {
+        {{"A", 4}, {"B", 4}, {"C", std::string("4")}, {"D", false}},
+        {{"A", 6}, {"B", 6}, {"C", std::string("6")}, {"D", false}},
+    });
 )
 
-TEST_BODY(RequestInterval, IncorrectBoundaries,
+TEST_BODY(Request, ComplexRequestWrongKey,
     Vault vlt;
     VaultRecordSet vrs;
     VaultOperationResult vor;
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddKey("B", 0);
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("bb")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", i}});
 
-    vor = vlt.RequestInterval("A", 2, -2, vrs);
+    vor = vlt.Request(Equal("A", 0) && Equal("Z", 0), vrs);
 
     TEST_ASSERT(vrs.Size() == 0);
-    COMPARE_VAULT(vrs, {});
-
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
-)
 
-TEST_BODY(RequestInterval, WrongKey,
-    Vault vlt;
-    VaultRecordSet vrs;
-    VaultOperationResult vor;
+    COMPARE_VAULT(vrs, {});
 
-    vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
 
-    vor = vlt.RequestInterval("Z", 1, 1, vrs);
+    vor = vlt.Request(Equal("Z", 0) && Equal("Y", 0), vrs);
 
     TEST_ASSERT(vrs.Size() == 0);
 
@@ -2802,653 +5262,876 @@ TEST_BODY(RequestInterval, WrongKey,
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 )
 
-TEST_BODY(RequestInterval, WrongType,
+TEST_BODY(Request, ComplexRequestWrongType,
     Vault vlt;
     VaultRecordSet vrs;
     VaultOperationResult vor;
+    std::string s;
 
     vlt.AddKey("A", 0);
-    vlt.AddUniqueKey<std::string>("B");
+    vlt.AddKey("B", 0);
 
-    vlt.CreateRecord({{"A", 1}, {"B", std::string("a")}});
-    vlt.CreateRecord({{"A", 2}, {"B", std::string("b")}});
-    vlt.CreateRecord({{"A", 3}, {"B", std::string("c")}});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", i}});
 
-    vor = vlt.RequestInterval("B", 1, 1, vrs);
+    vor = vlt.Request(Equal("A", 0) && Equal("B", s), vrs);
 
     TEST_ASSERT(vrs.Size() == 0);
 
     COMPARE_VAULT(vrs, {});
 
     COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(std::string));
-)
-
-TEST_BODY(Request, CorrectRequest,
-    Vault vlt;
-    VaultRecordSet vrs;
-    VaultOperationResult vor;
-    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
-
-    vlt.AddKey("A", 0);
-
-    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
 
-    // Equal
-    COMPARE_CORRECT_REQUEST(Equal("A", 2), {{{"A", 2}}})
 
-    // Greater
-    COMPARE_CORRECT_REQUEST(Greater("A", 7), {{{"A", 8}}, {{"A", 9}}});
+    vor = vlt.Request(Equal("A", s) && Equal("B", 0), vrs);
 
-    // Greater or equal
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 7), {{{"A", 7}}, {{"A", 8}}, {{"A", 9}}});
+    TEST_ASSERT(vrs.Size() == 0);
 
-    // Less
-    COMPARE_CORRECT_REQUEST(Less("A", 2), {{{"A", 0}}, {{"A", 1}}});
+    COMPARE_VAULT(vrs, {});
 
-    // Less or equal
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 2), {{{"A", 0}}, {{"A", 1}}, {{"A", 2}}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
 )
-
-TEST_BODY(Request, CorrectRequestWithPredicat,
+TEST_BODY(Request, ComplexRequestCompositeIndex,
     Vault vlt;
     VaultRecordSet vrs;
     VaultOperationResult vor;
+    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
+    std::string s;
 
     vlt.AddKey("A", 0);
     vlt.AddKey("B", 0);
+    vlt.AddKey("C", 0);
+    vlt.AddCompositeIndex({"A", "B"});
 
-    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", 100 - i}});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i % 2}, {"B", i % 3}, {"C", i}});
 
-    for (int i = 0; i < 4; ++i) vlt.CreateRecord({{"A", 5}, {"B", i}});
+    COMPARE_CORRECT_REQUEST(Equal("A", 0) && Equal("B", 2), {
+        {{"A", 0}, {"B", 2}, {"C", 2}},
+        {{"A", 0}, {"B", 2}, {"C", 8}},
+    });
 
-    // Equal
-    vor = vlt.Request(Equal("A", 5, [](const VaultRecordRef& ref) -> bool
-    {
-        int b = 0;
-        ref.GetData("B", b);
-        if (b % 2 == 0) return true;
-        else return false;
-    }), vrs);
+    COMPARE_CORRECT_REQUEST(Equal("B", 2) && Equal("A", 1), {
+        {{"A", 1}, {"B", 2}, {"C", 5}},
+    });
 
-    TEST_ASSERT(vrs.Size() == 2);
+    COMPARE_CORRECT_REQUEST(Equal("A", 0) && Equal("B", 2) && Greater("C", 5), {
+        {{"A", 0}, {"B", 2}, {"C", 8}},
+    });
 
-    COMPARE_VAULT(vrs, {
-        {{"A", 5}, {"B", 0}},
-        {{"A", 5}, {"B", 2}},
+    COMPARE_CORRECT_REQUEST(Equal("A", 0) && (Equal("B", 2) || Equal("C", 3)), {
+        {{"A", 0}, {"B", 2}, {"C", 2}},
+        {{"A", 0}, {"B", 2}, {"C", 8}},
     });
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
-        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+    COMPARE_CORRECT_REQUEST(Equal("A", 0) && Equal("B", 2) && Equal("A", 1), {});
 
+    COMPARE_CORRECT_REQUEST(Equal("A", 2) && Equal("B", 2), {});
 
-    // Greater
-    vor = vlt.Request(Greater("A", 7, [](const VaultRecordRef& ref) -> bool
-    {
-        int b = 0;
-        ref.GetData("B", b);
-        if (b % 2 == 0) return true;
-        else return false;
-    }), vrs);
+    vor = vlt.Request(Equal("A", 0) && Equal("B", s), vrs);
 
-    TEST_ASSERT(vrs.Size() == 1);
+    TEST_ASSERT(vrs.Size() == 0);
 
-    COMPARE_VAULT(vrs, {{{"A", 8}, {"B", 92}}});
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+)
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
-        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+TEST_BODY(Request, ComplexRequestCompositeIndexRange,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
+    std::string a = "a", b = "b", c = "c";
 
+    vlt.AddKey<std::string>("tenant", "");
+    vlt.AddKey("ts", 0);
+    vlt.AddCompositeIndex({"tenant", "ts"}, VaultIndexPolicy::OrderedOnly);
 
-    // Greater or equal
-    vor = vlt.Request(GreaterOrEqual("A", 7, [](const VaultRecordRef& ref) -> bool
+    for (int i = 0; i < 10; ++i)
     {
-        int b = 0;
-        ref.GetData("B", b);
-        if (b % 2 == 0) return true;
-        else return false;
-    }), vrs);
+        vlt.CreateRecord({{"tenant", a}, {"ts", i}});
+        vlt.CreateRecord({{"tenant", b}, {"ts", i}});
+    }
 
-    TEST_ASSERT(vrs.Size() == 1);
+    COMPARE_CORRECT_REQUEST(Equal("tenant", a) && Greater("ts", 7), {
+        {{"tenant", a}, {"ts", 8}},
+        {{"tenant", a}, {"ts", 9}},
+    });
 
-    COMPARE_VAULT(vrs, {{{"A", 8}, {"B", 92}}});
+    COMPARE_CORRECT_REQUEST(Equal("tenant", a) && GreaterOrEqual("ts", 3) && Less("ts", 5), {
+        {{"tenant", a}, {"ts", 3}},
+        {{"tenant", a}, {"ts", 4}},
+    });
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
-        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+    COMPARE_CORRECT_REQUEST(LessOrEqual("ts", 1) && Equal("tenant", b), {
+        {{"tenant", b}, {"ts", 0}},
+        {{"tenant", b}, {"ts", 1}},
+    });
 
+    COMPARE_CORRECT_REQUEST(Equal("tenant", b) && Greater("ts", 2) && LessOrEqual("ts", 4) && Greater("ts", 3), {
+        {{"tenant", b}, {"ts", 4}},
+    });
 
-    // Less
-    vor = vlt.Request(Less("A", 2, [](const VaultRecordRef& ref) -> bool
-    {
-        int b = 0;
-        ref.GetData("B", b);
-        if (b % 2 == 0) return true;
-        else return false;
-    }), vrs);
+    COMPARE_CORRECT_REQUEST(Equal("tenant", a) && Greater("ts", 5, [](const VaultRecordRef& ref)
+        {
+            int ts = 0;
+            ref.GetData("ts", ts);
+            return ts % 2 == 0;
+        }), {
+        {{"tenant", a}, {"ts", 6}},
+        {{"tenant", a}, {"ts", 8}},
+    });
 
-    TEST_ASSERT(vrs.Size() == 1);
+    COMPARE_CORRECT_REQUEST(Equal("tenant", a) && Equal("ts", 4), {
+        {{"tenant", a}, {"ts", 4}},
+    });
 
-    COMPARE_VAULT(vrs, {{{"A", 0}, {"B", 100}}});
+    COMPARE_CORRECT_REQUEST(Equal("tenant", c) && Greater("ts", 0), {});
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
-        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+    COMPARE_CORRECT_REQUEST(Equal("tenant", a) && Greater("ts", 9), {});
+)
 
+TEST_BODY(Request, ComplexRequestCompositeIndexHashOnly,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
 
-    // Less or equal
-    vor = vlt.Request(LessOrEqual("A", 2, [](const VaultRecordRef& ref) -> bool
-    {
-        int b = 0;
-        ref.GetData("B", b);
-        if (b % 2 == 0) return true;
-        else return false;
-    }), vrs);
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+    vlt.AddCompositeIndex({"A", "B"}, VaultIndexPolicy::HashOnly);
 
-    TEST_ASSERT(vrs.Size() == 2);
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i % 2}, {"B", i}});
 
-    COMPARE_VAULT(vrs, {{{"A", 0}, {"B", 100}}, {{"A", 2}, {"B", 98}}});
+    COMPARE_CORRECT_REQUEST(Equal("A", 1) && Equal("B", 3), {{{"A", 1}, {"B", 3}}});
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
-        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+    // Hash map can not be used with range request, so the usual request is made
+    COMPARE_CORRECT_REQUEST(Equal("A", 1) && Less("B", 4), {{{"A", 1}, {"B", 1}}, {{"A", 1}, {"B", 3}}});
 )
 
-TEST_BODY(Request, BoundaryValues,
+TEST_BODY(Request, ComplexRequestCompositeIndexAfterChanges,
     Vault vlt;
     VaultRecordSet vrs;
+    VaultRecordRef vrr;
     VaultOperationResult vor;
     std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
+    KeyHandle<int> keyHandle;
 
     vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+    vlt.AddCompositeIndex({"A", "B"});
+    vlt.GetKeyHandle("A", keyHandle);
 
-    // ...1...3...
-    vlt.CreateRecord({{"A", 1}});
-    vlt.CreateRecord({{"A", 3}});
+    for (int i = 0; i < 9; ++i) vlt.CreateRecord({{"A", i % 3}, {"B", i}});
 
+    // Change data by key
+    vlt.GetRecord("B", 4, vrr);
+    vrr.SetData("A", 0);
 
-    // Greater
-    //  x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(Greater("A", 0), {{{"A", 1}}, {{"A", 3}}});
+    COMPARE_CORRECT_REQUEST(Equal("A", 0) && Equal("B", 4), {{{"A", 0}, {"B", 4}}});
+    COMPARE_CORRECT_REQUEST(Equal("A", 1) && Equal("B", 4), {});
 
-    //    x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(Greater("A", 1), {{{"A", 3}}});
+    // Change data by key handle
+    vlt.GetRecord("B", 5, vrr);
+    vrr.SetData(keyHandle, 0);
 
-    //      x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(Greater("A", 2), {{{"A", 3}}});
+    COMPARE_CORRECT_REQUEST(Equal("A", 0) && GreaterOrEqual("B", 3), {
+        {{"A", 0}, {"B", 3}},
+        {{"A", 0}, {"B", 4}},
+        {{"A", 0}, {"B", 5}},
+        {{"A", 0}, {"B", 6}},
+    });
+
+    // Erase records
+    vlt.EraseRecord("B", 3);
+    vlt.EraseRecords("B", 6);
+    vlt.GetRecord("B", 4, vrr);
+    vlt.EraseRecord(vrr);
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 0) && GreaterOrEqual("B", 3), {{{"A", 0}, {"B", 5}}});
+
+    // Drop data and add new record
+    vlt.DropData();
+    vlt.CreateRecord({{"A", 0}, {"B", 5}});
+
+    COMPARE_CORRECT_REQUEST(Equal("A", 0) && Equal("B", 5), {{{"A", 0}, {"B", 5}}});
+    COMPARE_CORRECT_REQUEST(Equal("A", 0) && Less("B", 5), {});
+)
+TEST_BODY(Request, ComplexRequestAndSelectivity,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
+    std::size_t predicatCalls = 0;
 
-    //        x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(Greater("A", 3), {});
+    auto countingPredicat = [&](const VaultRecordRef&)
+    {
+        ++predicatCalls;
+        return true;
+    };
 
-    //          x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(Greater("A", 4), {});
+    vlt.AddKey("user", 0);
+    vlt.AddKey("ts", 0);
 
+    for (int i = 0; i < 1000; ++i) vlt.CreateRecord({{"user", i % 100}, {"ts", i}});
 
-    // Greater or equal
-    //  x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 0), {{{"A", 1}}, {{"A", 3}}});
+    // Only records of user are checked by the ts request
+    COMPARE_CORRECT_REQUEST(Equal("user", 5) && Greater("ts", 900, countingPredicat), {{{"user", 5}, {"ts", 905}}});
+    TEST_ASSERT(predicatCalls == 1);
 
-    //    x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 1), {{{"A", 1}}, {{"A", 3}}});
+    predicatCalls = 0;
+    COMPARE_CORRECT_REQUEST(GreaterOrEqual("ts", 0, countingPredicat) && Equal("user", 7), {
+        {{"user", 7}, {"ts", 7}}, {{"user", 7}, {"ts", 107}}, {{"user", 7}, {"ts", 207}}, {{"user", 7}, {"ts", 307}}, {{"user", 7}, {"ts", 407}},
+        {{"user", 7}, {"ts", 507}}, {{"user", 7}, {"ts", 607}}, {{"user", 7}, {"ts", 707}}, {{"user", 7}, {"ts", 807}}, {{"user", 7}, {"ts", 907}},
+    });
+    TEST_ASSERT(predicatCalls == 10);
 
-    //      x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 2), {{{"A", 3}}});
+    // The ts request is more selective than the user request
+    predicatCalls = 0;
+    COMPARE_CORRECT_REQUEST(Equal("user", 2, countingPredicat) && Less("ts", 5), {{{"user", 2}, {"ts", 2}}});
+    TEST_ASSERT(predicatCalls == 1);
 
-    //        x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 3), {{{"A", 3}}});
+    COMPARE_CORRECT_REQUEST(Equal("user", 2) && Less("ts", 10) && Greater("ts", 5), {});
 
-    //          x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 4), {});
+    COMPARE_CORRECT_REQUEST(Equal("user", 100) && Greater("ts", 10), {});
+)
 
+TEST_BODY(Request, ComplexRequestAndWithoutStructures,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
 
-    // Less
-    //  x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(Less("A", 0), {});
+    vlt.AddKey("user", 0, VaultIndexPolicy::None);
+    vlt.AddKey("ts", 0, VaultIndexPolicy::OrderedOnly);
+    vlt.AddKey("group", 0, VaultIndexPolicy::HashOnly);
 
-    //    x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(Less("A", 1), {});
+    for (int i = 0; i < 1000; ++i) vlt.CreateRecord({{"user", i % 100}, {"ts", i}, {"group", i % 10}});
 
-    //      x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(Less("A", 2), {{{"A", 1}}});
+    COMPARE_CORRECT_REQUEST(Equal("user", 5) && Greater("ts", 900), {{{"user", 5}, {"ts", 905}, {"group", 5}}});
 
-    //        x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(Less("A", 3), {{{"A", 1}}});
+    COMPARE_CORRECT_REQUEST(Equal("user", 5) && Equal("group", 5) && LessOrEqual("ts", 105), {
+        {{"user", 5}, {"ts", 5}, {"group", 5}},
+        {{"user", 5}, {"ts", 105}, {"group", 5}},
+    });
 
-    //          x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(Less("A", 4), {{{"A", 1}}, {{"A", 3}}});
+    COMPARE_CORRECT_REQUEST(Less("group", 1) && GreaterOrEqual("ts", 980), {
+        {{"user", 80}, {"ts", 980}, {"group", 0}},
+        {{"user", 90}, {"ts", 990}, {"group", 0}},
+    });
+)
 
+TEST_BODY(Request, ComplexRequestAndWithOr,
+    Vault vlt;
+    VaultRecordSet vrs;
+    VaultOperationResult vor;
+    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
 
-    // Less or equal
-    //  x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 0), {});
+    vlt.AddKey("user", 0);
+    vlt.AddKey("ts", 0);
 
-    //    x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 1), {{{"A", 1}}});
+    for (int i = 0; i < 1000; ++i) vlt.CreateRecord({{"user", i % 100}, {"ts", i}});
 
-    //      x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 2), {{{"A", 1}}});
+    COMPARE_CORRECT_REQUEST(Equal("user", 5) && (Less("ts", 100) || Greater("ts", 900)), {
+        {{"user", 5}, {"ts", 5}},
+        {{"user", 5}, {"ts", 905}},
+    });
 
-    //        x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 3), {{{"A", 1}}, {{"A", 3}}});
+    COMPARE_CORRECT_REQUEST((Equal("user", 5) || Equal("user", 6)) && Less("ts", 200), {
+        {{"user", 5}, {"ts", 5}},
+        {{"user", 6}, {"ts", 6}},
+        {{"user", 5}, {"ts", 105}},
+        {{"user", 6}, {"ts", 106}},
+    });
 
-    //          x
-    // ...1...3...
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 4), {{{"A", 1}}, {{"A", 3}}});
+    COMPARE_CORRECT_REQUEST((Equal("user", 5) || Greater("ts", 990)) && (Less("ts", 10) || Equal("user", 95)), {
+        {{"user", 5}, {"ts", 5}},
+        {{"user", 95}, {"ts", 995}},
+    });
 )
 
-TEST_BODY(Request, WrongKey,
+
+
+TEST_BODY(Scan, CorrectScan,
     Vault vlt;
-    VaultRecordSet vrs;
     VaultOperationResult vor;
+    std::vector<int> found;
 
     vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
 
-    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", 9 - i}});
 
-    // Equal
-    vor = vlt.Request(Equal("Z", 2), vrs);
+    auto scanFunc = [&](const VaultRecordRef& ref)
+    {
+        int a = 0;
+        ref.GetData("A", a);
+        found.emplace_back(a);
+        return true;
+    };
 
-    TEST_ASSERT(vrs.Size() == 0);
+    // Records are read from the map in the order of the key
+    vor = vlt.Scan(Greater("A", 6), scanFunc);
+    std::vector<int> expected = {7, 8, 9};
+    TEST_ASSERT(found == expected);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    COMPARE_VAULT(vrs, {});
+    found.clear();
+    vor = vlt.Scan(LessOrEqual("A", 2), scanFunc);
+    expected = {0, 1, 2};
+    TEST_ASSERT(found == expected);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+    found.clear();
+    vor = vlt.Scan(Equal("A", 4), scanFunc);
+    expected = {4};
+    TEST_ASSERT(found == expected);
 
+    found.clear();
+    vor = vlt.Scan(Equal("A", 40), scanFunc);
+    TEST_ASSERT(found.empty());
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    // Greater
-    vor = vlt.Request(Greater("Z", 7), vrs);
+    found.clear();
+    vor = vlt.Scan(Less("A", 5, [](const VaultRecordRef& ref)
+        {
+            int b = 0;
+            ref.GetData("B", b);
+            return b % 2 == 0;
+        }), scanFunc);
+    expected = {1, 3};
+    TEST_ASSERT(found == expected);
+)
 
-    TEST_ASSERT(vrs.Size() == 0);
+TEST_BODY(Scan, ComplexScan,
+    Vault vlt;
+    VaultOperationResult vor;
+    std::vector<int> counts;
 
-    COMPARE_VAULT(vrs, {});
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", 9 - i}});
 
+    // Count how many times every record is found
+    auto scanFunc = [&](const VaultRecordRef& ref)
+    {
+        int a = 0;
+        ref.GetData("A", a);
+        ++counts[a];
+        return true;
+    };
 
-    // Greater or equal
-    vor = vlt.Request(GreaterOrEqual("Z", 7), vrs);
+    counts.assign(10, 0);
+    vor = vlt.Scan(Greater("A", 2) && Greater("B", 2), scanFunc);
+    std::vector<int> expected = {0, 0, 0, 1, 1, 1, 1, 0, 0, 0};
+    TEST_ASSERT(counts == expected);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    TEST_ASSERT(vrs.Size() == 0);
+    // Records found by both requests are found only once
+    counts.assign(10, 0);
+    vor = vlt.Scan(Less("A", 5) || Less("B", 7), scanFunc);
+    expected = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+    TEST_ASSERT(counts == expected);
+
+    counts.assign(10, 0);
+    vor = vlt.Scan(GreaterOrEqual("A", 2) && LessOrEqual("A", 4), scanFunc);
+    expected = {0, 0, 1, 1, 1, 0, 0, 0, 0, 0};
+    TEST_ASSERT(counts == expected);
+
+    counts.assign(10, 0);
+    vor = vlt.Scan((Equal("A", 1) || Equal("A", 8)) && (Less("B", 5) || Equal("A", 1)), scanFunc);
+    expected = {0, 1, 0, 0, 0, 0, 0, 0, 1, 0};
+    TEST_ASSERT(counts == expected);
+
+    // Composite index is used in the same way as in Request
+    vlt.AddCompositeIndex({"A", "B"});
+    counts.assign(10, 0);
+    vor = vlt.Scan(Equal("A", 6) && Equal("B", 3), scanFunc);
+    expected = {0, 0, 0, 0, 0, 0, 1, 0, 0, 0};
+    TEST_ASSERT(counts == expected);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
+)
 
-    COMPARE_VAULT(vrs, {});
+TEST_BODY(Scan, EarlyStop,
+    Vault vlt;
+    VaultOperationResult vor;
+    std::size_t counter = 0;
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
 
+    for (int i = 0; i < 100; ++i) vlt.CreateRecord({{"A", i}, {"B", i % 10}});
 
-    // Less
-    vor = vlt.Request(Less("Z", 2), vrs);
+    // Stop after the third record
+    auto scanFunc = [&](const VaultRecordRef&)
+    {
+        ++counter;
+        return counter < 3;
+    };
 
-    TEST_ASSERT(vrs.Size() == 0);
+    vor = vlt.Scan(Greater("A", 10), scanFunc);
+    TEST_ASSERT(counter == 3);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    COMPARE_VAULT(vrs, {});
+    counter = 0;
+    vor = vlt.Scan(Equal("B", 5), scanFunc);
+    TEST_ASSERT(counter == 3);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+    counter = 0;
+    vor = vlt.Scan(Equal("B", 5) && Greater("A", 10), scanFunc);
+    TEST_ASSERT(counter == 3);
 
+    // The second request is not scanned after the stop in the first one
+    counter = 0;
+    vor = vlt.Scan(Less("A", 5) || Equal("B", 7), scanFunc);
+    TEST_ASSERT(counter == 3);
+)
 
-    // Less or equal
-    vor = vlt.Request(LessOrEqual("Z", 2), vrs);
+TEST_BODY(Scan, WrongKey,
+    Vault vlt;
+    VaultOperationResult vor;
+    std::size_t counter = 0;
 
-    TEST_ASSERT(vrs.Size() == 0);
+    vlt.AddKey("A", 0);
 
-    COMPARE_VAULT(vrs, {});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
+
+    auto scanFunc = [&](const VaultRecordRef&)
+    {
+        ++counter;
+        return true;
+    };
+
+    vor = vlt.Scan(Equal("Z", 0), scanFunc);
+    TEST_ASSERT(counter == 0);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 
+    // Keys are checked before any record is found
+    vor = vlt.Scan(Less("A", 5) || Equal("Z", 0), scanFunc);
+    TEST_ASSERT(counter == 0);
     COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 )
 
-TEST_BODY(Request, WrongType,
+TEST_BODY(Scan, WrongType,
     Vault vlt;
-    VaultRecordSet vrs;
     VaultOperationResult vor;
+    std::size_t counter = 0;
     std::string s;
 
     vlt.AddKey("A", 0);
 
     for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
 
-    // Equal
-    vor = vlt.Request(Equal("A", s), vrs);
-
-    TEST_ASSERT(vrs.Size() == 0);
-
-    COMPARE_VAULT(vrs, {});
+    auto scanFunc = [&](const VaultRecordRef&)
+    {
+        ++counter;
+        return true;
+    };
 
+    vor = vlt.Scan(Equal("A", s), scanFunc);
+    TEST_ASSERT(counter == 0);
     COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
         RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
 
-
-    // Greater
-    vor = vlt.Request(Greater("A", s), vrs);
-
-    TEST_ASSERT(vrs.Size() == 0);
-
-    COMPARE_VAULT(vrs, {});
-
+    vor = vlt.Scan(Less("A", 5) && Equal("A", s), scanFunc);
+    TEST_ASSERT(counter == 0);
     COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
         RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+)
 
+TEST_BODY(Count, CorrectCount,
+    Vault vlt;
+    VaultOperationResult vor;
+    std::size_t count = 0;
 
-    // Greater or equal
-    vor = vlt.Request(GreaterOrEqual("A", s), vrs);
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0, VaultIndexPolicy::HashOnly);
+    vlt.AddKey("C", 0, VaultIndexPolicy::OrderedOnly);
+    vlt.AddKey("D", 0, VaultIndexPolicy::None);
 
-    TEST_ASSERT(vrs.Size() == 0);
+    for (int i = 0; i < 1000; ++i) vlt.CreateRecord({{"A", i}, {"B", i % 10}, {"C", i % 10}, {"D", i % 10}});
 
-    COMPARE_VAULT(vrs, {});
+    vor = vlt.Count(Less("A", 100), count);
+    TEST_ASSERT(count == 100);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "",
+        RequestedType == typeid(void), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(void));
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
-        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+    vlt.Count(GreaterOrEqual("A", 100), count);
+    TEST_ASSERT(count == 900);
 
+    vlt.Count(Greater("A", 100), count);
+    TEST_ASSERT(count == 899);
 
-    // Less
-    vor = vlt.Request(Less("A", s), vrs);
+    vlt.Count(LessOrEqual("A", 100), count);
+    TEST_ASSERT(count == 101);
 
-    TEST_ASSERT(vrs.Size() == 0);
+    vlt.Count(Equal("A", 100), count);
+    TEST_ASSERT(count == 1);
 
-    COMPARE_VAULT(vrs, {});
+    vlt.Count(Equal("A", 1000), count);
+    TEST_ASSERT(count == 0);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
-        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+    // All structures return the same result
+    vlt.Count(Equal("B", 3), count);
+    TEST_ASSERT(count == 100);
 
+    vlt.Count(Equal("C", 3), count);
+    TEST_ASSERT(count == 100);
 
-    // Less or equal
-    vor = vlt.Request(LessOrEqual("A", s), vrs);
+    vlt.Count(Equal("D", 3), count);
+    TEST_ASSERT(count == 100);
 
-    TEST_ASSERT(vrs.Size() == 0);
+    vlt.Count(Less("B", 3), count);
+    TEST_ASSERT(count == 300);
 
-    COMPARE_VAULT(vrs, {});
+    vlt.Count(Less("C", 3), count);
+    TEST_ASSERT(count == 300);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
-        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+    vlt.Count(Less("D", 3), count);
+    TEST_ASSERT(count == 300);
+
+    // Predicat is checked for every record
+    vlt.Count(Less("A", 100, [](const VaultRecordRef& ref)
+        {
+            int b = 0;
+            ref.GetData("B", b);
+            return b == 0;
+        }), count);
+    TEST_ASSERT(count == 10);
 )
 
-TEST_BODY(Request, ComplexRequestAnd,
+TEST_BODY(Count, ComplexCount,
     Vault vlt;
-    VaultRecordSet vrs;
-    VaultOperationResult vor;
-    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
+    std::size_t count = 0;
 
     vlt.AddKey("A", 0);
     vlt.AddKey("B", 0);
 
-    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", i}});
-
-    // Equal
-    COMPARE_CORRECT_REQUEST(Equal("A", 2) && Equal("B", 2), {{{"A", 2}, {"B", 2}}});
-
-    COMPARE_CORRECT_REQUEST(Equal("A", 2) && Equal("B", 3), {});
-
-    COMPARE_CORRECT_REQUEST(Equal("A", 2) && Greater("B", 1), {{{"A", 2}, {"B", 2}}});
-
-    COMPARE_CORRECT_REQUEST(Equal("A", 2) && GreaterOrEqual("B", 2), {{{"A", 2}, {"B", 2}}});
-
-    COMPARE_CORRECT_REQUEST(Equal("A", 2) && Less("B", 5), {{{"A", 2}, {"B", 2}}});
-
-    COMPARE_CORRECT_REQUEST(Equal("A", 2) && LessOrEqual("B", 2), {{{"A", 2}, {"B", 2}}});
-
+    for (int i = 0; i < 1000; ++i) vlt.CreateRecord({{"A", i}, {"B", i % 10}});
 
-    // Greater
-    COMPARE_CORRECT_REQUEST(Greater("A", 2) && Equal("B", 9), {{{"A", 9}, {"B", 9}}});
+    vlt.Count(Less("A", 100) && Equal("B", 5), count);
+    TEST_ASSERT(count == 10);
 
-    COMPARE_CORRECT_REQUEST(Greater("A", 7) && Greater("B", 1), {{{"A", 8}, {"B", 8}}, {{"A", 9}, {"B", 9}}});
+    vlt.Count(Less("A", 100) || Equal("B", 5), count);
+    TEST_ASSERT(count == 190);
 
-    COMPARE_CORRECT_REQUEST(Greater("A", 8) && GreaterOrEqual("B", 8), {{{"A", 9}, {"B", 9}}});
+    vlt.Count(GreaterOrEqual("A", 10) && Less("A", 20), count);
+    TEST_ASSERT(count == 10);
+)
 
-    COMPARE_CORRECT_REQUEST(Greater("A", 2) && Less("B", 4), {{{"A", 3}, {"B", 3}}});
+TEST_BODY(Count, AfterChanges,
+    Vault vlt;
+    std::size_t count = 0;
 
-    COMPARE_CORRECT_REQUEST(Greater("A", 2) && LessOrEqual("B", 3), {{{"A", 3}, {"B", 3}}});
+    vlt.AddKey("A", 0);
 
+    // Enough records to split and merge nodes of the map
+    for (int i = 0; i < 5000; ++i) vlt.CreateRecord({{"A", i % 500}});
 
-    // Greater or equal
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 2) && Equal("B", 5), {{{"A", 5}, {"B", 5}}});
+    vlt.Count(Less("A", 100), count);
+    TEST_ASSERT(count == 1000);
 
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 8) && Greater("B", 1), {{{"A", 8}, {"B", 8}}, {{"A", 9}, {"B", 9}}});
+    vlt.EraseRecords("A", 50);
+    vlt.EraseRecords("A", 450);
+    for (int i = 0; i < 300; ++i) vlt.EraseRecord("A", i % 3 * 100 + 1);
 
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 8) && GreaterOrEqual("B", 9), {{{"A", 9}, {"B", 9}}});
+    vlt.Count(Less("A", 100), count);
+    TEST_ASSERT(count == 980);
 
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 2) && Less("B", 4), {{{"A", 2}, {"B", 2}}, {{"A", 3}, {"B", 3}}});
+    vlt.Count(Less("A", 201), count);
+    TEST_ASSERT(count == 1980);
 
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 2) && LessOrEqual("B", 3), {{{"A", 2}, {"B", 2}}, {{"A", 3}, {"B", 3}}});
+    vlt.Count(Greater("A", 400), count);
+    TEST_ASSERT(count == 980);
 
+    vlt.Count(Equal("A", 101), count);
+    TEST_ASSERT(count == 0);
 
-    // Less
-    COMPARE_CORRECT_REQUEST(Less("A", 7) && Equal("B", 5), {{{"A", 5}, {"B", 5}}});
+    vlt.Count(Equal("A", 102), count);
+    TEST_ASSERT(count == 10);
+)
 
-    COMPARE_CORRECT_REQUEST(Less("A", 3) && Greater("B", 1), {{{"A", 2}, {"B", 2}}});
+TEST_BODY(Count, WrongKey,
+    Vault vlt;
+    VaultOperationResult vor;
+    std::size_t count = 7;
+    std::string s;
 
-    COMPARE_CORRECT_REQUEST(Less("A", 8) && GreaterOrEqual("B", 7), {{{"A", 7}, {"B", 7}}});
+    vlt.AddKey("A", 0);
 
-    COMPARE_CORRECT_REQUEST(Less("A", 2) && Less("B", 4), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
 
-    COMPARE_CORRECT_REQUEST(Less("A", 2) && LessOrEqual("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}});
+    vor = vlt.Count(Equal("Z", 0), count);
+    TEST_ASSERT(count == 7);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 
+    vor = vlt.Count(Equal("A", s), count);
+    TEST_ASSERT(count == 7);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
 
-    // Less or equal
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 7) && Equal("B", 5), {{{"A", 5}, {"B", 5}}});
+    vor = vlt.Count(Less("A", 5) && Equal("Z", 0), count);
+    TEST_ASSERT(count == 7);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+)
 
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 3) && Greater("B", 2), {{{"A", 3}, {"B", 3}}});
+TEST_BODY(Min, CorrectMin,
+    Vault vlt;
+    VaultOperationResult vor;
+    int min = 0;
 
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 8) && GreaterOrEqual("B", 8), {{{"A", 8}, {"B", 8}}});
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0, VaultIndexPolicy::HashOnly);
 
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 2) && Less("B", 4), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 2}, {"B", 2}}});
+    for (int i = 0; i < 100; ++i) vlt.CreateRecord({{"A", 100 - i}, {"B", 100 - i}});
 
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 2) && LessOrEqual("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}});
+    // The value is taken from the map
+    vor = vlt.Min("A", min);
+    TEST_ASSERT(min == 1);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+    // The key has no map, so all records are checked
+    min = 0;
+    vlt.Min("B", min);
+    TEST_ASSERT(min == 1);
 )
 
-TEST_BODY(Request, ComplexRequestOr,
+TEST_BODY(Min, MinWithRequest,
     Vault vlt;
-    VaultRecordSet vrs;
     VaultOperationResult vor;
-    std::vector<std::vector<std::pair<std::string, TypeWrapper>>> records;
+    int min = 0;
 
     vlt.AddKey("A", 0);
     vlt.AddKey("B", 0);
 
-    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", i}});
-
-    // Equal
-    COMPARE_CORRECT_REQUEST(Equal("A", 2) || Equal("B", 3), {{{"A", 2}, {"B", 2}}, {{"A", 3}, {"B", 3}}});
-
-    COMPARE_CORRECT_REQUEST(Equal("A", 2) || Greater("B", 8), {{{"A", 2}, {"B", 2}}, {{"A", 9}, {"B", 9}}});
+    for (int i = 0; i < 1000; ++i) vlt.CreateRecord({{"A", i}, {"B", i % 10}});
 
-    COMPARE_CORRECT_REQUEST(Equal("A", 2) || GreaterOrEqual("B", 9), {{{"A", 2}, {"B", 2}}, {{"A", 9}, {"B", 9}}});
+    // Not selective request uses the map of A
+    vor = vlt.Min("A", Greater("B", 2), min);
+    TEST_ASSERT(min == 3);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 
-    COMPARE_CORRECT_REQUEST(Equal("A", 2) || Less("B", 2), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 2}, {"B", 2}}});
+    // Selective request reads its records
+    vlt.Min("A", Greater("A", 995), min);
+    TEST_ASSERT(min == 996);
 
-    COMPARE_CORRECT_REQUEST(Equal("A", 2) || LessOrEqual("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 2}, {"B", 2}}});
+    vlt.Min("A", Equal("B", 7) && Greater("A", 500), min);
+    TEST_ASSERT(min == 507);
 
+    vlt.Min("B", Greater("A", 995), min);
+    TEST_ASSERT(min == 6);
+)
 
-    // Greater
-    COMPARE_CORRECT_REQUEST(Greater("A", 8) || Equal("B", 0), {{{"A", 0}, {"B", 0}}, {{"A", 9}, {"B", 9}}});
+TEST_BODY(Min, NoRecords,
+    Vault vlt;
+    VaultOperationResult vor;
+    int min = -1;
 
-    COMPARE_CORRECT_REQUEST(Greater("A", 8) || Greater("B", 10), {{{"A", 9}, {"B", 9}}});
+    vlt.AddKey("A", 0);
 
-    COMPARE_CORRECT_REQUEST(Greater("A", 8) || GreaterOrEqual("B", 9), {{{"A", 9}, {"B", 9}}});
+    vor = vlt.Min("A", min);
+    TEST_ASSERT(min == -1);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
 
-    COMPARE_CORRECT_REQUEST(Greater("A", 8) || Less("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 9}, {"B", 9}}});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
 
-    COMPARE_CORRECT_REQUEST(Greater("A", 8) || LessOrEqual("B", 0), {{{"A", 0}, {"B", 0}}, {{"A", 9}, {"B", 9}}});
+    vor = vlt.Min("A", Greater("A", 10), min);
+    TEST_ASSERT(min == -1);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
+)
 
+TEST_BODY(Min, WrongKey,
+    Vault vlt;
+    VaultOperationResult vor;
+    int min = -1;
+    std::string s;
 
-    // Greater or equal
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 9) || Equal("B", 5), {{{"A", 5}, {"B", 5}}, {{"A", 9}, {"B", 9}}});
+    vlt.AddKey("A", 0);
 
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 8) || Greater("B", 8), {{{"A", 8}, {"B", 8}}, {{"A", 9}, {"B", 9}}});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
 
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 8) || GreaterOrEqual("B", 9), {{{"A", 8}, {"B", 8}}, {{"A", 9}, {"B", 9}}});
+    vor = vlt.Min("Z", min);
+    TEST_ASSERT(min == -1);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 9) || Less("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 9}, {"B", 9}}});
+    vor = vlt.Min("A", s);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
 
-    COMPARE_CORRECT_REQUEST(GreaterOrEqual("A", 9) || LessOrEqual("B", 0), {{{"A", 0}, {"B", 0}}, {{"A", 9}, {"B", 9}}});
+    vor = vlt.Min("A", Equal("Z", 0), min);
+    TEST_ASSERT(min == -1);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+)
 
+TEST_BODY(Max, CorrectMax,
+    Vault vlt;
+    VaultOperationResult vor;
+    std::string max;
 
-    // Less
-    COMPARE_CORRECT_REQUEST(Less("A", 1) || Equal("B", 5), {{{"A", 0}, {"B", 0}}, {{"A", 5}, {"B", 5}}});
+    vlt.AddKey<std::string>("A", "");
+    vlt.AddKey<std::string>("B", "", VaultIndexPolicy::None);
 
-    COMPARE_CORRECT_REQUEST(Less("A", 1) || Greater("B", 8), {{{"A", 0}, {"B", 0}}, {{"A", 9}, {"B", 9}}});
+    for (int i = 0; i < 100; ++i) vlt.CreateRecord({{"A", std::to_string(i)}, {"B", std::to_string(i)}});
 
-    COMPARE_CORRECT_REQUEST(Less("A", 1) || GreaterOrEqual("B", 9), {{{"A", 0}, {"B", 0}}, {{"A", 9}, {"B", 9}}});
+    vor = vlt.Max("A", max);
+    TEST_ASSERT(max == "99");
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(std::string));
 
-    COMPARE_CORRECT_REQUEST(Less("A", 2) || Less("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}});
+    max.clear();
+    vlt.Max("B", max);
+    TEST_ASSERT(max == "99");
+)
 
-    COMPARE_CORRECT_REQUEST(Less("A", 1) || LessOrEqual("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}});
+TEST_BODY(Max, MaxWithRequest,
+    Vault vlt;
+    VaultOperationResult vor;
+    int max = 0;
 
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
 
-    // Less or equal
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 1) || Equal("B", 5), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 5}, {"B", 5}}});
+    for (int i = 0; i < 1000; ++i) vlt.CreateRecord({{"A", i}, {"B", i % 10}});
 
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 1) || Greater("B", 8), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 9}, {"B", 9}}});
+    vor = vlt.Max("A", Less("B", 5), max);
+    TEST_ASSERT(max == 994);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 1) || GreaterOrEqual("B", 9), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 9}, {"B", 9}}});
+    vlt.Max("A", Less("A", 3), max);
+    TEST_ASSERT(max == 2);
 
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 1) || Less("B", 3), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 2}, {"B", 2}}});
+    vlt.Max("A", Equal("B", 3) || Equal("B", 1), max);
+    TEST_ASSERT(max == 993);
 
-    COMPARE_CORRECT_REQUEST(LessOrEqual("A", 2) || LessOrEqual("B", 1), {{{"A", 0}, {"B", 0}}, {{"A", 1}, {"B", 1}}, {{"A", 2}, {"B", 2}}});
+    vlt.Max("B", Less("A", 3), max);
+    TEST_ASSERT(max == 2);
 )
 
-TEST_BODY(Request, ComplexRequest,
+TEST_BODY(Sum, CorrectSum,
     Vault vlt;
-    VaultRecordSet vrs;
     VaultOperationResult vor;
-    VaultRecordRef vrr;
+    long long sum = 0;
 
-    vlt.AddKey("A", 0);
-    vlt.AddKey("B", 0);
-    vlt.AddKey<std::string>("C", "");
-    vlt.AddKey<bool>("D", false);
+    vlt.AddKey<long long>("A", 0);
 
-    for (int i = 0; i < 10; ++i)
-    {
-        vlt.CreateRecord(vrr, {{"A", i}, {"B", i}, {"C", std::to_string(i)}});
-        if (i == 5 || i == 9) vrr.SetData("D", true);
-    }
-    
-    vlt.Request(Greater("A", 2) && Less("B", 8) && (Equal("C", std::string("3")) || Equal("C", std::string("4"))) || Equal("D", true), vrs);
-    
-    CompareVault(vrs, {
-        {{"A", 3}, {"B", 3}, {"C", std::string("3")}, {"D", false}},
-        {{"A", 4}, {"B", 4}, {"C", std::string("4")}, {"D", false}},
-        {{"A", 5}, {"B", 5}, {"C", std::string("5")}, {"D", true}},
-        {{"A", 9}, {"B", 9}, {"C", std::string("9")}, {"D", true}},
-    });
+    vor = vlt.Sum("A", sum);
+    TEST_ASSERT(sum == 0);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(long long), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(long long));
+
+    for (long long i = 1; i <= 100; ++i) vlt.CreateRecord({{"A", i}});
+
+    vlt.Sum("A", sum);
+    TEST_ASSERT(sum == 5050);
 )
 
-TEST_BODY(Request, ComplexRequestInterval,
+TEST_BODY(Sum, SumWithRequest,
     Vault vlt;
-    VaultRecordSet vrs;
     VaultOperationResult vor;
-    VaultRecordRef vrr;
+    double sum = 0;
 
     vlt.AddKey("A", 0);
-    vlt.AddKey("B", 0);
-    vlt.AddKey<std::string>("C", "");
-    vlt.AddKey<bool>("D", false);
-
-    for (int i = 0; i < 10; ++i)
-    {
-        vlt.CreateRecord(vrr, {{"A", i}, {"B", i}, {"C", std::to_string(i)}});
-        if (i == 5 || i == 9) vrr.SetData("D", true);
-    }
+    vlt.AddKey("B", 0.0);
 
-    vlt.Request(Greater("A", 3) && Less("A", 7), vrs);
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", i * 0.5}});
 
-    CompareVault(vrs, {
-        {{"A", 4}, {"B", 4}, {"C", std::string("4")}, {"D", false}},
-        {{"A", 5}, {"B", 5}, {"C", std::string("5")}, {"D", true}},
-        {{"A", 6}, {"B", 6}, {"C", std::string("6")}, {"D", false}},
-    });
+    vor = vlt.Sum("B", Less("A", 4), sum);
+    TEST_ASSERT(sum == 3.0);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "B", 
+        RequestedType == typeid(double), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(double));
 
-    vlt.Request(Greater("A", 3, [](const VaultRecordRef& ref) -> bool 
-    {
-        bool d = false;
-        ref.GetData("D", d);
-        if (!d) return true;
-        else return false;
-    }) && Less("A", 7), vrs);
+    vlt.Sum("B", Less("A", 2) || Greater("A", 7), sum);
+    TEST_ASSERT(sum == 9.0);
 
-    CompareVault(vrs, {
-        {{"A", 4}, {"B", 4}, {"C", std::string("4")}, {"D", false}},
-        {{"A", 6}, {"B", 6}, {"C", std::string("6")}, {"D", false}},
-    });
+    vlt.Sum("B", Greater("A", 20), sum);
+    TEST_ASSERT(sum == 0.0);
 )
 
-TEST_BODY(Request, ComplexRequestWrongKey,
+TEST_BODY(Sum, WrongKey,
     Vault vlt;
-    VaultRecordSet vrs;
     VaultOperationResult vor;
+    int sum = -1;
+    double d = -1;
 
     vlt.AddKey("A", 0);
-    vlt.AddKey("B", 0);
-
-    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", i}});
-
-    vor = vlt.Request(Equal("A", 0) && Equal("Z", 0), vrs);
-
-    TEST_ASSERT(vrs.Size() == 0);
 
-    COMPARE_VAULT(vrs, {});
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
 
+    vor = vlt.Sum("Z", sum);
+    TEST_ASSERT(sum == -1);
     COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 
+    vor = vlt.Sum("A", d);
+    TEST_ASSERT(d == -1);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(double), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
 
-    vor = vlt.Request(Equal("Z", 0) && Equal("Y", 0), vrs);
-
-    TEST_ASSERT(vrs.Size() == 0);
-
-    COMPARE_VAULT(vrs, {});
-
+    vor = vlt.Sum("A", Less("Z", 3), sum);
+    TEST_ASSERT(sum == -1);
     COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z", 
         RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
 )
 
-TEST_BODY(Request, ComplexRequestWrongType,
+TEST_BODY(Avg, CorrectAvg,
     Vault vlt;
-    VaultRecordSet vrs;
     VaultOperationResult vor;
-    std::string s;
+    double avg = 0;
 
     vlt.AddKey("A", 0);
-    vlt.AddKey("B", 0);
-
-    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}, {"B", i}});
 
-    vor = vlt.Request(Equal("A", 0) && Equal("B", s), vrs);
+    for (int i = 1; i <= 4; ++i) vlt.CreateRecord({{"A", i}});
 
-    TEST_ASSERT(vrs.Size() == 0);
+    vor = vlt.Avg<int>("A", avg);
+    TEST_ASSERT(avg == 2.5);
+    COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
 
-    COMPARE_VAULT(vrs, {});
+    vor = vlt.Avg<int>("A", Greater("A", 2), avg);
+    TEST_ASSERT(avg == 3.5);
+)
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "B", 
-        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+TEST_BODY(Avg, NoRecords,
+    Vault vlt;
+    VaultOperationResult vor;
+    double avg = -1;
 
+    vlt.AddKey("A", 0);
 
-    vor = vlt.Request(Equal("A", s) && Equal("B", 0), vrs);
+    vor = vlt.Avg<int>("A", avg);
+    TEST_ASSERT(avg == -1);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
 
-    TEST_ASSERT(vrs.Size() == 0);
+    vlt.CreateRecord({{"A", 1}});
 
-    COMPARE_VAULT(vrs, {});
+    vor = vlt.Avg<int>("A", Greater("A", 1), avg);
+    TEST_ASSERT(avg == -1);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
 
+    vor = vlt.Avg<long long>("A", avg);
+    TEST_ASSERT(avg == -1);
     COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
-        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+        RequestedType == typeid(long long), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
 )
 
 TEST_BODY(DropVault, Drop,
@@ -3587,6 +6270,35 @@ TEST_BODY(DropData, DropWithDependent,
     COMPARE_VAULT(vrs, {});
 )
 
+TEST_BODY(DropData, DropWithRecordRef,
+    Vault vlt;
+    VaultRecordRef vrr1, vrr2;
+
+    vlt.AddKey("A", 0);
+
+    for (int i = 0; i < 1000; ++i) vlt.CreateRecord({{"A", i}});
+
+    vlt.GetRecord("A", 10, vrr1);
+
+    vlt.DropData();
+
+    TEST_ASSERT(vrr1.IsValid() == false);
+
+    for (int i = 0; i < 1000; ++i) vlt.CreateRecord({{"A", i}});
+
+    TEST_ASSERT(vlt.Size() == 1000);
+    TEST_ASSERT(vrr1.IsValid() == false);
+
+    vlt.GetRecord("A", 10, vrr2);
+
+    TEST_ASSERT(vrr2.IsValid());
+    TEST_ASSERT(vrr1 != vrr2);
+
+    vlt.DropData();
+
+    TEST_ASSERT(vrr2.IsValid() == false);
+)
+
 TEST_BODY(EraseRecord, CorrectEraseByRef,
     Vault vlt;
     VaultRecordRef vrr;
@@ -3724,18 +6436,103 @@ TEST_BODY(EraseRecord, WrongValueEraseByKeyAndValue,
     VaultRecordRef vrr;
     VaultOperationResult vor;
 
-    vlt.AddKey("A", 0);
+    vlt.AddKey("A", 0);
+
+    vlt.CreateRecord(vrr, {{"A", 0}});
+
+    vor = vlt.EraseRecord("A", 1);
+
+    TEST_ASSERT(vlt.Size() == 1);
+
+    COMPARE_VAULT(vlt, {{{"A", 0}}});
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
+)
+
+TEST_BODY(EraseRecord, CreateAfterErase,
+    Vault vlt;
+    VaultRecordRef vrr;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey<std::string>("B", "none");
+
+    vlt.CreateRecord(vrr, {{"A", 1}, {"B", std::string("first")}});
+    vlt.CreateRecord({{"A", 2}, {"B", std::string("second")}});
+
+    TEST_ASSERT(vlt.EraseRecord(vrr));
+
+    vlt.UpdateKey<std::string>("B", "empty");
+    vlt.CreateRecord(vrr, {{"A", 3}});
+
+    COMPARE_VAULT(vlt, {
+        {{"A", 2}, {"B", std::string("second")}},
+        {{"A", 3}, {"B", std::string("empty")}},
+    })
+
+    vrr.SetData<std::string>("B", "third");
+
+    COMPARE_VAULT(vlt, {
+        {{"A", 2}, {"B", std::string("second")}},
+        {{"A", 3}, {"B", std::string("third")}},
+    })
+    TEST_ASSERT(vlt.EraseRecord("A", 2).IsOperationSuccess);
+    vlt.CreateRecord({{"A", 4}});
+
+    COMPARE_VAULT(vlt, {
+        {{"A", 3}, {"B", std::string("third")}},
+        {{"A", 4}, {"B", std::string("empty")}},
+    })
+)
+
+TEST_BODY(EraseRecord, CorrectByKeyHandle,
+    Vault vlt;
+    KeyHandle<int> handle;
+    VaultOperationResult vor;
+
+    vlt.AddKey("A", 0);
+    vlt.GetKeyHandle("A", handle);
+
+    for (int i = 0; i < 100; ++i) vlt.CreateRecord({{"A", i}});
+
+    for (int i = 0; i < 100; ++i)
+    {
+        vor = vlt.EraseRecord(handle, i);
+        TEST_ASSERT(vor.IsOperationSuccess);
+    }
+
+    TEST_ASSERT(vlt.Size() == 0);
+
+    vor = vlt.EraseRecord(handle, 0);
+
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
+)
+
+TEST_BODY(EraseRecord, SameKeyValue,
+    Vault vlt;
+    VaultRecordSet vrs;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+
+    for (int i = 0; i < 100; ++i) vlt.CreateRecord({{"A", i % 2}, {"B", i}});
 
-    vlt.CreateRecord(vrr, {{"A", 0}});
+    // Erase half of records, all other records with same A value must stay in both structures
+    for (int i = 0; i < 50; ++i) vlt.EraseRecord("B", i);
 
-    vor = vlt.EraseRecord("A", 1);
+    TEST_ASSERT(vlt.Size() == 50);
 
-    TEST_ASSERT(vlt.Size() == 1);
+    // Check hash table request
+    vlt.RequestEqual("A", 0, vrs);
+    TEST_ASSERT(vrs.Size() == 25);
 
-    COMPARE_VAULT(vlt, {{{"A", 0}}});
+    // Check map request
+    vlt.RequestGreater("A", 0, vrs);
+    TEST_ASSERT(vrs.Size() == 25);
 
-    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A", 
-        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongValue, SavedType == typeid(int));
+    vlt.RequestLessOrEqual("A", 1, vrs);
+    TEST_ASSERT(vrs.Size() == 50);
 )
 
 TEST_BODY(EraseRecords, Erase,
@@ -3898,6 +6695,42 @@ TEST_BODY(GetSortedRecords, GetNotAllRecords,
     }
 )
 
+TEST_BODY(GetSortedRecords, GetRecordsAfterErase,
+    Vault vlt;
+    std::vector<VaultRecordRef> refs;
+
+    vlt.AddKey("A", 0);
+
+    // Insert values in mixed order
+    for (int i = 0; i < 5000; ++i) vlt.CreateRecord({{"A", (i * 7919) % 5000}});
+
+    // Erase all values except every fifth
+    for (int i = 0; i < 5000; ++i)
+        if (i % 5 != 0) vlt.EraseRecord("A", i);
+
+    refs = vlt.GetSortedRecords("A");
+
+    TEST_ASSERT(refs.size() == 1000);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        int a = 0;
+        refs[i].GetData("A", a);
+        TEST_ASSERT(a == i * 5);
+    }
+
+    refs = vlt.GetSortedRecords("A", true);
+
+    TEST_ASSERT(refs.size() == 1000);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        int a = 0;
+        refs[i].GetData("A", a);
+        TEST_ASSERT(a == (999 - i) * 5);
+    }
+)
+
 TEST_BODY(GetSortedRecords, WrongKey,
     Vault vlt;
     std::vector<VaultRecordRef> refs;
@@ -3991,6 +6824,305 @@ TEST_BODY(SortBy, WrongKey,
     TEST_ASSERT(counter == 0);
 )
 
+TEST_BODY(GetTopRecords, TopRecords,
+    Vault vlt;
+
+    vlt.AddKey("A", 0);
+
+    for (int i = 0; i < 1000; ++i) vlt.CreateRecord({{"A", i}});
+
+    int calls = 0;
+    std::vector<VaultRecordRef> records = vlt.GetTopRecords("A", 5, [&](const VaultRecordRef& ref) -> bool
+    {
+        int a = 0;
+        ref.GetData("A", a);
+        ++calls;
+        return a % 3 == 0;
+    });
+
+    TEST_ASSERT(records.size() == 5);
+    for (std::size_t i = 0; i < records.size(); ++i)
+    {
+        int a = -1;
+        records[i].GetData("A", a);
+        TEST_ASSERT(a == static_cast<int>(i) * 3);
+    }
+
+    // The iteration stops after the last found record
+    TEST_ASSERT(calls == 13);
+
+    records = vlt.GetTopRecords("A", 2000);
+    TEST_ASSERT(records.size() == 1000);
+)
+
+TEST_BODY(GetTopRecords, TopRecordsReverse,
+    Vault vlt;
+
+    vlt.AddKey("A", 0, VaultIndexPolicy::HashOnly);
+
+    for (int i = 0; i < 1000; ++i) vlt.CreateRecord({{"A", i}});
+
+    std::vector<VaultRecordRef> records = vlt.GetTopRecords("A", 3, [&](const VaultRecordRef& ref) -> bool
+    {
+        int a = 0;
+        ref.GetData("A", a);
+        return a % 2 == 0;
+    }, true);
+
+    std::vector<int> expected = {998, 996, 994};
+    TEST_ASSERT(records.size() == expected.size());
+    for (std::size_t i = 0; i < records.size(); ++i)
+    {
+        int a = -1;
+        records[i].GetData("A", a);
+        TEST_ASSERT(a == expected[i]);
+    }
+)
+
+TEST_BODY(GetTopRecords, WrongKey,
+    Vault vlt;
+
+    vlt.AddKey("A", 0);
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
+
+    TEST_ASSERT(vlt.GetTopRecords("Z", 5).empty());
+    TEST_ASSERT(vlt.GetTopRecords("A", 0).empty());
+)
+
+TEST_BODY(GetSortedPage, AllPages,
+    Vault vlt;
+    VaultOperationResult vor;
+    VaultPageCursor<int> cursor;
+    std::vector<VaultRecordRef> page;
+    std::set<int> ids;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey("id", 0);
+
+    for (int i = 0; i < 1000; ++i) vlt.CreateRecord({{"A", i % 50}, {"id", i}});
+
+    TEST_ASSERT(cursor.GetIsSet() == false);
+
+    int lastA = -1;
+    std::size_t pagesCount = 0;
+    do
+    {
+        vor = vlt.GetSortedPage("A", cursor, 37, page);
+        COMPARE_OPERATION(vor, IsOperationSuccess == true, Key == "A",
+            RequestedType == typeid(int), ResultCode == VaultOperationResultCode::Success, SavedType == typeid(int));
+
+        for (const VaultRecordRef& ref : page)
+        {
+            int a = -1, id = -1;
+            ref.GetData("A", a);
+            ref.GetData("id", id);
+
+            TEST_ASSERT(lastA <= a);
+            TEST_ASSERT(ids.emplace(id).second);
+            lastA = a;
+        }
+
+        ++pagesCount;
+    } while (page.size() == 37);
+
+    TEST_ASSERT(ids.size() == 1000);
+    TEST_ASSERT(pagesCount == 28);
+    TEST_ASSERT(cursor.GetIsSet());
+
+    // The cursor after the last record returns empty page
+    vlt.GetSortedPage("A", cursor, 37, page);
+    TEST_ASSERT(page.empty());
+
+    cursor.Reset();
+    vlt.GetSortedPage("A", cursor, 1, page);
+    int a = -1;
+    page.front().GetData("A", a);
+    TEST_ASSERT(page.size() == 1 && a == 0);
+)
+
+TEST_BODY(GetSortedPage, AllPagesReverse,
+    Vault vlt;
+    VaultPageCursor<int> cursor;
+    std::vector<VaultRecordRef> page;
+    std::set<int> ids;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey("id", 0);
+
+    for (int i = 0; i < 1000; ++i) vlt.CreateRecord({{"A", i % 50}, {"id", i}});
+
+    int lastA = 50;
+    do
+    {
+        vlt.GetSortedPage("A", cursor, 64, page, true);
+
+        for (const VaultRecordRef& ref : page)
+        {
+            int a = -1, id = -1;
+            ref.GetData("A", a);
+            ref.GetData("id", id);
+
+            TEST_ASSERT(a <= lastA);
+            TEST_ASSERT(ids.emplace(id).second);
+            lastA = a;
+        }
+    } while (page.size() == 64);
+
+    TEST_ASSERT(ids.size() == 1000);
+    TEST_ASSERT(lastA == 0);
+)
+
+TEST_BODY(GetSortedPage, AllPagesWithoutMap,
+    Vault vlt;
+    VaultPageCursor<int> cursor;
+    VaultPageCursor<int> reverseCursor;
+    std::vector<VaultRecordRef> page;
+    std::set<int> ids;
+    std::set<int> reverseIds;
+
+    vlt.AddKey("A", 0, VaultIndexPolicy::HashOnly);
+    vlt.AddKey("id", 0);
+
+    for (int i = 0; i < 100; ++i) vlt.CreateRecord({{"A", i % 7}, {"id", i}});
+
+    int lastA = -1;
+    do
+    {
+        vlt.GetSortedPage("A", cursor, 9, page);
+
+        for (const VaultRecordRef& ref : page)
+        {
+            int a = -1, id = -1;
+            ref.GetData("A", a);
+            ref.GetData("id", id);
+
+            TEST_ASSERT(lastA <= a);
+            TEST_ASSERT(ids.emplace(id).second);
+            lastA = a;
+        }
+    } while (page.size() == 9);
+
+    TEST_ASSERT(ids.size() == 100);
+
+    lastA = 7;
+    do
+    {
+        vlt.GetSortedPage("A", reverseCursor, 9, page, true);
+
+        for (const VaultRecordRef& ref : page)
+        {
+            int a = -1, id = -1;
+            ref.GetData("A", a);
+            ref.GetData("id", id);
+
+            TEST_ASSERT(a <= lastA);
+            TEST_ASSERT(reverseIds.emplace(id).second);
+            lastA = a;
+        }
+    } while (page.size() == 9);
+
+    TEST_ASSERT(reverseIds.size() == 100);
+)
+
+TEST_BODY(GetSortedPage, ChangesBetweenPages,
+    Vault vlt;
+    VaultPageCursor<int> cursor;
+    std::vector<VaultRecordRef> page;
+    std::set<int> ids;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey("id", 0);
+
+    for (int i = 0; i < 100; ++i) vlt.CreateRecord({{"A", i / 10}, {"id", i}});
+
+    vlt.GetSortedPage("A", cursor, 15, page);
+    for (const VaultRecordRef& ref : page)
+    {
+        int id = -1;
+        ref.GetData("id", id);
+        ids.emplace(id);
+    }
+
+    // Erase the last record of the page, add records before and after the cursor
+    VaultRecordRef last = page.back();
+    vlt.EraseRecord(last);
+    vlt.CreateRecord({{"A", 0}, {"id", 1000}});
+    vlt.CreateRecord({{"A", 5}, {"id", 1001}});
+
+    do
+    {
+        vlt.GetSortedPage("A", cursor, 15, page);
+
+        for (const VaultRecordRef& ref : page)
+        {
+            int id = -1;
+            ref.GetData("id", id);
+            TEST_ASSERT(ids.emplace(id).second);
+        }
+    } while (page.size() == 15);
+
+    TEST_ASSERT(ids.find(1000) == ids.end());
+    TEST_ASSERT(ids.find(1001) != ids.end());
+    TEST_ASSERT(ids.size() == 101);
+)
+
+TEST_BODY(GetSortedPage, PagesWithPredicat,
+    Vault vlt;
+    VaultPageCursor<int> cursor;
+    std::vector<VaultRecordRef> page;
+    std::vector<int> values;
+
+    vlt.AddKey("A", 0);
+
+    for (int i = 0; i < 100; ++i) vlt.CreateRecord({{"A", i}});
+
+    auto predicat = [](const VaultRecordRef& ref) -> bool
+    {
+        int a = 0;
+        ref.GetData("A", a);
+        return a % 10 == 0;
+    };
+
+    do
+    {
+        vlt.GetSortedPage("A", cursor, 4, page, false, predicat);
+
+        for (const VaultRecordRef& ref : page)
+        {
+            int a = -1;
+            ref.GetData("A", a);
+            values.emplace_back(a);
+        }
+    } while (page.size() == 4);
+
+    std::vector<int> expected = {0, 10, 20, 30, 40, 50, 60, 70, 80, 90};
+    TEST_ASSERT(values == expected);
+)
+
+TEST_BODY(GetSortedPage, WrongKey,
+    Vault vlt;
+    VaultOperationResult vor;
+    VaultPageCursor<int> cursor;
+    VaultPageCursor<std::string> wrongTypeCursor;
+    std::vector<VaultRecordRef> page;
+
+    vlt.AddKey("A", 0);
+
+    for (int i = 0; i < 10; ++i) vlt.CreateRecord({{"A", i}});
+
+    vor = vlt.GetSortedPage("Z", cursor, 5, page);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "Z",
+        RequestedType == typeid(int), ResultCode == VaultOperationResultCode::WrongKey, SavedType == typeid(void));
+
+    vor = vlt.GetSortedPage("A", wrongTypeCursor, 5, page);
+    COMPARE_OPERATION(vor, IsOperationSuccess == false, Key == "A",
+        RequestedType == typeid(std::string), ResultCode == VaultOperationResultCode::WrongType, SavedType == typeid(int));
+
+    TEST_ASSERT(page.empty());
+    TEST_ASSERT(cursor.GetIsSet() == false);
+)
+
 TEST_BODY(ToJson, Default,
     Vault vlt;
 
@@ -4857,6 +7989,280 @@ TEST_BODY(Destructor, Default,
     TEST_ASSERT(vrf.IsValid() == false);
     TEST_ASSERT(vrs.GetIsParentVaultValid() == false);
 )
+
+TEST_BODY(Multithreading, ReadersAndWriters,
+    Vault vlt;
+    std::vector<std::thread> threads;
+    std::atomic<bool> isWrongRead(false);
+    const int writersCount = 4, readersCount = 8, recordsCount = 500;
+
+    vlt.AddUniqueKey<int>("A");
+    vlt.AddKey("B", 0);
+
+    for (int i = 0; i < writersCount; ++i)
+    {
+        threads.emplace_back([&, i]()
+        {
+            for (int j = 0; j < recordsCount; ++j)
+            {
+                VaultRecordRef vrr;
+                vlt.CreateRecord(vrr, {{"A", i * recordsCount + j}});
+                vrr.SetData("B", i * recordsCount + j);
+            }
+        });
+    }
+
+    for (int i = 0; i < readersCount; ++i)
+    {
+        threads.emplace_back([&, i]()
+        {
+            std::size_t lastSize = 0;
+            for (int j = 0; j < writersCount * recordsCount; ++j)
+            {
+                // Records are only added, so the size never decreases
+                std::size_t size = vlt.Size();
+                if (size < lastSize) isWrongRead.store(true);
+                lastSize = size;
+
+                VaultRecordRef vrr;
+                int b = 0;
+                if (vlt.GetRecord("A", (i * 97 + j) % (writersCount * recordsCount), vrr).IsOperationSuccess)
+                {
+                    vrr.GetData("B", b);
+                    if (b != 0 && b != (i * 97 + j) % (writersCount * recordsCount)) isWrongRead.store(true);
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    TEST_ASSERT(isWrongRead.load() == false);
+    TEST_ASSERT(vlt.Size() == writersCount * recordsCount);
+
+    for (int i = 0; i < writersCount * recordsCount; ++i)
+    {
+        VaultRecordRef vrr;
+        int b = -1;
+        vlt.GetRecord("A", i, vrr);
+        vrr.GetData("B", b);
+        TEST_ASSERT(b == i);
+    }
+)
+
+TEST_BODY(Multithreading, LockFreeReaders,
+    Vault vlt;
+    std::vector<std::thread> threads;
+    std::atomic<bool> isWrongRead(false);
+    std::atomic<bool> isWritersFinished(false);
+    const int writersCount = 2, readersCount = 8, recordsCount = 200, changesCount = 20;
+
+    vlt.AddUniqueKey<int>("A");
+    vlt.AddKey("B", 0);
+    vlt.AddKey("C", 0);
+    vlt.AddLockFreeReadKey<int>("A");
+
+    for (int i = 0; i < writersCount; ++i)
+    {
+        threads.emplace_back([&, i]()
+        {
+            for (int j = 0; j < changesCount; ++j)
+            {
+                for (int k = i * recordsCount; k < (i + 1) * recordsCount; ++k)
+                {
+                    VaultRecordRef vrr;
+                    if (!vlt.GetRecord("A", k, vrr).IsOperationSuccess)
+                        vlt.CreateRecord(vrr, {{"A", k}});
+
+                    // Both keys are changed at once, so every snapshot has equal values
+                    vrr.SetData({{"B", j}, {"C", j}});
+
+                    if (j % 5 == 4 && k % 3 == 0) vlt.EraseRecord(vrr);
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < readersCount; ++i)
+    {
+        threads.emplace_back([&, i]()
+        {
+            int j = 0;
+            while (!isWritersFinished.load())
+            {
+                int b = -1, c = -2;
+                VaultOperationResult vor = vlt.ReadRecord("A", (i * 97 + j++) % (writersCount * recordsCount), [&](const VaultRecordSnapshot& snapshot)
+                {
+                    snapshot.GetData("B", b);
+                    snapshot.GetData("C", c);
+                });
+
+                if (vor.IsOperationSuccess && b != c) isWrongRead.store(true);
+            }
+        });
+    }
+
+    for (int i = 0; i < writersCount; ++i)
+        threads[i].join();
+
+    isWritersFinished.store(true);
+
+    for (std::thread& thread : threads)
+        if (thread.joinable()) thread.join();
+
+    TEST_ASSERT(isWrongRead.load() == false);
+
+    for (int i = 0; i < writersCount * recordsCount; ++i)
+    {
+        int b = -1;
+        vlt.ReadRecord("A", i, [&](const VaultRecordSnapshot& snapshot)
+        {
+            snapshot.GetData("B", b);
+        });
+        // Records erased on the last change are not found
+        TEST_ASSERT(b == (i % 3 == 0 ? -1 : changesCount - 1));
+    }
+)
+
+
+TEST_BODY(Multithreading, RecordSetsAndErasers,
+    Vault vlt;
+    std::vector<std::thread> threads;
+    std::atomic<bool> isWrongRead(false);
+    std::atomic<bool> isWriterFinished(false);
+    const int readersCount = 8, recordsCount = 1000;
+
+    vlt.AddKey("A", 0);
+    vlt.AddKey("B", 0);
+
+    for (int i = 0; i < recordsCount; ++i) vlt.CreateRecord({{"A", i % 10}, {"B", i}});
+
+    // Writer erases and creates records of the sets and references of readers
+    threads.emplace_back([&]()
+    {
+        for (int i = 0; i < recordsCount; ++i)
+        {
+            vlt.EraseRecord("B", i);
+            vlt.CreateRecord({{"A", i % 10}, {"B", i}});
+        }
+
+        isWriterFinished.store(true);
+    });
+
+    for (int i = 0; i < readersCount; ++i)
+    {
+        threads.emplace_back([&, i]()
+        {
+            while (!isWriterFinished.load())
+            {
+                // Every reader attaches records to its own set, so records are shared between sets
+                VaultRecordSet vrs;
+                vlt.Request(Equal("A", i % 10), vrs);
+
+                std::vector<VaultRecordRef> refs;
+                vlt.GetRecords("A", i % 10, refs);
+
+                std::vector<VaultRecordRef> copiedRefs(refs);
+                for (const VaultRecordRef& ref : copiedRefs)
+                {
+                    int a = -1;
+                    if (ref.GetData("A", a).IsOperationSuccess && a != i % 10) isWrongRead.store(true);
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    TEST_ASSERT(isWrongRead.load() == false);
+    TEST_ASSERT(vlt.Size() == recordsCount);
+
+    VaultRecordSet vrs;
+    vlt.Request(Equal("A", 3), vrs);
+    TEST_ASSERT(vrs.Size() == recordsCount / 10);
+)
+
+TEST_BODY(Multithreading, Transactions,
+    Vault vlt;
+    std::vector<std::thread> threads;
+    std::atomic<bool> isWrongRead(false);
+    std::atomic<bool> isWritersFinished(false);
+    const int writersCount = 4, readersCount = 4, writerAccountsCount = 5, transfersCount = 500, startBalance = 100;
+    const int accountsCount = writersCount * writerAccountsCount;
+
+    vlt.AddUniqueKey<int>("id");
+    vlt.AddKey("balance", 0);
+
+    for (int i = 0; i < accountsCount; ++i) vlt.CreateRecord({{"id", i}, {"balance", startBalance}});
+
+    // Every writer moves money between its own accounts, so the total balance never changes
+    for (int i = 0; i < writersCount; ++i)
+    {
+        threads.emplace_back([&, i]()
+        {
+            for (int j = 0; j < transfersCount; ++j)
+            {
+                VaultRecordRef from, to;
+                vlt.GetRecord("id", i * writerAccountsCount + j % writerAccountsCount, from);
+                vlt.GetRecord("id", i * writerAccountsCount + (j + 1) % writerAccountsCount, to);
+
+                int fromBalance = 0, toBalance = 0;
+                from.GetData("balance", fromBalance);
+                to.GetData("balance", toBalance);
+
+                VaultTransaction transaction = vlt.BeginTransaction();
+                transaction.SetData(from, "balance", fromBalance - 1);
+                transaction.SetData(to, "balance", toBalance + 1);
+
+                // The id of the account of the next writer is taken, so every fifth transaction is rolled back
+                if (j % 5 == 0) transaction.SetData(from, "id", ((i + 1) % writersCount) * writerAccountsCount);
+
+                transaction.Commit();
+            }
+        });
+    }
+
+    for (int i = 0; i < readersCount; ++i)
+    {
+        threads.emplace_back([&]()
+        {
+            while (!isWritersFinished.load())
+            {
+                int sum = 0;
+                vlt.Scan(GreaterOrEqual("id", 0), [&](const VaultRecordRef& ref) -> bool
+                {
+                    int balance = 0;
+                    ref.GetData("balance", balance);
+                    sum += balance;
+                    return true;
+                });
+
+                if (sum != accountsCount * startBalance) isWrongRead.store(true);
+            }
+        });
+    }
+
+    for (int i = 0; i < writersCount; ++i)
+        threads[i].join();
+
+    isWritersFinished.store(true);
+
+    for (std::thread& thread : threads)
+        if (thread.joinable()) thread.join();
+
+    TEST_ASSERT(isWrongRead.load() == false);
+    TEST_ASSERT(vlt.Size() == accountsCount);
+
+    // Transfers from the first account of every writer were always rolled back, and transfers to it were always committed
+    int balance = 0;
+    VaultRecordRef vrr;
+    vlt.GetRecord("id", 0, vrr);
+    vrr.GetData("balance", balance);
+    TEST_ASSERT(balance == startBalance + transfersCount / writerAccountsCount);
+)
+
 }
 
 void VaultUnitTests(const std::string& testName)
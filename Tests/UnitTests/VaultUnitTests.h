@@ -35,6 +35,10 @@ namespace VaultTestNs
         TEST_CASE(CopyEmptyVault)
 
         TEST_CASE(CopyFilledVault)
+
+        TEST_CASE(CopyCompositeIndexes)
+
+        TEST_CASE(CopyGroupAggregates)
     )
 
     TEST_SUITE(AssignmentOperator,
@@ -77,6 +81,14 @@ namespace VaultTestNs
         TEST_CASE(AddKeyWithDependentSets)
 
         TEST_CASE(IncorrectAddKeyWithDependentSets)
+
+        TEST_CASE(HashOnlyIndexPolicy)
+
+        TEST_CASE(OrderedOnlyIndexPolicy)
+
+        TEST_CASE(NoneIndexPolicy)
+
+        TEST_CASE(IndexPolicyWithDependentSets)
     )
 
     TEST_SUITE(AddUniqueKey,
@@ -96,6 +108,8 @@ namespace VaultTestNs
         TEST_CASE(IncorrectAddKeyWithDependentSets);
 
         TEST_CASE(CorrectAddKeyWithDependentSetsWithDuplicate);
+
+        TEST_CASE(IndexPolicy);
     )
 
     TEST_SUITE(UpdateKey,
@@ -134,6 +148,21 @@ namespace VaultTestNs
         TEST_CASE(NonExistingKey)
     )
 
+    TEST_SUITE(GetKeyHandle,
+
+        TEST_CASE(CorrectHandle)
+
+        TEST_CASE(WrongKey)
+
+        TEST_CASE(WrongType)
+
+        TEST_CASE(InvalidAfterRemoveKey)
+
+        TEST_CASE(InvalidAfterDropVault)
+
+        TEST_CASE(WrongVault)
+    )
+
     TEST_SUITE(GetKeys,
 
         TEST_CASE(Keys)
@@ -155,6 +184,96 @@ namespace VaultTestNs
         TEST_CASE(IncorrectRemoveFromEmptyVault)
 
         TEST_CASE(IncorrectRemoveFromNonEmptyVault)
+
+        TEST_CASE(AddRemovedKeyWithOtherType)
+
+        TEST_CASE(RemoveKeyWithCompositeIndex)
+    )
+
+    TEST_SUITE(AddCompositeIndex,
+
+        TEST_CASE(CorrectAdd)
+
+        TEST_CASE(AddToNonEmptyVault)
+
+        TEST_CASE(WrongKey)
+
+        TEST_CASE(WrongCompositeIndex)
+
+        TEST_CASE(DuplicateCompositeIndex)
+    )
+
+    TEST_SUITE(RemoveCompositeIndex,
+
+        TEST_CASE(CorrectRemove)
+
+        TEST_CASE(IncorrectRemove)
+    )
+
+    TEST_SUITE(AddGroupBy,
+
+        TEST_CASE(CorrectAdd)
+
+        TEST_CASE(WrongKey)
+
+        TEST_CASE(WrongType)
+
+        TEST_CASE(DuplicateGroupBy)
+    )
+
+    TEST_SUITE(GetGroups,
+
+        TEST_CASE(AfterChanges)
+
+        TEST_CASE(AfterDropData)
+
+        TEST_CASE(GetGroup)
+
+        TEST_CASE(WrongGroupBy)
+
+        TEST_CASE(WrongType)
+    )
+
+    TEST_SUITE(RemoveGroupBy,
+
+        TEST_CASE(CorrectRemove)
+
+        TEST_CASE(RemoveKeyWithGroupBy)
+    )
+
+    TEST_SUITE(AddLockFreeReadKey,
+
+        TEST_CASE(CorrectAdd)
+
+        TEST_CASE(WrongKey)
+
+        TEST_CASE(WrongType)
+
+        TEST_CASE(NonUniqueKey)
+
+        TEST_CASE(DuplicateKey)
+    )
+
+    TEST_SUITE(ReadRecord,
+
+        TEST_CASE(AfterChanges)
+
+        TEST_CASE(AfterEraseRecord)
+
+        TEST_CASE(AfterKeysChanges)
+
+        TEST_CASE(AfterDropData)
+
+        TEST_CASE(WrongKey)
+
+        TEST_CASE(CopyVault)
+    )
+
+    TEST_SUITE(RemoveLockFreeReadKey,
+
+        TEST_CASE(CorrectRemove)
+
+        TEST_CASE(RemoveKeyWithLockFreeRead)
     )
 
     TEST_SUITE(CreateRecord,
@@ -176,6 +295,36 @@ namespace VaultTestNs
         TEST_CASE(DuplicateUniqueKeyValue)
 
         TEST_CASE(EmptyUniqueKeyValue)
+
+        TEST_CASE(MoveParams)
+
+        TEST_CASE(ReuseParams)
+    )
+
+    TEST_SUITE(CreateRecords,
+
+        TEST_CASE(CorrectParams)
+
+        TEST_CASE(WrongParams)
+
+        TEST_CASE(DuplicateUniqueKeyValue)
+
+        TEST_CASE(ManyBatches)
+    )
+
+    TEST_SUITE(Transaction,
+
+        TEST_CASE(CorrectCommit)
+
+        TEST_CASE(DuplicateUniqueKeyValue)
+
+        TEST_CASE(RollbackIndexes)
+
+        TEST_CASE(EraseAndCreateSameUniqueValue)
+
+        TEST_CASE(WrongRecord)
+
+        TEST_CASE(Rollback)
     )
 
     TEST_SUITE(GetRecord,
@@ -187,6 +336,10 @@ namespace VaultTestNs
         TEST_CASE(WrongType)
 
         TEST_CASE(WrongValue)
+
+        TEST_CASE(CorrectByKeyHandle)
+
+        TEST_CASE(ManyRecordsAfterErase)
     )
 
     TEST_SUITE(GetRecords,
@@ -200,6 +353,10 @@ namespace VaultTestNs
         TEST_CASE(WrongType)
 
         TEST_CASE(WrongValue)
+
+        TEST_CASE(CorrectByKeyHandle)
+
+        TEST_CASE(ManyRecordsAfterErase)
     )
 
     TEST_SUITE(RequestEqual,
@@ -215,6 +372,8 @@ namespace VaultTestNs
         TEST_CASE(WrongType)
 
         TEST_CASE(ValueNotInVault)
+
+        TEST_CASE(CorrectByKeyHandle)
     )
 
     TEST_SUITE(RequestGreater,
@@ -308,6 +467,10 @@ namespace VaultTestNs
         TEST_CASE(WrongKey)
 
         TEST_CASE(WrongType)
+
+        TEST_CASE(CorrectByKeyHandle)
+
+        TEST_CASE(ManyRecordsAfterErase)
     )
 
     TEST_SUITE(Request,
@@ -333,6 +496,78 @@ namespace VaultTestNs
         TEST_CASE(ComplexRequestWrongKey)
 
         TEST_CASE(ComplexRequestWrongType)
+
+        TEST_CASE(ComplexRequestCompositeIndex)
+
+        TEST_CASE(ComplexRequestCompositeIndexRange)
+
+        TEST_CASE(ComplexRequestCompositeIndexHashOnly)
+
+        TEST_CASE(ComplexRequestCompositeIndexAfterChanges)
+
+        TEST_CASE(ComplexRequestAndSelectivity)
+
+        TEST_CASE(ComplexRequestAndWithoutStructures)
+
+        TEST_CASE(ComplexRequestAndWithOr)
+    )
+
+    TEST_SUITE(Scan,
+
+        TEST_CASE(CorrectScan)
+
+        TEST_CASE(ComplexScan)
+
+        TEST_CASE(EarlyStop)
+
+        TEST_CASE(WrongKey)
+
+        TEST_CASE(WrongType)
+    )
+
+    TEST_SUITE(Count,
+
+        TEST_CASE(CorrectCount)
+
+        TEST_CASE(ComplexCount)
+
+        TEST_CASE(AfterChanges)
+
+        TEST_CASE(WrongKey)
+    )
+
+    TEST_SUITE(Min,
+
+        TEST_CASE(CorrectMin)
+
+        TEST_CASE(MinWithRequest)
+
+        TEST_CASE(NoRecords)
+
+        TEST_CASE(WrongKey)
+    )
+
+    TEST_SUITE(Max,
+
+        TEST_CASE(CorrectMax)
+
+        TEST_CASE(MaxWithRequest)
+    )
+
+    TEST_SUITE(Sum,
+
+        TEST_CASE(CorrectSum)
+
+        TEST_CASE(SumWithRequest)
+
+        TEST_CASE(WrongKey)
+    )
+
+    TEST_SUITE(Avg,
+
+        TEST_CASE(CorrectAvg)
+
+        TEST_CASE(NoRecords)
     )
 
     TEST_SUITE(DropVault,
@@ -355,6 +590,8 @@ namespace VaultTestNs
         TEST_CASE(DropSecond)
 
         TEST_CASE(DropWithDependent)
+
+        TEST_CASE(DropWithRecordRef)
     )
 
     TEST_SUITE(EraseRecord,
@@ -370,6 +607,12 @@ namespace VaultTestNs
         TEST_CASE(WrongTypeEraseByKeyAndValue)
 
         TEST_CASE(WrongValueEraseByKeyAndValue)
+
+        TEST_CASE(CreateAfterErase)
+
+        TEST_CASE(CorrectByKeyHandle)
+
+        TEST_CASE(SameKeyValue)
     )
 
     TEST_SUITE(EraseRecords,
@@ -396,6 +639,8 @@ namespace VaultTestNs
 
         TEST_CASE(GetNotAllRecords)
 
+        TEST_CASE(GetRecordsAfterErase)
+
         TEST_CASE(WrongKey)
     )
 
@@ -410,6 +655,30 @@ namespace VaultTestNs
         TEST_CASE(WrongKey)
     )
 
+    TEST_SUITE(GetTopRecords,
+
+        TEST_CASE(TopRecords)
+
+        TEST_CASE(TopRecordsReverse)
+
+        TEST_CASE(WrongKey)
+    )
+
+    TEST_SUITE(GetSortedPage,
+
+        TEST_CASE(AllPages)
+
+        TEST_CASE(AllPagesReverse)
+
+        TEST_CASE(AllPagesWithoutMap)
+
+        TEST_CASE(ChangesBetweenPages)
+
+        TEST_CASE(PagesWithPredicat)
+
+        TEST_CASE(WrongKey)
+    )
+
     TEST_SUITE(ToJson,
 
         TEST_CASE(Default)
@@ -526,6 +795,17 @@ namespace VaultTestNs
 
         TEST_CASE(Default)
     )
+
+    TEST_SUITE(Multithreading,
+
+        TEST_CASE(ReadersAndWriters)
+
+        TEST_CASE(LockFreeReaders)
+
+        TEST_CASE(RecordSetsAndErasers)
+
+        TEST_CASE(Transactions)
+    )
 }
 
 void VaultUnitTests(const std::string& testName);
\ No newline at end of file
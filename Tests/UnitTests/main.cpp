@@ -1,6 +1,8 @@
 #include "VaultUnitTests.h"
 #include "VaultRecordSetUnitTests.h"
 #include "VaultRecordRefUnitTests.h"
+#include "TypedVaultUnitTests.h"
+#include "ShardedVaultUnitTests.h"
 
 const std::uint64_t VaultUnitTestsKey = ~0b0001;
 const std::uint64_t VaultRecordSetUnitTestsKey = ~0b0010;
@@ -98,12 +100,16 @@ int main(int argc, char** argv)
     std::cout << "\n";
     VaultRecordRefUnitTests("");
     std::cout << "\n";
+    TypedVaultUnitTests("");
+    std::cout << "\n";
+    ShardedVaultUnitTests("");
+    std::cout << "\n";
 
     auto end = std::chrono::high_resolution_clock::now();
 
     ColorizedPrint("[==========]", ConsoleTextColor::Green, "");
-    /// \todo 3 hardcoded
-    ColorizedPrint(" " + std::to_string(TestCounter) + " tests from 3 units ran. (" +
+    /// \todo 5 hardcoded
+    ColorizedPrint(" " + std::to_string(TestCounter) + " tests from 5 units ran. (" +
         std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - beg).count()) +
         " ms total)");
     ColorizedPrint("[  PASSED  ]" , ConsoleTextColor::Green, "");
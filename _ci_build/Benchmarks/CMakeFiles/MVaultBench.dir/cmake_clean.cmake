@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MVaultBench.dir/Helpers/Measure.cpp.o"
+  "CMakeFiles/MVaultBench.dir/Helpers/Measure.cpp.o.d"
+  "CMakeFiles/MVaultBench.dir/MVault/main.cpp.o"
+  "CMakeFiles/MVaultBench.dir/MVault/main.cpp.o.d"
+  "MVaultBench"
+  "MVaultBench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MVaultBench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
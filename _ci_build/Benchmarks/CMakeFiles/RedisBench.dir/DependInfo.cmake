@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Benchmarks/Helpers/Measure.cpp" "Benchmarks/CMakeFiles/RedisBench.dir/Helpers/Measure.cpp.o" "gcc" "Benchmarks/CMakeFiles/RedisBench.dir/Helpers/Measure.cpp.o.d"
+  "/root/repo/Benchmarks/Redis/RedisDb.cpp" "Benchmarks/CMakeFiles/RedisBench.dir/Redis/RedisDb.cpp.o" "gcc" "Benchmarks/CMakeFiles/RedisBench.dir/Redis/RedisDb.cpp.o.d"
+  "/root/repo/Benchmarks/Redis/main.cpp" "Benchmarks/CMakeFiles/RedisBench.dir/Redis/main.cpp.o" "gcc" "Benchmarks/CMakeFiles/RedisBench.dir/Redis/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ci_build/Source/CMakeFiles/MVault.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
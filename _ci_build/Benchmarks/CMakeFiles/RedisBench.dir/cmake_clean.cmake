@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RedisBench.dir/Helpers/Measure.cpp.o"
+  "CMakeFiles/RedisBench.dir/Helpers/Measure.cpp.o.d"
+  "CMakeFiles/RedisBench.dir/Redis/RedisDb.cpp.o"
+  "CMakeFiles/RedisBench.dir/Redis/RedisDb.cpp.o.d"
+  "CMakeFiles/RedisBench.dir/Redis/main.cpp.o"
+  "CMakeFiles/RedisBench.dir/Redis/main.cpp.o.d"
+  "RedisBench"
+  "RedisBench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RedisBench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
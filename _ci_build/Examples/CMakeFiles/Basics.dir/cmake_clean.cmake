@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "Basics"
+  "Basics.pdb"
+  "CMakeFiles/Basics.dir/Basics.cpp.o"
+  "CMakeFiles/Basics.dir/Basics.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Basics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
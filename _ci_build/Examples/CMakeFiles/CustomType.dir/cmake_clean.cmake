@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CustomType.dir/CustomType.cpp.o"
+  "CMakeFiles/CustomType.dir/CustomType.cpp.o.d"
+  "CustomType"
+  "CustomType.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CustomType.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
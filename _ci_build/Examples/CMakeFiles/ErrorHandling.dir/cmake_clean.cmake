@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ErrorHandling.dir/ErrorHandling.cpp.o"
+  "CMakeFiles/ErrorHandling.dir/ErrorHandling.cpp.o.d"
+  "ErrorHandling"
+  "ErrorHandling.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ErrorHandling.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Keys.dir/Keys.cpp.o"
+  "CMakeFiles/Keys.dir/Keys.cpp.o.d"
+  "Keys"
+  "Keys.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Keys.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Requests.dir/Requests.cpp.o"
+  "CMakeFiles/Requests.dir/Requests.cpp.o.d"
+  "Requests"
+  "Requests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Requests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Sets.dir/Sets.cpp.o"
+  "CMakeFiles/Sets.dir/Sets.cpp.o.d"
+  "Sets"
+  "Sets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Sets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
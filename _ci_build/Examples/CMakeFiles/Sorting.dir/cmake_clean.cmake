@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Sorting.dir/ErrorHandling.cpp.o"
+  "CMakeFiles/Sorting.dir/ErrorHandling.cpp.o.d"
+  "Sorting"
+  "Sorting.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Sorting.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/BackTrace/BackTrace.cpp" "Source/CMakeFiles/MVault.dir/BackTrace/BackTrace.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/BackTrace/BackTrace.cpp.o.d"
+  "/root/repo/Source/CompositeIndex.cpp" "Source/CMakeFiles/MVault.dir/CompositeIndex.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/CompositeIndex.cpp.o.d"
+  "/root/repo/Source/CompositeKey.cpp" "Source/CMakeFiles/MVault.dir/CompositeKey.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/CompositeKey.cpp.o.d"
+  "/root/repo/Source/CsvParser/CsvParser.cpp" "Source/CMakeFiles/MVault.dir/CsvParser/CsvParser.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/CsvParser/CsvParser.cpp.o.d"
+  "/root/repo/Source/CsvParser/StreamFileReader.cpp" "Source/CMakeFiles/MVault.dir/CsvParser/StreamFileReader.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/CsvParser/StreamFileReader.cpp.o.d"
+  "/root/repo/Source/DataColumn.cpp" "Source/CMakeFiles/MVault.dir/DataColumn.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/DataColumn.cpp.o.d"
+  "/root/repo/Source/DataSaver.cpp" "Source/CMakeFiles/MVault.dir/DataSaver.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/DataSaver.cpp.o.d"
+  "/root/repo/Source/EpochManager.cpp" "Source/CMakeFiles/MVault.dir/EpochManager.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/EpochManager.cpp.o.d"
+  "/root/repo/Source/GroupAggregate.cpp" "Source/CMakeFiles/MVault.dir/GroupAggregate.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/GroupAggregate.cpp.o.d"
+  "/root/repo/Source/ReadWriteMutex.cpp" "Source/CMakeFiles/MVault.dir/ReadWriteMutex.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/ReadWriteMutex.cpp.o.d"
+  "/root/repo/Source/ShardedVault.cpp" "Source/CMakeFiles/MVault.dir/ShardedVault.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/ShardedVault.cpp.o.d"
+  "/root/repo/Source/Strings/ToJson.cpp" "Source/CMakeFiles/MVault.dir/Strings/ToJson.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/Strings/ToJson.cpp.o.d"
+  "/root/repo/Source/Uuid/Uuid.cpp" "Source/CMakeFiles/MVault.dir/Uuid/Uuid.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/Uuid/Uuid.cpp.o.d"
+  "/root/repo/Source/Vault.cpp" "Source/CMakeFiles/MVault.dir/Vault.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/Vault.cpp.o.d"
+  "/root/repo/Source/VaultColumnStorage.cpp" "Source/CMakeFiles/MVault.dir/VaultColumnStorage.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/VaultColumnStorage.cpp.o.d"
+  "/root/repo/Source/VaultOperationResult.cpp" "Source/CMakeFiles/MVault.dir/VaultOperationResult.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/VaultOperationResult.cpp.o.d"
+  "/root/repo/Source/VaultParamInput.cpp" "Source/CMakeFiles/MVault.dir/VaultParamInput.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/VaultParamInput.cpp.o.d"
+  "/root/repo/Source/VaultRecord.cpp" "Source/CMakeFiles/MVault.dir/VaultRecord.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/VaultRecord.cpp.o.d"
+  "/root/repo/Source/VaultRecordArena.cpp" "Source/CMakeFiles/MVault.dir/VaultRecordArena.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/VaultRecordArena.cpp.o.d"
+  "/root/repo/Source/VaultRecordRef.cpp" "Source/CMakeFiles/MVault.dir/VaultRecordRef.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/VaultRecordRef.cpp.o.d"
+  "/root/repo/Source/VaultRecordSet.cpp" "Source/CMakeFiles/MVault.dir/VaultRecordSet.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/VaultRecordSet.cpp.o.d"
+  "/root/repo/Source/VaultRecordSnapshot.cpp" "Source/CMakeFiles/MVault.dir/VaultRecordSnapshot.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/VaultRecordSnapshot.cpp.o.d"
+  "/root/repo/Source/VaultRequest.cpp" "Source/CMakeFiles/MVault.dir/VaultRequest.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/VaultRequest.cpp.o.d"
+  "/root/repo/Source/VaultTransaction.cpp" "Source/CMakeFiles/MVault.dir/VaultTransaction.cpp.o" "gcc" "Source/CMakeFiles/MVault.dir/VaultTransaction.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,57 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MVault.dir/BackTrace/BackTrace.cpp.o"
+  "CMakeFiles/MVault.dir/BackTrace/BackTrace.cpp.o.d"
+  "CMakeFiles/MVault.dir/CompositeIndex.cpp.o"
+  "CMakeFiles/MVault.dir/CompositeIndex.cpp.o.d"
+  "CMakeFiles/MVault.dir/CompositeKey.cpp.o"
+  "CMakeFiles/MVault.dir/CompositeKey.cpp.o.d"
+  "CMakeFiles/MVault.dir/CsvParser/CsvParser.cpp.o"
+  "CMakeFiles/MVault.dir/CsvParser/CsvParser.cpp.o.d"
+  "CMakeFiles/MVault.dir/CsvParser/StreamFileReader.cpp.o"
+  "CMakeFiles/MVault.dir/CsvParser/StreamFileReader.cpp.o.d"
+  "CMakeFiles/MVault.dir/DataColumn.cpp.o"
+  "CMakeFiles/MVault.dir/DataColumn.cpp.o.d"
+  "CMakeFiles/MVault.dir/DataSaver.cpp.o"
+  "CMakeFiles/MVault.dir/DataSaver.cpp.o.d"
+  "CMakeFiles/MVault.dir/EpochManager.cpp.o"
+  "CMakeFiles/MVault.dir/EpochManager.cpp.o.d"
+  "CMakeFiles/MVault.dir/GroupAggregate.cpp.o"
+  "CMakeFiles/MVault.dir/GroupAggregate.cpp.o.d"
+  "CMakeFiles/MVault.dir/ReadWriteMutex.cpp.o"
+  "CMakeFiles/MVault.dir/ReadWriteMutex.cpp.o.d"
+  "CMakeFiles/MVault.dir/ShardedVault.cpp.o"
+  "CMakeFiles/MVault.dir/ShardedVault.cpp.o.d"
+  "CMakeFiles/MVault.dir/Strings/ToJson.cpp.o"
+  "CMakeFiles/MVault.dir/Strings/ToJson.cpp.o.d"
+  "CMakeFiles/MVault.dir/Uuid/Uuid.cpp.o"
+  "CMakeFiles/MVault.dir/Uuid/Uuid.cpp.o.d"
+  "CMakeFiles/MVault.dir/Vault.cpp.o"
+  "CMakeFiles/MVault.dir/Vault.cpp.o.d"
+  "CMakeFiles/MVault.dir/VaultColumnStorage.cpp.o"
+  "CMakeFiles/MVault.dir/VaultColumnStorage.cpp.o.d"
+  "CMakeFiles/MVault.dir/VaultOperationResult.cpp.o"
+  "CMakeFiles/MVault.dir/VaultOperationResult.cpp.o.d"
+  "CMakeFiles/MVault.dir/VaultParamInput.cpp.o"
+  "CMakeFiles/MVault.dir/VaultParamInput.cpp.o.d"
+  "CMakeFiles/MVault.dir/VaultRecord.cpp.o"
+  "CMakeFiles/MVault.dir/VaultRecord.cpp.o.d"
+  "CMakeFiles/MVault.dir/VaultRecordArena.cpp.o"
+  "CMakeFiles/MVault.dir/VaultRecordArena.cpp.o.d"
+  "CMakeFiles/MVault.dir/VaultRecordRef.cpp.o"
+  "CMakeFiles/MVault.dir/VaultRecordRef.cpp.o.d"
+  "CMakeFiles/MVault.dir/VaultRecordSet.cpp.o"
+  "CMakeFiles/MVault.dir/VaultRecordSet.cpp.o.d"
+  "CMakeFiles/MVault.dir/VaultRecordSnapshot.cpp.o"
+  "CMakeFiles/MVault.dir/VaultRecordSnapshot.cpp.o.d"
+  "CMakeFiles/MVault.dir/VaultRequest.cpp.o"
+  "CMakeFiles/MVault.dir/VaultRequest.cpp.o.d"
+  "CMakeFiles/MVault.dir/VaultTransaction.cpp.o"
+  "CMakeFiles/MVault.dir/VaultTransaction.cpp.o.d"
+  "libMVault.a"
+  "libMVault.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MVault.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
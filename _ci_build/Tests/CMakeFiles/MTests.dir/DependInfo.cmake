@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Tests/MTests/ColorizedPrint.cpp" "Tests/CMakeFiles/MTests.dir/MTests/ColorizedPrint.cpp.o" "gcc" "Tests/CMakeFiles/MTests.dir/MTests/ColorizedPrint.cpp.o.d"
+  "/root/repo/Tests/MTests/CompareVaultRecordRef.cpp" "Tests/CMakeFiles/MTests.dir/MTests/CompareVaultRecordRef.cpp.o" "gcc" "Tests/CMakeFiles/MTests.dir/MTests/CompareVaultRecordRef.cpp.o.d"
+  "/root/repo/Tests/MTests/GetLine.cpp" "Tests/CMakeFiles/MTests.dir/MTests/GetLine.cpp.o" "gcc" "Tests/CMakeFiles/MTests.dir/MTests/GetLine.cpp.o.d"
+  "/root/repo/Tests/MTests/Starter.cpp" "Tests/CMakeFiles/MTests.dir/MTests/Starter.cpp.o" "gcc" "Tests/CMakeFiles/MTests.dir/MTests/Starter.cpp.o.d"
+  "/root/repo/Tests/MTests/TestLog.cpp" "Tests/CMakeFiles/MTests.dir/MTests/TestLog.cpp.o" "gcc" "Tests/CMakeFiles/MTests.dir/MTests/TestLog.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
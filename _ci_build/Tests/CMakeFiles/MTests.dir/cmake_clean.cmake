@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MTests.dir/MTests/ColorizedPrint.cpp.o"
+  "CMakeFiles/MTests.dir/MTests/ColorizedPrint.cpp.o.d"
+  "CMakeFiles/MTests.dir/MTests/CompareVaultRecordRef.cpp.o"
+  "CMakeFiles/MTests.dir/MTests/CompareVaultRecordRef.cpp.o.d"
+  "CMakeFiles/MTests.dir/MTests/GetLine.cpp.o"
+  "CMakeFiles/MTests.dir/MTests/GetLine.cpp.o.d"
+  "CMakeFiles/MTests.dir/MTests/Starter.cpp.o"
+  "CMakeFiles/MTests.dir/MTests/Starter.cpp.o.d"
+  "CMakeFiles/MTests.dir/MTests/TestLog.cpp.o"
+  "CMakeFiles/MTests.dir/MTests/TestLog.cpp.o.d"
+  "libMTests.a"
+  "libMTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
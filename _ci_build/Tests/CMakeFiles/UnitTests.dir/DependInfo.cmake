@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Tests/UnitTests/ShardedVaultUnitTests.cpp" "Tests/CMakeFiles/UnitTests.dir/UnitTests/ShardedVaultUnitTests.cpp.o" "gcc" "Tests/CMakeFiles/UnitTests.dir/UnitTests/ShardedVaultUnitTests.cpp.o.d"
+  "/root/repo/Tests/UnitTests/TypedVaultUnitTests.cpp" "Tests/CMakeFiles/UnitTests.dir/UnitTests/TypedVaultUnitTests.cpp.o" "gcc" "Tests/CMakeFiles/UnitTests.dir/UnitTests/TypedVaultUnitTests.cpp.o.d"
+  "/root/repo/Tests/UnitTests/VaultRecordRefUnitTests.cpp" "Tests/CMakeFiles/UnitTests.dir/UnitTests/VaultRecordRefUnitTests.cpp.o" "gcc" "Tests/CMakeFiles/UnitTests.dir/UnitTests/VaultRecordRefUnitTests.cpp.o.d"
+  "/root/repo/Tests/UnitTests/VaultRecordSetUnitTests.cpp" "Tests/CMakeFiles/UnitTests.dir/UnitTests/VaultRecordSetUnitTests.cpp.o" "gcc" "Tests/CMakeFiles/UnitTests.dir/UnitTests/VaultRecordSetUnitTests.cpp.o.d"
+  "/root/repo/Tests/UnitTests/VaultUnitTests.cpp" "Tests/CMakeFiles/UnitTests.dir/UnitTests/VaultUnitTests.cpp.o" "gcc" "Tests/CMakeFiles/UnitTests.dir/UnitTests/VaultUnitTests.cpp.o.d"
+  "/root/repo/Tests/UnitTests/main.cpp" "Tests/CMakeFiles/UnitTests.dir/UnitTests/main.cpp.o" "gcc" "Tests/CMakeFiles/UnitTests.dir/UnitTests/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ci_build/Source/CMakeFiles/MVault.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/Tests/CMakeFiles/MTests.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/UnitTests.dir/UnitTests/ShardedVaultUnitTests.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/ShardedVaultUnitTests.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TypedVaultUnitTests.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TypedVaultUnitTests.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/VaultRecordRefUnitTests.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/VaultRecordRefUnitTests.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/VaultRecordSetUnitTests.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/VaultRecordSetUnitTests.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/VaultUnitTests.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/VaultUnitTests.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/main.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/main.cpp.o.d"
+  "UnitTests"
+  "UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()